@@ -28,6 +28,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh::cells_label_name
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/MeshOps.hh" // USES MeshOps::checkTopology()
+#include "pylith/utils/array.hh" // USES int_array
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -232,40 +233,21 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
         PetscDM dmMesh = mesh->getDM();assert(dmMesh);
 
         PetscDMLabel surfaceLabel = NULL;
-        PetscBool hasLabel = PETSC_FALSE;
-        PetscInt depth, gdepth, dim;
-        PetscMPIInt rank;
         PetscErrorCode err;
-        // We do not have labels on all ranks until after distribution
-        err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
-        err = DMHasLabel(dmMesh, _surfaceLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
-        if (!hasLabel && !rank) {
-            std::ostringstream msg;
-            msg << "Mesh missing group of vertices '" << _surfaceLabelName
-                << "' for fault interface condition.";
-            throw std::runtime_error(msg.str());
-        } // if
-        err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
-        err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh->getComm());PYLITH_CHECK_ERROR(err);
+        _checkLabels(*mesh);
         err = DMGetLabel(dmMesh, _surfaceLabelName.c_str(), &surfaceLabel);PYLITH_CHECK_ERROR(err);
         TopologyOps::createFault(&faultMesh, *mesh, surfaceLabel, _surfaceLabelValue);
         PetscDMLabel buriedEdgesLabel = NULL;
 
         // We do not have labels on all ranks until after distribution
-        if ((_buriedEdgesLabelName.length() > 0) && !rank) {
+        if (_buriedEdgesLabelName.length() > 0) {
             err = DMGetLabel(dmMesh, _buriedEdgesLabelName.c_str(), &buriedEdgesLabel);PYLITH_CHECK_ERROR(err);
-            if (!buriedEdgesLabel) {
-                std::ostringstream msg;
-                msg << "Could not find label '" << _buriedEdgesLabelName << "' marking buried edges for fault '" << _surfaceLabelName << "'.";
-                throw std::runtime_error(msg.str());
-            } // if
         } // if
         TopologyOps::create(mesh, faultMesh, buriedEdgesLabel, _buriedEdgesLabelValue, getCohesiveLabelValue());
 
-        // Check consistency of mesh.
-        pylith::topology::MeshOps::checkTopology(*mesh);
-        pylith::topology::MeshOps::checkTopology(faultMesh);
+        // Check consistency of mesh around the fault.
+        std::vector<FaultCohesive*> faults(1, this);
+        _checkTopology(*mesh, faultMesh, faults);
 
         pythia::journal::debug_t debug(PyreComponent::getName());
         if (debug.state()) {
@@ -283,6 +265,161 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
 } // adjustTopology
 
 
+// ------------------------------------------------------------------------------------------------
+// Adjust mesh topology for multiple faults.
+void
+pylith::faults::FaultCohesive::adjustTopologyMultiple(pylith::topology::Mesh* const mesh,
+                                                      FaultCohesive* faults[],
+                                                      const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert( (!faults && 0 == numFaults) || (faults && 0 < numFaults) );
+
+    PetscErrorCode err;
+    std::vector<FaultCohesive*> group;
+    TopologyOps::PointSet groupCells;
+    for (int i = 0; i < numFaults; ++i) {
+        assert(faults[i]);
+        faults[i]->_checkLabels(*mesh);
+
+        TopologyOps::PointSet faultCells;
+        TopologyOps::getFaultCells(&faultCells, *mesh, faults[i]->getSurfaceLabelName(), faults[i]->getSurfaceLabelValue());
+        int sharesCellsLocal = 0;
+        for (TopologyOps::PointSet::const_iterator iter = faultCells.begin(); iter != faultCells.end(); ++iter) {
+            if (groupCells.count(*iter) > 0) {
+                sharesCellsLocal = 1;
+                break;
+            } // if
+        } // for
+        int sharesCells = 0;
+        err = MPI_Allreduce(&sharesCellsLocal, &sharesCells, 1, MPI_INT, MPI_MAX, mesh->getComm());PYLITH_CHECK_ERROR(err);
+        if (sharesCells) {
+            _adjustTopologyGroup(mesh, group);
+            group.clear();
+            groupCells.clear();
+
+            // Cell numbering changes after inserting cohesive cells.
+            faultCells.clear();
+            TopologyOps::getFaultCells(&faultCells, *mesh, faults[i]->getSurfaceLabelName(), faults[i]->getSurfaceLabelValue());
+        } // if
+        group.push_back(faults[i]);
+        groupCells.insert(faultCells.begin(), faultCells.end());
+    } // for
+    if (group.size() > 0) {
+        _adjustTopologyGroup(mesh, group);
+    } // if
+
+    PYLITH_METHOD_END;
+} // adjustTopologyMultiple
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify mesh has labels for fault surface and buried edges.
+void
+pylith::faults::FaultCohesive::_checkLabels(const pylith::topology::Mesh& mesh) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscBool isDistributed = PETSC_FALSE;
+    PetscMPIInt rank;
+    PetscErrorCode err;
+    // We do not have labels on all ranks until after distribution
+    err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
+    err = DMPlexIsDistributed(dmMesh, &isDistributed);PYLITH_CHECK_ERROR(err);
+    const bool checkLabels = isDistributed || !rank;
+    if (!checkLabels) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMHasLabel(dmMesh, _surfaceLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (!hasLabel) {
+        std::ostringstream msg;
+        msg << "Mesh missing group of vertices '" << _surfaceLabelName
+            << "' for fault interface condition.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (_buriedEdgesLabelName.length() > 0) {
+        err = DMHasLabel(dmMesh, _buriedEdgesLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+        if (!hasLabel) {
+            std::ostringstream msg;
+            msg << "Could not find label '" << _buriedEdgesLabelName << "' marking buried edges for fault '" << _surfaceLabelName << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // _checkLabels
+
+
+// ------------------------------------------------------------------------------------------------
+// Adjust mesh topology for group of faults that do not share any cells.
+void
+pylith::faults::FaultCohesive::_adjustTopologyGroup(pylith::topology::Mesh* const mesh,
+                                                    const std::vector<FaultCohesive*>& faults) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(faults.size() > 0);
+
+    if (1 == faults.size()) {
+        faults[0]->adjustTopology(mesh);
+        PYLITH_METHOD_END;
+    } // if
+
+    try {
+        pylith::topology::Mesh faultMesh;
+        TopologyOps::createMultiple(mesh, &faultMesh, faults);
+
+        // Check consistency of mesh around the faults.
+        _checkTopology(*mesh, faultMesh, faults);
+
+        pythia::journal::debug_t debug(faults[0]->getName());
+        if (debug.state()) {
+            mesh->view("::ascii_info_detail");
+        } // if
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error occurred while adjusting topology to create cohesive cells for faults";
+        for (size_t i = 0; i < faults.size(); ++i) {
+            msg << (i > 0 ? ", '" : " '") << faults[i]->_surfaceLabelName << "'";
+        } // for
+        msg << ".\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _adjustTopologyGroup
+
+
+// ------------------------------------------------------------------------------------------------
+// Check topology of cells adjacent to the fault surfaces and the fault mesh.
+void
+pylith::faults::FaultCohesive::_checkTopology(const pylith::topology::Mesh& mesh,
+                                              const pylith::topology::Mesh& faultMesh,
+                                              const std::vector<FaultCohesive*>& faults) {
+    PYLITH_METHOD_BEGIN;
+
+    // Only cells adjacent to the split surfaces change when inserting cohesive cells.
+    TopologyOps::PointSet splitCells;
+    for (size_t i = 0; i < faults.size(); ++i) {
+        assert(faults[i]);
+        TopologyOps::getSplitCells(&splitCells, mesh, faults[i]->getCohesiveLabelName(), faults[i]->getCohesiveLabelValue());
+    } // for
+    pylith::int_array cells(splitCells.size());
+    size_t index = 0;
+    for (TopologyOps::PointSet::const_iterator iter = splitCells.begin(); iter != splitCells.end(); ++iter, ++index) {
+        cells[index] = *iter;
+    } // for
+    pylith::topology::MeshOps::checkTopology(mesh, cells);
+    pylith::topology::MeshOps::checkTopology(faultMesh);
+
+    PYLITH_METHOD_END;
+} // _checkTopology
+
+
 // ------------------------------------------------------------------------------------------------
 // Create integrator and set kernels.
 pylith::feassemble::Integrator*
@@ -31,6 +31,7 @@
 #include "pylith/materials/materialsfwd.hh" // USES Material
 
 #include <string> // HASA std::string
+#include <vector> // USES std::vector
 
 class pylith::faults::FaultCohesive : public pylith::problems::Physics {
     friend class TestFaultCohesive; // unit testing
@@ -138,6 +139,22 @@ public:
      */
     void adjustTopology(pylith::topology::Mesh* const mesh);
 
+    /** Adjust mesh topology for multiple faults.
+     *
+     * Consecutive faults that do not share any cells are grouped together, and the cohesive cells
+     * for each group are created in a single pass. Faults sharing cells with a fault in the current
+     * group start a new group, so the faults are processed in the same order as calling
+     * adjustTopology() for each fault.
+     *
+     * @param mesh[in] PETSc mesh.
+     * @param faults[in] Array of faults.
+     * @param numFaults[in] Number of faults.
+     */
+    static
+    void adjustTopologyMultiple(pylith::topology::Mesh* const mesh,
+                                FaultCohesive* faults[],
+                                const int numFaults);
+
     /** Create integrator and set kernels.
      *
      * @param[in] solution Solution field.
@@ -220,6 +237,32 @@ protected:
     // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
 private:
 
+    /** Verify mesh has labels for fault surface and buried edges.
+     *
+     * @param mesh[in] PETSc mesh.
+     */
+    void _checkLabels(const pylith::topology::Mesh& mesh) const;
+
+    /** Adjust mesh topology for group of faults that do not share any cells.
+     *
+     * @param mesh[in] PETSc mesh.
+     * @param faults[in] Array of faults.
+     */
+    static
+    void _adjustTopologyGroup(pylith::topology::Mesh* const mesh,
+                              const std::vector<FaultCohesive*>& faults);
+
+    /** Check topology of cells adjacent to the fault surfaces and the fault mesh.
+     *
+     * @param mesh[in] PETSc mesh.
+     * @param faultMesh[in] Mesh for fault surfaces.
+     * @param faults[in] Array of faults.
+     */
+    static
+    void _checkTopology(const pylith::topology::Mesh& mesh,
+                        const pylith::topology::Mesh& faultMesh,
+                        const std::vector<FaultCohesive*>& faults);
+
     inline
     static
     PetscErrorCode _zero(PetscInt dim,
@@ -24,10 +24,37 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 
+#include <algorithm> // USES std::max(), std::swap()
 #include <cassert> // USES assert()
+#include <cmath> // USES fabs()
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _FaultOps {
+            // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////
+public:
+
+            /** Compute inverse of small dense matrix using Gauss-Jordan elimination with partial pivoting.
+             *
+             * @param[out] aInv Inverse of matrix (row major) [n*n].
+             * @param[in] a Matrix (row major) [n*n].
+             * @param[in] n Number of rows and columns.
+             * @returns True if matrix is nonsingular, false otherwise.
+             */
+            static
+            bool invertDense(PetscScalar* aInv,
+                             const PetscScalar* a,
+                             const PetscInt n);
+
+        }; // _FaultOps
+    } // faults
+} // pylith
 
 // ------------------------------------------------------------------------------------------------
 // Create weighting vector for dynamic prescribed slip DAE.
@@ -106,4 +133,275 @@ pylith::faults::FaultOps::updateDAEMassWeighting(pylith::feassemble::Integration
 } // updateDAEMassWeighting
 
 
+// ------------------------------------------------------------------------------------------------
+// Create approximate Schur complement for the fault Lagrange multipliers.
+void
+pylith::faults::FaultOps::createSchurPrecond(PetscMat* precondMat,
+                                             PetscMat jacobianMat,
+                                             const pylith::topology::Field& solution,
+                                             const std::vector<pylith::feassemble::IntegratorInterface*>& integrators) {
+    PYLITH_METHOD_BEGIN;
+    assert(precondMat);
+    assert(jacobianMat);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    const PetscInt lagrangeIndex = solution.getSubfieldInfo("lagrange_multiplier_fault").index;
+
+    // Mark displacement DOF on the negative and positive sides of the faults. Use ADD_VALUES so that
+    // DOF marked only by another process are included.
+    PetscVec markLocalVec = NULL, markVec = NULL;
+    err = DMGetLocalVector(dmSoln, &markLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(markLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < integrators.size(); ++i) {
+        assert(integrators[i]);
+        integrators[i]->markSideDOF(markLocalVec, solution, "displacement");
+    } // for
+    err = DMGetGlobalVector(dmSoln, &markVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(markVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, markLocalVec, ADD_VALUES, markVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, markLocalVec, ADD_VALUES, markVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &markLocalVec);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> faultDispIndices;
+    std::vector<PetscInt> blockSizes;
+    _getFaultDispBlocks(&faultDispIndices, &blockSizes, solution, markVec);
+    err = DMRestoreGlobalVector(dmSoln, &markVec);PYLITH_CHECK_ERROR(err);
+
+    PetscIS faultDispIS = NULL;
+    const PetscInt numFaultDispIndices = faultDispIndices.size();
+    err = ISCreateGeneral(PetscObjectComm((PetscObject)dmSoln), numFaultDispIndices,
+                          numFaultDispIndices > 0 ? &faultDispIndices[0] : NULL, PETSC_COPY_VALUES,
+                          &faultDispIS);PYLITH_CHECK_ERROR(err);
+
+    // Index set for the Lagrange multiplier DOF consistent with the splits in PCFIELDSPLIT.
+    PetscInt numFields = 0;
+    char** fieldNames = NULL;
+    PetscIS* fieldIS = NULL;
+    err = DMCreateFieldIS(dmSoln, &numFields, &fieldNames, &fieldIS);PYLITH_CHECK_ERROR(err);
+    assert(lagrangeIndex < numFields);
+    PetscIS lagrangeIS = fieldIS[lagrangeIndex];
+
+    // Sp = A11 - A10 inv(blockdiag(A00)) A01
+    PetscMat A00 = NULL, A01 = NULL, A10 = NULL, A11 = NULL, A00Inv = NULL;
+    err = MatCreateSubMatrix(jacobianMat, faultDispIS, faultDispIS, MAT_INITIAL_MATRIX, &A00);PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrix(jacobianMat, faultDispIS, lagrangeIS, MAT_INITIAL_MATRIX, &A01);PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrix(jacobianMat, lagrangeIS, faultDispIS, MAT_INITIAL_MATRIX, &A10);PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrix(jacobianMat, lagrangeIS, lagrangeIS, MAT_INITIAL_MATRIX, &A11);PYLITH_CHECK_ERROR(err);
+    _invertBlockDiagonal(&A00Inv, A00, blockSizes);
+
+    err = MatDestroy(precondMat);PYLITH_CHECK_ERROR(err);
+    err = MatMatMatMult(A10, A00Inv, A01, MAT_INITIAL_MATRIX, PETSC_DEFAULT, precondMat);PYLITH_CHECK_ERROR(err);
+    err = MatAYPX(*precondMat, -1.0, A11, DIFFERENT_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+
+    err = MatDestroy(&A00);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&A01);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&A10);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&A11);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&A00Inv);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&faultDispIS);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        err = PetscFree(fieldNames[iField]);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&fieldIS[iField]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscFree(fieldNames);PYLITH_CHECK_ERROR(err);
+    err = PetscFree(fieldIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createSchurPrecond
+
+
+// ------------------------------------------------------------------------------------------------
+// Get global indices of the marked displacement DOF and the size of the block for each point.
+void
+pylith::faults::FaultOps::_getFaultDispBlocks(std::vector<PetscInt>* indices,
+                                              std::vector<PetscInt>* blockSizes,
+                                              const pylith::topology::Field& solution,
+                                              PetscVec markVec) {
+    PYLITH_METHOD_BEGIN;
+    assert(indices);
+    assert(blockSizes);
+    assert(markVec);
+
+    PetscErrorCode err = 0;
+    PetscSection localSection = solution.getLocalSection();assert(localSection);
+    PetscSection globalSection = solution.getGlobalSection();assert(globalSection);
+    const PetscInt dispIndex = solution.getSubfieldInfo("displacement").index;
+
+    PetscInt indexStart = 0, indexEnd = 0;
+    err = VecGetOwnershipRange(markVec, &indexStart, &indexEnd);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* markArray = NULL;
+    err = VecGetArrayRead(markVec, &markArray);PYLITH_CHECK_ERROR(err);
+
+    indices->clear();
+    blockSizes->clear();
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(localSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt globalDof = 0, globalOffset = 0;
+        err = PetscSectionGetDof(globalSection, point, &globalDof);PYLITH_CHECK_ERROR(err);
+        if (globalDof <= 0) { continue; } // Point is not local or has no DOF.
+        err = PetscSectionGetOffset(globalSection, point, &globalOffset);PYLITH_CHECK_ERROR(err);
+
+        // Global DOF for a point are ordered by subfield without the constrained DOF, consistent
+        // with DMCreateFieldIS().
+        PetscInt dispOffset = globalOffset;
+        for (PetscInt iField = 0; iField < dispIndex; ++iField) {
+            PetscInt fieldDof = 0, fieldConstraintDof = 0;
+            err = PetscSectionGetFieldDof(localSection, point, iField, &fieldDof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldConstraintDof(localSection, point, iField, &fieldConstraintDof);PYLITH_CHECK_ERROR(err);
+            dispOffset += fieldDof - fieldConstraintDof;
+        } // for
+        PetscInt dispDof = 0, dispConstraintDof = 0;
+        err = PetscSectionGetFieldDof(localSection, point, dispIndex, &dispDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldConstraintDof(localSection, point, dispIndex, &dispConstraintDof);PYLITH_CHECK_ERROR(err);
+        const PetscInt blockSize = dispDof - dispConstraintDof;
+        if ((blockSize <= 0) || (markArray[dispOffset-indexStart] < 0.5)) { continue; }
+
+        for (PetscInt iDof = 0; iDof < blockSize; ++iDof) {
+            indices->push_back(dispOffset+iDof);
+        } // for
+        blockSizes->push_back(blockSize);
+    } // for
+    err = VecRestoreArrayRead(markVec, &markArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _getFaultDispBlocks
+
+
+// ------------------------------------------------------------------------------------------------
+// Create inverse of block diagonal of matrix.
+void
+pylith::faults::FaultOps::_invertBlockDiagonal(PetscMat* matInv,
+                                               PetscMat mat,
+                                               const std::vector<PetscInt>& blockSizes) {
+    PYLITH_METHOD_BEGIN;
+    assert(matInv);
+    assert(mat);
+
+    PetscErrorCode err = 0;
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = MatGetOwnershipRange(mat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt numRows = rowEnd - rowStart;
+
+    std::vector<PetscInt> numNonzeros(numRows);
+    PetscInt iRow = 0;
+    for (size_t iBlock = 0; iBlock < blockSizes.size(); ++iBlock) {
+        for (PetscInt i = 0; i < blockSizes[iBlock]; ++i) {
+            assert(iRow < numRows);
+            numNonzeros[iRow++] = blockSizes[iBlock];
+        } // for
+    } // for
+    assert(numRows == iRow);
+
+    err = MatDestroy(matInv);PYLITH_CHECK_ERROR(err);
+    err = MatCreate(PetscObjectComm((PetscObject)mat), matInv);PYLITH_CHECK_ERROR(err);
+    err = MatSetSizes(*matInv, numRows, numRows, PETSC_DETERMINE, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+    err = MatSetType(*matInv, MATAIJ);PYLITH_CHECK_ERROR(err);
+    err = MatSeqAIJSetPreallocation(*matInv, 0, numRows > 0 ? &numNonzeros[0] : NULL);PYLITH_CHECK_ERROR(err);
+    err = MatMPIAIJSetPreallocation(*matInv, 0, numRows > 0 ? &numNonzeros[0] : NULL, 0, NULL);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> blockIndices;
+    std::vector<PetscScalar> blockValues;
+    std::vector<PetscScalar> blockInvValues;
+    PetscInt blockStart = rowStart;
+    for (size_t iBlock = 0; iBlock < blockSizes.size(); ++iBlock) {
+        const PetscInt blockSize = blockSizes[iBlock];
+        blockIndices.resize(blockSize);
+        blockValues.resize(blockSize*blockSize);
+        blockInvValues.resize(blockSize*blockSize);
+
+        for (PetscInt i = 0; i < blockSize; ++i) {
+            blockIndices[i] = blockStart + i;
+        } // for
+        for (PetscInt i = 0; i < blockSize*blockSize; ++i) {
+            blockValues[i] = 0.0;
+        } // for
+        for (PetscInt i = 0; i < blockSize; ++i) {
+            PetscInt numCols = 0;
+            const PetscInt* cols = NULL;
+            const PetscScalar* values = NULL;
+            err = MatGetRow(mat, blockStart+i, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iCol = 0; iCol < numCols; ++iCol) {
+                const PetscInt j = cols[iCol] - blockStart;
+                if ((j >= 0) && (j < blockSize)) {
+                    blockValues[i*blockSize+j] = values[iCol];
+                } // if
+            } // for
+            err = MatRestoreRow(mat, blockStart+i, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        if (!_FaultOps::invertDense(&blockInvValues[0], &blockValues[0], blockSize)) {
+            // Fall back to the inverse of the diagonal for singular blocks.
+            for (PetscInt i = 0; i < blockSize; ++i) {
+                for (PetscInt j = 0; j < blockSize; ++j) {
+                    const PetscScalar diag = blockValues[i*blockSize+i];
+                    blockInvValues[i*blockSize+j] = (i == j && diag != 0.0) ? 1.0 / diag : 0.0;
+                } // for
+            } // for
+        } // if
+        err = MatSetValues(*matInv, blockSize, &blockIndices[0], blockSize, &blockIndices[0], &blockInvValues[0],
+                           INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        blockStart += blockSize;
+    } // for
+    assert(rowEnd == blockStart);
+    err = MatAssemblyBegin(*matInv, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(*matInv, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _invertBlockDiagonal
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute inverse of small dense matrix using Gauss-Jordan elimination with partial pivoting.
+bool
+pylith::faults::_FaultOps::invertDense(PetscScalar* aInv,
+                                       const PetscScalar* a,
+                                       const PetscInt n) {
+    assert(aInv);
+    assert(a);
+
+    std::vector<PetscScalar> lu(a, a+n*n);
+    PylithReal scale = 0.0;
+    for (PetscInt i = 0; i < n*n; ++i) {
+        scale = std::max(scale, PylithReal(fabs(PetscRealPart(lu[i]))));
+        aInv[i] = 0.0;
+    } // for
+    for (PetscInt i = 0; i < n; ++i) {
+        aInv[i*n+i] = 1.0;
+    } // for
+    const PylithReal tolerance = 1.0e-14 * scale;
+
+    for (PetscInt k = 0; k < n; ++k) {
+        PetscInt pivot = k;
+        for (PetscInt i = k+1; i < n; ++i) {
+            if (fabs(PetscRealPart(lu[i*n+k])) > fabs(PetscRealPart(lu[pivot*n+k]))) { pivot = i; }
+        } // for
+        if (fabs(PetscRealPart(lu[pivot*n+k])) <= tolerance) { return false; }
+        if (pivot != k) {
+            for (PetscInt j = 0; j < n; ++j) {
+                std::swap(lu[k*n+j], lu[pivot*n+j]);
+                std::swap(aInv[k*n+j], aInv[pivot*n+j]);
+            } // for
+        } // if
+
+        const PetscScalar pivotInv = 1.0 / lu[k*n+k];
+        for (PetscInt j = 0; j < n; ++j) {
+            lu[k*n+j] *= pivotInv;
+            aInv[k*n+j] *= pivotInv;
+        } // for
+        for (PetscInt i = 0; i < n; ++i) {
+            if (i == k) { continue; }
+            const PetscScalar factor = lu[i*n+k];
+            for (PetscInt j = 0; j < n; ++j) {
+                lu[i*n+j] -= factor * lu[k*n+j];
+                aInv[i*n+j] -= factor * aInv[k*n+j];
+            } // for
+        } // for
+    } // for
+
+    return true;
+} // invertDense
+
+
 // End of file
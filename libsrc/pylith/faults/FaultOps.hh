@@ -30,6 +30,9 @@
 
 #include "pylith/feassemble/feassemblefwd.hh" // USES IntegrationData
 #include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // USES PetscMat, PetscVec
+
+#include <vector> // USES std::vector
 
 class pylith::faults::FaultOps {
     friend class TestFaultOps; // unit testing
@@ -51,6 +54,55 @@ public:
     static
     void updateDAEMassWeighting(pylith::feassemble::IntegrationData* integrationData);
 
+    /** Create approximate Schur complement for the fault Lagrange multipliers.
+     *
+     * S_p = A_11 - A_10 inv(blockdiag(A_00)) A_01, where A_00 is the displacement block of the
+     * Jacobian restricted to the degrees of freedom on the negative and positive sides of the
+     * faults, and blockdiag(A_00) contains the diagonal blocks for each point. The size of each
+     * block is the number of unconstrained displacement degrees of freedom at the point, so points
+     * with Dirichlet boundary conditions on some components have smaller blocks. Singular blocks
+     * fall back to the inverse of their diagonal.
+     *
+     * @param[out] precondMat PETSc Mat for approximate Schur complement.
+     * @param[in] jacobianMat Assembled Jacobian (or preconditioner for Jacobian).
+     * @param[in] solution Solution field.
+     * @param[in] integrators Integrators for the faults.
+     */
+    static
+    void createSchurPrecond(PetscMat* precondMat,
+                            PetscMat jacobianMat,
+                            const pylith::topology::Field& solution,
+                            const std::vector<pylith::feassemble::IntegratorInterface*>& integrators);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Get global indices of the marked displacement degrees of freedom and the size of the block for each point.
+     *
+     * Only points owned by this process are included. The indices for each point are contiguous.
+     *
+     * @param[out] indices Global indices of marked, unconstrained displacement degrees of freedom.
+     * @param[out] blockSizes Number of indices for each point.
+     * @param[in] solution Solution field.
+     * @param[in] markVec Global PETSc Vec with displacement degrees of freedom to include marked by 1.
+     */
+    static
+    void _getFaultDispBlocks(std::vector<PetscInt>* indices,
+                             std::vector<PetscInt>* blockSizes,
+                             const pylith::topology::Field& solution,
+                             PetscVec markVec);
+
+    /** Create inverse of block diagonal of matrix with variable block sizes.
+     *
+     * @param[out] matInv PETSc Mat with inverse of block diagonal.
+     * @param[in] mat PETSc Mat.
+     * @param[in] blockSizes Size of each diagonal block for rows owned by this process.
+     */
+    static
+    void _invertBlockDiagonal(PetscMat* matInv,
+                              PetscMat mat,
+                              const std::vector<PetscInt>& blockSizes);
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
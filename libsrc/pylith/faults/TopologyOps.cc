@@ -20,13 +20,74 @@
 
 #include "TopologyOps.hh" // implementation of object methods
 
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
 #include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include <sstream> // USES std::ostringstream
+#include <cstring> // USES strlen()
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::min
 #include <iostream> // USES std::cout
 #include <cassert> // USES assert()
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _TopologyOps {
+public:
+
+            /** Remove faces and cross edges from label of buried edges in 3-D.
+             *
+             * DMPlexLabelCohesiveComplete() is over-aggressive in completing the label of buried edges.
+             *
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] label Label of points to split.
+             * @param[inout] faultBdLabel Label for buried edges of fault.
+             * @param[in] faultBdLabelValue Value for buried edges of fault.
+             */
+            static
+            void fixBuriedEdges(PetscDM dm,
+                                PetscDMLabel label,
+                                PetscDMLabel faultBdLabel,
+                                const int faultBdLabelValue);
+
+            /** Split points and insert cohesive cells.
+             *
+             * @param[inout] mesh Finite-element mesh.
+             * @param[in] faultMesh Finite-element mesh of fault(s).
+             * @param[in] label Label of points to split.
+             * @param[in] faultBdLabel Label for buried edges of fault(s).
+             * @param[in] faultBdLabelValue Value for buried edges of fault(s).
+             * @param[in] cohesiveLabelValue Value of cells label for cohesive cells.
+             */
+            static
+            void insertCohesiveCells(pylith::topology::Mesh* mesh,
+                                     const pylith::topology::Mesh& faultMesh,
+                                     PetscDMLabel label,
+                                     PetscDMLabel faultBdLabel,
+                                     const int faultBdLabelValue,
+                                     const int cohesiveLabelValue);
+
+            /** Get points in stratum of label.
+             *
+             * @param[inout] points Set of points.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] labelName Name of label.
+             * @param[in] labelValue Value of label.
+             */
+            static
+            void addStratumPoints(TopologyOps::PointSet* points,
+                                  PetscDM dm,
+                                  const char* labelName,
+                                  const int labelValue);
+
+        }; // _TopologyOps
+    } // faults
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
@@ -116,121 +177,385 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
                                     const int faultBdLabelValue,
                                     const int cohesiveLabelValue) {
     assert(mesh);
-    PetscDM sdm = NULL;
     PetscDM dm = mesh->getDM();assert(dm);
-    PetscDMLabel subpointMap = NULL, label = NULL, mlabel = NULL;
-    PetscInt dim, cMax, cStart, cEnd, numCohesiveCellsOld;
+    PetscDMLabel subpointMap = NULL, label = NULL;
     PetscErrorCode err;
 
-    // Have to remember the old number of cohesive cells
-    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-    cMax = cStart;
-    for (PetscInt cell = cStart; cell < cEnd; ++cell, ++cMax) {
-        if (pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
-    } // for
-    numCohesiveCellsOld = cEnd - cMax;
     // Create cohesive cells
     err = DMPlexGetSubpointMap(faultMesh.getDM(), &subpointMap);PYLITH_CHECK_ERROR(err);
     err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
     err = DMLabelClearStratum(label, mesh->getDimension());PYLITH_CHECK_ERROR(err);
     // Fix over-aggressive completion of boundary label
-    err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
-    if (faultBdLabel && (dim > 2)) {
-        PetscIS bdIS;
-        const PetscInt *bd;
-        PetscInt fStart, fEnd, n, i;
+    _TopologyOps::fixBuriedEdges(dm, label, faultBdLabel, faultBdLabelValue);
+    _TopologyOps::insertCohesiveCells(mesh, faultMesh, label, faultBdLabel, faultBdLabelValue, cohesiveLabelValue);
+    err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+} // create
 
-        err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
-        err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
-        err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
-        err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-        for (i = 0; i < n; ++i) {
-            const PetscInt p = bd[i];
 
-            // Remove faces
-            if ((p >= fStart) && (p < fEnd)) {
-                const PetscInt *edges,   *verts, *supportA, *supportB;
-                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
-                PetscBool found = PETSC_FALSE;
+// ------------------------------------------------------------------------------------------------
+// Create cohesive cells for multiple faults in a single pass.
+void
+pylith::faults::TopologyOps::createMultiple(pylith::topology::Mesh* mesh,
+                                            pylith::topology::Mesh* faultMesh,
+                                            const std::vector<FaultCohesive*>& faults) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    assert(faultMesh);
+    assert(faults.size() > 0);
 
-                err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
-                // Remove the cross edge
-                err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
-                err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
-                if (numEdges != 3) {
-                    std::ostringstream msg;
-                    msg << "Internal error while creating fault mesh. Face "<<p<<" has "<<numEdges<<" edges != 3.";
-                    throw std::logic_error(msg.str());
-                }
-                for (e = 0; e < numEdges; ++e) {
-                    err = DMPlexGetCone(dm, edges[e], &verts);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetConeSize(dm, edges[e], &numVerts);PYLITH_CHECK_ERROR(err);
-                    if (numVerts != 2) {
-                        std::ostringstream msg;
-                        msg << "Internal error while creating fault mesh. Edge "<<edges[e]<<" has "<<numVerts<<" vertices != 2.";
-                        throw std::logic_error(msg.str());
-                    }
-                    err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
-                    for (s = 0, sA = 0; s < supportSizeA; ++s) {
-                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
-                    }
-                    err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
-                    for (s = 0, sB = 0; s < supportSizeB; ++s) {
-                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
-                    }
-                    if ((sA > 2) && (sB > 2)) {
-                        err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
-                        found = PETSC_TRUE;
-                        break;
-                    }
-                }
-                if (!found) {
-                    std::ostringstream msg;
-                    msg << "Internal error while creating fault mesh. Face "<<p<<" has no cross edge.";
-                    throw std::logic_error(msg.str());
-                }
-            }
-        }
-        err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
-    }
-    // Completes the set of cells scheduled to be replaced
-    err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, faultMesh.getDM());PYLITH_CHECK_ERROR(err);
-    err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+    PetscDM dm = mesh->getDM();assert(dm);
+    PetscErrorCode err;
 
-    const char* interfaceLabelName = pylith::topology::Mesh::cells_label_name;
-    err = DMGetLabel(sdm, interfaceLabelName, &mlabel);PYLITH_CHECK_ERROR(err);
-    if (mlabel) {
-        err = DMPlexGetHeightStratum(sdm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-        cMax = cStart;
-        for (PetscInt cell = cStart; cell < cEnd; ++cell, ++cMax) {
-            if (pylith::topology::MeshOps::isCohesiveCell(sdm, cell)) { break; }
-        }
-        assert(cStart == cEnd || cEnd > cMax + numCohesiveCellsOld);
-        for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
-            PetscInt onBd;
+    // Merge surfaces and buried edges of faults into single labels.
+    const char* surfacesLabelName = "pylith_fault_surfaces";
+    const char* edgesLabelName = "pylith_fault_edges";
+    const int mergedValue = 1;
+    TopologyOps::PointSet surfacePoints;
+    TopologyOps::PointSet edgePoints;
+    const size_t numFaults = faults.size();
+    for (size_t i = 0; i < numFaults; ++i) {
+        assert(faults[i]);
+        _TopologyOps::addStratumPoints(&surfacePoints, dm, faults[i]->getSurfaceLabelName(), faults[i]->getSurfaceLabelValue());
+    } // for
+    PetscDMLabel surfacesLabel = NULL;
+    err = DMCreateLabel(dm, surfacesLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, surfacesLabelName, &surfacesLabel);PYLITH_CHECK_ERROR(err);
+    for (PointSet::const_iterator iter = surfacePoints.begin(); iter != surfacePoints.end(); ++iter) {
+        err = DMLabelSetValue(surfacesLabel, *iter, mergedValue);PYLITH_CHECK_ERROR(err);
+    } // for
+    createFault(faultMesh, *mesh, surfacesLabel, mergedValue);
 
-            /* Eliminate hybrid cells on the boundary of the split from cohesive label,
-             * they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
-            err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
-            // if (onBd == dim) continue;
-            err = DMLabelSetValue(mlabel, cell, cohesiveLabelValue);PYLITH_CHECK_ERROR(err);
-        }
-    }
+    PetscDMLabel subpointMap = NULL, label = NULL;
+    err = DMPlexGetSubpointMap(faultMesh->getDM(), &subpointMap);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
+    err = DMLabelClearStratum(label, mesh->getDimension());PYLITH_CHECK_ERROR(err);
+
+    // Fix each label of buried edges, because we use them for the constraints on the Lagrange multipliers.
+    bool hasBuriedEdges = false;
+    for (size_t i = 0; i < numFaults; ++i) {
+        const char* edgesName = faults[i]->getBuriedEdgesLabelName();
+        PetscDMLabel faultBdLabel = NULL;
+        if (strlen(edgesName) > 0) {
+            err = DMGetLabel(dm, edgesName, &faultBdLabel);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (!faultBdLabel) { continue; }
+        hasBuriedEdges = true;
+        _TopologyOps::fixBuriedEdges(dm, label, faultBdLabel, faults[i]->getBuriedEdgesLabelValue());
+        _TopologyOps::addStratumPoints(&edgePoints, dm, edgesName, faults[i]->getBuriedEdgesLabelValue());
+    } // for
+    PetscDMLabel edgesLabel = NULL;
+    if (hasBuriedEdges) {
+        err = DMCreateLabel(dm, edgesLabelName);PYLITH_CHECK_ERROR(err);
+        err = DMGetLabel(dm, edgesLabelName, &edgesLabel);PYLITH_CHECK_ERROR(err);
+        for (PointSet::const_iterator iter = edgePoints.begin(); iter != edgePoints.end(); ++iter) {
+            err = DMLabelSetValue(edgesLabel, *iter, mergedValue);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // if
+
+    // Cohesive cells are initially assigned the cohesive label value of the first fault.
+    const int cohesiveLabelValue = faults[0]->getCohesiveLabelValue();
+    _TopologyOps::insertCohesiveCells(mesh, *faultMesh, label, edgesLabel, mergedValue, cohesiveLabelValue);
     err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
 
-    PetscReal lengthScale = 1.0;
-    err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
-    err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
-    err = DMViewFromOptions(sdm, NULL, "-pylith_cohesive_dm_view");PYLITH_CHECK_ERROR(err);
-    mesh->setDM(sdm);
-} // create
+    // Assign cohesive label value of each fault using the fault face of the cohesive cell.
+    PetscDM sdm = mesh->getDM();assert(sdm);
+    PetscDMLabel cellsLabel = NULL;
+    err = DMGetLabel(sdm, pylith::topology::Mesh::cells_label_name, &cellsLabel);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscDMLabel> faultLabels(numFaults);
+    for (size_t i = 0; i < numFaults; ++i) {
+        err = DMGetLabel(sdm, faults[i]->getSurfaceLabelName(), &faultLabels[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    PetscIS cohesiveIS = NULL;
+    PetscInt numCohesiveCells = 0;
+    const PetscInt* cohesiveCells = NULL;
+    if (cellsLabel) {
+        err = DMLabelGetStratumIS(cellsLabel, cohesiveLabelValue, &cohesiveIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (cohesiveIS) {
+        err = ISGetLocalSize(cohesiveIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+    } // if
+    for (PetscInt iCohesive = 0; iCohesive < numCohesiveCells; ++iCohesive) {
+        const PetscInt cell = cohesiveCells[iCohesive];
+        const PetscInt* cone = NULL;
+        err = DMPlexGetCone(sdm, cell, &cone);PYLITH_CHECK_ERROR(err);
+        size_t iFault = 0;
+        for (; iFault < numFaults; ++iFault) {
+            PetscInt value = 0;
+            if (!faultLabels[iFault]) { continue; }
+            err = DMLabelGetValue(faultLabels[iFault], cone[0], &value);PYLITH_CHECK_ERROR(err);
+            if (value == faults[iFault]->getSurfaceLabelValue()) { break; }
+        } // for
+        if (iFault >= numFaults) {
+            std::ostringstream msg;
+            msg << "Internal error while creating cohesive cells. Could not find fault for cohesive cell " << cell << ".";
+            throw std::logic_error(msg.str());
+        } // if
+        if (iFault > 0) {
+            err = DMLabelClearValue(cellsLabel, cell, cohesiveLabelValue);PYLITH_CHECK_ERROR(err);
+            err = DMLabelSetValue(cellsLabel, cell, faults[iFault]->getCohesiveLabelValue());PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+    if (cohesiveIS) {
+        err = ISRestoreIndices(cohesiveIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = ISDestroy(&cohesiveIS);PYLITH_CHECK_ERROR(err);
+
+    err = DMRemoveLabel(sdm, surfacesLabelName, NULL);PYLITH_CHECK_ERROR(err);
+    if (hasBuriedEdges) {
+        err = DMRemoveLabel(sdm, edgesLabelName, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // createMultiple
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cells with a vertex on the fault surface.
+void
+pylith::faults::TopologyOps::getFaultCells(PointSet* cells,
+                                           const pylith::topology::Mesh& mesh,
+                                           const char* surfaceLabelName,
+                                           const int surfaceLabelValue) {
+    PYLITH_METHOD_BEGIN;
+    assert(cells);
+
+    PetscDM dm = mesh.getDM();assert(dm);
+    PetscErrorCode err;
+    PetscInt vStart = 0, vEnd = 0, cStart = 0, cEnd = 0;
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    PointSet surfacePoints;
+    _TopologyOps::addStratumPoints(&surfacePoints, dm, surfaceLabelName, surfaceLabelValue);
+    for (PointSet::const_iterator iter = surfacePoints.begin(); iter != surfacePoints.end(); ++iter) {
+        if ((*iter < vStart) || (*iter >= vEnd)) { continue; }
+        PetscInt* star = NULL;
+        PetscInt starSize = 0;
+        err = DMPlexGetTransitiveClosure(dm, *iter, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+        for (PetscInt s = 0; s < starSize*2; s += 2) {
+            if ((star[s] >= cStart) && (star[s] < cEnd)) {
+                cells->insert(star[s]);
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, *iter, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // getFaultCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cohesive cells and the cells adjacent to them.
+void
+pylith::faults::TopologyOps::getSplitCells(PointSet* cells,
+                                           const pylith::topology::Mesh& mesh,
+                                           const char* cohesiveLabelName,
+                                           const int cohesiveLabelValue) {
+    PYLITH_METHOD_BEGIN;
+    assert(cells);
+
+    PetscDM dm = mesh.getDM();assert(dm);
+    PetscErrorCode err;
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    PointSet cohesiveCells;
+    _TopologyOps::addStratumPoints(&cohesiveCells, dm, cohesiveLabelName, cohesiveLabelValue);
+    for (PointSet::const_iterator iter = cohesiveCells.begin(); iter != cohesiveCells.end(); ++iter) {
+        if ((*iter < cStart) || (*iter >= cEnd)) { continue; }
+        cells->insert(*iter);
+
+        // The first two points in the cone of a cohesive cell are the faces on the negative and
+        // positive sides of the fault.
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0;
+        err = DMPlexGetConeSize(dm, *iter, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dm, *iter, &cone);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCone = 0; iCone < std::min(coneSize, PetscInt(2)); ++iCone) {
+            const PetscInt* support = NULL;
+            PetscInt supportSize = 0;
+            err = DMPlexGetSupportSize(dm, cone[iCone], &supportSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetSupport(dm, cone[iCone], &support);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+                cells->insert(support[iSupport]);
+            } // for
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // getSplitCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Complete the point SF of a distributed mesh after inserting cohesive cells.
+void
+pylith::faults::TopologyOps::completePointSF(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    PetscErrorCode err;
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject) dm), &commSize);PYLITH_CHECK_ERROR(err);
+    PetscSF sfPoint = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    const PetscSFNode* remotePoints = NULL;
+    err = DMGetPointSF(dm, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, &remotePoints);PYLITH_CHECK_ERROR(err);
+    if ((1 == commSize) || (numRoots < 0)) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Map each split point to its split copy and the tensor product point over it. The first two
+    // points in the cone of a tensor product point are the original point and its split copy.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(0 == pStart && numRoots == pEnd);
+    std::vector<PetscInt> splitPoint(pEnd, -1);
+    std::vector<PetscInt> tensorPoint(pEnd, -1);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dm, point, &ct);PYLITH_CHECK_ERROR(err);
+        if ((ct != DM_POLYTOPE_POINT_PRISM_TENSOR) && (ct != DM_POLYTOPE_SEG_PRISM_TENSOR) &&
+            (ct != DM_POLYTOPE_TRI_PRISM_TENSOR) && (ct != DM_POLYTOPE_QUAD_PRISM_TENSOR)) {
+            continue;
+        } // if
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0;
+        err = DMPlexGetConeSize(dm, point, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dm, point, &cone);PYLITH_CHECK_ERROR(err);
+        assert(coneSize >= 2);
+        splitPoint[cone[0]] = cone[1];
+        tensorPoint[cone[0]] = point;
+    } // for
+
+    // Get the split copies and tensor product points of the remote roots.
+    std::vector<PetscInt> remoteSplitPoint(pEnd, -1);
+    std::vector<PetscInt> remoteTensorPoint(pEnd, -1);
+    err = PetscSFBcastBegin(sfPoint, MPIU_INT, &splitPoint[0], &remoteSplitPoint[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfPoint, MPIU_INT, &splitPoint[0], &remoteSplitPoint[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastBegin(sfPoint, MPIU_INT, &tensorPoint[0], &remoteTensorPoint[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfPoint, MPIU_INT, &tensorPoint[0], &remoteTensorPoint[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    // Remote point for each local point (rank < 0 if the point is not a leaf).
+    std::vector<PetscSFNode> remoteOfPoint(pEnd);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        remoteOfPoint[point].rank = -1;
+        remoteOfPoint[point].index = -1;
+    } // for
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt leaf = leaves ? leaves[iLeaf] : iLeaf;
+        remoteOfPoint[leaf] = remotePoints[iLeaf];
+    } // for
+
+    // A process with a fault point but none of the fault faces containing it cannot tell which
+    // cells are on which side of the fault. Depending on how the fault label was completed, the
+    // point is either not split or split without any cohesive cells over it. We check all
+    // processes before throwing, so that no process is left waiting in a collective operation.
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    std::ostringstream inconsistentMsg;
+    int numInconsistentLocal = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        if (tensorPoint[point] < 0) {
+            continue;
+        } // if
+        PetscInt* star = NULL;
+        PetscInt starSize = 0;
+        bool hasCohesiveCell = false;
+        err = DMPlexGetTransitiveClosure(dm, tensorPoint[point], PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iStar = 0; iStar < starSize; ++iStar) {
+            const PetscInt starPoint = star[2*iStar];
+            if ((starPoint >= cStart) && (starPoint < cEnd)) {
+                hasCohesiveCell = true;
+                break;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, tensorPoint[point], PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+        if (!hasCohesiveCell) {
+            if (!numInconsistentLocal) {
+                inconsistentMsg << "Fault point " << point << " was split without any fault faces containing it.";
+            } // if
+            ++numInconsistentLocal;
+        } // if
+    } // for
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt leaf = leaves ? leaves[iLeaf] : iLeaf;
+        if ((splitPoint[leaf] < 0) != (remoteSplitPoint[leaf] < 0)) {
+            if (!numInconsistentLocal) {
+                inconsistentMsg << "Inconsistent splitting of fault point " << leaf << " shared with process "
+                                << remotePoints[iLeaf].rank << " (remote point " << remotePoints[iLeaf].index << ").";
+            } // if
+            ++numInconsistentLocal;
+        } // if
+    } // for
+    int numInconsistent = 0;
+    err = MPI_Allreduce(&numInconsistentLocal, &numInconsistent, 1, MPI_INT, MPI_SUM,
+                        PetscObjectComm((PetscObject) dm));PYLITH_CHECK_ERROR(err);
+    if (numInconsistent > 0) {
+        std::ostringstream msg;
+        if (numInconsistentLocal > 0) {
+            msg << inconsistentMsg.str() << "\n";
+        } // if
+        msg << "Inconsistent splitting of " << numInconsistent << " fault points across processes. "
+            << "A process has a vertex on the fault but none of the fault faces containing it, even though "
+            << "the fault faces are added to the overlap before inserting the cohesive cells. "
+            << "Check that every vertex on each fault belongs to a face with all of its vertices on the fault.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PetscInt numLeavesNew = numLeaves;
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt leaf = leaves ? leaves[iLeaf] : iLeaf;
+        if (splitPoint[leaf] < 0) {
+            continue;
+        } // if
+        const PetscInt newPoints[2] = { splitPoint[leaf], tensorPoint[leaf] };
+        const PetscInt remoteNewPoints[2] = { remoteSplitPoint[leaf], remoteTensorPoint[leaf] };
+        for (int i = 0; i < 2; ++i) {
+            if (remoteOfPoint[newPoints[i]].rank < 0) {
+                remoteOfPoint[newPoints[i]].rank = remotePoints[iLeaf].rank;
+                remoteOfPoint[newPoints[i]].index = remoteNewPoints[i];
+                ++numLeavesNew;
+            } // if
+        } // for
+    } // for
+    PetscInt numLeavesAdded = 0;
+    const PetscInt numLeavesAddedLocal = numLeavesNew - numLeaves;
+    err = MPI_Allreduce(&numLeavesAddedLocal, &numLeavesAdded, 1, MPIU_INT, MPI_SUM,
+                        PetscObjectComm((PetscObject) dm));PYLITH_CHECK_ERROR(err);
+    if (!numLeavesAdded) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Leaves must be sorted by local point.
+    PetscInt* leavesNew = NULL;
+    PetscSFNode* remotePointsNew = NULL;
+    err = PetscMalloc1(numLeavesNew, &leavesNew);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numLeavesNew, &remotePointsNew);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart, iLeaf = 0; point < pEnd; ++point) {
+        if (remoteOfPoint[point].rank >= 0) {
+            leavesNew[iLeaf] = point;
+            remotePointsNew[iLeaf] = remoteOfPoint[point];
+            ++iLeaf;
+        } // if
+    } // for
+
+    PetscSF sfPointNew = NULL;
+    err = PetscSFCreate(PetscObjectComm((PetscObject) dm), &sfPointNew);PYLITH_CHECK_ERROR(err);
+    err = PetscSFSetGraph(sfPointNew, numRoots, numLeavesNew, leavesNew, PETSC_OWN_POINTER, remotePointsNew, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+    err = DMSetPointSF(dm, sfPointNew);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmCoord = NULL;
+    err = DMGetCoordinateDM(dm, &dmCoord);PYLITH_CHECK_ERROR(err);
+    if (dmCoord) {
+        err = DMSetPointSF(dmCoord, sfPointNew);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscSFDestroy(&sfPointNew);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // completePointSF
 
 
 // ------------------------------------------------------------------------------------------------
@@ -464,4 +789,167 @@ pylith::faults::TopologyOps::getAdjacentCells(PylithInt* adjacentCellNegative,
 } // getAdjacentCells
 
 
+// ------------------------------------------------------------------------------------------------
+// Remove faces and cross edges from label of buried edges in 3-D.
+void
+pylith::faults::_TopologyOps::fixBuriedEdges(PetscDM dm,
+                                             PetscDMLabel label,
+                                             PetscDMLabel faultBdLabel,
+                                             const int faultBdLabelValue) {
+    PetscInt dim = 0;
+    PetscErrorCode err;
+    err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
+    if (faultBdLabel && (dim > 2)) {
+        PetscIS bdIS;
+        const PetscInt *bd;
+        PetscInt fStart, fEnd, n, i;
+
+        err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+        for (i = 0; i < n; ++i) {
+            const PetscInt p = bd[i];
+
+            // Remove faces
+            if ((p >= fStart) && (p < fEnd)) {
+                const PetscInt *edges,   *verts, *supportA, *supportB;
+                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
+                PetscBool found = PETSC_FALSE;
+
+                err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                // Remove the cross edge
+                err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
+                if (numEdges != 3) {
+                    std::ostringstream msg;
+                    msg << "Internal error while creating fault mesh. Face "<<p<<" has "<<numEdges<<" edges != 3.";
+                    throw std::logic_error(msg.str());
+                }
+                for (e = 0; e < numEdges; ++e) {
+                    err = DMPlexGetCone(dm, edges[e], &verts);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetConeSize(dm, edges[e], &numVerts);PYLITH_CHECK_ERROR(err);
+                    if (numVerts != 2) {
+                        std::ostringstream msg;
+                        msg << "Internal error while creating fault mesh. Edge "<<edges[e]<<" has "<<numVerts<<" vertices != 2.";
+                        throw std::logic_error(msg.str());
+                    }
+                    err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
+                    for (s = 0, sA = 0; s < supportSizeA; ++s) {
+                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
+                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
+                    }
+                    err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
+                    for (s = 0, sB = 0; s < supportSizeB; ++s) {
+                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
+                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
+                    }
+                    if ((sA > 2) && (sB > 2)) {
+                        err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                        found = PETSC_TRUE;
+                        break;
+                    }
+                }
+                if (!found) {
+                    std::ostringstream msg;
+                    msg << "Internal error while creating fault mesh. Face "<<p<<" has no cross edge.";
+                    throw std::logic_error(msg.str());
+                }
+            }
+        }
+        err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    }
+} // fixBuriedEdges
+
+
+// ------------------------------------------------------------------------------------------------
+// Split points and insert cohesive cells.
+void
+pylith::faults::_TopologyOps::insertCohesiveCells(pylith::topology::Mesh* mesh,
+                                                  const pylith::topology::Mesh& faultMesh,
+                                                  PetscDMLabel label,
+                                                  PetscDMLabel faultBdLabel,
+                                                  const int faultBdLabelValue,
+                                                  const int cohesiveLabelValue) {
+    assert(mesh);
+    PetscDM sdm = NULL;
+    PetscDM dm = mesh->getDM();assert(dm);
+    PetscDMLabel mlabel = NULL;
+    PetscInt cMax, cStart, cEnd, numCohesiveCellsOld;
+    PetscErrorCode err;
+
+    // Have to remember the old number of cohesive cells
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    cMax = cStart;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell, ++cMax) {
+        if (pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
+    } // for
+    numCohesiveCellsOld = cEnd - cMax;
+    // Completes the set of cells scheduled to be replaced
+    err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, faultMesh.getDM());PYLITH_CHECK_ERROR(err);
+    err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+    TopologyOps::completePointSF(sdm);
+
+    const char* interfaceLabelName = pylith::topology::Mesh::cells_label_name;
+    err = DMGetLabel(sdm, interfaceLabelName, &mlabel);PYLITH_CHECK_ERROR(err);
+    if (mlabel) {
+        err = DMPlexGetHeightStratum(sdm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+        cMax = cStart;
+        for (PetscInt cell = cStart; cell < cEnd; ++cell, ++cMax) {
+            if (pylith::topology::MeshOps::isCohesiveCell(sdm, cell)) { break; }
+        }
+        assert(cStart == cEnd || cEnd > cMax + numCohesiveCellsOld);
+        for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
+            PetscInt onBd;
+
+            /* Eliminate hybrid cells on the boundary of the split from cohesive label,
+             * they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
+            err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
+            // if (onBd == dim) continue;
+            err = DMLabelSetValue(mlabel, cell, cohesiveLabelValue);PYLITH_CHECK_ERROR(err);
+        }
+    }
+
+    PetscReal lengthScale = 1.0;
+    err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+    err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+    err = DMViewFromOptions(sdm, NULL, "-pylith_cohesive_dm_view");PYLITH_CHECK_ERROR(err);
+    mesh->setDM(sdm);
+} // insertCohesiveCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Get points in stratum of label.
+void
+pylith::faults::_TopologyOps::addStratumPoints(TopologyOps::PointSet* points,
+                                               PetscDM dm,
+                                               const char* labelName,
+                                               const int labelValue) {
+    assert(points);
+
+    PetscErrorCode err;
+    PetscDMLabel label = NULL;
+    err = DMGetLabel(dm, labelName, &label);PYLITH_CHECK_ERROR(err);
+    if (!label) { return; }
+
+    PetscIS pointIS = NULL;
+    err = DMLabelGetStratumIS(label, labelValue, &pointIS);PYLITH_CHECK_ERROR(err);
+    if (!pointIS) { return; }
+    PetscInt numPoints = 0;
+    const PetscInt* pointsArray = NULL;
+    err = ISGetLocalSize(pointIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointIS, &pointsArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numPoints; ++i) {
+        points->insert(pointsArray[i]);
+    } // for
+    err = ISRestoreIndices(pointIS, &pointsArray);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+} // addStratumPoints
+
+
 // End of file
@@ -29,6 +29,7 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include <set> // USES std::set
+#include <vector> // USES std::vector
 
 // TopologyOps ----------------------------------------------------------
 /// Helper object for creation of cohesive cells.
@@ -67,6 +68,62 @@ public:
                 const int faultBdLabelValue,
                 const int cohesiveLabelValue);
 
+    /** Create cohesive cells for multiple faults in a single pass.
+     *
+     * The fault surfaces are merged into a single fault mesh, so the faults cannot share any cells
+     * (see getFaultCells()). The cohesive cells of each fault are assigned the cohesive label
+     * value of the fault.
+     *
+     * @param[inout] mesh Finite-element mesh.
+     * @param[out] faultMesh Finite-element mesh of all of the fault surfaces.
+     * @param[in] faults Array of faults.
+     */
+    static
+    void createMultiple(topology::Mesh* mesh,
+                        topology::Mesh* faultMesh,
+                        const std::vector<FaultCohesive*>& faults);
+
+    /** Get cells with a vertex on the fault surface.
+     *
+     * @param[inout] cells Set of cells.
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] surfaceLabelName Name of label for points on fault surface.
+     * @param[in] surfaceLabelValue Value of label for points on fault surface.
+     */
+    static
+    void getFaultCells(PointSet* cells,
+                       const topology::Mesh& mesh,
+                       const char* surfaceLabelName,
+                       const int surfaceLabelValue);
+
+    /** Get cohesive cells and the cells adjacent to them.
+     *
+     * @param[inout] cells Set of cells.
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] cohesiveLabelName Name of label for cohesive cells.
+     * @param[in] cohesiveLabelValue Value of label for cohesive cells.
+     */
+    static
+    void getSplitCells(PointSet* cells,
+                       const topology::Mesh& mesh,
+                       const char* cohesiveLabelName,
+                       const int cohesiveLabelValue);
+
+    /** Complete the point SF of a distributed mesh after inserting cohesive cells.
+     *
+     * Each process splits its local fault points, so the split copy of a shared fault point and
+     * the tensor product (cohesive) point over it exist on every process sharing the point. We add
+     * the missing leaves so these new points are owned by the owner of the original point.
+     *
+     * Throws std::runtime_error on all processes if a shared fault point is split on some of the
+     * processes sharing it but not on the others, or if a process splits a fault point without
+     * having any of the fault faces containing it.
+     *
+     * @param[inout] dm PETSc DM for mesh with cohesive cells.
+     */
+    static
+    void completePointSF(PetscDM dm);
+
     /** Create (distributed) fault mesh from cohesive cells.
      *
      * @param faultMesh Finite-element mesh of fault (output).
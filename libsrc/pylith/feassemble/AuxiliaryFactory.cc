@@ -23,12 +23,19 @@
 #include "pylith/topology/Field.hh" // HOLDSA AuxiliaryField
 #include "pylith/topology/FieldQuery.hh" // USES FieldQuery
 
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/array.hh" // USES real_array
+
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
 #include <cassert>
+#include <cmath> // USES fabs()
+#include <limits> // USES std::numeric_limits
+#include <algorithm> // USES std::min(), std::max()
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
@@ -76,11 +83,43 @@ pylith::feassemble::AuxiliaryFactory::initialize(pylith::topology::Field* field,
 
     FieldFactory::initialize(field, normalizer, spaceDim, defaultDescription);
     delete _fieldQuery;_fieldQuery = new pylith::topology::FieldQuery(*field);
+    _subfieldQueryDBs.clear();
 
     PYLITH_METHOD_END;
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use basis order 0 for read-only subfields that are uniform.
+void
+pylith::feassemble::AuxiliaryFactory::compactUniformSubfields(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("compactUniformSubfields()");
+
+    assert(_field);
+    for (std::map<std::string, spatialdata::spatialdb::SpatialDB*>::const_iterator iter = _subfieldQueryDBs.begin(); iter != _subfieldQueryDBs.end(); ++iter) {
+        const char* subfieldName = iter->first.c_str();
+        const spatialdata::spatialdb::SpatialDB* db = iter->second ? iter->second : _queryDB;
+        if (!dynamic_cast<const spatialdata::spatialdb::UniformDB*>(db) || !_field->hasSubfield(subfieldName)) {
+            continue;
+        } // if
+
+        const pylith::topology::Field::SubfieldInfo& info = _field->getSubfieldInfo(subfieldName);
+        if (info.description.hasHistory || (0 == info.fe.basisOrder)) {
+            continue;
+        } // if
+
+        pylith::topology::Field::Discretization discretization = info.fe;
+        discretization.basisOrder = 0;
+        _field->subfieldUpdateDiscretization(subfieldName, discretization);
+        PYLITH_JOURNAL_INFO("Using basis order 0 for uniform auxiliary subfield '" << subfieldName << "' in '"
+                                                                                  << _field->getLabel() << "'.");
+    } // for
+
+    PYLITH_METHOD_END;
+} // compactUniformSubfields
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize subfields.
 void
@@ -99,6 +138,7 @@ pylith::feassemble::AuxiliaryFactory::setValuesFromDB(void) {
         PYLITH_JOURNAL_ERROR("Unknown case for filling auxiliary subfields.");
         throw std::logic_error("Unknown case for filling auxiliary subfields.");
     } // if/else
+    _reportUniformSubfields();
 
     delete _fieldQuery;_fieldQuery = NULL;
     _field = NULL;
@@ -122,9 +162,83 @@ pylith::feassemble::AuxiliaryFactory::setSubfieldQuery(const char* subfieldName,
 
     assert(_fieldQuery);
     _fieldQuery->setQuery(subfieldName, namesDBValues, numDBValues, convertFn, db);
+    _subfieldQueryDBs[subfieldName] = db;
 
     PYLITH_METHOD_END;
 } // _setSubfieldQueryFn
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Report read-only subfields filled from a spatial database with uniform values that use a basis order greater than 0.
+void
+pylith::feassemble::AuxiliaryFactory::_reportUniformSubfields(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_reportUniformSubfields()");
+
+    pythia::journal::info_t info(GenericComponent::getName());
+    if (!info.state()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_field);
+    PetscErrorCode err = 0;
+    PetscSection auxiliarySection = _field->getLocalSection();assert(auxiliarySection);
+    PetscVec auxiliaryVec = _field->getLocalVector();assert(auxiliaryVec);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(auxiliarySection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* auxiliaryArray = NULL;
+    err = VecGetArrayRead(auxiliaryVec, &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+
+    const pylith::string_vector& subfieldNames = _field->getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+        // Only subfields filled from a spatial database; derived subfields are not set yet.
+        if (_subfieldQueryDBs.find(subfieldNames[iSubfield]) == _subfieldQueryDBs.end()) {
+            continue;
+        } // if
+        const pylith::topology::Field::SubfieldInfo& subfieldInfo = _field->getSubfieldInfo(subfieldNames[iSubfield].c_str());
+        if (subfieldInfo.description.hasHistory || (0 == subfieldInfo.fe.basisOrder)) {
+            continue;
+        } // if
+
+        // Compute range of values for each component over all points and processes.
+        const size_t numComponents = subfieldInfo.description.numComponents;
+        pylith::real_array minLocal(std::numeric_limits<PylithReal>::max(), numComponents);
+        pylith::real_array maxLocal(-std::numeric_limits<PylithReal>::max(), numComponents);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0, off = 0;
+            err = PetscSectionGetFieldDof(auxiliarySection, point, subfieldInfo.index, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(auxiliarySection, point, subfieldInfo.index, &off);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                const size_t iComponent = iDof % numComponents;
+                minLocal[iComponent] = std::min(minLocal[iComponent], PylithReal(auxiliaryArray[off+iDof]));
+                maxLocal[iComponent] = std::max(maxLocal[iComponent], PylithReal(auxiliaryArray[off+iDof]));
+            } // for
+        } // for
+        pylith::real_array minGlobal(numComponents);
+        pylith::real_array maxGlobal(numComponents);
+        MPI_Comm comm = _field->getMesh().getComm();
+        err = MPI_Allreduce(&minLocal[0], &minGlobal[0], numComponents, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Allreduce(&maxLocal[0], &maxGlobal[0], numComponents, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+
+        const PylithReal tolerance = 1.0e-12;
+        bool isUniform = true;
+        for (size_t iComponent = 0; iComponent < numComponents; ++iComponent) {
+            const PylithReal scale = std::max(fabs(minGlobal[iComponent]), fabs(maxGlobal[iComponent]));
+            isUniform = isUniform && (maxGlobal[iComponent] - minGlobal[iComponent] <= tolerance*scale);
+        } // for
+        if (isUniform) {
+            PYLITH_JOURNAL_INFO_ROOT("Auxiliary subfield '" << subfieldNames[iSubfield] << "' in '" << _field->getLabel()
+                                                           << "' is uniform; use basis order 0 to reduce memory use.");
+        } // if
+    } // for
+
+    err = VecRestoreArrayRead(auxiliaryVec, &auxiliaryArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _reportUniformSubfields
+
+
 // End of file
@@ -31,6 +31,9 @@
 #include "pylith/topology/FieldQuery.hh" // USES FieldQuery::queryfn_type
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+
+#include <map> // HASA std::map
+#include <string> // USES std::string
 #include "spatialdata/units/unitsfwd.hh" // HOLDSA Normalizer
 
 class pylith::feassemble::AuxiliaryFactory : public pylith::topology::FieldFactory {
@@ -69,6 +72,14 @@ public:
                     const int spaceDim,
                     const pylith::topology::FieldBase::Description* defaultDescription=NULL);
 
+    /** Use basis order 0 for read-only subfields that are uniform.
+     *
+     * Subfields without history (material properties) queried from a UniformDB are uniform over the
+     * domain of the auxiliary field, so a single value per cell represents them exactly. Must be called
+     * after adding the subfields and before Field::subfieldsSetup().
+     */
+    void compactUniformSubfields(void);
+
     /// Set subfield values using spatial database.
     void setValuesFromDB(void);
 
@@ -86,6 +97,12 @@ public:
                           pylith::topology::FieldQuery::convertfn_type convertFn=NULL,
                           spatialdata::spatialdb::SpatialDB* db=NULL);
 
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Report read-only subfields filled from a spatial database with uniform values that use a basis order greater than 0.
+    void _reportUniformSubfields(void);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -99,6 +116,9 @@ protected:
     /// Field query for filling subfield values via spatial database.
     pylith::topology::FieldQuery* _fieldQuery;
 
+    /// Spatial database used to fill each subfield (NULL if using default database).
+    std::map<std::string, spatialdata::spatialdb::SpatialDB*> _subfieldQueryDBs;
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
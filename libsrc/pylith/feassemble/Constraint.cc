@@ -42,7 +42,15 @@ pylith::feassemble::Constraint::Constraint(pylith::problems::Physics* const phys
     _subfieldName(""),
     _labelName(""),
     _labelValue(1),
-    _boundaryMesh(NULL) {}
+    _boundaryMesh(NULL),
+    _eventSetState(0),
+    _eventSetSolution(0),
+    _eventObservers(0) {
+    _initializeLogger("Constraint");
+    _eventSetState = _registerEvent("SetState");
+    _eventSetSolution = _registerEvent("SetSolution");
+    _eventObservers = _registerEvent("Observers");
+} // constructor
 
 
 // ------------------------------------------------------------------------------------------------
@@ -200,8 +208,11 @@ pylith::feassemble::Constraint::poststep(const PylithReal t,
                                          const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("poststep(t="<<t<<", dt="<<dt<<")");
+    assert(_logger);
 
+    _logger->eventBegin(_eventObservers);
     notifyObservers(t, tindex, solution);
+    _logger->eventEnd(_eventObservers);
 
     PYLITH_METHOD_END;
 } // poststep
@@ -156,6 +156,11 @@ protected:
     pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh.
     PylithReal _tSolution; ///< Time used for current solution.
 
+    /// Identifiers for logging events.
+    int _eventSetState;
+    int _eventSetSolution;
+    int _eventObservers;
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
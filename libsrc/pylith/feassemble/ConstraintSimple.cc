@@ -144,6 +144,8 @@ pylith::feassemble::ConstraintSimple::setSolution(pylith::feassemble::Integratio
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setSolution(integrationData="<<integrationData->str()<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetSolution);
 
     const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
     assert(solution);
@@ -172,6 +174,8 @@ pylith::feassemble::ConstraintSimple::setSolution(pylith::feassemble::Integratio
         solution->view("solution field");
     } // if
 
+    _logger->eventEnd(_eventSetSolution);
+
     PYLITH_METHOD_END;
 } // setSolution
 
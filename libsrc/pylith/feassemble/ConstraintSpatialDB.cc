@@ -100,6 +100,8 @@ void
 pylith::feassemble::ConstraintSpatialDB::setState(const double t) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetState);
 
     assert(_physics);
     _physics->updateAuxiliaryField(_auxiliaryField, t);
@@ -113,6 +115,8 @@ pylith::feassemble::ConstraintSpatialDB::setState(const double t) {
         _auxiliaryField->view("Constraint auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
 
+    _logger->eventEnd(_eventSetState);
+
     PYLITH_METHOD_END;
 } // setState
 
@@ -124,6 +128,8 @@ pylith::feassemble::ConstraintSpatialDB::setSolution(pylith::feassemble::Integra
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetSolution);
 
     assert(_auxiliaryField);
     assert(_physics);
@@ -162,6 +168,8 @@ pylith::feassemble::ConstraintSpatialDB::setSolution(pylith::feassemble::Integra
         solution->view("Solution field after setting constrained values", pylith::topology::Field::VIEW_ALL);
     } // if
 
+    _logger->eventEnd(_eventSetSolution);
+
     PYLITH_METHOD_END;
 } // setSolution
 
@@ -118,6 +118,8 @@ pylith::feassemble::ConstraintUserFn::setSolution(pylith::feassemble::Integratio
     assert(integrationData);
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setSolution(integrationData="<<integrationData->str()<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetSolution);
 
     const pylith::topology::Field* solution = integrationData->getField(pylith::feassemble::IntegrationData::solution);
     assert(solution);
@@ -131,6 +133,8 @@ pylith::feassemble::ConstraintUserFn::setSolution(pylith::feassemble::Integratio
         _ConstraintUserFn::setSolution(solutionDot, t, _fnDot, *this);
     } // if
 
+    _logger->eventEnd(_eventSetSolution);
+
     PYLITH_METHOD_END;
 } // setSolution
 
@@ -34,6 +34,7 @@ const std::string pylith::feassemble::IntegrationData::time = "t";
 const std::string pylith::feassemble::IntegrationData::time_step = "dt";
 const std::string pylith::feassemble::IntegrationData::s_tshift = "s_tshift";
 const std::string pylith::feassemble::IntegrationData::t_state = "t_state";
+const std::string pylith::feassemble::IntegrationData::dt_state = "dt_state";
 const std::string pylith::feassemble::IntegrationData::dt_residual = "dt_residual";
 const std::string pylith::feassemble::IntegrationData::dt_jacobian = "dt_jacobian";
 const std::string pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse = "dt_lumped_jacobian_inverse";
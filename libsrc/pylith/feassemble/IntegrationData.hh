@@ -43,6 +43,7 @@ public:
     static const std::string time_step;
     static const std::string s_tshift;
     static const std::string t_state;
+    static const std::string dt_state;
     static const std::string dt_residual;
     static const std::string dt_jacobian;
     static const std::string dt_lumped_jacobian_inverse;
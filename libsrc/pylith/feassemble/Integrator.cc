@@ -46,9 +46,30 @@ pylith::feassemble::Integrator::Integrator(pylith::problems::Physics* const phys
     _hasRHSResidual(false),
     _hasLHSResidual(false),
     _hasLHSJacobian(false),
+    _hasLHSJacobianPrecond(false),
     _hasLHSJacobianLumped(false),
     _needNewLHSJacobian(true),
-    _needNewLHSJacobianLumped(true) {}
+    _needNewLHSJacobianLumped(true),
+    _eventSetState(0),
+    _eventRHSResidual(0),
+    _eventLHSResidual(0),
+    _eventLHSJacobian(0),
+    _eventLHSJacobianLumpedInv(0),
+    _eventUpdateStateVars(0),
+    _eventSetTimeStep(0),
+    _eventDerivedField(0),
+    _eventObservers(0) {
+    _initializeLogger("Integrator");
+    _eventSetState = _registerEvent("SetState");
+    _eventRHSResidual = _registerEvent("RHSResidual");
+    _eventLHSResidual = _registerEvent("LHSResidual");
+    _eventLHSJacobian = _registerEvent("LHSJacobian");
+    _eventLHSJacobianLumpedInv = _registerEvent("LHSJacobianLumpedInv");
+    _eventUpdateStateVars = _registerEvent("UpdateStateVars");
+    _eventSetTimeStep = _registerEvent("SetTimeStep");
+    _eventDerivedField = _registerEvent("DerivedField");
+    _eventObservers = _registerEvent("Observers");
+} // constructor
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -97,6 +118,22 @@ pylith::feassemble::Integrator::getLabelValue(void) const {
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Does integrator contribute to the LHS Jacobian?
+bool
+pylith::feassemble::Integrator::hasLHSJacobian(void) const {
+    return _hasLHSJacobian;
+} // hasLHSJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Does integrator have separate kernels for the LHS Jacobian preconditioner?
+bool
+pylith::feassemble::Integrator::hasLHSJacobianPrecond(void) const {
+    return _hasLHSJacobianPrecond;
+} // hasLHSJacobianPrecond
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check whether LHS Jacobian needs to be recomputed.
 bool
@@ -174,6 +211,19 @@ pylith::feassemble::Integrator::setState(const PylithReal t) {
 } // setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Update auxiliary field values that depend on the time step.
+void
+pylith::feassemble::Integrator::setTimeStep(const PylithReal t,
+                                            const PylithReal dt,
+                                            const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setTimeStep(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<") empty method");
+
+    PYLITH_METHOD_END;
+} // setTimeStep
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Update auxiliary fields at end of time step.
 void
@@ -183,11 +233,19 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
                                          const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("poststep(t="<<t<<", dt="<<dt<<")");
+    assert(_logger);
 
+    _logger->eventBegin(_eventUpdateStateVars);
     _updateStateVars(t, dt, solution);
+    _logger->eventEnd(_eventUpdateStateVars);
 
+    _logger->eventBegin(_eventDerivedField);
     _computeDerivedField(t, dt, solution);
+    _logger->eventEnd(_eventDerivedField);
+
+    _logger->eventBegin(_eventObservers);
     notifyObservers(t, tindex, solution);
+    _logger->eventEnd(_eventObservers);
 
     PYLITH_METHOD_END;
 } // poststep
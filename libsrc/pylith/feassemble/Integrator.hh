@@ -89,6 +89,18 @@ public:
      */
     int getLabelValue(void) const;
 
+    /** Does integrator contribute to the LHS Jacobian?
+     *
+     * @returns True if integrator has LHS Jacobian kernels, false otherwise.
+     */
+    bool hasLHSJacobian(void) const;
+
+    /** Does integrator have separate kernels for the LHS Jacobian preconditioner?
+     *
+     * @returns True if integrator has LHS Jacobian preconditioner kernels, false otherwise.
+     */
+    bool hasLHSJacobianPrecond(void) const;
+
     /** Check whether LHS Jacobian needs to be recomputed.
      *
      * @param[in] dtChanged True if time step has changed since previous Jacobian computation.
@@ -142,6 +154,19 @@ public:
     virtual
     void setState(const PylithReal t);
 
+    /** Update auxiliary field values that depend on the time step.
+     *
+     * Called when the time step changes.
+     *
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solution Solution field.
+     */
+    virtual
+    void setTimeStep(const PylithReal t,
+                     const PylithReal dt,
+                     const pylith::topology::Field& solution);
+
     /** Compute RHS residual for G(t,s).
      *
      * @param[out] residual Field for residual.
@@ -227,6 +252,7 @@ protected:
     bool _hasRHSResidual;
     bool _hasLHSResidual;
     bool _hasLHSJacobian;
+    bool _hasLHSJacobianPrecond;
     bool _hasLHSJacobianLumped;
 
     /// True if we need to recompute Jacobian for operator, false otherwise.
@@ -234,6 +260,17 @@ protected:
     bool _needNewLHSJacobian;
     bool _needNewLHSJacobianLumped;
 
+    /// Identifiers for logging events.
+    int _eventSetState;
+    int _eventRHSResidual;
+    int _eventLHSResidual;
+    int _eventLHSJacobian;
+    int _eventLHSJacobianLumpedInv;
+    int _eventUpdateStateVars;
+    int _eventSetTimeStep;
+    int _eventDerivedField;
+    int _eventObservers;
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -29,6 +29,7 @@
 
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include "petscds.h" // USES PetscDS
@@ -191,6 +192,8 @@ void
 pylith::feassemble::IntegratorBoundary::setState(const double t) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetState);
 
     Integrator::setState(t);
 
@@ -206,6 +209,8 @@ pylith::feassemble::IntegratorBoundary::setState(const double t) {
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
 
+    _logger->eventEnd(_eventSetState);
+
     PYLITH_METHOD_END;
 } // setState
 
@@ -218,6 +223,8 @@ pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Fie
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventRHSResidual);
     assert(residual);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
@@ -241,6 +248,8 @@ pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Fie
     err = DMPlexComputeBdResidualSingle(dsLabel.dm(), t, dsLabel.weakForm(), key, solution->getLocalVector(), solutionDotVec,
                                         residual->getLocalVector());PYLITH_CHECK_ERROR(err);
 
+    _logger->eventEnd(_eventRHSResidual);
+
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
@@ -253,6 +262,8 @@ pylith::feassemble::IntegratorBoundary::computeLHSResidual(pylith::topology::Fie
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventLHSResidual);
     assert(residual);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
@@ -277,6 +288,8 @@ pylith::feassemble::IntegratorBoundary::computeLHSResidual(pylith::topology::Fie
     err = DMPlexComputeBdResidualSingle(dsLabel.dm(), t, dsLabel.weakForm(), key, solution->getLocalVector(),
                                         solutionDot->getLocalVector(), residual->getLocalVector());PYLITH_CHECK_ERROR(err);
 
+    _logger->eventEnd(_eventLHSResidual);
+
     PYLITH_METHOD_END;
 } // computeLHSResidual
 
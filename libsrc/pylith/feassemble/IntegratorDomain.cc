@@ -34,6 +34,7 @@
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 #include "petscds.h" // USES PetscDS
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include <cassert> // USES assert()
@@ -96,6 +97,7 @@ pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics
     Integrator(physics),
     _materialMesh(NULL),
     _updateState(NULL),
+    _updateTimeStepVars(NULL),
     _jacobianValues(NULL),
     _dsLabel(NULL) {
     GenericComponent::setName("integratordomain");
@@ -119,6 +121,7 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
 
     delete _materialMesh;_materialMesh = NULL;
     delete _updateState;_updateState = NULL;
+    delete _updateTimeStepVars;_updateTimeStepVars = NULL;
     delete _jacobianValues;_jacobianValues = NULL;
     delete _dsLabel;_dsLabel = NULL;
 
@@ -212,6 +215,34 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
 } // setKernelsJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+void
+pylith::feassemble::IntegratorDomain::setKernelsJacobianPrecond(const std::vector<JacobianKernels>& kernels,
+                                                                const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsJacobianPrecond(# kernels="<<kernels.size()<<")");
+
+    PetscErrorCode err;
+    DSLabelAccess dsLabel(solution.getDM(), _labelName.c_str(), _labelValue);
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_fieldTrial = solution.getSubfieldInfo(kernels[i].subfieldTrial.c_str()).index;
+        const PetscInt i_fieldBasis = solution.getSubfieldInfo(kernels[i].subfieldBasis.c_str()).index;
+        const PetscInt i_part = kernels[i].part;
+        if (LHS != kernels[i].part) {
+            PYLITH_JOURNAL_LOGICERROR("Unknown Jacobian preconditioner part " << kernels[i].part <<".");
+        } // if
+        if (dsLabel.weakForm()) {
+            err = PetscWeakFormAddJacobianPreconditioner(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_fieldTrial,
+                                                         i_fieldBasis, i_part, kernels[i].j0, kernels[i].j1, kernels[i].j2,
+                                                         kernels[i].j3);PYLITH_CHECK_ERROR(err);
+        } // if
+        _hasLHSJacobianPrecond = true;
+    } // for
+
+    PYLITH_METHOD_END;
+} // setKernelsJacobianPrecond
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for Jacobian without finite-element integration.
 void
@@ -235,6 +266,18 @@ pylith::feassemble::IntegratorDomain::setKernelsUpdateStateVars(const std::vecto
 } // setKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+void
+pylith::feassemble::IntegratorDomain::setKernelsUpdateTimeStepVars(const std::vector<ProjectKernels>& kernels) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsUpdateTimeStepVars(# kernels="<<kernels.size()<<")");
+
+    _kernelsUpdateTimeStepVars = kernels;
+
+    PYLITH_METHOD_END;
+} // setKernelsUpdateTimeStepVars
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorDomain::setKernelsDerivedField(const std::vector<ProjectKernels>& kernels) {
@@ -274,6 +317,16 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
         _updateState->initialize(*_auxiliaryField);
     } // if
 
+    if (_kernelsUpdateTimeStepVars.size() > 0) {
+        const size_t numKernels = _kernelsUpdateTimeStepVars.size();
+        pylith::string_vector subfieldNames(numKernels);
+        for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
+            subfieldNames[iKernel] = _kernelsUpdateTimeStepVars[iKernel].subfield;
+        } // for
+        delete _updateTimeStepVars;_updateTimeStepVars = new pylith::feassemble::UpdateStateVars;assert(_updateTimeStepVars);
+        _updateTimeStepVars->initialize(*_auxiliaryField, subfieldNames);
+    } // if
+
     delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
     _dsLabel->removeOverlap();
 
@@ -372,6 +425,8 @@ void
 pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG("setState(t="<<t<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetState);
 
     Integrator::setState(t);
 
@@ -387,10 +442,68 @@ pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
 
+    _logger->eventEnd(_eventSetState);
+
     PYLITH_METHOD_END;
 } // setState
 
 
+// ------------------------------------------------------------------------------------------------
+// Update auxiliary field values that depend on the time step.
+void
+pylith::feassemble::IntegratorDomain::setTimeStep(const PylithReal t,
+                                                  const PylithReal dt,
+                                                  const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setTimeStep(t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
+
+    if (0 == _kernelsUpdateTimeStepVars.size()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_logger);
+    _logger->eventBegin(_eventSetTimeStep);
+
+    assert(_updateTimeStepVars);
+    assert(_auxiliaryField);
+    _updateTimeStepVars->prepare(_auxiliaryField);
+    _setKernelConstants(solution, dt);
+
+    // We assume order of the kernels matches the order of the corresponding subfields in the
+    // auxiliary field.
+    const size_t numKernels = _kernelsUpdateTimeStepVars.size();
+    PetscPointFunc* kernelsArray = (numKernels > 0) ? new PetscPointFunc[numKernels] : NULL;
+    for (size_t iKernel = 0; iKernel < numKernels; ++iKernel) {
+        kernelsArray[iKernel] = _kernelsUpdateTimeStepVars[iKernel].f;
+    } // for
+
+    PetscErrorCode err = 0;
+    PetscDM timeStepVarsDM = _updateTimeStepVars->stateVarsDM();
+    PetscDMLabel dmLabel = NULL;
+    PetscInt labelValue = 0;
+    const PetscInt part = 0;
+    err = DMSetAuxiliaryVec(timeStepVarsDM, dmLabel, labelValue, part, _auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    err = DMProjectFieldLocal(timeStepVarsDM, t, solution.getLocalVector(), kernelsArray, INSERT_VALUES,
+                              _updateTimeStepVars->stateVarsLocalVector());PYLITH_CHECK_ERROR(err);
+    _updateTimeStepVars->restore(_auxiliaryField);
+
+    delete[] kernelsArray;kernelsArray = NULL;
+
+    _logger->eventEnd(_eventSetTimeStep);
+
+    PYLITH_METHOD_END;
+} // setTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cells over which integration is performed.
+PetscIS
+pylith::feassemble::IntegratorDomain::getCellsIS(void) const {
+    assert(_dsLabel);
+    return _dsLabel->cellsIS();
+} // getCellsIS
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute RHS residual for G(t,s).
 void
@@ -398,7 +511,25 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
                                                          const pylith::feassemble::IntegrationData& integrationData) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+
+    assert(_dsLabel);
+    computeRHSResidual(residual, integrationData, _dsLabel->cellsIS());
+
+    PYLITH_METHOD_END;
+} // computeRHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) over a subset of the cells.
+void
+pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field* residual,
+                                                         const pylith::feassemble::IntegrationData& integrationData,
+                                                         const PetscIS cellsIS) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<", cellsIS="<<cellsIS<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventRHSResidual);
     assert(residual);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
@@ -418,9 +549,11 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
     assert(solution->getLocalVector());
     assert(residual->getLocalVector());
     PetscVec solutionDotVec = NULL;
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
+    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, cellsIS, PETSC_MIN_REAL, solution->getLocalVector(),
                                          solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
 
+    _logger->eventEnd(_eventRHSResidual);
+
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
@@ -433,6 +566,8 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END; }
+    assert(_logger);
+    _logger->eventBegin(_eventLHSResidual);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
     assert(solution);
@@ -456,6 +591,8 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
                                          solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
 
+    _logger->eventEnd(_eventLHSResidual);
+
     PYLITH_METHOD_END;
 } // computeLHSResidual
 
@@ -471,6 +608,8 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
 
     _needNewLHSJacobian = false;
     if (!_hasLHSJacobian) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventLHSJacobian);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
     assert(solution);
@@ -506,6 +645,8 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
         } // if
     } // if
 
+    _logger->eventEnd(_eventLHSJacobian);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
@@ -520,6 +661,8 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
 
     _needNewLHSJacobianLumped = false;
     if (!_hasLHSJacobianLumped) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventLHSJacobianLumpedInv);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
     assert(solution);
@@ -549,6 +692,8 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
     // Compute the Jacobian inverse.
     err = VecReciprocal(jacobianInv->getLocalVector());PYLITH_CHECK_ERROR(err);
 
+    _logger->eventEnd(_eventLHSJacobianLumpedInv);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobianLumpedInv
 
@@ -154,6 +154,17 @@ public:
     void setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
                             const pylith::topology::Field& solution);
 
+    /** Set kernels for LHS Jacobian preconditioner.
+     *
+     * The preconditioner is assembled into a separate matrix, so the kernels must include all blocks
+     * of the Jacobian, not just the blocks that differ from the Jacobian.
+     *
+     * @param[in] kernels Array of kernels for computing the Jacobian preconditioner.
+     * @param[in] solution Solution field.
+     */
+    void setKernelsJacobianPrecond(const std::vector<JacobianKernels>& kernels,
+                                   const pylith::topology::Field& solution);
+
     /** Set kernels for Jacobian without finite-element integration.
      *
      * @param[in] kernelsJacobian Array of kernels for computing the Jacobian values without integration.
@@ -169,6 +180,12 @@ public:
      */
     void setKernelsUpdateStateVars(const std::vector<ProjectKernels>& kernels);
 
+    /** Set kernels for updating auxiliary subfields that depend on the time step.
+     *
+     * @param kernels Array of kernels for updating time step dependent subfields.
+     */
+    void setKernelsUpdateTimeStepVars(const std::vector<ProjectKernels>& kernels);
+
     /** Set kernels for computing derived field.
      *
      * @param kernels Array of kernels for computing derived field.
@@ -195,6 +212,22 @@ public:
      */
     void setState(const PylithReal t);
 
+    /** Update auxiliary field values that depend on the time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solution Solution field.
+     */
+    void setTimeStep(const PylithReal t,
+                     const PylithReal dt,
+                     const pylith::topology::Field& solution);
+
+    /** Get cells over which integration is performed.
+     *
+     * @returns PETSc IS with cells.
+     */
+    PetscIS getCellsIS(void) const;
+
     /** Compute RHS residual for G(t,s).
      *
      * @param[out] residual Field for residual.
@@ -203,6 +236,19 @@ public:
     void computeRHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Compute RHS residual for G(t,s) over a subset of the cells.
+     *
+     * Used with local time stepping to integrate only the cells adjacent to the degrees of freedom
+     * in a rate class.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cellsIS Cells over which to integrate (must be a subset of getCellsIS()).
+     */
+    void computeRHSResidual(pylith::topology::Field* residual,
+                            const pylith::feassemble::IntegrationData& integrationData,
+                            const PetscIS cellsIS);
+
     /** Compute LHS residual for F(t,s,\dot{s}).
      *
      * @param[out] residual Field for residual.
@@ -256,11 +302,13 @@ protected:
 private:
 
     std::vector<ProjectKernels> _kernelsUpdateStateVars; ///< kernels for updating state variables.
+    std::vector<ProjectKernels> _kernelsUpdateTimeStepVars; ///< kernels for updating time step dependent subfields.
     std::vector<ProjectKernels> _kernelsDerivedField; ///< kernels for computing derived field.
 
     pylith::topology::Mesh* _materialMesh; ///< Mesh associated with material.
 
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
+    pylith::feassemble::UpdateStateVars* _updateTimeStepVars; ///< Layout needed to update time step dependent subfields.
     pylith::feassemble::JacobianValues* _jacobianValues; ///< Jacobian values without finite-element integration.
     pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc).
 
@@ -34,6 +34,7 @@
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 #include "petscds.h" // USES PetscDS
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include <cassert> // USES assert()
@@ -475,6 +476,8 @@ void
 pylith::feassemble::IntegratorInterface::setState(const double t) {
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setState(t="<<t<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventSetState);
 
     Integrator::setState(t);
 
@@ -490,6 +493,8 @@ pylith::feassemble::IntegratorInterface::setState(const double t) {
         _auxiliaryField->view("IntegratorInterface auxiliary field", pylith::topology::Field::VIEW_ALL);
     } // if
 
+    _logger->eventEnd(_eventSetState);
+
     PYLITH_METHOD_END;
 } // setState
 
@@ -502,9 +507,13 @@ pylith::feassemble::IntegratorInterface::computeRHSResidual(pylith::topology::Fi
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasRHSResidual) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventRHSResidual);
 
     _IntegratorInterface::computeResidual(residual, this, pylith::feassemble::Integrator::RHS, integrationData);
 
+    _logger->eventEnd(_eventRHSResidual);
+
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
@@ -517,6 +526,8 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
     PYLITH_METHOD_BEGIN;
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
     if (!_hasLHSResidual) { PYLITH_METHOD_END;}
+    assert(_logger);
+    _logger->eventBegin(_eventLHSResidual);
 
     if (_hasLHSResidual) {
         const pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
@@ -552,6 +563,8 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
         _IntegratorInterface::computeResidual(residual, this, equationPart, integrationData);
     } // if
 
+    _logger->eventEnd(_eventLHSResidual);
+
     PYLITH_METHOD_END;
 } // computeLHSResidual
 
@@ -566,6 +579,8 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobian(PetscMat jacobianMat
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", integrationData="<<integrationData.str()<<")");
 
     _needNewLHSJacobian = false;
+    assert(_logger);
+    _logger->eventBegin(_eventLHSJacobian);
 
     if (_hasLHSJacobian) {
         pylith::feassemble::Integrator::EquationPart equationPart = pylith::feassemble::Integrator::LHS;
@@ -577,6 +592,8 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobian(PetscMat jacobianMat
         _IntegratorInterface::computeJacobian(jacobianMat, precondMat, this, equationPart, integrationData);
     } // if
 
+    _logger->eventEnd(_eventLHSJacobian);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
@@ -596,6 +613,62 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobianLumpedInv(pylith::top
 } // computeLHSJacobianLumpedInv
 
 
+// ------------------------------------------------------------------------------------------------
+// Mark degrees of freedom of solution subfield on the negative and positive sides of the interface.
+void
+pylith::feassemble::IntegratorInterface::markSideDOF(PetscVec markLocalVec,
+                                                     const pylith::topology::Field& solution,
+                                                     const char* subfieldName) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" markSideDOF(markLocalVec="<<markLocalVec<<", solution="<<solution.getLabel()<<", subfieldName="<<subfieldName<<")");
+
+    assert(markLocalVec);
+    assert(subfieldName);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    PetscSection solnSection = solution.getLocalSection();assert(solnSection);
+    const PetscInt subfieldIndex = solution.getSubfieldInfo(subfieldName).index;
+
+    PetscIS cohesiveCellsIS = NULL;
+    PetscInt numCohesiveCells = 0;
+    const PetscInt* cohesiveCells = NULL;
+    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
+    if (cohesiveCellsIS) {
+        err = ISGetLocalSize(cohesiveCellsIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscScalar* markArray = NULL;
+    err = VecGetArray(markLocalVec, &markArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCohesive = 0; iCohesive < numCohesiveCells; ++iCohesive) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmSoln, cohesiveCells[iCohesive], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < 2*closureSize; iPoint += 2) {
+            // Only points on the negative and positive sides of the interface have DOF for
+            // subfields other than the Lagrange multiplier.
+            PetscInt numDof = 0, offset = 0;
+            err = PetscSectionGetFieldDof(solnSection, closure[iPoint], subfieldIndex, &numDof);PYLITH_CHECK_ERROR(err);
+            if (!numDof) { continue; }
+            err = PetscSectionGetFieldOffset(solnSection, closure[iPoint], subfieldIndex, &offset);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                markArray[offset+iDof] = 1.0;
+            } // for
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cohesiveCells[iCohesive], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArray(markLocalVec, &markArray);PYLITH_CHECK_ERROR(err);
+
+    if (cohesiveCellsIS) {
+        err = ISRestoreIndices(cohesiveCellsIS, &cohesiveCells);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = ISDestroy(&cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // markSideDOF
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute residual.
 void
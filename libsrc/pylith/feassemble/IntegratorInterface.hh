@@ -241,6 +241,18 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Mark degrees of freedom of solution subfield on the negative and positive sides of the interface.
+     *
+     * Values in the local vector for these degrees of freedom are set to 1.
+     *
+     * @param[inout] markLocalVec Local PETSc Vec with layout of solution.
+     * @param[in] solution Solution field.
+     * @param[in] subfieldName Name of solution subfield.
+     */
+    void markSideDOF(PetscVec markLocalVec,
+                     const pylith::topology::Field& solution,
+                     const char* subfieldName) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -114,4 +114,39 @@ pylith::feassemble::PhysicsImplementation::notifyObservers(const PylithReal t,
 } // _notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Get event logger.
+const pylith::utils::EventLogger*
+pylith::feassemble::PhysicsImplementation::getEventLogger(void) const {
+    return _logger;
+} // getEventLogger
+
+
+// ------------------------------------------------------------------------------------------------
+// Create event logger.
+void
+pylith::feassemble::PhysicsImplementation::_initializeLogger(const char* className) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _logger;_logger = new pylith::utils::EventLogger;assert(_logger);
+    _logger->setClassName(className);
+    _logger->initialize();
+
+    PYLITH_METHOD_END;
+} // _initializeLogger
+
+
+// ------------------------------------------------------------------------------------------------
+// Register logging event for a phase of the physics implementation.
+int
+pylith::feassemble::PhysicsImplementation::_registerEvent(const char* phase) {
+    PYLITH_METHOD_BEGIN;
+    assert(_logger);
+    assert(_physics);
+
+    const std::string name = std::string("Py-") + _physics->getIdentifier() + "-" + phase;
+    PYLITH_METHOD_RETURN(_logger->registerEvent(name.c_str()));
+} // _registerEvent
+
+
 // End of file
@@ -94,6 +94,33 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Get event logger.
+     *
+     * @returns Event logger (NULL if events have not been registered).
+     */
+    const pylith::utils::EventLogger* getEventLogger(void) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Create event logger.
+     *
+     * @param[in] className Name of logging class.
+     */
+    void _initializeLogger(const char* className);
+
+    /** Register logging event for a phase of the physics implementation.
+     *
+     * The event name includes the identifier of the physics, so each material, boundary condition,
+     * and fault has its own events in -log_view.
+     *
+     * @prerequisite Must call _initializeLogger() before _registerEvent().
+     *
+     * @param[in] phase Name of phase.
+     * @returns Event identifier.
+     */
+    int _registerEvent(const char* phase);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
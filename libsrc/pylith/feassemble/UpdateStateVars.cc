@@ -22,6 +22,7 @@
 
 #include "pylith/topology/Field.hh" // USES Field
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 
 #include <cassert> // USES assert()
@@ -30,10 +31,19 @@
 // Default constructor.
 pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
     _stateVarsIS(NULL),
+    _stateVarsLocalIS(NULL),
     _stateVarsDM(NULL),
     _stateVarsVecLocal(NULL),
     _stateVarsVecGlobal(NULL),
-    _auxiliaryFieldVecGlobal(NULL) {}
+    _logger(new pylith::utils::EventLogger),
+    _eventPrepare(0),
+    _eventRestore(0) {
+    assert(_logger);
+    _logger->setClassName("UpdateStateVars");
+    _logger->initialize();
+    _eventPrepare = _logger->registerEvent("Py-UpSV-prepare");
+    _eventRestore = _logger->registerEvent("Py-UpSV-restore");
+} // constructor
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -51,10 +61,11 @@ pylith::feassemble::UpdateStateVars::deallocate(void) {
 
     PetscErrorCode err = 0;
     err = ISDestroy(&_stateVarsIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_stateVarsLocalIS);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&_stateVarsDM);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = VecDestroy(&_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    delete _logger;_logger = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -82,29 +93,92 @@ void
 pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
-    PetscErrorCode err = 0;
-    PetscDM auxiliaryDM = auxiliaryField.getDM();
-
-    const pylith::string_vector& subfieldNames = auxiliaryField.getSubfieldNames();
-    const size_t numAuxiliarySubfields = subfieldNames.size();
-    pylith::int_array stateSubfieldIndices(numAuxiliarySubfields);
+    const pylith::string_vector& auxiliarySubfieldNames = auxiliaryField.getSubfieldNames();
+    const size_t numAuxiliarySubfields = auxiliarySubfieldNames.size();
 
-    size_t numStateSubfields = 0;
+    pylith::string_vector stateSubfieldNames;
     for (size_t iSubfield = 0; iSubfield < numAuxiliarySubfields; ++iSubfield) {
-        const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[iSubfield].c_str());
+        const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(auxiliarySubfieldNames[iSubfield].c_str());
         if (info.description.hasHistory) {
-            stateSubfieldIndices[numStateSubfields++] = info.index;
+            stateSubfieldNames.push_back(auxiliarySubfieldNames[iSubfield]);
         } // if
     } // for
+    initialize(auxiliaryField, stateSubfieldNames);
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize layout for updating a subset of the auxiliary subfields.
+void
+pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& auxiliaryField,
+                                                const pylith::string_vector& subfieldNames) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscDM auxiliaryDM = auxiliaryField.getDM();
+
+    const size_t numStateSubfields = subfieldNames.size();
+    pylith::int_array stateSubfieldIndices(numStateSubfields);
+    for (size_t iSubfield = 0; iSubfield < numStateSubfields; ++iSubfield) {
+        const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[iSubfield].c_str());
+        stateSubfieldIndices[iSubfield] = info.index;
+    } // for
     std::sort(&stateSubfieldIndices[0], &stateSubfieldIndices[numStateSubfields]);
 
     // Create subDM holding only the state vars, which we want to update.
     err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], &_stateVarsIS,
                         &_stateVarsDM);PYLITH_CHECK_ERROR(err);
-    err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(_stateVarsDM, &_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
 
-    err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);
+    // Map entries in the local vector for the state vars to entries in the local vector for the
+    // auxiliary field, so we can copy the state vars without going through the global vectors.
+    PetscSection auxiliarySection = auxiliaryField.getLocalSection();
+    PetscSection stateVarsSection = NULL;
+    err = DMGetLocalSection(_stateVarsDM, &stateVarsSection);PYLITH_CHECK_ERROR(err);
+    PetscInt stateVarsSize = 0;
+    err = VecGetLocalSize(_stateVarsVecLocal, &stateVarsSize);PYLITH_CHECK_ERROR(err);
+    PetscInt* auxiliaryIndices = NULL;
+    err = PetscMalloc1(stateVarsSize, &auxiliaryIndices);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(stateVarsSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        for (size_t iState = 0; iState < numStateSubfields; ++iState) {
+            PetscInt dof = 0, stateVarsOff = 0, auxiliaryOff = 0;
+            err = PetscSectionGetFieldDof(stateVarsSection, point, iState, &dof);PYLITH_CHECK_ERROR(err);
+            if (!dof) { continue; }
+            err = PetscSectionGetFieldOffset(stateVarsSection, point, iState, &stateVarsOff);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(auxiliarySection, point, stateSubfieldIndices[iState], &auxiliaryOff);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                assert(stateVarsOff+iDof < stateVarsSize);
+                auxiliaryIndices[stateVarsOff+iDof] = auxiliaryOff + iDof;
+            } // for
+        } // for
+    } // for
+    err = ISCreateGeneral(PETSC_COMM_SELF, stateVarsSize, auxiliaryIndices, PETSC_OWN_POINTER,
+                          &_stateVarsLocalIS);PYLITH_CHECK_ERROR(err);
+
+    // We only need to update ghost values of the state vars if they have degrees of freedom on points
+    // shared among processes.
+    PetscSF sfPoint = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(_stateVarsDM, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    PetscInt hasSharedDofLocal = 0, hasSharedDof = 0;
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves && !hasSharedDofLocal; ++iLeaf) {
+        const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+        PetscInt dof = 0;
+        err = PetscSectionGetDof(stateVarsSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        hasSharedDofLocal = dof > 0 ? 1 : 0;
+    } // for
+    err = MPI_Allreduce(&hasSharedDofLocal, &hasSharedDof, 1, MPIU_INT, MPI_MAX,
+                        PetscObjectComm((PetscObject) _stateVarsDM));PYLITH_CHECK_ERROR(err);
+    if (hasSharedDof) {
+        err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
 } // initialize
@@ -116,16 +190,13 @@ void
 pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
-    // :TODO: Verify that we need the global vectors and can't get by with just using VecISCopy() with the local vector.
+    assert(_logger);
+    _logger->eventBegin(_eventPrepare);
 
     PetscErrorCode err = 0;
     err = VecSet(_stateVarsVecLocal, 0.0);PYLITH_CHECK_ERROR(err);
 
-    // Move auxiliaryDM data to global vector.
-    assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
-    err = DMLocalToGlobalBegin(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    _logger->eventEnd(_eventPrepare);
 
     PYLITH_METHOD_END;
 } // prepare
@@ -136,21 +207,25 @@ pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryF
 void
 pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryField) {
     PYLITH_METHOD_BEGIN;
+    assert(_logger);
+    _logger->eventBegin(_eventRestore);
 
     PetscErrorCode err = 0;
     assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
 
-    // Move statevarDM data to global vector.
-    err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    // Update ghost values of state vars with values from the owners. Inserting values into the
+    // global vector is a local copy, so only the state vars are communicated.
+    if (_stateVarsVecGlobal) {
+        err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalBegin(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+        err = DMGlobalToLocalEnd(_stateVarsDM, _stateVarsVecGlobal, INSERT_VALUES, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+    } // if
 
-    // Copy global data from stateVars to auxiliaryField
-    err = VecISCopy(_auxiliaryFieldVecGlobal, _stateVarsIS, SCATTER_FORWARD, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+    // Copy local data from stateVars to auxiliaryField
+    err = VecISCopy(auxiliaryField->getLocalVector(), _stateVarsLocalIS, SCATTER_FORWARD, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
 
-    // Move auxiliaryDM data to local vector
-    err = DMGlobalToLocalBegin(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMGlobalToLocalEnd(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    _logger->eventEnd(_eventRestore);
 
     PYLITH_METHOD_END;
 } // restore
@@ -31,6 +31,8 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
 #include "pylith/utils/petscfwd.h" // USES PetscIS, PetscDM, PetscVec
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+#include "pylith/utils/arrayfwd.hh" // USES string_vector
 
 class pylith::feassemble::UpdateStateVars : public pylith::utils::GenericComponent {
     friend class TestUpdateStateVars; // unit testing
@@ -66,6 +68,14 @@ public:
      */
     void initialize(const pylith::topology::Field& auxiliaryField);
 
+    /** Initialize layout for updating a subset of the auxiliary subfields.
+     *
+     * @param[in] auxiliaryField Auxiliary field containing subfields.
+     * @param[in] subfieldNames Names of subfields to update.
+     */
+    void initialize(const pylith::topology::Field& auxiliaryField,
+                    const pylith::string_vector& subfieldNames);
+
     /** Extract current state variables in auxiliary field in preparation for computing new ones.
      *
      * @param[inout] auxiliaryField Auxiliary field containing state variables.
@@ -82,10 +92,14 @@ public:
 private:
 
     PetscIS _stateVarsIS; ///< Petsc IS for state vars in auxiliary field.
+    PetscIS _stateVarsLocalIS; ///< Petsc IS for state vars in local vector of auxiliary field.
     PetscDM _stateVarsDM; ///< Petsc DM for state vars subfield.
-    PetscVec _stateVarsVecLocal; ///< Petsc Vec with global vector for state vars.
-    PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars.
-    PetscVec _auxiliaryFieldVecGlobal; ///< Petsc Vec with global vector for auxiliary field.
+    PetscVec _stateVarsVecLocal; ///< Petsc Vec with local vector for state vars.
+    PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars (NULL if no shared points).
+
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    int _eventPrepare; ///< Identifier for logging event for prepare().
+    int _eventRestore; ///< Identifier for logging event for restore().
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -37,10 +37,12 @@
  * - 6: bulk_modulus(1)
  * - 7: maxwell_time(3) (maxwell_time_1, maxwell_time_2, maxwell_time_3)
  * - 8: shear_modulus_ratio(3) (shear_modulus_ratio_1, shear_modulus_ratio_2, shear_modulus_ratio_3)
- * - 9: viscous_strain
+ * - 9: maxwell_factors(6) (maxwell_decay_factor_1, ..._2, ..._3, maxwell_integration_factor_1, ..._2, ..._3);
+ *     derived from maxwell_time and dt.
+ * - 10: viscous_strain
  *     2D: 3*4 components (strain1_xx, strain1_yy, strain1_zz, strain1_xy, ...)
  *     3D: 3*6 components (strain1_xx, strain1_yy, strain1_zz, strain1_xy, strain1_yz, strain1_xz, ...)
- * - 10: total_strain
+ * - 11: total_strain
  *     2D: 4 components (strain_xx, strain_yy, strain_zz, strain_xy)
  *     3D: 6 components (strain_xx, strain_yy, strain_zz, strain_xy, strain_yz, strain_xz)
  *
@@ -98,9 +100,9 @@ public:
     struct Context {
         PylithReal shearModulus;
         PylithReal bulkModulus;
-        const PylithReal* maxwellTime; // size is numParallel
         const PylithReal* shearModulusRatio; // size is numParallel
-        PylithReal dt;
+        const PylithReal* decayFactor; // size is numParallel
+        const PylithReal* integrationFactor; // size is numParallel
         pylith::fekernels::Tensor viscousStrain[3]; // Size must match numParallel
         pylith::fekernels::Tensor totalStrain;
         pylith::fekernels::Tensor refStress;
@@ -109,9 +111,9 @@ public:
         Context(void) :
             shearModulus(0.0),
             bulkModulus(0.0),
-            maxwellTime(nullptr),
             shearModulusRatio(nullptr),
-            dt(0.0) {}
+            decayFactor(nullptr),
+            integrationFactor(nullptr) {}
 
 
     };
@@ -142,30 +144,28 @@ public:
                     const pylith::fekernels::TensorOps& tensorOps) {
         assert(context);
 
-        const PylithInt i_shearModulus = numA-6;
-        const PylithInt i_bulkModulus = numA-5;
-        const PylithInt i_maxwellTime = numA-4;
-        const PylithInt i_shearModulusRatio = numA-3;
+        const PylithInt i_shearModulus = numA-7;
+        const PylithInt i_bulkModulus = numA-6;
+        const PylithInt i_shearModulusRatio = numA-4;
+        const PylithInt i_maxwellFactors = numA-3;
         const PylithInt i_viscousStrain = numA-2;
         const PylithInt i_totalStrain = numA-1;
 
-        assert(numA >= 7); // also have density
+        assert(numA >= 8); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_shearModulus] >= 0);
         assert(aOff[i_bulkModulus] >= 0);
-        assert(aOff[i_maxwellTime] >= 0);
         assert(aOff[i_shearModulusRatio] >= 0);
+        assert(aOff[i_maxwellFactors] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
-        assert(1 == numConstants);
-        assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
-        context->maxwellTime = &a[aOff[i_maxwellTime]];assert(context->maxwellTime);
         context->shearModulusRatio = &a[aOff[i_shearModulusRatio]];assert(context->shearModulusRatio);
-        context->dt = constants[0];
+        context->decayFactor = &a[aOff[i_maxwellFactors]];
+        context->integrationFactor = &a[aOff[i_maxwellFactors]+numParallel];
 
         for (PylithInt i = 0; i < numParallel; ++i) {
             const PylithInt offset = i*tensorOps.vectorSize;
@@ -197,34 +197,32 @@ public:
                              const pylith::fekernels::TensorOps& tensorOps) {
         assert(context);
 
-        const PylithInt i_refStress = numA-8;
-        const PylithInt i_refStrain = numA-7;
-        const PylithInt i_shearModulus = numA-6;
-        const PylithInt i_bulkModulus = numA-5;
-        const PylithInt i_maxwellTime = numA-4;
-        const PylithInt i_shearModulusRatio = numA-3;
+        const PylithInt i_refStress = numA-9;
+        const PylithInt i_refStrain = numA-8;
+        const PylithInt i_shearModulus = numA-7;
+        const PylithInt i_bulkModulus = numA-6;
+        const PylithInt i_shearModulusRatio = numA-4;
+        const PylithInt i_maxwellFactors = numA-3;
         const PylithInt i_viscousStrain = numA-2;
         const PylithInt i_totalStrain = numA-1;
 
-        assert(numA >= 9); // also have density
+        assert(numA >= 10); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_refStress] >= 0);
         assert(aOff[i_refStrain] >= 0);
         assert(aOff[i_shearModulus] >= 0);
         assert(aOff[i_bulkModulus] >= 0);
-        assert(aOff[i_maxwellTime] >= 0);
         assert(aOff[i_shearModulusRatio] >= 0);
+        assert(aOff[i_maxwellFactors] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
-        assert(1 == numConstants);
-        assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
-        context->maxwellTime = &a[aOff[i_maxwellTime]];assert(context->maxwellTime);
         context->shearModulusRatio = &a[aOff[i_shearModulusRatio]];assert(context->shearModulusRatio);
-        context->dt = constants[0];
+        context->decayFactor = &a[aOff[i_maxwellFactors]];
+        context->integrationFactor = &a[aOff[i_maxwellFactors]+numParallel];
 
         for (PylithInt i = 0; i < numParallel; ++i) {
             const PylithInt offset = i*tensorOps.vectorSize;
@@ -235,6 +233,55 @@ public:
         tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
+    // --------------------------------------------------------------------------------------------
+    /** Compute decay and integration factors for the viscous strain of each Maxwell element.
+     *
+     * The factors depend only on the Maxwell times and the time step, so we compute them when the
+     * time step changes rather than at every quadrature point in every residual and Jacobian.
+     *
+     * Auxiliary fields: [..., maxwell_time(3), shear_modulus_ratio(3), maxwell_factors(6), viscous_strain(3*n),
+     *                   total_strain(n)]
+     * Kernel constants: [dt]
+     */
+    static inline
+    void maxwellFactors(const PylithInt dim,
+                        const PylithInt numS,
+                        const PylithInt numA,
+                        const PylithInt sOff[],
+                        const PylithInt sOff_x[],
+                        const PylithScalar s[],
+                        const PylithScalar s_t[],
+                        const PylithScalar s_x[],
+                        const PylithInt aOff[],
+                        const PylithInt aOff_x[],
+                        const PylithScalar a[],
+                        const PylithScalar a_t[],
+                        const PylithScalar a_x[],
+                        const PylithReal t,
+                        const PylithScalar x[],
+                        const PylithInt numConstants,
+                        const PylithScalar constants[],
+                        PylithScalar factors[]) {
+        const PylithInt i_maxwellTime = numA-5;
+
+        assert(numA >= 8); // also have density
+        assert(a);
+        assert(aOff);
+        assert(aOff[i_maxwellTime] >= 0);
+        assert(1 == numConstants);
+        assert(constants);
+        assert(factors);
+
+        const PylithReal* maxwellTime = &a[aOff[i_maxwellTime]];
+        const PylithReal dt = constants[0];assert(dt > 0.0);
+
+        for (PylithInt i = 0; i < numParallel; ++i) {
+            assert(maxwellTime[i] > 0.0);
+            factors[i] = exp(-dt/maxwellTime[i]);
+            factors[numParallel+i] = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime[i]);
+        } // for
+    } // maxwellFactors
+
     // --------------------------------------------------------------------------------------------
     /** Calculate viscous strain as a vector.
      *
@@ -252,14 +299,14 @@ public:
         Tensor strain;
         strainFn(strainContext, &strain);
 
-        const PylithReal dt = rheologyContext.dt;
         const pylith::fekernels::Tensor& totalStrain = rheologyContext.totalStrain;
         for (PylithInt i = 0; i < numParallel; ++i ) {
-            const PylithReal maxwellTime = rheologyContext.maxwellTime[i];
+            const PylithReal decayFactor = rheologyContext.decayFactor[i];
+            const PylithReal integrationFactor = rheologyContext.integrationFactor[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = rheologyContext.viscousStrain[i];
             pylith::fekernels::Tensor viscousStrainTensor;
 
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
+            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrainTensor);
 
             const PylithInt offset = i*tensorOps.vectorSize;
             tensorOps.toVector(viscousStrainTensor, &viscousStrainVector[offset]);
@@ -285,14 +332,14 @@ public:
 
         const PylithReal shearModulus = context->shearModulus;assert(shearModulus);
         const PylithReal* shearModulusRatio = context->shearModulusRatio;
-        const PylithReal dt = context->dt;
         const pylith::fekernels::Tensor& totalStrain = context->totalStrain;
 
         pylith::fekernels::Tensor viscousStrain[numParallel];
         for (PylithInt i = 0; i < numParallel; ++i ) {
-            const PylithReal maxwellTime = context->maxwellTime[i];
+            const PylithReal decayFactor = context->decayFactor[i];
+            const PylithReal integrationFactor = context->integrationFactor[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain[i];
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrain[i]);
         } // for
 
         pylith::fekernels::Tensor devStrain;
@@ -324,14 +371,14 @@ public:
 
         const PylithReal shearModulus = context->shearModulus;
         const PylithReal* shearModulusRatio = context->shearModulusRatio;
-        const PylithReal dt = context->dt;
         const pylith::fekernels::Tensor& totalStrain = context->totalStrain;
 
         pylith::fekernels::Tensor viscousStrain[numParallel];
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context->maxwellTime[i];
+            const PylithReal decayFactor = context->decayFactor[i];
+            const PylithReal integrationFactor = context->integrationFactor[i];
             const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain[i];
-            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain[i]);
+            pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrain[i]);
         } // for
 
         pylith::fekernels::Tensor devStrain;
@@ -530,7 +577,7 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(3), shear_modulus_ratio(3),
-     *                    total_strain(4), viscous_strain(12)]
+     *                    maxwell_factors(6), viscous_strain(12), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain(const PylithInt dim,
@@ -575,7 +622,8 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., reference_stress(4), reference_strain(4), shear_modulus(1), bulk_modulus(1),
-     *                    maxwell_time(3), shear_modulus_ratio(3), total_strain(4), viscous_strain(12)]
+     *                    maxwell_time(3), shear_modulus_ratio(3), maxwell_factors(6),
+     *                    viscous_strain(12), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain_refState(const PylithInt dim,
@@ -619,7 +667,7 @@ public:
      *
      * Solution fields: [...]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(3), shear_modulus_ratio(3),
-     *                    total_strain(4), viscous_strain(12)]
+     *                    maxwell_factors(6), viscous_strain(12), total_strain(4)]
      */
     static inline
     void Jf3vu_infinitesimalStrain(const PylithInt dim,
@@ -652,13 +700,11 @@ public:
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
         const PylithReal* shearModulusRatio = context.shearModulusRatio;
-        const PylithScalar dt = context.dt;
 
         const PylithReal shearModulusRatio_0 = 1.0 - shearModulusRatio[0] - shearModulusRatio[1] - shearModulusRatio[2];
         PylithReal shearFactor = shearModulus * shearModulusRatio_0;
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context.maxwellTime[i];
-            const PylithReal dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+            const PylithReal dq = context.integrationFactor[i];
             shearFactor += shearModulus * dq * shearModulusRatio[i];
         } // for
 
@@ -1057,7 +1103,7 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(3), shear_modulus_ratio(3),
-     *                    total_strain(4), viscous_strain(12)]
+     *                    maxwell_factors(6), viscous_strain(12), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain(const PylithInt dim,
@@ -1102,7 +1148,8 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., reference_stress(4), reference_strain(4), shear_modulus(1), bulk_modulus(1),
-     *                    maxwell_time(3), shear_modulus_ratio(3), total_strain(4), viscous_strain(12)]
+     *                    maxwell_time(3), shear_modulus_ratio(3), maxwell_factors(6),
+     *                    viscous_strain(12), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain_refState(const PylithInt dim,
@@ -1146,7 +1193,7 @@ public:
      *
      * Solution fields: [...]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(3), shear_modulus_ratio(3),
-     *                    total_strain(4), viscous_strain(12)]
+     *                    maxwell_factors(6), viscous_strain(12), total_strain(4)]
      */
     static inline
     void Jf3vu_infinitesimalStrain(const PylithInt dim,
@@ -1181,13 +1228,11 @@ public:
         const PylithReal shearModulus = context.shearModulus;
         const PylithReal bulkModulus = context.bulkModulus;
         const PylithReal* shearModulusRatio = context.shearModulusRatio;
-        const PylithReal dt = context.dt;
 
         const PylithReal shearModulusRatio_0 = 1.0 - shearModulusRatio[0] - shearModulusRatio[1] - shearModulusRatio[2];
         PylithReal shearFactor = shearModulus * shearModulusRatio_0;
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithReal maxwellTime = context.maxwellTime[i];
-            const PylithReal dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+            const PylithReal dq = context.integrationFactor[i];
             shearFactor += shearModulus * dq * shearModulusRatio[i];
         } // for
 
@@ -36,10 +36,11 @@
  * - 5: shear_modulus(1)
  * - 6: bulk_modulus(1)
  * - 7: maxwell_time(1)
- * - 8: viscous_strain
+ * - 8: maxwell_factors(2) (decay factor, integration factor); derived from maxwell_time and dt.
+ * - 9: viscous_strain
  *     2D: 4 components (strain_xx, strain_yy, strain_zz, strain_xy)
  *     3D: 6 components (strain_xx, strain_yy, strain_zz, strain_xy, strain_yz, strain_xz)
- * - 9: total_strain
+ * - 10: total_strain
  *     2D: 4 components (strain_xx, strain_yy, strain_zz, strain_xy)
  *     3D: 6 components (strain_xx, strain_yy, strain_zz, strain_xy, strain_yz, strain_xz)
  *
@@ -94,8 +95,8 @@ public:
     struct Context {
         PylithReal shearModulus;
         PylithReal bulkModulus;
-        PylithReal maxwellTime;
-        PylithReal dt;
+        PylithReal decayFactor;
+        PylithReal integrationFactor;
         pylith::fekernels::Tensor viscousStrain;
         pylith::fekernels::Tensor totalStrain;
         pylith::fekernels::Tensor refStress;
@@ -104,8 +105,8 @@ public:
         Context(void) :
             shearModulus(0.0),
             bulkModulus(0.0),
-            maxwellTime(0.0),
-            dt(0.0) {}
+            decayFactor(0.0),
+            integrationFactor(0.0) {}
 
 
     };
@@ -136,27 +137,25 @@ public:
                     const pylith::fekernels::TensorOps& tensorOps) {
         assert(context);
 
-        const PylithInt i_shearModulus = numA-5;
-        const PylithInt i_bulkModulus = numA-4;
-        const PylithInt i_maxwellTime = numA-3;
+        const PylithInt i_shearModulus = numA-6;
+        const PylithInt i_bulkModulus = numA-5;
+        const PylithInt i_maxwellFactors = numA-3;
         const PylithInt i_viscousStrain = numA-2;
         const PylithInt i_totalStrain = numA-1;
 
-        assert(numA >= 6); // also have density
+        assert(numA >= 7); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_shearModulus] >= 0);
         assert(aOff[i_bulkModulus] >= 0);
-        assert(aOff[i_maxwellTime] >= 0);
+        assert(aOff[i_maxwellFactors] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
-        assert(1 == numConstants);
-        assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
-        context->maxwellTime = a[aOff[i_maxwellTime]];assert(context->maxwellTime > 0.0);
-        context->dt = constants[0];
+        context->decayFactor = a[aOff[i_maxwellFactors]+0];
+        context->integrationFactor = a[aOff[i_maxwellFactors]+1];
 
         tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
         tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
@@ -185,28 +184,29 @@ public:
                              const pylith::fekernels::TensorOps& tensorOps) {
         assert(context);
 
-        const PylithInt i_refStress = numA-7;
-        const PylithInt i_refStrain = numA-6;
-        const PylithInt i_shearModulus = numA-5;
-        const PylithInt i_bulkModulus = numA-4;
-        const PylithInt i_maxwellTime = numA-3;
+        const PylithInt i_refStress = numA-8;
+        const PylithInt i_refStrain = numA-7;
+        const PylithInt i_shearModulus = numA-6;
+        const PylithInt i_bulkModulus = numA-5;
+        const PylithInt i_maxwellFactors = numA-3;
         const PylithInt i_viscousStrain = numA-2;
         const PylithInt i_totalStrain = numA-1;
 
-        assert(numA >= 8); // also have density
+        assert(numA >= 9); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_refStress] >= 0);
         assert(aOff[i_refStrain] >= 0);
         assert(aOff[i_shearModulus] >= 0);
         assert(aOff[i_bulkModulus] >= 0);
-        assert(aOff[i_maxwellTime] >= 0);
+        assert(aOff[i_maxwellFactors] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
-        context->maxwellTime = a[aOff[i_maxwellTime]];assert(context->maxwellTime > 0.0);
+        context->decayFactor = a[aOff[i_maxwellFactors]+0];
+        context->integrationFactor = a[aOff[i_maxwellFactors]+1];
 
         tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
         tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
@@ -228,6 +228,51 @@ public:
         return maxwellTime*(1.0-exp(-dt/maxwellTime))/dt;
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Compute decay and integration factors for the viscous strain.
+     *
+     * The factors depend only on the Maxwell time and the time step, so we compute them when the
+     * time step changes rather than at every quadrature point in every residual and Jacobian.
+     *
+     * Auxiliary fields: [..., maxwell_time(1), maxwell_factors(2), viscous_strain(n), total_strain(n)]
+     * Kernel constants: [dt]
+     */
+    static inline
+    void maxwellFactors(const PylithInt dim,
+                        const PylithInt numS,
+                        const PylithInt numA,
+                        const PylithInt sOff[],
+                        const PylithInt sOff_x[],
+                        const PylithScalar s[],
+                        const PylithScalar s_t[],
+                        const PylithScalar s_x[],
+                        const PylithInt aOff[],
+                        const PylithInt aOff_x[],
+                        const PylithScalar a[],
+                        const PylithScalar a_t[],
+                        const PylithScalar a_x[],
+                        const PylithReal t,
+                        const PylithScalar x[],
+                        const PylithInt numConstants,
+                        const PylithScalar constants[],
+                        PylithScalar factors[]) {
+        const PylithInt i_maxwellTime = numA-4;
+
+        assert(numA >= 7); // also have density
+        assert(a);
+        assert(aOff);
+        assert(aOff[i_maxwellTime] >= 0);
+        assert(1 == numConstants);
+        assert(constants);
+        assert(factors);
+
+        const PylithReal maxwellTime = a[aOff[i_maxwellTime]];assert(maxwellTime > 0.0);
+        const PylithReal dt = constants[0];assert(dt > 0.0);
+
+        factors[0] = exp(-dt/maxwellTime);
+        factors[1] = viscousStrainCoeff(dt, maxwellTime);
+    } // maxwellFactors
+
     // --------------------------------------------------------------------------------------------
     /** Calculate viscous strain as a vector.
      *
@@ -245,25 +290,28 @@ public:
         Tensor strain;
         strainFn(strainContext, &strain);
 
-        const PylithReal dt = rheologyContext.dt;
-        const PylithReal maxwellTime = rheologyContext.maxwellTime;
+        const PylithReal decayFactor = rheologyContext.decayFactor;
+        const PylithReal integrationFactor = rheologyContext.integrationFactor;
         const pylith::fekernels::Tensor& totalStrain = rheologyContext.totalStrain;
         const pylith::fekernels::Tensor& viscousStrainPrev = rheologyContext.viscousStrain;
         pylith::fekernels::Tensor viscousStrainTensor;
-        viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
+        viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrainTensor);
 
         tensorOps.toVector(viscousStrainTensor, viscousStrainVector);
     }
 
     // --------------------------------------------------------------------------------------------
     /** Calculate viscous strain.
+     *
+     * @param[in] decayFactor Decay factor, exp(-dt/maxwellTime).
+     * @param[in] integrationFactor Integration factor, maxwellTime*(1-exp(-dt/maxwellTime))/dt.
      */
     static inline
-    void viscousStrain(const PylithReal maxwellTime,
+    void viscousStrain(const PylithReal decayFactor,
+                       const PylithReal integrationFactor,
                        const pylith::fekernels::Tensor& viscousStrainPrev,
                        const pylith::fekernels::Tensor& totalStrain,
                        const pylith::fekernels::Tensor& strain,
-                       const PylithReal dt,
                        pylith::fekernels::Tensor* viscousStrain) {
         assert(viscousStrain);
 
@@ -273,8 +321,8 @@ public:
         pylith::fekernels::Tensor devTotalStrain;
         pylith::fekernels::Elasticity::deviatoric(totalStrain, &devTotalStrain);
 
-        const PylithScalar dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
-        const PylithScalar expFac = exp(-dt/maxwellTime);
+        const PylithScalar dq = integrationFactor;
+        const PylithScalar expFac = decayFactor;
         viscousStrain->xx = expFac * viscousStrainPrev.xx + dq * (devStrain.xx - devTotalStrain.xx);
         viscousStrain->yy = expFac * viscousStrainPrev.yy + dq * (devStrain.yy - devTotalStrain.yy);
         viscousStrain->zz = expFac * viscousStrainPrev.zz + dq * (devStrain.zz - devTotalStrain.zz);
@@ -300,12 +348,12 @@ public:
         const PylithReal bulkModulus = context->bulkModulus;
         pylith::fekernels::IsotropicLinearElasticity::meanStress(bulkModulus, strain, stress);
 
-        const PylithReal dt = context->dt;
-        const PylithReal maxwellTime = context->maxwellTime;
+        const PylithReal decayFactor = context->decayFactor;
+        const PylithReal integrationFactor = context->integrationFactor;
         const pylith::fekernels::Tensor& totalStrain = context->totalStrain;
         const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain;
         pylith::fekernels::Tensor viscousStrain;
-        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain);
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrain);
 
         const PylithReal shearModulus = context->shearModulus;
         _deviatoricStress(shearModulus, viscousStrain, stress);
@@ -332,12 +380,12 @@ public:
         const PylithReal bulkModulus = context->bulkModulus;
         pylith::fekernels::IsotropicLinearElasticity::meanStress_refState(bulkModulus, refStress, refStrain, strain, stress);
 
-        const PylithReal dt = context->dt;
-        const PylithReal maxwellTime = context->maxwellTime;
+        const PylithReal decayFactor = context->decayFactor;
+        const PylithReal integrationFactor = context->integrationFactor;
         const pylith::fekernels::Tensor& totalStrain = context->totalStrain;
         const pylith::fekernels::Tensor& viscousStrainPrev = context->viscousStrain;
         pylith::fekernels::Tensor viscousStrain;
-        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrain);
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(decayFactor, integrationFactor, viscousStrainPrev, totalStrain, strain, &viscousStrain);
 
         const PylithReal shearModulus = context->shearModulus;
         _deviatoricStress_refState(shearModulus, refStress, refStrain, viscousStrain, stress);
@@ -452,7 +500,7 @@ public:
      * reference stress and reference strain.
      *
      * Solution fields: [disp(dim), ...]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain(const PylithInt dim,
@@ -497,7 +545,7 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., reference_stress(4), reference_strain(4), shear_modulus(1), bulk_modulus(1),
-     *                    maxwell_time(1), viscous_strain(4), total_strain(4)]
+     *                    maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void f1v_infinitesimalStrain_refState(const PylithInt dim,
@@ -540,7 +588,7 @@ public:
     /** Jf3_vu entry function for 2D plane strain isotropic linear Maxwell viscoelasticity.
      *
      * Solution fields: [...]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void Jf3vu_infinitesimalStrain(const PylithInt dim,
@@ -571,10 +619,7 @@ public:
 
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
-        const PylithScalar maxwellTime = context.maxwellTime;
-        const PylithScalar dt = context.dt;
-
-        const PylithScalar dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+        const PylithScalar dq = context.integrationFactor;
 
         // Unique components of Jacobian.
         const PylithReal C1111 = bulkModulus + 4.0/3.0 * shearModulus * dq;
@@ -817,7 +862,7 @@ public:
      * Used to output viscous strain.
      *
      * Solution fields: [disp(dim)]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void viscousStrain_infinitesimalStrain_asVector(const PylithInt dim,
@@ -866,7 +911,7 @@ public:
      * Used to output of Cauchy stress.
      *
      * Solution fields: [disp(dim)]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void cauchyStress_infinitesimalStrain_asVector(const PylithInt dim,
@@ -913,7 +958,7 @@ public:
      *
      * Solution fields: [disp(dim)]
      * Auxiliary fields: [..., reference_stress(4), reference_strain(4), shear_modulus(1), bulk_modulus(1),
-     *                    maxwell_time(1), viscous_strain(4), total_strain(4)]
+     *                    maxwell_time(1), maxwell_factors(2), viscous_strain(4), total_strain(4)]
      */
     static inline
     void cauchyStress_infinitesimalStrain_refState_asVector(const PylithInt dim,
@@ -969,7 +1014,7 @@ public:
      * reference stress and reference strain.
      *
      * Solution fields: [disp(dim), ...]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), total_strain(6), viscous_strain(6)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(6), total_strain(6)]
      */
     static inline
     void f1v_infinitesimalStrain(const PylithInt dim,
@@ -1014,7 +1059,7 @@ public:
      *
      * Solution fields: [disp(dim), ...]
      * Auxiliary fields: [..., reference_stress(6), reference_strain(6), shear_modulus(1), bulk_modulus(1),
-     *                    maxwell_time(1), total_strain(6), viscous_strain(6)]
+     *                    maxwell_time(1), maxwell_factors(2), viscous_strain(6), total_strain(6)]
      */
     static inline
     void f1v_infinitesimalStrain_refState(const PylithInt dim,
@@ -1058,7 +1103,7 @@ public:
      * reference strain.
      *
      * Solution fields: [...]
-     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), total_strain(6), viscous_strain(6)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), maxwell_factors(2), viscous_strain(6), total_strain(6)]
      */
     static inline
     void Jf3vu_infinitesimalStrain(const PylithInt dim,
@@ -1089,10 +1134,7 @@ public:
 
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
-        const PylithScalar maxwellTime = context.maxwellTime;
-        const PylithScalar dt = context.dt;
-
-        const PylithScalar dq = pylith::fekernels::IsotropicLinearMaxwell::viscousStrainCoeff(dt, maxwellTime);
+        const PylithScalar dq = context.integrationFactor;
 
         /* Unique components of Jacobian. */
         const PylithReal C1111 = bulkModulus + 4.0*dq*shearModulus/3.0;
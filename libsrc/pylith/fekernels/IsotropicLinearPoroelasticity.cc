@@ -335,337 +335,6 @@ pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_explicit(const
 } // f0p_explicit
 
 
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit(const PylithInt dim,
-                                                                          const PylithInt numS,
-                                                                          const PylithInt numA,
-                                                                          const PylithInt sOff[],
-                                                                          const PylithInt sOff_x[],
-                                                                          const PylithScalar s[],
-                                                                          const PylithScalar s_t[],
-                                                                          const PylithScalar s_x[],
-                                                                          const PylithInt aOff[],
-                                                                          const PylithInt aOff_x[],
-                                                                          const PylithScalar a[],
-                                                                          const PylithScalar a_t[],
-                                                                          const PylithScalar a_x[],
-                                                                          const PylithReal t,
-                                                                          const PylithScalar x[],
-                                                                          const PylithInt numConstants,
-                                                                          const PylithScalar constants[],
-                                                                          PylithScalar f0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += s_t ? (biotCoefficient * trace_strain_t) : 0.0;
-    f0[0] += s_t ? (pressure_t / biotModulus) : 0.0;
-} // f0p_implicit
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source(const PylithInt dim,
-                                                                                 const PylithInt numS,
-                                                                                 const PylithInt numA,
-                                                                                 const PylithInt sOff[],
-                                                                                 const PylithInt sOff_x[],
-                                                                                 const PylithScalar s[],
-                                                                                 const PylithScalar s_t[],
-                                                                                 const PylithScalar s_x[],
-                                                                                 const PylithInt aOff[],
-                                                                                 const PylithInt aOff_x[],
-                                                                                 const PylithScalar a[],
-                                                                                 const PylithScalar a_t[],
-                                                                                 const PylithScalar a_x[],
-                                                                                 const PylithReal t,
-                                                                                 const PylithScalar x[],
-                                                                                 const PylithInt numConstants,
-                                                                                 const PylithScalar constants[],
-                                                                                 PylithScalar f0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 4;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_body(const PylithInt dim,
-                                                                                      const PylithInt numS,
-                                                                                      const PylithInt numA,
-                                                                                      const PylithInt sOff[],
-                                                                                      const PylithInt sOff_x[],
-                                                                                      const PylithScalar s[],
-                                                                                      const PylithScalar s_t[],
-                                                                                      const PylithScalar s_x[],
-                                                                                      const PylithInt aOff[],
-                                                                                      const PylithInt aOff_x[],
-                                                                                      const PylithScalar a[],
-                                                                                      const PylithScalar a_t[],
-                                                                                      const PylithScalar a_x[],
-                                                                                      const PylithReal t,
-                                                                                      const PylithScalar x[],
-                                                                                      const PylithInt numConstants,
-                                                                                      const PylithScalar constants[],
-                                                                                      PylithScalar f0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 5;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_body
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav(const PylithInt dim,
-                                                                                      const PylithInt numS,
-                                                                                      const PylithInt numA,
-                                                                                      const PylithInt sOff[],
-                                                                                      const PylithInt sOff_x[],
-                                                                                      const PylithScalar s[],
-                                                                                      const PylithScalar s_t[],
-                                                                                      const PylithScalar s_x[],
-                                                                                      const PylithInt aOff[],
-                                                                                      const PylithInt aOff_x[],
-                                                                                      const PylithScalar a[],
-                                                                                      const PylithScalar a_t[],
-                                                                                      const PylithScalar a_x[],
-                                                                                      const PylithReal t,
-                                                                                      const PylithScalar x[],
-                                                                                      const PylithInt numConstants,
-                                                                                      const PylithScalar constants[],
-                                                                                      PylithScalar f0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 5;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar source = a[aOff[i_source]];
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_grav
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav_body(const PylithInt dim,
-                                                                                           const PylithInt numS,
-                                                                                           const PylithInt numA,
-                                                                                           const PylithInt sOff[],
-                                                                                           const PylithInt sOff_x[],
-                                                                                           const PylithScalar s[],
-                                                                                           const PylithScalar s_t[],
-                                                                                           const PylithScalar s_x[],
-                                                                                           const PylithInt aOff[],
-                                                                                           const PylithInt aOff_x[],
-                                                                                           const PylithScalar a[],
-                                                                                           const PylithScalar a_t[],
-                                                                                           const PylithScalar a_x[],
-                                                                                           const PylithReal t,
-                                                                                           const PylithScalar x[],
-                                                                                           const PylithInt numConstants,
-                                                                                           const PylithScalar constants[],
-                                                                                           PylithScalar f0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 6;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_grav_body
-
-
 // ----------------------------------------------------------------------
 // f1u function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
 // Quasi - Static Case
@@ -814,3755 +483,1157 @@ pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1u_refstate(const
 } // f1u_refstate
 
 
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
+// =============================== LHS Jacobian ================================
+
+// ---------------------------------------------------------------------------------------------------------------------
+/* Jf3_uu entry function for isotropic linear poroelasticity WITHOUT reference stress and reference strain.
  */
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3uu(const PylithInt dim,
+                                                                   const PylithInt numS,
+                                                                   const PylithInt numA,
+                                                                   const PylithInt sOff[],
+                                                                   const PylithInt sOff_x[],
+                                                                   const PylithScalar s[],
+                                                                   const PylithScalar s_t[],
+                                                                   const PylithScalar s_x[],
+                                                                   const PylithInt aOff[],
+                                                                   const PylithInt aOff_x[],
+                                                                   const PylithScalar a[],
+                                                                   const PylithScalar a_t[],
+                                                                   const PylithScalar a_x[],
+                                                                   const PylithReal t,
+                                                                   const PylithReal s_tshift,
+                                                                   const PylithScalar x[],
+                                                                   const PylithInt numConstants,
+                                                                   const PylithScalar constants[],
+                                                                   PylithScalar Jf3[]) {
     const PylithInt _dim = 2;
 
     // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
 
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
+    // Incoming auxiliary fields.
 
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_shearModulus = numA - 5;
 
     // Run Checks
     assert(_dim == dim);
     assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numA >= 5);
     assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(f1);
+    assert(aOff[i_shearModulus] >= 0);
+    assert(Jf3);
 
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
 
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    for (PylithInt i = 0; i < _dim; ++i) {
+        for (PylithInt j = 0; j < _dim; ++j) {
+            Jf3[((i*_dim + i)*_dim + j)*_dim + j] -= shearModulus;
+            Jf3[((i*_dim + j)*_dim + j)*_dim + i] -= shearModulus;
+        }
+    }
 
-    f1[0] += ((isotropicPermeability / fluidViscosity) * pressure_x[0]);
-    f1[1] += ((isotropicPermeability / fluidViscosity) * pressure_x[1]);
-} // f1p
+} // Jf3uu
 
 
-// ------------------------------------------*----------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
+// -----------------------------------------------------------------------------
+// Jf2up function for isotropic linear poroelasticity.
+
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_tensor_permeability(const PylithInt dim,
-                                                                                     const PylithInt numS,
-                                                                                     const PylithInt numA,
-                                                                                     const PylithInt sOff[],
-                                                                                     const PylithInt sOff_x[],
-                                                                                     const PylithScalar s[],
-                                                                                     const PylithScalar s_t[],
-                                                                                     const PylithScalar s_x[],
-                                                                                     const PylithInt aOff[],
-                                                                                     const PylithInt aOff_x[],
-                                                                                     const PylithScalar a[],
-                                                                                     const PylithScalar a_t[],
-                                                                                     const PylithScalar a_x[],
-                                                                                     const PylithReal t,
-                                                                                     const PylithScalar x[],
-                                                                                     const PylithInt numConstants,
-                                                                                     const PylithScalar constants[],
-                                                                                     PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf2up(const PylithInt dim,
+                                                                   const PylithInt numS,
+                                                                   const PylithInt numA,
+                                                                   const PylithInt sOff[],
+                                                                   const PylithInt sOff_x[],
+                                                                   const PylithScalar s[],
+                                                                   const PylithScalar s_t[],
+                                                                   const PylithScalar s_x[],
+                                                                   const PylithInt aOff[],
+                                                                   const PylithInt aOff_x[],
+                                                                   const PylithScalar a[],
+                                                                   const PylithScalar a_t[],
+                                                                   const PylithScalar a_x[],
+                                                                   const PylithReal t,
+                                                                   const PylithReal utshift,
+                                                                   const PylithScalar x[],
+                                                                   const PylithInt numConstants,
+                                                                   const PylithScalar constants[],
+                                                                   PylithScalar Jf2[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_biotCoefficient = numA - 3;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 2);
+    assert(numA >= 5);
     assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf2);
 
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i*_dim+j] / fluidViscosity) * (pressure_x[j]);
-        } // for
+    for (PylithInt d = 0; d < _dim; ++d) {
+        Jf2[d*_dim+d] += biotCoefficient;
     } // for
-} // f1p_tensor_permeability
+} // Jf2up
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// Jf2ue function for isotropic linear poroelasticity.
+
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body(const PylithInt dim,
-                                                                      const PylithInt numS,
-                                                                      const PylithInt numA,
-                                                                      const PylithInt sOff[],
-                                                                      const PylithInt sOff_x[],
-                                                                      const PylithScalar s[],
-                                                                      const PylithScalar s_t[],
-                                                                      const PylithScalar s_x[],
-                                                                      const PylithInt aOff[],
-                                                                      const PylithInt aOff_x[],
-                                                                      const PylithScalar a[],
-                                                                      const PylithScalar a_t[],
-                                                                      const PylithScalar a_x[],
-                                                                      const PylithReal t,
-                                                                      const PylithScalar x[],
-                                                                      const PylithInt numConstants,
-                                                                      const PylithScalar constants[],
-                                                                      PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf2ue(const PylithInt dim,
+                                                                   const PylithInt numS,
+                                                                   const PylithInt numA,
+                                                                   const PylithInt sOff[],
+                                                                   const PylithInt sOff_x[],
+                                                                   const PylithScalar s[],
+                                                                   const PylithScalar s_t[],
+                                                                   const PylithScalar s_x[],
+                                                                   const PylithInt aOff[],
+                                                                   const PylithInt aOff_x[],
+                                                                   const PylithScalar a[],
+                                                                   const PylithScalar a_t[],
+                                                                   const PylithScalar a_x[],
+                                                                   const PylithReal t,
+                                                                   const PylithReal utshift,
+                                                                   const PylithScalar x[],
+                                                                   const PylithInt numConstants,
+                                                                   const PylithScalar constants[],
+                                                                   PylithScalar Jf2[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    const PylithInt i_body_force = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 2);
+    assert(numA >= 5);
     assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    assert(aOff[i_drainedBulkModulus] >= 0);
+    assert(aOff[i_shearModulus] >= 0);
+    assert(Jf2);
 
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
 
     for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropicPermeability / fluidViscosity) * (pressure_x[d] - body_force[d]);
+        Jf2[d*_dim+d] -= lambda;
     } // for
-
-} // f1p_gravity
+} // Jf2ue
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH body force, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_tensor_permeability(const PylithInt dim,
-                                                                                          const PylithInt numS,
-                                                                                          const PylithInt numA,
-                                                                                          const PylithInt sOff[],
-                                                                                          const PylithInt sOff_x[],
-                                                                                          const PylithScalar s[],
-                                                                                          const PylithScalar s_t[],
-                                                                                          const PylithScalar s_x[],
-                                                                                          const PylithInt aOff[],
-                                                                                          const PylithInt aOff_x[],
-                                                                                          const PylithScalar a[],
-                                                                                          const PylithScalar a_t[],
-                                                                                          const PylithScalar a_x[],
-                                                                                          const PylithReal t,
-                                                                                          const PylithScalar x[],
-                                                                                          const PylithInt numConstants,
-                                                                                          const PylithScalar constants[],
-                                                                                          PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pp(const PylithInt dim,
+                                                                   const PylithInt numS,
+                                                                   const PylithInt numA,
+                                                                   const PylithInt sOff[],
+                                                                   const PylithInt sOff_x[],
+                                                                   const PylithScalar s[],
+                                                                   const PylithScalar s_t[],
+                                                                   const PylithScalar s_x[],
+                                                                   const PylithInt aOff[],
+                                                                   const PylithInt aOff_x[],
+                                                                   const PylithScalar a[],
+                                                                   const PylithScalar a_t[],
+                                                                   const PylithScalar a_x[],
+                                                                   const PylithReal t,
+                                                                   const PylithReal utshift,
+                                                                   const PylithScalar x[],
+                                                                   const PylithInt numConstants,
+                                                                   const PylithScalar constants[],
+                                                                   PylithScalar Jf0[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_body_force = 4;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    const PylithInt i_biotModulus = numA - 2;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 2);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
 
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    Jf0[0] += utshift / biotModulus;
+} // Jf0pp
 
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
 
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
+// -----------------------------------------------------------------------------
+// Jf0pp function for fixed-stress split preconditioner for isotropic linear poroelasticity plane strain.
+void
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pp_fixedstress(const PylithInt dim,
+                                                                               const PylithInt numS,
+                                                                               const PylithInt numA,
+                                                                               const PylithInt sOff[],
+                                                                               const PylithInt sOff_x[],
+                                                                               const PylithScalar s[],
+                                                                               const PylithScalar s_t[],
+                                                                               const PylithScalar s_x[],
+                                                                               const PylithInt aOff[],
+                                                                               const PylithInt aOff_x[],
+                                                                               const PylithScalar a[],
+                                                                               const PylithScalar a_t[],
+                                                                               const PylithScalar a_x[],
+                                                                               const PylithReal t,
+                                                                               const PylithReal utshift,
+                                                                               const PylithScalar x[],
+                                                                               const PylithInt numConstants,
+                                                                               const PylithScalar constants[],
+                                                                               PylithScalar Jf0[]) {
+    const PylithInt _dim = 2;
 
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
+    // Incoming auxiliary fields.
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - body_force[j]);
-        } // for
-    } // for
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
+    const PylithInt i_biotModulus = numA - 2;
+
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 4);
+    assert(aOff);
+    assert(aOff[i_drainedBulkModulus] >= 0);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
+
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-} // f1p_gravity_tensor_permeability
+    Jf0[0] += utshift * (1.0 / biotModulus + biotCoefficient * biotCoefficient / drainedBulkModulus);
+} // Jf0pp_fixedstress
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// Jf0pe function for isotropic linear poroelasticity plane strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity(const PylithInt dim,
-                                                                         const PylithInt numS,
-                                                                         const PylithInt numA,
-                                                                         const PylithInt sOff[],
-                                                                         const PylithInt sOff_x[],
-                                                                         const PylithScalar s[],
-                                                                         const PylithScalar s_t[],
-                                                                         const PylithScalar s_x[],
-                                                                         const PylithInt aOff[],
-                                                                         const PylithInt aOff_x[],
-                                                                         const PylithScalar a[],
-                                                                         const PylithScalar a_t[],
-                                                                         const PylithScalar a_x[],
-                                                                         const PylithReal t,
-                                                                         const PylithScalar x[],
-                                                                         const PylithInt numConstants,
-                                                                         const PylithScalar constants[],
-                                                                         PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pe(const PylithInt dim,
+                                                                   const PylithInt numS,
+                                                                   const PylithInt numA,
+                                                                   const PylithInt sOff[],
+                                                                   const PylithInt sOff_x[],
+                                                                   const PylithScalar s[],
+                                                                   const PylithScalar s_t[],
+                                                                   const PylithScalar s_x[],
+                                                                   const PylithInt aOff[],
+                                                                   const PylithInt aOff_x[],
+                                                                   const PylithScalar a[],
+                                                                   const PylithScalar a_t[],
+                                                                   const PylithScalar a_x[],
+                                                                   const PylithReal t,
+                                                                   const PylithReal utshift,
+                                                                   const PylithScalar x[],
+                                                                   const PylithInt numConstants,
+                                                                   const PylithScalar constants[],
+                                                                   PylithScalar Jf0[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
+    // Incoming re-packed auxiliary field.
     // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    const PylithInt i_biotCoefficient = numA - 3;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 2);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(aOff[i_gravityField] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar *gravityField = &a[aOff[i_gravityField]];
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf0);
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropicPermeability / fluidViscosity) * (pressure_x[d] - fluidDensity * gravityField[d]);
-    } // for
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-} // f1p_gravity
+    Jf0[0] += utshift * biotCoefficient;
+} // Jf0pe
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity_tensor_permeability(const PylithInt dim,
-                                                                                             const PylithInt numS,
-                                                                                             const PylithInt numA,
-                                                                                             const PylithInt sOff[],
-                                                                                             const PylithInt sOff_x[],
-                                                                                             const PylithScalar s[],
-                                                                                             const PylithScalar s_t[],
-                                                                                             const PylithScalar s_x[],
-                                                                                             const PylithInt aOff[],
-                                                                                             const PylithInt aOff_x[],
-                                                                                             const PylithScalar a[],
-                                                                                             const PylithScalar a_t[],
-                                                                                             const PylithScalar a_x[],
-                                                                                             const PylithReal t,
-                                                                                             const PylithScalar x[],
-                                                                                             const PylithInt numConstants,
-                                                                                             const PylithScalar constants[],
-                                                                                             PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0ppdot(const PylithInt dim,
+                                                                      const PylithInt numS,
+                                                                      const PylithInt numA,
+                                                                      const PylithInt sOff[],
+                                                                      const PylithInt sOff_x[],
+                                                                      const PylithScalar s[],
+                                                                      const PylithScalar s_t[],
+                                                                      const PylithScalar s_x[],
+                                                                      const PylithInt aOff[],
+                                                                      const PylithInt aOff_x[],
+                                                                      const PylithScalar a[],
+                                                                      const PylithScalar a_t[],
+                                                                      const PylithScalar a_x[],
+                                                                      const PylithReal t,
+                                                                      const PylithReal utshift,
+                                                                      const PylithScalar x[],
+                                                                      const PylithInt numConstants,
+                                                                      const PylithScalar constants[],
+                                                                      PylithScalar Jf0[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    const PylithInt i_biotModulus = numA - 2;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 3);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_gravityField] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar *gravityField = &a[aOff[i_gravityField]];
-
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
-
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - fluidDensity * gravityField[j]);
-        } // for
-    } // for
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-} // f1p_gravity_tensor_permeability
+    Jf0[0] += 1.0 / biotModulus;
+} // Jf0ppdot
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// Jf0pedot function for isotropic linear poroelasticity plane strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity(const PylithInt dim,
-                                                                              const PylithInt numS,
-                                                                              const PylithInt numA,
-                                                                              const PylithInt sOff[],
-                                                                              const PylithInt sOff_x[],
-                                                                              const PylithScalar s[],
-                                                                              const PylithScalar s_t[],
-                                                                              const PylithScalar s_x[],
-                                                                              const PylithInt aOff[],
-                                                                              const PylithInt aOff_x[],
-                                                                              const PylithScalar a[],
-                                                                              const PylithScalar a_t[],
-                                                                              const PylithScalar a_x[],
-                                                                              const PylithReal t,
-                                                                              const PylithScalar x[],
-                                                                              const PylithInt numConstants,
-                                                                              const PylithScalar constants[],
-                                                                              PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pedot(const PylithInt dim,
+                                                                      const PylithInt numS,
+                                                                      const PylithInt numA,
+                                                                      const PylithInt sOff[],
+                                                                      const PylithInt sOff_x[],
+                                                                      const PylithScalar s[],
+                                                                      const PylithScalar s_t[],
+                                                                      const PylithScalar s_x[],
+                                                                      const PylithInt aOff[],
+                                                                      const PylithInt aOff_x[],
+                                                                      const PylithScalar a[],
+                                                                      const PylithScalar a_t[],
+                                                                      const PylithScalar a_x[],
+                                                                      const PylithReal t,
+                                                                      const PylithReal utshift,
+                                                                      const PylithScalar x[],
+                                                                      const PylithInt numConstants,
+                                                                      const PylithScalar constants[],
+                                                                      PylithScalar Jf0[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluid_density = 1;
-    const PylithInt i_fluid_viscosity = 2;
-
-    const PylithInt i_body_force = 4;
-    const PylithInt i_gravity_field = 5;
-
+    // Incoming re-packed auxiliary field.
     // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropic_permeability = numA - 1;
+    const PylithInt i_biotCoefficient = numA - 3;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
+    assert(numS >= 3);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_fluid_density] >= 0);
-    assert(aOff[i_fluid_viscosity] >= 0);
-    assert(aOff[i_isotropic_permeability] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_gravity_field] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluid_density = a[aOff[i_fluid_density]];
-    const PylithScalar fluid_viscosity = a[aOff[i_fluid_viscosity]];
-
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar *gravity_field = &a[aOff[i_gravity_field]];
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf0);
 
-    const PylithScalar isotropic_permeability = a[aOff[i_isotropic_permeability]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropic_permeability / fluid_viscosity) * (pressure_x[d] - body_force[d] - fluid_density * gravity_field[d]);
-    } // for
+    Jf0[0] += biotCoefficient;
+} // Jf0pedot
 
-} // f1p_body_gravity
 
+// ============================== RHS Residual =================================
 
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// ----------------------------------------------------------------------
+// g1v function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
+// Dynamic Case
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity_tensor_permeability(const PylithInt dim,
-                                                                                                  const PylithInt numS,
-                                                                                                  const PylithInt numA,
-                                                                                                  const PylithInt sOff[],
-                                                                                                  const PylithInt sOff_x[],
-                                                                                                  const PylithScalar s[],
-                                                                                                  const PylithScalar s_t[],
-                                                                                                  const PylithScalar s_x[],
-                                                                                                  const PylithInt aOff[],
-                                                                                                  const PylithInt aOff_x[],
-                                                                                                  const PylithScalar a[],
-                                                                                                  const PylithScalar a_t[],
-                                                                                                  const PylithScalar a_x[],
-                                                                                                  const PylithReal t,
-                                                                                                  const PylithScalar x[],
-                                                                                                  const PylithInt numConstants,
-                                                                                                  const PylithScalar constants[],
-                                                                                                  PylithScalar f1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1v(const PylithInt dim,
+                                                                 const PylithInt numS,
+                                                                 const PylithInt numA,
+                                                                 const PylithInt sOff[],
+                                                                 const PylithInt sOff_x[],
+                                                                 const PylithScalar s[],
+                                                                 const PylithScalar s_t[],
+                                                                 const PylithScalar s_x[],
+                                                                 const PylithInt aOff[],
+                                                                 const PylithInt aOff_x[],
+                                                                 const PylithScalar a[],
+                                                                 const PylithScalar a_t[],
+                                                                 const PylithScalar a_x[],
+                                                                 const PylithReal t,
+                                                                 const PylithScalar x[],
+                                                                 const PylithInt numConstants,
+                                                                 const PylithScalar constants[],
+                                                                 PylithScalar g1[]) {
     const PylithInt _dim = 2;
 
-    // Incoming solution field.
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
     const PylithInt i_pressure = 1;
 
-    // Incoming auxiliary field.
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
 
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
+    PylithScalar trace_strain = 0.0;
+    for (PylithInt d = 0; d < _dim; ++d) {
+        trace_strain += displacement_x[d*_dim+d];
+    }
 
-    const PylithInt i_body_force = 4;
-    const PylithInt i_gravity_field = 5;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_gravity_field] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar *gravity_field = &a[aOff[i_gravity_field]];
-
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - body_force[j] - fluidDensity * gravity_field[j]);
+    for (PylithInt c = 0; c < _dim; ++c) {
+        for (PylithInt d = 0; d < _dim; ++d) {
+            g1[c*dim+d] -= shearModulus * (displacement_x[c*_dim+d] + displacement_x[d*_dim+c]);
         } // for
+        g1[c*dim+c] -= (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
+        g1[c*dim+c] += biotCoefficient*pressure;
     } // for
+} // g1v
 
-} // f1p_body_gravity_tensor_permeability
-
-
-// =============================== LHS Jacobian ================================
 
-// ---------------------------------------------------------------------------------------------------------------------
-/* Jf3_uu entry function for isotropic linear poroelasticity WITHOUT reference stress and reference strain.
- */
+// ----------------------------------------------------------------------
+// g1v function for isotropic linear Poroelasticity plane strain with reference stress and strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3uu(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal s_tshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf3[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution field.
-
-    // Incoming auxiliary fields.
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 5);
-    assert(aOff);
-    assert(aOff[i_shearModulus] >= 0);
-    assert(Jf3);
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            Jf3[((i*_dim + i)*_dim + j)*_dim + j] -= shearModulus;
-            Jf3[((i*_dim + j)*_dim + j)*_dim + i] -= shearModulus;
-        }
-    }
-
-} // Jf3uu
-
-
-// -----------------------------------------------------------------------------
-// Jf2up function for isotropic linear poroelasticity.
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf2up(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal utshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf2[]) {
-    const PylithInt _dim = 2;
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 5);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf2);
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        Jf2[d*_dim+d] += biotCoefficient;
-    } // for
-} // Jf2up
-
-
-// -----------------------------------------------------------------------------
-// Jf2ue function for isotropic linear poroelasticity.
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf2ue(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal utshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf2[]) {
-    const PylithInt _dim = 2;
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 5);
-    assert(aOff);
-    assert(aOff[i_drainedBulkModulus] >= 0);
-    assert(aOff[i_shearModulus] >= 0);
-    assert(Jf2);
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        Jf2[d*_dim+d] -= lambda;
-    } // for
-} // Jf2ue
-
-
-// ----------------------------------------------------------------------
-/* Jf3pp entry function for isotropic linear poroelasticity. */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal utshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf3[]) {
-    const PylithInt _dim = 2;
-
-    // index of Incoming auxiliary fields.
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(Jf3);
-
-    const PylithScalar isotropicPermeablity = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        Jf3[d*_dim+d] += isotropicPermeablity / fluidViscosity;
-    }
-} // Jf3pp
-
-
-// ----------------------------------------------------------------------
-/* Jf3pp entry function for isotropic linear poroelasticity, permeability in tensor form */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp_tensor_permeability(const PylithInt dim,
-                                                                                       const PylithInt numS,
-                                                                                       const PylithInt numA,
-                                                                                       const PylithInt sOff[],
-                                                                                       const PylithInt sOff_x[],
-                                                                                       const PylithScalar s[],
-                                                                                       const PylithScalar s_t[],
-                                                                                       const PylithScalar s_x[],
-                                                                                       const PylithInt aOff[],
-                                                                                       const PylithInt aOff_x[],
-                                                                                       const PylithScalar a[],
-                                                                                       const PylithScalar a_t[],
-                                                                                       const PylithScalar a_x[],
-                                                                                       const PylithReal t,
-                                                                                       const PylithReal utshift,
-                                                                                       const PylithScalar x[],
-                                                                                       const PylithInt numConstants,
-                                                                                       const PylithScalar constants[],
-                                                                                       PylithScalar Jf3[]) {
-    const PylithInt _dim = 2;
-
-    // index of Incoming auxiliary fields.
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(Jf3);
-
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            Jf3[i*_dim+j] += tensorPermeability[i*_dim+j]/fluidViscosity;
-        } // for
-    } // for
-} // Jf3pp_tensorPermeability
-
-
-// -----------------------------------------------------------------------------
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pp(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal utshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(Jf0);
-
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    Jf0[0] += utshift / biotModulus;
-} // Jf0pp
-
-
-// -----------------------------------------------------------------------------
-// Jf0pe function for isotropic linear poroelasticity plane strain.
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pe(const PylithInt dim,
-                                                                   const PylithInt numS,
-                                                                   const PylithInt numA,
-                                                                   const PylithInt sOff[],
-                                                                   const PylithInt sOff_x[],
-                                                                   const PylithScalar s[],
-                                                                   const PylithScalar s_t[],
-                                                                   const PylithScalar s_x[],
-                                                                   const PylithInt aOff[],
-                                                                   const PylithInt aOff_x[],
-                                                                   const PylithScalar a[],
-                                                                   const PylithScalar a_t[],
-                                                                   const PylithScalar a_x[],
-                                                                   const PylithReal t,
-                                                                   const PylithReal utshift,
-                                                                   const PylithScalar x[],
-                                                                   const PylithInt numConstants,
-                                                                   const PylithScalar constants[],
-                                                                   PylithScalar Jf0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed auxiliary field.
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf0);
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    Jf0[0] += utshift * biotCoefficient;
-} // Jf0pe
-
-
-// -----------------------------------------------------------------------------
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0ppdot(const PylithInt dim,
-                                                                      const PylithInt numS,
-                                                                      const PylithInt numA,
-                                                                      const PylithInt sOff[],
-                                                                      const PylithInt sOff_x[],
-                                                                      const PylithScalar s[],
-                                                                      const PylithScalar s_t[],
-                                                                      const PylithScalar s_x[],
-                                                                      const PylithInt aOff[],
-                                                                      const PylithInt aOff_x[],
-                                                                      const PylithScalar a[],
-                                                                      const PylithScalar a_t[],
-                                                                      const PylithScalar a_x[],
-                                                                      const PylithReal t,
-                                                                      const PylithReal utshift,
-                                                                      const PylithScalar x[],
-                                                                      const PylithInt numConstants,
-                                                                      const PylithScalar constants[],
-                                                                      PylithScalar Jf0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(Jf0);
-
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    Jf0[0] += 1.0 / biotModulus;
-} // Jf0ppdot
-
-
-// -----------------------------------------------------------------------------
-// Jf0pedot function for isotropic linear poroelasticity plane strain.
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pedot(const PylithInt dim,
-                                                                      const PylithInt numS,
-                                                                      const PylithInt numA,
-                                                                      const PylithInt sOff[],
-                                                                      const PylithInt sOff_x[],
-                                                                      const PylithScalar s[],
-                                                                      const PylithScalar s_t[],
-                                                                      const PylithScalar s_x[],
-                                                                      const PylithInt aOff[],
-                                                                      const PylithInt aOff_x[],
-                                                                      const PylithScalar a[],
-                                                                      const PylithScalar a_t[],
-                                                                      const PylithScalar a_x[],
-                                                                      const PylithReal t,
-                                                                      const PylithReal utshift,
-                                                                      const PylithScalar x[],
-                                                                      const PylithInt numConstants,
-                                                                      const PylithScalar constants[],
-                                                                      PylithScalar Jf0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed auxiliary field.
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf0);
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    Jf0[0] += biotCoefficient;
-} // Jf0pedot
-
-
-// ============================== RHS Residual =================================
-
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar g0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_implicit
-
-
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source(const PylithInt dim,
-                                                                        const PylithInt numS,
-                                                                        const PylithInt numA,
-                                                                        const PylithInt sOff[],
-                                                                        const PylithInt sOff_x[],
-                                                                        const PylithScalar s[],
-                                                                        const PylithScalar s_t[],
-                                                                        const PylithScalar s_x[],
-                                                                        const PylithInt aOff[],
-                                                                        const PylithInt aOff_x[],
-                                                                        const PylithScalar a[],
-                                                                        const PylithScalar a_t[],
-                                                                        const PylithScalar a_x[],
-                                                                        const PylithReal t,
-                                                                        const PylithScalar x[],
-                                                                        const PylithInt numConstants,
-                                                                        const PylithScalar constants[],
-                                                                        PylithScalar g0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 4;
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source
-
-
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_body(const PylithInt dim,
-                                                                             const PylithInt numS,
-                                                                             const PylithInt numA,
-                                                                             const PylithInt sOff[],
-                                                                             const PylithInt sOff_x[],
-                                                                             const PylithScalar s[],
-                                                                             const PylithScalar s_t[],
-                                                                             const PylithScalar s_x[],
-                                                                             const PylithInt aOff[],
-                                                                             const PylithInt aOff_x[],
-                                                                             const PylithScalar a[],
-                                                                             const PylithScalar a_t[],
-                                                                             const PylithScalar a_x[],
-                                                                             const PylithReal t,
-                                                                             const PylithScalar x[],
-                                                                             const PylithInt numConstants,
-                                                                             const PylithScalar constants[],
-                                                                             PylithScalar g0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 5;
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_body
-
-
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav(const PylithInt dim,
-                                                                             const PylithInt numS,
-                                                                             const PylithInt numA,
-                                                                             const PylithInt sOff[],
-                                                                             const PylithInt sOff_x[],
-                                                                             const PylithScalar s[],
-                                                                             const PylithScalar s_t[],
-                                                                             const PylithScalar s_x[],
-                                                                             const PylithInt aOff[],
-                                                                             const PylithInt aOff_x[],
-                                                                             const PylithScalar a[],
-                                                                             const PylithScalar a_t[],
-                                                                             const PylithScalar a_x[],
-                                                                             const PylithReal t,
-                                                                             const PylithScalar x[],
-                                                                             const PylithInt numConstants,
-                                                                             const PylithScalar constants[],
-                                                                             PylithScalar g0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 5;
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_grav
-
-
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav_body(const PylithInt dim,
-                                                                                  const PylithInt numS,
-                                                                                  const PylithInt numA,
-                                                                                  const PylithInt sOff[],
-                                                                                  const PylithInt sOff_x[],
-                                                                                  const PylithScalar s[],
-                                                                                  const PylithScalar s_t[],
-                                                                                  const PylithScalar s_x[],
-                                                                                  const PylithInt aOff[],
-                                                                                  const PylithInt aOff_x[],
-                                                                                  const PylithScalar a[],
-                                                                                  const PylithScalar a_t[],
-                                                                                  const PylithScalar a_x[],
-                                                                                  const PylithReal t,
-                                                                                  const PylithScalar x[],
-                                                                                  const PylithInt numConstants,
-                                                                                  const PylithScalar constants[],
-                                                                                  PylithScalar g0[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 6;
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_grav_body
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity(const PylithInt dim,
-                                                                         const PylithInt numS,
-                                                                         const PylithInt numA,
-                                                                         const PylithInt sOff[],
-                                                                         const PylithInt sOff_x[],
-                                                                         const PylithScalar s[],
-                                                                         const PylithScalar s_t[],
-                                                                         const PylithScalar s_x[],
-                                                                         const PylithInt aOff[],
-                                                                         const PylithInt aOff_x[],
-                                                                         const PylithScalar a[],
-                                                                         const PylithScalar a_t[],
-                                                                         const PylithScalar a_x[],
-                                                                         const PylithReal t,
-                                                                         const PylithScalar x[],
-                                                                         const PylithInt numConstants,
-                                                                         const PylithScalar constants[],
-                                                                         PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar* gravityField = &a[aOff[i_gravityField]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        g1[d] -= (isotropicPermeability / fluidViscosity) * (pressure_x[d] - fluidDensity*gravityField[d]);
-    } // for
-
-} // g1p_gravity
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity_tensor_permeability(const PylithInt dim,
-                                                                                             const PylithInt numS,
-                                                                                             const PylithInt numA,
-                                                                                             const PylithInt sOff[],
-                                                                                             const PylithInt sOff_x[],
-                                                                                             const PylithScalar s[],
-                                                                                             const PylithScalar s_t[],
-                                                                                             const PylithScalar s_x[],
-                                                                                             const PylithInt aOff[],
-                                                                                             const PylithInt aOff_x[],
-                                                                                             const PylithScalar a[],
-                                                                                             const PylithScalar a_t[],
-                                                                                             const PylithScalar a_x[],
-                                                                                             const PylithReal t,
-                                                                                             const PylithScalar x[],
-                                                                                             const PylithInt numConstants,
-                                                                                             const PylithScalar constants[],
-                                                                                             PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar* gravityField = &a[aOff[i_gravityField]];
-
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            g1[i] -= (tensorPermeability[i*_dim+j] / fluidViscosity) * (pressure_x[j] - fluidDensity*gravityField[j]);
-        } // for
-    } // for
-
-} // g1p_gravity_tensor_permeability
-
-
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        g1[d] -= (isotropicPermeability / fluidViscosity) * pressure_x[d];
-    } // for
-} // g1p
-
-
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_tensor_permeability(const PylithInt dim,
-                                                                                     const PylithInt numS,
-                                                                                     const PylithInt numA,
-                                                                                     const PylithInt sOff[],
-                                                                                     const PylithInt sOff_x[],
-                                                                                     const PylithScalar s[],
-                                                                                     const PylithScalar s_t[],
-                                                                                     const PylithScalar s_x[],
-                                                                                     const PylithInt aOff[],
-                                                                                     const PylithInt aOff_x[],
-                                                                                     const PylithScalar a[],
-                                                                                     const PylithScalar a_t[],
-                                                                                     const PylithScalar a_x[],
-                                                                                     const PylithReal t,
-                                                                                     const PylithScalar x[],
-                                                                                     const PylithInt numConstants,
-                                                                                     const PylithScalar constants[],
-                                                                                     PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    PylithScalar tensorPermeability[4];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[1];
-    tensorPermeability[3] = vectorPermeability[3];
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            g1[i] -= (tensorPermeability[i*_dim+j] / fluidViscosity) * (pressure_x[j]);
-        } // for
-    } // for
-} // g1p_tensor_permeability
-
-
-// ----------------------------------------------------------------------
-// g1v function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
-// Dynamic Case
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1v(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-
-    PylithScalar trace_strain = 0.0;
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain += displacement_x[d*_dim+d];
-    }
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    for (PylithInt c = 0; c < _dim; ++c) {
-        for (PylithInt d = 0; d < _dim; ++d) {
-            g1[c*dim+d] -= shearModulus * (displacement_x[c*_dim+d] + displacement_x[d*_dim+c]);
-        } // for
-        g1[c*dim+c] -= (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
-        g1[c*dim+c] += biotCoefficient*pressure;
-    } // for
-} // g1v
-
-
-// ----------------------------------------------------------------------
-// g1v function for isotropic linear Poroelasticity plane strain with reference stress and strain.
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1v_refstate(const PylithInt dim,
-                                                                          const PylithInt numS,
-                                                                          const PylithInt numA,
-                                                                          const PylithInt sOff[],
-                                                                          const PylithInt sOff_x[],
-                                                                          const PylithScalar s[],
-                                                                          const PylithScalar s_t[],
-                                                                          const PylithScalar s_x[],
-                                                                          const PylithInt aOff[],
-                                                                          const PylithInt aOff_x[],
-                                                                          const PylithScalar a[],
-                                                                          const PylithScalar a_t[],
-                                                                          const PylithScalar a_x[],
-                                                                          const PylithReal t,
-                                                                          const PylithScalar x[],
-                                                                          const PylithInt numConstants,
-                                                                          const PylithScalar constants[],
-                                                                          PylithScalar g1[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-
-    PylithScalar trace_strain = 0.0;
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain += displacement_x[d*_dim+d];
-    }
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_rstress = numA - 7;
-    const PylithInt i_rstrain = numA - 6;
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
-    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
-
-    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
-    const PylithScalar meanRefStress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
-    const PylithScalar meanStress = meanRefStress + drainedBulkModulus * (trace_strain - ref_trace_strain);
-    const PylithScalar alphaPres = biotCoefficient * pressure;
-    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
-
-    // Convert reference vectors to refrence tensors
-    PylithScalar refStressTensor[_dim*_dim];
-    PylithScalar refStrainTensor[_dim*_dim];
-    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
-            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
-        } // for
-    } // for
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        g1[i*_dim+i] -= (meanStress - alphaPres);
-        g1[i*_dim+i] -= refStressTensor[i*_dim+i] - meanRefStress + traceTerm;
-        for (PylithInt j = 0; j < _dim; ++j) {
-            g1[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrainTensor[i*_dim+j];
-        } // for
-    } // for
-} // g1v_refstate
-
-
-// RHS Jacobians
-
-// ========================== Helper Kernels ===================================
-
-// ---------------------------------------------------------------------------------------------------------------------
-/* Calculate stress vector for isotropic linear
- * poroelasticity WITHOUT a reference stress and strain.
- *
- * Used to output the stress field.
- *
- * Solution fields: [displacement(dim), ...]
- * Auxiliary fields: [density(1), ..., shear_modulus(1), bulk_modulus(1)]
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::cauchyStress(const PylithInt dim,
-                                                                          const PylithInt numS,
-                                                                          const PylithInt numA,
-                                                                          const PylithInt sOff[],
-                                                                          const PylithInt sOff_x[],
-                                                                          const PylithScalar s[],
-                                                                          const PylithScalar s_t[],
-                                                                          const PylithScalar s_x[],
-                                                                          const PylithInt aOff[],
-                                                                          const PylithInt aOff_x[],
-                                                                          const PylithScalar a[],
-                                                                          const PylithScalar a_t[],
-                                                                          const PylithScalar a_x[],
-                                                                          const PylithReal t,
-                                                                          const PylithScalar x[],
-                                                                          const PylithInt numConstants,
-                                                                          const PylithScalar constants[],
-                                                                          PylithScalar stressVector[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
-
-    // Incoming auxiliary fields.
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    // Create and populate stress tensor
-
-    PylithScalar stressTensor[4] = { 0.0, 0.0, 0.0, 0.0 };
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            stressTensor[i*_dim+j] += shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]);
-        } // for
-        stressTensor[i*_dim+i] += (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
-        stressTensor[i*_dim+i] -= biotCoefficient*pressure;
-    } // for
-
-    // Construct stress vector
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-    const PylithScalar stress_zz = 0.5*lambda/(lambda+shearModulus) * (stressTensor[0*_dim+0] + stressTensor[1*_dim+1]);
-
-    stressVector[0] = stressTensor[0*_dim+0]; // stress_xx
-    stressVector[1] = stressTensor[1*_dim+1]; // stress_yy
-    stressVector[2] = stress_zz;
-    stressVector[3] = stressTensor[0*_dim+1]; // stress_xy
-} // cauchyStress
-
-
-// ---------------------------------------------------------------------------------------------------------------------
-/* Calculate stress vector for isotropic linear
- * poroelasticity WITH a reference stress/strain.
- *
- * Used to output the stress field.
- *
- * Solution fields: [displacement(dim), ...]
- * Auxiliary fields: [density(1), ..., refstress(4), refstrain(4), shear_modulus(1), bulk_modulus(1)]
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::cauchyStress_refstate(const PylithInt dim,
-                                                                                   const PylithInt numS,
-                                                                                   const PylithInt numA,
-                                                                                   const PylithInt sOff[],
-                                                                                   const PylithInt sOff_x[],
-                                                                                   const PylithScalar s[],
-                                                                                   const PylithScalar s_t[],
-                                                                                   const PylithScalar s_x[],
-                                                                                   const PylithInt aOff[],
-                                                                                   const PylithInt aOff_x[],
-                                                                                   const PylithScalar a[],
-                                                                                   const PylithScalar a_t[],
-                                                                                   const PylithScalar a_x[],
-                                                                                   const PylithReal t,
-                                                                                   const PylithScalar x[],
-                                                                                   const PylithInt numConstants,
-                                                                                   const PylithScalar constants[],
-                                                                                   PylithScalar stressVector[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_rstress = numA - 7;
-    const PylithInt i_rstrain = numA - 6;
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
-    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
-
-    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
-    const PylithScalar meanRefStress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
-    const PylithScalar meanStress = meanRefStress + drainedBulkModulus * (trace_strain - ref_trace_strain);
-    const PylithScalar alphaPres = biotCoefficient * pressure;
-    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
-
-    // Convert reference vectors to refrence tensors
-    PylithScalar refStressTensor[_dim*_dim];
-    PylithScalar refStrainTensor[_dim*_dim];
-    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
-            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
-        } // for
-    } // for
-
-    // Create and populate stress tensor
-
-    PylithScalar stressTensor[4] = { 0.0, 0.0, 0.0, 0.0 };
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        stressTensor[i*_dim+i] -= (meanStress - alphaPres);
-        stressTensor[i*_dim+i] -= refStressTensor[i*_dim+i] - meanRefStress + traceTerm;
-        for (PylithInt j = 0; j < _dim; ++j) {
-            stressTensor[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrainTensor[i*_dim+j];
-        } // for
-    } // for
-
-    // Generate stress vector
-
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-    const PylithScalar stress_zz = refStress[2] +  0.5*lambda/(lambda+shearModulus) *
-                                   (stressTensor[0*_dim+0]-refStress[0] + stressTensor[1*_dim+1]-refStress[1]);
-
-    stressVector[0] = stressTensor[0*_dim+0]; // stress_xx
-    stressVector[1] = stressTensor[1*_dim+1]; // stress_yy
-    stressVector[2] = stress_zz;
-    stressVector[3] = stressTensor[0*_dim+1]; // stress_xy
-} // cauchyStress_refstate
-
-
-// ========================== Update Kernels ===================================
-
-// ---------------------------------------------------------------------------------------------------------------------
-/* Update porosity for a linear poroelastic material, implicit.
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::updatePorosityImplicit(const PylithInt dim,
-                                                                                    const PylithInt numS,
-                                                                                    const PylithInt numA,
-                                                                                    const PylithInt sOff[],
-                                                                                    const PylithInt sOff_x[],
-                                                                                    const PylithScalar s[],
-                                                                                    const PylithScalar s_t[],
-                                                                                    const PylithScalar s_x[],
-                                                                                    const PylithInt aOff[],
-                                                                                    const PylithInt aOff_x[],
-                                                                                    const PylithScalar a[],
-                                                                                    const PylithScalar a_t[],
-                                                                                    const PylithScalar a_x[],
-                                                                                    const PylithReal t,
-                                                                                    const PylithScalar x[],
-                                                                                    const PylithInt numConstants,
-                                                                                    const PylithScalar constants[],
-                                                                                    PylithScalar porosity[]) {
-    const PylithInt _dim = 2;
-    // Incoming solution fields.
-    const PylithInt i_pressure_t = 4;
-    const PylithInt i_trace_strain_t = 5;
-
-    // Incoming re-packed auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_porosityPrev = 3;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Constants
-    const PylithScalar dt = constants[0];
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_porosityPrev] >= 0);
-    assert(porosity);
-
-    // Do stuff
-    const PylithScalar pressure_t = s ? s[sOff[i_pressure_t]] : 0.0;
-    const PylithScalar trace_strain_t = s ? s[sOff[i_trace_strain_t]] : 0.0;
-
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar porosityPrev = a[aOff[i_porosityPrev]];
-
-    // Update porosity
-    porosity[0] = porosityPrev + dt * ((biotCoefficient - porosityPrev) * trace_strain_t +
-                                       ((1.0 - biotCoefficient) * (biotCoefficient - porosityPrev)) /
-                                       drainedBulkModulus * pressure_t);
-
-} // updatePorosityImplicit
-
-
-// ---------------------------------------------------------------------------------------------------------------------
-/* Update porosity for a linear poroelastic material, explicit.
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::updatePorosityExplicit(const PylithInt dim,
-                                                                                    const PylithInt numS,
-                                                                                    const PylithInt numA,
-                                                                                    const PylithInt sOff[],
-                                                                                    const PylithInt sOff_x[],
-                                                                                    const PylithScalar s[],
-                                                                                    const PylithScalar s_t[],
-                                                                                    const PylithScalar s_x[],
-                                                                                    const PylithInt aOff[],
-                                                                                    const PylithInt aOff_x[],
-                                                                                    const PylithScalar a[],
-                                                                                    const PylithScalar a_t[],
-                                                                                    const PylithScalar a_x[],
-                                                                                    const PylithReal t,
-                                                                                    const PylithScalar x[],
-                                                                                    const PylithInt numConstants,
-                                                                                    const PylithScalar constants[],
-                                                                                    PylithScalar porosity[]) {
-    const PylithInt _dim = 2;
-
-    // Incoming solution fields.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_porosity = 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_porosity] >= 0);
-    assert(porosity);
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Constants
-    const PylithScalar dt = constants[0];
-
-#if 0 // :DEBUG:
-    std::cout << "dim:  " << dim << std::endl;
-    std::cout << "numS:  " << numS << std::endl;
-    std::cout << "numA:  " << numA << std::endl;
-    std::cout << "sOff[0]:  " << sOff[0] << std::endl;
-    std::cout << "sOff_x[0]:  " << sOff_x[0] << std::endl;
-    std::cout << "s[0]:  " << s[0] << std::endl;
-    std::cout << "aOff[0]:  " << aOff[0] << std::endl;
-    std::cout << "a[0]:  " << a[0] << std::endl;
-    std::cout << "t:  " << t << std::endl;
-    std::cout << "x[0]:  " << x[0] << std::endl;
-    std::cout << "numConstants:  " << numConstants << std::endl;
-    std::cout << "porosity[0]:  " << totalStrain[0] << std::endl;
-#endif
-
-    // Do stuff
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    PylithScalar trace_strain_t = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    // Update porosity
-    porosity[0] = a[aOff[i_porosity]] + dt * ((biotCoefficient - a[aOff[i_porosity]]) * trace_strain_t +
-                                              ((1.0 - biotCoefficient) * (biotCoefficient - a[aOff[i_porosity]])) /
-                                              drainedBulkModulus * pressure_t);
-} // updatePorosityExplicit
-
-
-// =====================================================================================================================
-// Kernels for isotropic, linear poroelasticity in 3D.
-// =====================================================================================================================
-
-// ----------------------------------------------------------------------
-
-// ================================= MMS =======================================
-
-// ----------------------------------------------------------------------
-// f0u function for quadratic space and linear time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_ql_u(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    // Incoming re-packed auxiliary field.
-
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_shearModulus] >= 0);
-    assert(aOff[i_drainedBulkModulus] >= 0);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(f0);
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-
-    for (PylithInt d = 0; d < _dim-1; ++d) {
-        f0[d] -= 2.0*shearModulus - biotCoefficient*t;
-    }
-    f0[_dim-1] -= 2.0*lambda + 4.0*shearModulus - biotCoefficient*t;
-} // f0_quadratic_linear_u
-
-
-// ----------------------------------------------------------------------
-// f0p function for quadratic space and linear time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_ql_p(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(f0);
-
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    PylithScalar sum = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        sum += x[d];
-    }
-    f0[0] -= sum/biotModulus;
-} // f0_quadratic_linear_p
-
-
-// ----------------------------------------------------------------------
-// f0u function for quadratic space and trigonometric time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_qt_u(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    // Incoming re-packed auxiliary field.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-
-    for (PylithInt d = 0; d < _dim-1; ++d) {
-        f0[d] -= 2.0*shearModulus - biotCoefficient*PetscCosReal(t);
-    }
-    f0[_dim-1] -= 2.0*lambda + 4.0*shearModulus - biotCoefficient*PetscCosReal(t);
-} // f0_quadratic_trig_u
-
-
-// ----------------------------------------------------------------------
-// f0p function for quadratic space and trigonometric time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_qt_p(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    const PylithInt i_biotModulus = numA - 2;
-
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    PylithScalar sum = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        sum += x[d];
-    }
-
-    f0[0] += PetscSinReal(t)*sum/biotModulus;
-} // f0_quadratic_trig_p
-
-
-// ----------------------------------------------------------------------
-// f0u function for trigonometric space and linear time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_tl_u(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    // Incoming re-packed auxiliary field.
-
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
-
-    for (PylithInt d = 0; d < _dim-1; ++d) {
-        f0[d] += PetscSqr(2.*PETSC_PI)*PetscSinReal(2.*PETSC_PI*x[d])*(2.*shearModulus + lambda) + 2.0*(shearModulus + lambda) - 2.*PETSC_PI*biotCoefficient*PetscSinReal(2.*PETSC_PI*x[d])*t;
-    }
-    f0[_dim-1] += PetscSqr(2.*PETSC_PI)*PetscSinReal(2.*PETSC_PI*x[_dim-1])*(2.*shearModulus + lambda) - 2.*PETSC_PI*biotCoefficient*PetscSinReal(2.*PETSC_PI*x[_dim-1])*t;
-} // f0_trig_linear_u
-
-
-// ----------------------------------------------------------------------
-// f0p function for trigonometric space and linear time MMS.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_tl_p(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-    const PylithInt i_biotModulus = numA - 2;
-
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-    const PylithScalar kappa = a[aOff[i_isotropicPermeability]] / a[aOff[i_fluidViscosity]];
-    PylithScalar sum = 0.0;
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        sum += PetscCosReal(2.*PETSC_PI*x[d]);
-    }
-
-    f0[0] -= sum/biotModulus - 4*PetscSqr(PETSC_PI)*kappa*sum*t;
-} // f0_quadratic_trig_p
-
-
-// ================================= STD =======================================
-
-// ================================= LHS =======================================
-
-// ----------------------------------------------------------------------
-// f0p function for explicit time stepping (dynamic).
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_explicit(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar f0[]) {
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming re-packed auxiliary field.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotModulus = numA - 2;
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += pressure_t/biotModulus;
-} // f0p_explicit
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar f0[]) {
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    // Incoming re-packed auxiliary field.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-} // f0p_implicit
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source(const PylithInt dim,
-                                                                        const PylithInt numS,
-                                                                        const PylithInt numA,
-                                                                        const PylithInt sOff[],
-                                                                        const PylithInt sOff_x[],
-                                                                        const PylithScalar s[],
-                                                                        const PylithScalar s_t[],
-                                                                        const PylithScalar s_x[],
-                                                                        const PylithInt aOff[],
-                                                                        const PylithInt aOff_x[],
-                                                                        const PylithScalar a[],
-                                                                        const PylithScalar a_t[],
-                                                                        const PylithScalar a_x[],
-                                                                        const PylithReal t,
-                                                                        const PylithScalar x[],
-                                                                        const PylithInt numConstants,
-                                                                        const PylithScalar constants[],
-                                                                        PylithScalar f0[]) {
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 4;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_body(const PylithInt dim,
-                                                                             const PylithInt numS,
-                                                                             const PylithInt numA,
-                                                                             const PylithInt sOff[],
-                                                                             const PylithInt sOff_x[],
-                                                                             const PylithScalar s[],
-                                                                             const PylithScalar s_t[],
-                                                                             const PylithScalar s_x[],
-                                                                             const PylithInt aOff[],
-                                                                             const PylithInt aOff_x[],
-                                                                             const PylithScalar a[],
-                                                                             const PylithScalar a_t[],
-                                                                             const PylithScalar a_x[],
-                                                                             const PylithReal t,
-                                                                             const PylithScalar x[],
-                                                                             const PylithInt numConstants,
-                                                                             const PylithScalar constants[],
-                                                                             PylithScalar f0[]) {
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 5;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_body
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav(const PylithInt dim,
-                                                                             const PylithInt numS,
-                                                                             const PylithInt numA,
-                                                                             const PylithInt sOff[],
-                                                                             const PylithInt sOff_x[],
-                                                                             const PylithScalar s[],
-                                                                             const PylithScalar s_t[],
-                                                                             const PylithScalar s_x[],
-                                                                             const PylithInt aOff[],
-                                                                             const PylithInt aOff_x[],
-                                                                             const PylithScalar a[],
-                                                                             const PylithScalar a_t[],
-                                                                             const PylithScalar a_x[],
-                                                                             const PylithReal t,
-                                                                             const PylithScalar x[],
-                                                                             const PylithInt numConstants,
-                                                                             const PylithScalar constants[],
-                                                                             PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 5;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar source = a[aOff[i_source]];
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_grav
-
-
-// ----------------------------------------------------------------------
-// f0p function for generic poroelasticity terms (body forces).
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav_body(const PylithInt dim,
-                                                                                  const PylithInt numS,
-                                                                                  const PylithInt numA,
-                                                                                  const PylithInt sOff[],
-                                                                                  const PylithInt sOff_x[],
-                                                                                  const PylithScalar s[],
-                                                                                  const PylithScalar s_t[],
-                                                                                  const PylithScalar s_x[],
-                                                                                  const PylithInt aOff[],
-                                                                                  const PylithInt aOff_x[],
-                                                                                  const PylithScalar a[],
-                                                                                  const PylithScalar a_t[],
-                                                                                  const PylithScalar a_x[],
-                                                                                  const PylithReal t,
-                                                                                  const PylithScalar x[],
-                                                                                  const PylithInt numConstants,
-                                                                                  const PylithScalar constants[],
-                                                                                  PylithScalar f0[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming re-packed solution field.
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-    const PylithInt i_source = 6;
-
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithInt i_biotModulus = numA - 2;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(sOff_x[i_trace_strain] >= 0);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(aOff[i_source] >= 0);
-    assert(f0);
-
-    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
-    const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
-
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
-
-    f0[0] += biotCoefficient*trace_strain_t;
-    f0[0] += pressure_t/biotModulus;
-    f0[0] -= source;
-} // f0p_implicit_source_grav_body
-
-
-// ----------------------------------------------------------------------
-// f1u function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
-// Quasi - Static Case
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1u(const PylithInt dim,
-                                                        const PylithInt numS,
-                                                        const PylithInt numA,
-                                                        const PylithInt sOff[],
-                                                        const PylithInt sOff_x[],
-                                                        const PylithScalar s[],
-                                                        const PylithScalar s_t[],
-                                                        const PylithScalar s_x[],
-                                                        const PylithInt aOff[],
-                                                        const PylithInt aOff_x[],
-                                                        const PylithScalar a[],
-                                                        const PylithScalar a_t[],
-                                                        const PylithScalar a_x[],
-                                                        const PylithReal t,
-                                                        const PylithScalar x[],
-                                                        const PylithInt numConstants,
-                                                        const PylithScalar constants[],
-                                                        PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 5);
-    assert(sOff);
-    assert(sOff[i_pressure] >= 0);
-    assert(sOff[i_trace_strain] >= 0);
-    assert(sOff_x);
-    assert(sOff_x[i_displacement] >= 0);
-    assert(aOff);
-    assert(aOff[i_shearModulus] >= 0);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(f1);
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    for (PylithInt c = 0; c < _dim; ++c) {
-        for (PylithInt d = 0; d < _dim; ++d) {
-            f1[c*_dim+d] -= shearModulus * (displacement_x[c*_dim+d] + displacement_x[d*_dim+c]);
-        } // for
-        f1[c*_dim+c] -= (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
-        f1[c*_dim+c] += biotCoefficient*pressure;
-    } // for
-} // f1u
-
-
-// ----------------------------------------------------------------------
-// f1u function for isotropic linear Poroelasticity plane strain with reference stress and strain.
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1u_refstate(const PylithInt dim,
-                                                                 const PylithInt numS,
-                                                                 const PylithInt numA,
-                                                                 const PylithInt sOff[],
-                                                                 const PylithInt sOff_x[],
-                                                                 const PylithScalar s[],
-                                                                 const PylithScalar s_t[],
-                                                                 const PylithScalar s_x[],
-                                                                 const PylithInt aOff[],
-                                                                 const PylithInt aOff_x[],
-                                                                 const PylithScalar a[],
-                                                                 const PylithScalar a_t[],
-                                                                 const PylithScalar a_x[],
-                                                                 const PylithReal t,
-                                                                 const PylithScalar x[],
-                                                                 const PylithInt numConstants,
-                                                                 const PylithScalar constants[],
-                                                                 PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution fields.
-    const PylithInt i_displacement = 0;
-    const PylithInt i_pressure = 1;
-    const PylithInt i_trace_strain = 2;
-
-    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
-    const PylithScalar pressure = s[sOff[i_pressure]];
-    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
-
-    // Incoming auxiliary fields.
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_rstress = numA - 7;
-    const PylithInt i_rstrain = numA - 6;
-    const PylithInt i_shearModulus = numA - 5;
-    const PylithInt i_drainedBulkModulus = numA - 4;
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
-    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
-    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
-
-    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
-    const PylithScalar meanrstress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
-    const PylithScalar meanStress = meanrstress + drainedBulkModulus * (trace_strain - ref_trace_strain);
-    const PylithScalar alphaPres = biotCoefficient * pressure;
-    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
-
-    // Convert reference vectors to refrence tensors
-    PylithScalar refStressTensor[_dim*_dim];
-    PylithScalar refStrainTensor[_dim*_dim];
-    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
-            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
-        } // for
-    } // for
-
-   assert(false); // :BUG: Reference stress and strain not used.
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        f1[i*_dim+i] -= (meanStress - alphaPres);
-        f1[i*_dim+i] -= refStress[i*_dim+i] - meanrstress + traceTerm;
-        for (PylithInt j = 0; j < _dim; ++j) {
-            f1[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrain[i*_dim+j];
-        } // for
-    } // for
-} // f1u_refstate
-
-
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p(const PylithInt dim,
-                                                        const PylithInt numS,
-                                                        const PylithInt numA,
-                                                        const PylithInt sOff[],
-                                                        const PylithInt sOff_x[],
-                                                        const PylithScalar s[],
-                                                        const PylithScalar s_t[],
-                                                        const PylithScalar s_x[],
-                                                        const PylithInt aOff[],
-                                                        const PylithInt aOff_x[],
-                                                        const PylithScalar a[],
-                                                        const PylithScalar a_t[],
-                                                        const PylithScalar a_x[],
-                                                        const PylithReal t,
-                                                        const PylithScalar x[],
-                                                        const PylithInt numConstants,
-                                                        const PylithScalar constants[],
-                                                        PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropicPermeability / fluidViscosity) * (pressure_x[d]);
-    } // for
-} // f1p
-
-
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_tensor_permeability(const PylithInt dim,
-                                                                            const PylithInt numS,
-                                                                            const PylithInt numA,
-                                                                            const PylithInt sOff[],
-                                                                            const PylithInt sOff_x[],
-                                                                            const PylithScalar s[],
-                                                                            const PylithScalar s_t[],
-                                                                            const PylithScalar s_x[],
-                                                                            const PylithInt aOff[],
-                                                                            const PylithInt aOff_x[],
-                                                                            const PylithScalar a[],
-                                                                            const PylithScalar a_t[],
-                                                                            const PylithScalar a_x[],
-                                                                            const PylithReal t,
-                                                                            const PylithScalar x[],
-                                                                            const PylithInt numConstants,
-                                                                            const PylithScalar constants[],
-                                                                            PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
-
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
-
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j]);
-        } // for
-    } // for
-} // f1p_tensor_permeability
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body(const PylithInt dim,
-                                                             const PylithInt numS,
-                                                             const PylithInt numA,
-                                                             const PylithInt sOff[],
-                                                             const PylithInt sOff_x[],
-                                                             const PylithScalar s[],
-                                                             const PylithScalar s_t[],
-                                                             const PylithScalar s_x[],
-                                                             const PylithInt aOff[],
-                                                             const PylithInt aOff_x[],
-                                                             const PylithScalar a[],
-                                                             const PylithScalar a_t[],
-                                                             const PylithScalar a_x[],
-                                                             const PylithReal t,
-                                                             const PylithScalar x[],
-                                                             const PylithInt numConstants,
-                                                             const PylithScalar constants[],
-                                                             PylithScalar f1[]) {
-    const PylithInt _dim = 3;
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1v_refstate(const PylithInt dim,
+                                                                          const PylithInt numS,
+                                                                          const PylithInt numA,
+                                                                          const PylithInt sOff[],
+                                                                          const PylithInt sOff_x[],
+                                                                          const PylithScalar s[],
+                                                                          const PylithScalar s_t[],
+                                                                          const PylithScalar s_x[],
+                                                                          const PylithInt aOff[],
+                                                                          const PylithInt aOff_x[],
+                                                                          const PylithScalar a[],
+                                                                          const PylithScalar a_t[],
+                                                                          const PylithScalar a_x[],
+                                                                          const PylithReal t,
+                                                                          const PylithScalar x[],
+                                                                          const PylithInt numConstants,
+                                                                          const PylithScalar constants[],
+                                                                          PylithScalar g1[]) {
+    const PylithInt _dim = 2;
 
-    // Incoming solution field.
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
     const PylithInt i_pressure = 1;
 
-    // Incoming auxiliary field.
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_body_force = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
 
+    PylithScalar trace_strain = 0.0;
     for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropicPermeability / fluidViscosity) * (pressure_x[d] - body_force[d]);
-    } // for
-
-} // f1p_gravity
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH body force, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_tensor_permeability(const PylithInt dim,
-                                                                                 const PylithInt numS,
-                                                                                 const PylithInt numA,
-                                                                                 const PylithInt sOff[],
-                                                                                 const PylithInt sOff_x[],
-                                                                                 const PylithScalar s[],
-                                                                                 const PylithScalar s_t[],
-                                                                                 const PylithScalar s_x[],
-                                                                                 const PylithInt aOff[],
-                                                                                 const PylithInt aOff_x[],
-                                                                                 const PylithScalar a[],
-                                                                                 const PylithScalar a_t[],
-                                                                                 const PylithScalar a_x[],
-                                                                                 const PylithReal t,
-                                                                                 const PylithScalar x[],
-                                                                                 const PylithInt numConstants,
-                                                                                 const PylithScalar constants[],
-                                                                                 PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
+        trace_strain += displacement_x[d*_dim+d];
+    }
 
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_body_force = 4;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    const PylithInt i_rstress = numA - 7;
+    const PylithInt i_rstrain = numA - 6;
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
+    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
 
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
+    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
+    const PylithScalar meanRefStress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
+    const PylithScalar meanStress = meanRefStress + drainedBulkModulus * (trace_strain - ref_trace_strain);
+    const PylithScalar alphaPres = biotCoefficient * pressure;
+    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
 
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
+    // Convert reference vectors to refrence tensors
+    PylithScalar refStressTensor[_dim*_dim];
+    PylithScalar refStrainTensor[_dim*_dim];
+    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
 
     for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - body_force[j]);
+        for (PylithInt j = 0; j < _dim; ++j) {
+            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
+            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
         } // for
     } // for
 
-} // f1p_gravity_tensor_permeability
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(aOff[i_gravityField] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar *gravityField = &a[aOff[i_gravityField]];
-
-    for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropicPermeability / fluidViscosity) * (pressure_x[d] - fluidDensity * gravityField[d]);
-    } // for
-
-} // f1p_gravity
-
-
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity_tensor_permeability(const PylithInt dim,
-                                                                                    const PylithInt numS,
-                                                                                    const PylithInt numA,
-                                                                                    const PylithInt sOff[],
-                                                                                    const PylithInt sOff_x[],
-                                                                                    const PylithScalar s[],
-                                                                                    const PylithScalar s_t[],
-                                                                                    const PylithScalar s_x[],
-                                                                                    const PylithInt aOff[],
-                                                                                    const PylithInt aOff_x[],
-                                                                                    const PylithScalar a[],
-                                                                                    const PylithScalar a_t[],
-                                                                                    const PylithScalar a_x[],
-                                                                                    const PylithReal t,
-                                                                                    const PylithScalar x[],
-                                                                                    const PylithInt numConstants,
-                                                                                    const PylithScalar constants[],
-                                                                                    PylithScalar f1[]) {
-    const PylithInt _dim = 3;
-
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_gravityField] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
-
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-
-    const PylithScalar *gravityField = &a[aOff[i_gravityField]];
-
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
-
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
-
     for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - fluidDensity * gravityField[j]);
+        g1[i*_dim+i] -= (meanStress - alphaPres);
+        g1[i*_dim+i] -= refStressTensor[i*_dim+i] - meanRefStress + traceTerm;
+        for (PylithInt j = 0; j < _dim; ++j) {
+            g1[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrainTensor[i*_dim+j];
         } // for
     } // for
+} // g1v_refstate
 
-} // f1p_gravity_tensor_permeability
 
+// RHS Jacobians
 
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
+// ========================== Helper Kernels ===================================
+
+// ---------------------------------------------------------------------------------------------------------------------
+/* Calculate stress vector for isotropic linear
+ * poroelasticity WITHOUT a reference stress and strain.
  *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
+ * Used to output the stress field.
  *
+ * Solution fields: [displacement(dim), ...]
+ * Auxiliary fields: [density(1), ..., shear_modulus(1), bulk_modulus(1)]
  */
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity(const PylithInt dim,
-                                                                     const PylithInt numS,
-                                                                     const PylithInt numA,
-                                                                     const PylithInt sOff[],
-                                                                     const PylithInt sOff_x[],
-                                                                     const PylithScalar s[],
-                                                                     const PylithScalar s_t[],
-                                                                     const PylithScalar s_x[],
-                                                                     const PylithInt aOff[],
-                                                                     const PylithInt aOff_x[],
-                                                                     const PylithScalar a[],
-                                                                     const PylithScalar a_t[],
-                                                                     const PylithScalar a_x[],
-                                                                     const PylithReal t,
-                                                                     const PylithScalar x[],
-                                                                     const PylithInt numConstants,
-                                                                     const PylithScalar constants[],
-                                                                     PylithScalar f1[]) {
-    const PylithInt _dim = 3;
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::cauchyStress(const PylithInt dim,
+                                                                          const PylithInt numS,
+                                                                          const PylithInt numA,
+                                                                          const PylithInt sOff[],
+                                                                          const PylithInt sOff_x[],
+                                                                          const PylithScalar s[],
+                                                                          const PylithScalar s_t[],
+                                                                          const PylithScalar s_x[],
+                                                                          const PylithInt aOff[],
+                                                                          const PylithInt aOff_x[],
+                                                                          const PylithScalar a[],
+                                                                          const PylithScalar a_t[],
+                                                                          const PylithScalar a_x[],
+                                                                          const PylithReal t,
+                                                                          const PylithScalar x[],
+                                                                          const PylithInt numConstants,
+                                                                          const PylithScalar constants[],
+                                                                          PylithScalar stressVector[]) {
+    const PylithInt _dim = 2;
 
-    // Incoming solution field.
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
     const PylithInt i_pressure = 1;
+    const PylithInt i_trace_strain = 2;
 
-    // Incoming auxiliary field.
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
+    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
 
+    // Incoming auxiliary fields.
     // Poroelasticity
-    const PylithInt i_fluid_density = 1;
-    const PylithInt i_fluid_viscosity = 2;
-
-    const PylithInt i_body_force = 4;
-    const PylithInt i_gravity_field = 5;
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropic_permeability = numA - 1;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluid_density] >= 0);
-    assert(aOff[i_fluid_viscosity] >= 0);
-    assert(aOff[i_isotropic_permeability] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_gravity_field] >= 0);
-    assert(f1);
-
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    const PylithScalar fluid_density = a[aOff[i_fluid_density]];
-    const PylithScalar fluid_viscosity = a[aOff[i_fluid_viscosity]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar *gravity_field = &a[aOff[i_gravity_field]];
+    // Create and populate stress tensor
 
-    const PylithScalar isotropic_permeability = a[aOff[i_isotropic_permeability]];
+    PylithScalar stressTensor[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        f1[d] += (isotropic_permeability / fluid_viscosity) * (pressure_x[d] - body_force[d] - fluid_density * gravity_field[d]);
+    for (PylithInt i = 0; i < _dim; ++i) {
+        for (PylithInt j = 0; j < _dim; ++j) {
+            stressTensor[i*_dim+j] += shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]);
+        } // for
+        stressTensor[i*_dim+i] += (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
+        stressTensor[i*_dim+i] -= biotCoefficient*pressure;
     } // for
 
-} // f1p_body_gravity
+    // Construct stress vector
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
+    const PylithScalar stress_zz = 0.5*lambda/(lambda+shearModulus) * (stressTensor[0*_dim+0] + stressTensor[1*_dim+1]);
+
+    stressVector[0] = stressTensor[0*_dim+0]; // stress_xx
+    stressVector[1] = stressTensor[1*_dim+1]; // stress_yy
+    stressVector[2] = stress_zz;
+    stressVector[3] = stressTensor[0*_dim+1]; // stress_xy
+} // cauchyStress
 
 
-// -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
+// ---------------------------------------------------------------------------------------------------------------------
+/* Calculate stress vector for isotropic linear
+ * poroelasticity WITH a reference stress/strain.
  *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
+ * Used to output the stress field.
  *
+ * Solution fields: [displacement(dim), ...]
+ * Auxiliary fields: [density(1), ..., refstress(4), refstrain(4), shear_modulus(1), bulk_modulus(1)]
  */
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity_tensor_permeability(const PylithInt dim,
-                                                                                         const PylithInt numS,
-                                                                                         const PylithInt numA,
-                                                                                         const PylithInt sOff[],
-                                                                                         const PylithInt sOff_x[],
-                                                                                         const PylithScalar s[],
-                                                                                         const PylithScalar s_t[],
-                                                                                         const PylithScalar s_x[],
-                                                                                         const PylithInt aOff[],
-                                                                                         const PylithInt aOff_x[],
-                                                                                         const PylithScalar a[],
-                                                                                         const PylithScalar a_t[],
-                                                                                         const PylithScalar a_x[],
-                                                                                         const PylithReal t,
-                                                                                         const PylithScalar x[],
-                                                                                         const PylithInt numConstants,
-                                                                                         const PylithScalar constants[],
-                                                                                         PylithScalar f1[]) {
-    const PylithInt _dim = 3;
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::cauchyStress_refstate(const PylithInt dim,
+                                                                                   const PylithInt numS,
+                                                                                   const PylithInt numA,
+                                                                                   const PylithInt sOff[],
+                                                                                   const PylithInt sOff_x[],
+                                                                                   const PylithScalar s[],
+                                                                                   const PylithScalar s_t[],
+                                                                                   const PylithScalar s_x[],
+                                                                                   const PylithInt aOff[],
+                                                                                   const PylithInt aOff_x[],
+                                                                                   const PylithScalar a[],
+                                                                                   const PylithScalar a_t[],
+                                                                                   const PylithScalar a_x[],
+                                                                                   const PylithReal t,
+                                                                                   const PylithScalar x[],
+                                                                                   const PylithInt numConstants,
+                                                                                   const PylithScalar constants[],
+                                                                                   PylithScalar stressVector[]) {
+    const PylithInt _dim = 2;
 
-    // Incoming solution field.
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
     const PylithInt i_pressure = 1;
+    const PylithInt i_trace_strain = 2;
 
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
+    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
 
-    const PylithInt i_body_force = 4;
-    const PylithInt i_gravity_field = 5;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    const PylithInt i_rstress = numA - 7;
+    const PylithInt i_rstrain = numA - 6;
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 4);
-    assert(sOff_x);
-    assert(sOff_x[i_pressure] >= 0);
-    assert(aOff);
-    assert(aOff[i_fluidDensity] >= 0);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_body_force] >= 0);
-    assert(aOff[i_gravity_field] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(f1);
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
+    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
 
-    const PylithScalar *pressure_x = &s_x[sOff_x[i_pressure]];
+    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
+    const PylithScalar meanRefStress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
+    const PylithScalar meanStress = meanRefStress + drainedBulkModulus * (trace_strain - ref_trace_strain);
+    const PylithScalar alphaPres = biotCoefficient * pressure;
+    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
 
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    // Convert reference vectors to refrence tensors
+    PylithScalar refStressTensor[_dim*_dim];
+    PylithScalar refStrainTensor[_dim*_dim];
+    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
 
-    const PylithScalar *body_force = &a[aOff[i_body_force]];
-    const PylithScalar *gravity_field = &a[aOff[i_gravity_field]];
+    for (PylithInt i = 0; i < _dim; ++i) {
+        for (PylithInt j = 0; j < _dim; ++j) {
+            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
+            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
+        } // for
+    } // for
 
-    const PylithScalar *vectorPermeability = &a[aOff[i_tensorPermeability]];
+    // Create and populate stress tensor
 
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
+    PylithScalar stressTensor[4] = { 0.0, 0.0, 0.0, 0.0 };
 
     for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            f1[i] += (tensorPermeability[i * _dim + j] / fluidViscosity) * (pressure_x[j] - body_force[j] - fluidDensity * gravity_field[j]);
+        stressTensor[i*_dim+i] -= (meanStress - alphaPres);
+        stressTensor[i*_dim+i] -= refStressTensor[i*_dim+i] - meanRefStress + traceTerm;
+        for (PylithInt j = 0; j < _dim; ++j) {
+            stressTensor[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrainTensor[i*_dim+j];
         } // for
     } // for
 
-} // f1p_body_gravity_tensor_permeability
+    // Generate stress vector
+
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
+    const PylithScalar stress_zz = refStress[2] +  0.5*lambda/(lambda+shearModulus) *
+                                   (stressTensor[0*_dim+0]-refStress[0] + stressTensor[1*_dim+1]-refStress[1]);
+
+    stressVector[0] = stressTensor[0*_dim+0]; // stress_xx
+    stressVector[1] = stressTensor[1*_dim+1]; // stress_yy
+    stressVector[2] = stress_zz;
+    stressVector[3] = stressTensor[0*_dim+1]; // stress_xy
+} // cauchyStress_refstate
 
 
-// =============================== LHS Jacobian ================================
+// ========================== Update Kernels ===================================
 
 // ---------------------------------------------------------------------------------------------------------------------
-/* Jg3_vu entry function for isotropic linear poroelasticity WITHOUT reference stress and reference strain.
- *
- * stress_ij = C_ijkl strain_kl
- *
- * stress_11 = C1111 strain_11 + C1122 strain_22, C1111=lambda+2mu, C1122=lambda.
- *
- * stress_12 = C1212 strain_12 + C1221 strain_21. C1212 = C1221 from symmetry, so C1212 = C1221 = shearModulus.
- *
- * For reference:
- *
- * Isotropic:
- *  C_ijkl = bulkModulus * delta_ij * delta_kl
- *   + shearModulus * (delta_ik*delta_jl + delta_il*delta*jk - 2/3*delta_ij*delta_kl)
+/* Update porosity for a linear poroelastic material, implicit.
  */
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3uu(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal s_tshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf3[]) {
-    const PylithInt _dim = 3;
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::updatePorosityImplicit(const PylithInt dim,
+                                                                                    const PylithInt numS,
+                                                                                    const PylithInt numA,
+                                                                                    const PylithInt sOff[],
+                                                                                    const PylithInt sOff_x[],
+                                                                                    const PylithScalar s[],
+                                                                                    const PylithScalar s_t[],
+                                                                                    const PylithScalar s_x[],
+                                                                                    const PylithInt aOff[],
+                                                                                    const PylithInt aOff_x[],
+                                                                                    const PylithScalar a[],
+                                                                                    const PylithScalar a_t[],
+                                                                                    const PylithScalar a_x[],
+                                                                                    const PylithReal t,
+                                                                                    const PylithScalar x[],
+                                                                                    const PylithInt numConstants,
+                                                                                    const PylithScalar constants[],
+                                                                                    PylithScalar porosity[]) {
+    const PylithInt _dim = 2;
+    // Incoming solution fields.
+    const PylithInt i_pressure_t = 4;
+    const PylithInt i_trace_strain_t = 5;
 
-    // Incoming solution field.
+    // Incoming re-packed auxiliary field.
 
-    // Incoming auxiliary fields.
+    // Poroelasticity
+    const PylithInt i_porosityPrev = 3;
 
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_shearModulus = numA - 5;
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
+
+    // Constants
+    const PylithScalar dt = constants[0];
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 1);
-    assert(numA >= 5);
+    assert(numS >= 3);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_shearModulus] >= 0);
-    assert(Jf3);
+    assert(aOff[i_porosityPrev] >= 0);
+    assert(porosity);
 
-    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    // Do stuff
+    const PylithScalar pressure_t = s ? s[sOff[i_pressure_t]] : 0.0;
+    const PylithScalar trace_strain_t = s ? s[sOff[i_trace_strain_t]] : 0.0;
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; ++j) {
-            Jf3[((i*_dim + i)*_dim + j)*_dim + j] -= shearModulus;
-            Jf3[((i*_dim + j)*_dim + j)*_dim + i] -= shearModulus;
-        }
-    }
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar porosityPrev = a[aOff[i_porosityPrev]];
 
-} // Jf3uu
+    // Update porosity
+    porosity[0] = porosityPrev + dt * ((biotCoefficient - porosityPrev) * trace_strain_t +
+                                       ((1.0 - biotCoefficient) * (biotCoefficient - porosityPrev)) /
+                                       drainedBulkModulus * pressure_t);
+
+} // updatePorosityImplicit
 
 
-// -----------------------------------------------------------------------------
-// Jf2up function for isotropic linear poroelasticity.
+// ---------------------------------------------------------------------------------------------------------------------
+/* Update porosity for a linear poroelastic material, explicit.
+ */
+void
+pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::updatePorosityExplicit(const PylithInt dim,
+                                                                                    const PylithInt numS,
+                                                                                    const PylithInt numA,
+                                                                                    const PylithInt sOff[],
+                                                                                    const PylithInt sOff_x[],
+                                                                                    const PylithScalar s[],
+                                                                                    const PylithScalar s_t[],
+                                                                                    const PylithScalar s_x[],
+                                                                                    const PylithInt aOff[],
+                                                                                    const PylithInt aOff_x[],
+                                                                                    const PylithScalar a[],
+                                                                                    const PylithScalar a_t[],
+                                                                                    const PylithScalar a_x[],
+                                                                                    const PylithReal t,
+                                                                                    const PylithScalar x[],
+                                                                                    const PylithInt numConstants,
+                                                                                    const PylithScalar constants[],
+                                                                                    PylithScalar porosity[]) {
+    const PylithInt _dim = 2;
+
+    // Incoming solution fields.
+    const PylithInt i_pressure = 1;
+    const PylithInt i_velocity = 2;
 
-void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf2up(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal utshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf2[]) {
-    const PylithInt _dim = 3;
+    // Incoming re-packed auxiliary field.
 
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
+    // Poroelasticity
+    const PylithInt i_porosity = 3;
 
     // Run Checks
     assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 5);
+    assert(numS >= 3);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf2);
+    assert(aOff[i_porosity] >= 0);
+    assert(porosity);
+
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
+
+    // Constants
+    const PylithScalar dt = constants[0];
+
+#if 0 // :DEBUG:
+    std::cout << "dim:  " << dim << std::endl;
+    std::cout << "numS:  " << numS << std::endl;
+    std::cout << "numA:  " << numA << std::endl;
+    std::cout << "sOff[0]:  " << sOff[0] << std::endl;
+    std::cout << "sOff_x[0]:  " << sOff_x[0] << std::endl;
+    std::cout << "s[0]:  " << s[0] << std::endl;
+    std::cout << "aOff[0]:  " << aOff[0] << std::endl;
+    std::cout << "a[0]:  " << a[0] << std::endl;
+    std::cout << "t:  " << t << std::endl;
+    std::cout << "x[0]:  " << x[0] << std::endl;
+    std::cout << "numConstants:  " << numConstants << std::endl;
+    std::cout << "porosity[0]:  " << totalStrain[0] << std::endl;
+#endif
+
+    // Do stuff
+    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
+    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
 
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
     const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
+    PylithScalar trace_strain_t = 0.0;
+
     for (PylithInt d = 0; d < _dim; ++d) {
-        Jf2[d*_dim+d] += biotCoefficient;
-    } // for
-} // Jf2up
+        trace_strain_t += velocity_x[d*_dim+d];
+    }
+
+    // Update porosity
+    porosity[0] = a[aOff[i_porosity]] + dt * ((biotCoefficient - a[aOff[i_porosity]]) * trace_strain_t +
+                                              ((1.0 - biotCoefficient) * (biotCoefficient - a[aOff[i_porosity]])) /
+                                              drainedBulkModulus * pressure_t);
+} // updatePorosityExplicit
 
 
-// -----------------------------------------------------------------------------
-// Jf2ue function for isotropic linear poroelasticity.
+// =====================================================================================================================
+// Kernels for isotropic, linear poroelasticity in 3D.
+// =====================================================================================================================
 
+// ----------------------------------------------------------------------
+
+// ================================= MMS =======================================
+
+// ----------------------------------------------------------------------
+// f0u function for quadratic space and linear time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf2ue(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal utshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf2[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_ql_u(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
-    // Isotropic Linear Poroelasticity
+    // Incoming re-packed solution field.
+
+    // Incoming re-packed auxiliary field.
+
+    // Poroelasticity
+
+    // IsotropicLinearPoroelasticity
     const PylithInt i_shearModulus = numA - 5;
     const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
     // Run Checks
     assert(_dim == dim);
     assert(numS >= 2);
-    assert(numA >= 5);
+    assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_drainedBulkModulus] >= 0);
     assert(aOff[i_shearModulus] >= 0);
-    assert(Jf2);
+    assert(aOff[i_drainedBulkModulus] >= 0);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(f0);
 
     const PylithScalar shearModulus = a[aOff[i_shearModulus]];
     const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        Jf2[d*_dim+d] -= drainedBulkModulus - (2.0*shearModulus) / 3.0;
-    } // for
-} // Jf2ue
+    for (PylithInt d = 0; d < _dim-1; ++d) {
+        f0[d] -= 2.0*shearModulus - biotCoefficient*t;
+    }
+    f0[_dim-1] -= 2.0*lambda + 4.0*shearModulus - biotCoefficient*t;
+} // f0_quadratic_linear_u
 
 
 // ----------------------------------------------------------------------
-/* Jf3pp entry function for isotropic linear poroelasticity. */
+// f0p function for quadratic space and linear time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal utshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf3[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_ql_p(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
-    // index of Incoming auxiliary fields.
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
+    // Incoming re-packed solution field.
 
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    const PylithInt i_biotModulus = numA - 2;
 
     // Run Checks
     assert(_dim == dim);
     assert(numS >= 2);
     assert(numA >= 3);
     assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_isotropicPermeability] >= 0);
-    assert(Jf3);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(f0);
+
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-    const PylithScalar isotropicPermeablity = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    PylithScalar sum = 0.0;
 
     for (PylithInt d = 0; d < _dim; ++d) {
-        Jf3[d*_dim+d] += isotropicPermeablity/fluidViscosity;
+        sum += x[d];
     }
-} // Jf3pp
+    f0[0] -= sum/biotModulus;
+} // f0_quadratic_linear_p
 
 
 // ----------------------------------------------------------------------
-/* Jf3pp entry function for isotropic linear poroelasticity, permeability in tensor form */
+// f0u function for quadratic space and trigonometric time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp_tensor_permeability(const PylithInt dim,
-                                                                              const PylithInt numS,
-                                                                              const PylithInt numA,
-                                                                              const PylithInt sOff[],
-                                                                              const PylithInt sOff_x[],
-                                                                              const PylithScalar s[],
-                                                                              const PylithScalar s_t[],
-                                                                              const PylithScalar s_x[],
-                                                                              const PylithInt aOff[],
-                                                                              const PylithInt aOff_x[],
-                                                                              const PylithScalar a[],
-                                                                              const PylithScalar a_t[],
-                                                                              const PylithScalar a_x[],
-                                                                              const PylithReal t,
-                                                                              const PylithReal utshift,
-                                                                              const PylithScalar x[],
-                                                                              const PylithInt numConstants,
-                                                                              const PylithScalar constants[],
-                                                                              PylithScalar Jf3[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_qt_u(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
-    // index of Incoming auxiliary fields.
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
-    // Isotropic Linear Poroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    // Incoming re-packed solution field.
 
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_fluidViscosity] >= 0);
-    assert(aOff[i_tensorPermeability] >= 0);
-    assert(Jf3);
+    // Incoming re-packed auxiliary field.
 
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            Jf3[i*_dim+j] += tensorPermeability[i*_dim+j]/fluidViscosity;
-        } // for
-    } // for
-} // Jf3pp_tensorPermeability
+    for (PylithInt d = 0; d < _dim-1; ++d) {
+        f0[d] -= 2.0*shearModulus - biotCoefficient*PetscCosReal(t);
+    }
+    f0[_dim-1] -= 2.0*lambda + 4.0*shearModulus - biotCoefficient*PetscCosReal(t);
+} // f0_quadratic_trig_u
 
 
-// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// f0p function for quadratic space and trigonometric time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pp(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal utshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_qt_p(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming auxiliary fields.
+    // Incoming re-packed solution field.
 
-    // IsotropicLinearPoroelasticity
     const PylithInt i_biotModulus = numA - 2;
 
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(Jf0);
-
     const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-    Jf0[0] = utshift / biotModulus;
-} // Jf0pp
+    PylithScalar sum = 0.0;
 
+    for (PylithInt d = 0; d < _dim; ++d) {
+        sum += x[d];
+    }
 
-// -----------------------------------------------------------------------------
-// Jf0pe function for isotropic linear poroelasticity plane strain.
+    f0[0] += PetscSinReal(t)*sum/biotModulus;
+} // f0_quadratic_trig_p
+
+
+// ----------------------------------------------------------------------
+// f0u function for trigonometric space and linear time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pe(const PylithInt dim,
-                                                          const PylithInt numS,
-                                                          const PylithInt numA,
-                                                          const PylithInt sOff[],
-                                                          const PylithInt sOff_x[],
-                                                          const PylithScalar s[],
-                                                          const PylithScalar s_t[],
-                                                          const PylithScalar s_x[],
-                                                          const PylithInt aOff[],
-                                                          const PylithInt aOff_x[],
-                                                          const PylithScalar a[],
-                                                          const PylithScalar a_t[],
-                                                          const PylithScalar a_x[],
-                                                          const PylithReal t,
-                                                          const PylithReal utshift,
-                                                          const PylithScalar x[],
-                                                          const PylithInt numConstants,
-                                                          const PylithScalar constants[],
-                                                          PylithScalar Jf0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_tl_u(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
+    // Incoming re-packed solution field.
+
     // Incoming re-packed auxiliary field.
+
+    // Poroelasticity
+
     // IsotropicLinearPoroelasticity
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
     const PylithInt i_biotCoefficient = numA - 3;
 
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 2);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf0);
-
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
     const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar lambda = drainedBulkModulus - 2.0/3.0*shearModulus;
 
-    Jf0[0] += utshift * biotCoefficient;
-} // Jf0pe
+    for (PylithInt d = 0; d < _dim-1; ++d) {
+        f0[d] += PetscSqr(2.*PETSC_PI)*PetscSinReal(2.*PETSC_PI*x[d])*(2.*shearModulus + lambda) + 2.0*(shearModulus + lambda) - 2.*PETSC_PI*biotCoefficient*PetscSinReal(2.*PETSC_PI*x[d])*t;
+    }
+    f0[_dim-1] += PetscSqr(2.*PETSC_PI)*PetscSinReal(2.*PETSC_PI*x[_dim-1])*(2.*shearModulus + lambda) - 2.*PETSC_PI*biotCoefficient*PetscSinReal(2.*PETSC_PI*x[_dim-1])*t;
+} // f0_trig_linear_u
 
 
-// -----------------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// f0p function for trigonometric space and linear time MMS.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0ppdot(const PylithInt dim,
-                                                             const PylithInt numS,
-                                                             const PylithInt numA,
-                                                             const PylithInt sOff[],
-                                                             const PylithInt sOff_x[],
-                                                             const PylithScalar s[],
-                                                             const PylithScalar s_t[],
-                                                             const PylithScalar s_x[],
-                                                             const PylithInt aOff[],
-                                                             const PylithInt aOff_x[],
-                                                             const PylithScalar a[],
-                                                             const PylithScalar a_t[],
-                                                             const PylithScalar a_x[],
-                                                             const PylithReal t,
-                                                             const PylithReal utshift,
-                                                             const PylithScalar x[],
-                                                             const PylithInt numConstants,
-                                                             const PylithScalar constants[],
-                                                             PylithScalar Jf0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0_mms_tl_p(const PylithInt dim,
+                                                                const PylithInt numS,
+                                                                const PylithInt numA,
+                                                                const PylithInt sOff[],
+                                                                const PylithInt sOff_x[],
+                                                                const PylithScalar s[],
+                                                                const PylithScalar s_t[],
+                                                                const PylithScalar s_x[],
+                                                                const PylithInt aOff[],
+                                                                const PylithInt aOff_x[],
+                                                                const PylithScalar a[],
+                                                                const PylithScalar a_t[],
+                                                                const PylithScalar a_x[],
+                                                                const PylithReal t,
+                                                                const PylithScalar x[],
+                                                                const PylithInt numConstants,
+                                                                const PylithScalar constants[],
+                                                                PylithScalar f0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming auxiliary fields.
+    // Incoming re-packed solution field.
+
+    // Poroelasticity
+    const PylithInt i_fluidViscosity = 2;
 
     // IsotropicLinearPoroelasticity
+    const PylithInt i_isotropicPermeability = numA - 1;
     const PylithInt i_biotModulus = numA - 2;
 
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotModulus] >= 0);
-    assert(Jf0);
-
     const PylithScalar biotModulus = a[aOff[i_biotModulus]];
+    const PylithScalar kappa = a[aOff[i_isotropicPermeability]] / a[aOff[i_fluidViscosity]];
+    PylithScalar sum = 0.0;
 
-    Jf0[0] += 1.0 / biotModulus;
-} // Jf0ppdot
+    for (PylithInt d = 0; d < _dim; ++d) {
+        sum += PetscCosReal(2.*PETSC_PI*x[d]);
+    }
 
+    f0[0] -= sum/biotModulus - 4*PetscSqr(PETSC_PI)*kappa*sum*t;
+} // f0_quadratic_trig_p
 
-// -----------------------------------------------------------------------------
-// Jf0pedot function for isotropic linear poroelasticity plane strain.
+
+// ================================= STD =======================================
+
+// ================================= LHS =======================================
+
+// ----------------------------------------------------------------------
+// f0p function for explicit time stepping (dynamic).
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pedot(const PylithInt dim,
-                                                             const PylithInt numS,
-                                                             const PylithInt numA,
-                                                             const PylithInt sOff[],
-                                                             const PylithInt sOff_x[],
-                                                             const PylithScalar s[],
-                                                             const PylithScalar s_t[],
-                                                             const PylithScalar s_x[],
-                                                             const PylithInt aOff[],
-                                                             const PylithInt aOff_x[],
-                                                             const PylithScalar a[],
-                                                             const PylithScalar a_t[],
-                                                             const PylithScalar a_x[],
-                                                             const PylithReal t,
-                                                             const PylithReal utshift,
-                                                             const PylithScalar x[],
-                                                             const PylithInt numConstants,
-                                                             const PylithScalar constants[],
-                                                             PylithScalar Jf0[]) {
-    const PylithInt _dim = 3;
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_explicit(const PylithInt dim,
+                                                                 const PylithInt numS,
+                                                                 const PylithInt numA,
+                                                                 const PylithInt sOff[],
+                                                                 const PylithInt sOff_x[],
+                                                                 const PylithScalar s[],
+                                                                 const PylithScalar s_t[],
+                                                                 const PylithScalar s_x[],
+                                                                 const PylithInt aOff[],
+                                                                 const PylithInt aOff_x[],
+                                                                 const PylithScalar a[],
+                                                                 const PylithScalar a_t[],
+                                                                 const PylithScalar a_x[],
+                                                                 const PylithReal t,
+                                                                 const PylithScalar x[],
+                                                                 const PylithInt numConstants,
+                                                                 const PylithScalar constants[],
+                                                                 PylithScalar f0[]) {
+    // Incoming re-packed solution field.
+    const PylithInt i_pressure = 1;
 
     // Incoming re-packed auxiliary field.
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-
-    // Run Checks
-    assert(_dim == dim);
-    assert(numS >= 3);
-    assert(numA >= 3);
-    assert(aOff);
-    assert(aOff[i_biotCoefficient] >= 0);
-    assert(Jf0);
 
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_biotModulus = numA - 2;
 
-    Jf0[0] += biotCoefficient;
-} // Jf0pedot
+    const PylithScalar pressure_t = s_t[sOff[i_pressure]];
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
+    f0[0] += pressure_t/biotModulus;
+} // f0p_explicit
 
-// ============================== RHS Residual =================================
 
 // ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
+// f1u function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
+// Quasi - Static Case
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p(const PylithInt dim,
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f1u(const PylithInt dim,
                                                         const PylithInt numS,
                                                         const PylithInt numA,
                                                         const PylithInt sOff[],
@@ -4579,465 +1650,505 @@ pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p(const PylithInt dim,
                                                         const PylithScalar x[],
                                                         const PylithInt numConstants,
                                                         const PylithScalar constants[],
-                                                        PylithScalar g0[]) {
+                                                        PylithScalar f1[]) {
     const PylithInt _dim = 3;
 
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
+    const PylithInt i_pressure = 1;
+    const PylithInt i_trace_strain = 2;
 
-    // Incoming re-packed auxiliary field.
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
     const PylithInt i_biotCoefficient = numA - 3;
 
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
-
-    PylithScalar trace_strain_t = 0.0;
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 5);
+    assert(sOff);
+    assert(sOff[i_pressure] >= 0);
+    assert(sOff[i_trace_strain] >= 0);
+    assert(sOff_x);
+    assert(sOff_x[i_displacement] >= 0);
+    assert(aOff);
+    assert(aOff[i_shearModulus] >= 0);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(f1);
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
+    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
 
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
     const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_implicit
+    for (PylithInt c = 0; c < _dim; ++c) {
+        for (PylithInt d = 0; d < _dim; ++d) {
+            f1[c*_dim+d] -= shearModulus * (displacement_x[c*_dim+d] + displacement_x[d*_dim+c]);
+        } // for
+        f1[c*_dim+c] -= (drainedBulkModulus - (2.0*shearModulus)/3.0) * trace_strain;
+        f1[c*_dim+c] += biotCoefficient*pressure;
+    } // for
+} // f1u
 
 
 // ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
-
+// f1u function for isotropic linear Poroelasticity plane strain with reference stress and strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source(const PylithInt dim,
-                                                               const PylithInt numS,
-                                                               const PylithInt numA,
-                                                               const PylithInt sOff[],
-                                                               const PylithInt sOff_x[],
-                                                               const PylithScalar s[],
-                                                               const PylithScalar s_t[],
-                                                               const PylithScalar s_x[],
-                                                               const PylithInt aOff[],
-                                                               const PylithInt aOff_x[],
-                                                               const PylithScalar a[],
-                                                               const PylithScalar a_t[],
-                                                               const PylithScalar a_x[],
-                                                               const PylithReal t,
-                                                               const PylithScalar x[],
-                                                               const PylithInt numConstants,
-                                                               const PylithScalar constants[],
-                                                               PylithScalar g0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::f1u_refstate(const PylithInt dim,
+                                                                 const PylithInt numS,
+                                                                 const PylithInt numA,
+                                                                 const PylithInt sOff[],
+                                                                 const PylithInt sOff_x[],
+                                                                 const PylithScalar s[],
+                                                                 const PylithScalar s_t[],
+                                                                 const PylithScalar s_x[],
+                                                                 const PylithInt aOff[],
+                                                                 const PylithInt aOff_x[],
+                                                                 const PylithScalar a[],
+                                                                 const PylithScalar a_t[],
+                                                                 const PylithScalar a_x[],
+                                                                 const PylithReal t,
+                                                                 const PylithScalar x[],
+                                                                 const PylithInt numConstants,
+                                                                 const PylithScalar constants[],
+                                                                 PylithScalar f1[]) {
     const PylithInt _dim = 3;
 
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
+    // Incoming solution fields.
+    const PylithInt i_displacement = 0;
+    const PylithInt i_pressure = 1;
+    const PylithInt i_trace_strain = 2;
 
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 4;
-    const PylithScalar source = a[aOff[i_source]];
+    const PylithScalar* displacement_x = &s_x[sOff_x[i_displacement]];
+    const PylithScalar pressure = s[sOff[i_pressure]];
+    const PylithScalar trace_strain = s[sOff[i_trace_strain]];
+
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
+    const PylithInt i_rstress = numA - 7;
+    const PylithInt i_rstrain = numA - 6;
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
     const PylithInt i_biotCoefficient = numA - 3;
+
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
     const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar* refStress = &a[aOff[i_rstress]]; // stress_xx, stress_yy, stress_zz, stress_xy
+    const PylithScalar* refStrain = &a[aOff[i_rstrain]]; // strain_xx, strain_yy, strain_zz, strain_xy
 
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
+    const PylithScalar ref_trace_strain = refStrain[0] + refStrain[1] + refStrain[2];
+    const PylithScalar meanrstress = (refStress[0] + refStress[1] + refStress[2]) / 3.0;
+    const PylithScalar meanStress = meanrstress + drainedBulkModulus * (trace_strain - ref_trace_strain);
+    const PylithScalar alphaPres = biotCoefficient * pressure;
+    const PylithReal traceTerm = (-2.0/3.0)*shearModulus * trace_strain;
 
-    PylithScalar trace_strain_t = 0.0;
+    // Convert reference vectors to refrence tensors
+    PylithScalar refStressTensor[_dim*_dim];
+    PylithScalar refStrainTensor[_dim*_dim];
+    PylithInt refTensorPos[9] = {0, 3, 5, 3, 1, 4, 5, 4, 2};
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
+    for (PylithInt i = 0; i < _dim; ++i) {
+        for (PylithInt j = 0; j < _dim; ++j) {
+            refStressTensor[i*_dim+j] = refStress[refTensorPos[i*_dim+j]];
+            refStrainTensor[i*_dim+j] = refStrain[refTensorPos[i*_dim+j]];
+        } // for
+    } // for
+
+   assert(false); // :BUG: Reference stress and strain not used.
 
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source
+    for (PylithInt i = 0; i < _dim; ++i) {
+        f1[i*_dim+i] -= (meanStress - alphaPres);
+        f1[i*_dim+i] -= refStress[i*_dim+i] - meanrstress + traceTerm;
+        for (PylithInt j = 0; j < _dim; ++j) {
+            f1[i*_dim+j] -= shearModulus * (displacement_x[i*_dim+j] + displacement_x[j*_dim+i]) - refStrain[i*_dim+j];
+        } // for
+    } // for
+} // f1u_refstate
 
 
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
+// =============================== LHS Jacobian ================================
 
+// ---------------------------------------------------------------------------------------------------------------------
+/* Jg3_vu entry function for isotropic linear poroelasticity WITHOUT reference stress and reference strain.
+ *
+ * stress_ij = C_ijkl strain_kl
+ *
+ * stress_11 = C1111 strain_11 + C1122 strain_22, C1111=lambda+2mu, C1122=lambda.
+ *
+ * stress_12 = C1212 strain_12 + C1221 strain_21. C1212 = C1221 from symmetry, so C1212 = C1221 = shearModulus.
+ *
+ * For reference:
+ *
+ * Isotropic:
+ *  C_ijkl = bulkModulus * delta_ij * delta_kl
+ *   + shearModulus * (delta_ik*delta_jl + delta_il*delta*jk - 2/3*delta_ij*delta_kl)
+ */
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_body(const PylithInt dim,
-                                                                    const PylithInt numS,
-                                                                    const PylithInt numA,
-                                                                    const PylithInt sOff[],
-                                                                    const PylithInt sOff_x[],
-                                                                    const PylithScalar s[],
-                                                                    const PylithScalar s_t[],
-                                                                    const PylithScalar s_x[],
-                                                                    const PylithInt aOff[],
-                                                                    const PylithInt aOff_x[],
-                                                                    const PylithScalar a[],
-                                                                    const PylithScalar a_t[],
-                                                                    const PylithScalar a_x[],
-                                                                    const PylithReal t,
-                                                                    const PylithScalar x[],
-                                                                    const PylithInt numConstants,
-                                                                    const PylithScalar constants[],
-                                                                    PylithScalar g0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3uu(const PylithInt dim,
+                                                          const PylithInt numS,
+                                                          const PylithInt numA,
+                                                          const PylithInt sOff[],
+                                                          const PylithInt sOff_x[],
+                                                          const PylithScalar s[],
+                                                          const PylithScalar s_t[],
+                                                          const PylithScalar s_x[],
+                                                          const PylithInt aOff[],
+                                                          const PylithInt aOff_x[],
+                                                          const PylithScalar a[],
+                                                          const PylithScalar a_t[],
+                                                          const PylithScalar a_x[],
+                                                          const PylithReal t,
+                                                          const PylithReal s_tshift,
+                                                          const PylithScalar x[],
+                                                          const PylithInt numConstants,
+                                                          const PylithScalar constants[],
+                                                          PylithScalar Jf3[]) {
     const PylithInt _dim = 3;
 
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
+    // Incoming solution field.
 
-    // Incoming re-packed auxiliary field.
-    // Poroelasticity
-    const PylithInt i_source = 5;
-    const PylithScalar source = a[aOff[i_source]];
+    // Incoming auxiliary fields.
 
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_shearModulus = numA - 5;
 
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 1);
+    assert(numA >= 5);
+    assert(aOff);
+    assert(aOff[i_shearModulus] >= 0);
+    assert(Jf3);
 
-    PylithScalar trace_strain_t = 0.0;
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
+    for (PylithInt i = 0; i < _dim; ++i) {
+        for (PylithInt j = 0; j < _dim; ++j) {
+            Jf3[((i*_dim + i)*_dim + j)*_dim + j] -= shearModulus;
+            Jf3[((i*_dim + j)*_dim + j)*_dim + i] -= shearModulus;
+        }
     }
 
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_body
+} // Jf3uu
 
 
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
+// -----------------------------------------------------------------------------
+// Jf2up function for isotropic linear poroelasticity.
+
+void
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf2up(const PylithInt dim,
+                                                          const PylithInt numS,
+                                                          const PylithInt numA,
+                                                          const PylithInt sOff[],
+                                                          const PylithInt sOff_x[],
+                                                          const PylithScalar s[],
+                                                          const PylithScalar s_t[],
+                                                          const PylithScalar s_x[],
+                                                          const PylithInt aOff[],
+                                                          const PylithInt aOff_x[],
+                                                          const PylithScalar a[],
+                                                          const PylithScalar a_t[],
+                                                          const PylithScalar a_x[],
+                                                          const PylithReal t,
+                                                          const PylithReal utshift,
+                                                          const PylithScalar x[],
+                                                          const PylithInt numConstants,
+                                                          const PylithScalar constants[],
+                                                          PylithScalar Jf2[]) {
+    const PylithInt _dim = 3;
+
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_biotCoefficient = numA - 3;
+
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 5);
+    assert(aOff);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf2);
+
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+
+    for (PylithInt d = 0; d < _dim; ++d) {
+        Jf2[d*_dim+d] += biotCoefficient;
+    } // for
+} // Jf2up
+
+
+// -----------------------------------------------------------------------------
+// Jf2ue function for isotropic linear poroelasticity.
 
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_grav(const PylithInt dim,
-                                                                    const PylithInt numS,
-                                                                    const PylithInt numA,
-                                                                    const PylithInt sOff[],
-                                                                    const PylithInt sOff_x[],
-                                                                    const PylithScalar s[],
-                                                                    const PylithScalar s_t[],
-                                                                    const PylithScalar s_x[],
-                                                                    const PylithInt aOff[],
-                                                                    const PylithInt aOff_x[],
-                                                                    const PylithScalar a[],
-                                                                    const PylithScalar a_t[],
-                                                                    const PylithScalar a_x[],
-                                                                    const PylithReal t,
-                                                                    const PylithScalar x[],
-                                                                    const PylithInt numConstants,
-                                                                    const PylithScalar constants[],
-                                                                    PylithScalar g0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf2ue(const PylithInt dim,
+                                                          const PylithInt numS,
+                                                          const PylithInt numA,
+                                                          const PylithInt sOff[],
+                                                          const PylithInt sOff_x[],
+                                                          const PylithScalar s[],
+                                                          const PylithScalar s_t[],
+                                                          const PylithScalar s_x[],
+                                                          const PylithInt aOff[],
+                                                          const PylithInt aOff_x[],
+                                                          const PylithScalar a[],
+                                                          const PylithScalar a_t[],
+                                                          const PylithScalar a_x[],
+                                                          const PylithReal t,
+                                                          const PylithReal utshift,
+                                                          const PylithScalar x[],
+                                                          const PylithInt numConstants,
+                                                          const PylithScalar constants[],
+                                                          PylithScalar Jf2[]) {
     const PylithInt _dim = 3;
 
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 5;
-    const PylithScalar source = a[aOff[i_source]];
-
-    // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    // Isotropic Linear Poroelasticity
+    const PylithInt i_shearModulus = numA - 5;
+    const PylithInt i_drainedBulkModulus = numA - 4;
 
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 5);
+    assert(aOff);
+    assert(aOff[i_drainedBulkModulus] >= 0);
+    assert(aOff[i_shearModulus] >= 0);
+    assert(Jf2);
 
-    PylithScalar trace_strain_t = 0.0;
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
 
     for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
-
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_grav
-
+        Jf2[d*_dim+d] -= drainedBulkModulus - (2.0*shearModulus) / 3.0;
+    } // for
+} // Jf2ue
 
-// ----------------------------------------------------------------------
-// g0p function for generic poroelasticity terms.
-// \left( \alpha \frac{\partial \epsilon_{v}}{\partial t} + \frac{1}{M} \frac{\partial p_{f}}{\partial t} \right)
-// \frac{\partial \epsilon)_{v}}{\partial t} = \frac{\nabla \cdot \vec{u}}{dt}
 
+// -----------------------------------------------------------------------------
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_grav_body(const PylithInt dim,
-                                                                         const PylithInt numS,
-                                                                         const PylithInt numA,
-                                                                         const PylithInt sOff[],
-                                                                         const PylithInt sOff_x[],
-                                                                         const PylithScalar s[],
-                                                                         const PylithScalar s_t[],
-                                                                         const PylithScalar s_x[],
-                                                                         const PylithInt aOff[],
-                                                                         const PylithInt aOff_x[],
-                                                                         const PylithScalar a[],
-                                                                         const PylithScalar a_t[],
-                                                                         const PylithScalar a_x[],
-                                                                         const PylithReal t,
-                                                                         const PylithScalar x[],
-                                                                         const PylithInt numConstants,
-                                                                         const PylithScalar constants[],
-                                                                         PylithScalar g0[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pp(const PylithInt dim,
+                                                          const PylithInt numS,
+                                                          const PylithInt numA,
+                                                          const PylithInt sOff[],
+                                                          const PylithInt sOff_x[],
+                                                          const PylithScalar s[],
+                                                          const PylithScalar s_t[],
+                                                          const PylithScalar s_x[],
+                                                          const PylithInt aOff[],
+                                                          const PylithInt aOff_x[],
+                                                          const PylithScalar a[],
+                                                          const PylithScalar a_t[],
+                                                          const PylithScalar a_x[],
+                                                          const PylithReal t,
+                                                          const PylithReal utshift,
+                                                          const PylithScalar x[],
+                                                          const PylithInt numConstants,
+                                                          const PylithScalar constants[],
+                                                          PylithScalar Jf0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming re-packed solution field.
-    const PylithInt i_velocity = 2;
-
-    // Incoming re-packed auxiliary field.
-    const PylithInt i_source = 6;
-    const PylithScalar source = a[aOff[i_source]];
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_biotCoefficient = numA - 3;
-    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
-
-    const PylithScalar* velocity_x = &s_x[sOff[i_velocity]];
+    const PylithInt i_biotModulus = numA - 2;
 
-    PylithScalar trace_strain_t = 0.0;
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 3);
+    assert(aOff);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        trace_strain_t += velocity_x[d*_dim+d];
-    }
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-    g0[0] += source;
-    g0[0] -= biotCoefficient*trace_strain_t;
-} // g0p_source_grav_body
+    Jf0[0] = utshift / biotModulus;
+} // Jf0pp
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// Jf0pp function for fixed-stress split preconditioner for isotropic linear poroelasticity 3D.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_gravity(const PylithInt dim,
-                                                                const PylithInt numS,
-                                                                const PylithInt numA,
-                                                                const PylithInt sOff[],
-                                                                const PylithInt sOff_x[],
-                                                                const PylithScalar s[],
-                                                                const PylithScalar s_t[],
-                                                                const PylithScalar s_x[],
-                                                                const PylithInt aOff[],
-                                                                const PylithInt aOff_x[],
-                                                                const PylithScalar a[],
-                                                                const PylithScalar a_t[],
-                                                                const PylithScalar a_x[],
-                                                                const PylithReal t,
-                                                                const PylithScalar x[],
-                                                                const PylithInt numConstants,
-                                                                const PylithScalar constants[],
-                                                                PylithScalar g1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pp_fixedstress(const PylithInt dim,
+                                                                      const PylithInt numS,
+                                                                      const PylithInt numA,
+                                                                      const PylithInt sOff[],
+                                                                      const PylithInt sOff_x[],
+                                                                      const PylithScalar s[],
+                                                                      const PylithScalar s_t[],
+                                                                      const PylithScalar s_x[],
+                                                                      const PylithInt aOff[],
+                                                                      const PylithInt aOff_x[],
+                                                                      const PylithScalar a[],
+                                                                      const PylithScalar a_t[],
+                                                                      const PylithScalar a_x[],
+                                                                      const PylithReal t,
+                                                                      const PylithReal utshift,
+                                                                      const PylithScalar x[],
+                                                                      const PylithInt numConstants,
+                                                                      const PylithScalar constants[],
+                                                                      PylithScalar Jf0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    const PylithInt i_drainedBulkModulus = numA - 4;
+    const PylithInt i_biotCoefficient = numA - 3;
+    const PylithInt i_biotModulus = numA - 2;
 
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar* gravityField = &a[aOff[i_gravityField]];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 4);
+    assert(aOff);
+    assert(aOff[i_drainedBulkModulus] >= 0);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        g1[d] -= (isotropicPermeability / fluidViscosity) * (pressure_x[d] - fluidDensity*gravityField[d]);
-    } // for
+    const PylithScalar drainedBulkModulus = a[aOff[i_drainedBulkModulus]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-} // g1p_gravity
+    Jf0[0] += utshift * (1.0 / biotModulus + biotCoefficient * biotCoefficient / drainedBulkModulus);
+} // Jf0pp_fixedstress
 
 
 // -----------------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITH gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure - grav)
- *
- */
+// Jf0pe function for isotropic linear poroelasticity plane strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_gravity_tensor_permeability(const PylithInt dim,
-                                                                                    const PylithInt numS,
-                                                                                    const PylithInt numA,
-                                                                                    const PylithInt sOff[],
-                                                                                    const PylithInt sOff_x[],
-                                                                                    const PylithScalar s[],
-                                                                                    const PylithScalar s_t[],
-                                                                                    const PylithScalar s_x[],
-                                                                                    const PylithInt aOff[],
-                                                                                    const PylithInt aOff_x[],
-                                                                                    const PylithScalar a[],
-                                                                                    const PylithScalar a_t[],
-                                                                                    const PylithScalar a_x[],
-                                                                                    const PylithReal t,
-                                                                                    const PylithScalar x[],
-                                                                                    const PylithInt numConstants,
-                                                                                    const PylithScalar constants[],
-                                                                                    PylithScalar g1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pe(const PylithInt dim,
+                                                          const PylithInt numS,
+                                                          const PylithInt numA,
+                                                          const PylithInt sOff[],
+                                                          const PylithInt sOff_x[],
+                                                          const PylithScalar s[],
+                                                          const PylithScalar s_t[],
+                                                          const PylithScalar s_x[],
+                                                          const PylithInt aOff[],
+                                                          const PylithInt aOff_x[],
+                                                          const PylithScalar a[],
+                                                          const PylithScalar a_t[],
+                                                          const PylithScalar a_x[],
+                                                          const PylithReal t,
+                                                          const PylithReal utshift,
+                                                          const PylithScalar x[],
+                                                          const PylithInt numConstants,
+                                                          const PylithScalar constants[],
+                                                          PylithScalar Jf0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidDensity = 1;
-    const PylithInt i_fluidViscosity = 2;
-    const PylithInt i_gravityField = 4;
-
+    // Incoming re-packed auxiliary field.
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
-    const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
-    const PylithScalar* gravityField = &a[aOff[i_gravityField]];
-
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 2);
+    assert(numA >= 3);
+    assert(aOff);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf0);
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            g1[i] -= (tensorPermeability[i*_dim+j] / fluidViscosity) * (pressure_x[j] - fluidDensity*gravityField[j]);
-        } // for
-    } // for
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-} // g1p_gravity_tensor_permeability
+    Jf0[0] += utshift * biotCoefficient;
+} // Jf0pe
 
 
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
+// -----------------------------------------------------------------------------
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p(const PylithInt dim,
-                                                        const PylithInt numS,
-                                                        const PylithInt numA,
-                                                        const PylithInt sOff[],
-                                                        const PylithInt sOff_x[],
-                                                        const PylithScalar s[],
-                                                        const PylithScalar s_t[],
-                                                        const PylithScalar s_x[],
-                                                        const PylithInt aOff[],
-                                                        const PylithInt aOff_x[],
-                                                        const PylithScalar a[],
-                                                        const PylithScalar a_t[],
-                                                        const PylithScalar a_x[],
-                                                        const PylithReal t,
-                                                        const PylithScalar x[],
-                                                        const PylithInt numConstants,
-                                                        const PylithScalar constants[],
-                                                        PylithScalar g1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0ppdot(const PylithInt dim,
+                                                             const PylithInt numS,
+                                                             const PylithInt numA,
+                                                             const PylithInt sOff[],
+                                                             const PylithInt sOff_x[],
+                                                             const PylithScalar s[],
+                                                             const PylithScalar s_t[],
+                                                             const PylithScalar s_x[],
+                                                             const PylithInt aOff[],
+                                                             const PylithInt aOff_x[],
+                                                             const PylithScalar a[],
+                                                             const PylithScalar a_t[],
+                                                             const PylithScalar a_x[],
+                                                             const PylithReal t,
+                                                             const PylithReal utshift,
+                                                             const PylithScalar x[],
+                                                             const PylithInt numConstants,
+                                                             const PylithScalar constants[],
+                                                             PylithScalar Jf0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
+    // Incoming auxiliary fields.
 
     // IsotropicLinearPoroelasticity
-    const PylithInt i_isotropicPermeability = numA - 1;
+    const PylithInt i_biotModulus = numA - 2;
 
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 3);
+    assert(numA >= 3);
+    assert(aOff);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(Jf0);
 
-    const PylithScalar isotropicPermeability = a[aOff[i_isotropicPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    const PylithScalar biotModulus = a[aOff[i_biotModulus]];
 
-    for (PylithInt d = 0; d < _dim; ++d) {
-        g1[d] -= (isotropicPermeability / fluidViscosity) * pressure_x[d];
-    } // for
-} // g1p
+    Jf0[0] += 1.0 / biotModulus;
+} // Jf0ppdot
 
 
-// ----------------------------------------------------------------------
-/* Calculate darcy flow rate for isotropic linear
- * poroelasticity WITHOUT gravity, permeability represented in tensor form.
- *
- * darcyFlow = -k / mu_f (det_poro_pressure)
- *
- */
+// -----------------------------------------------------------------------------
+// Jf0pedot function for isotropic linear poroelasticity plane strain.
 void
-pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_tensor_permeability(const PylithInt dim,
-                                                                            const PylithInt numS,
-                                                                            const PylithInt numA,
-                                                                            const PylithInt sOff[],
-                                                                            const PylithInt sOff_x[],
-                                                                            const PylithScalar s[],
-                                                                            const PylithScalar s_t[],
-                                                                            const PylithScalar s_x[],
-                                                                            const PylithInt aOff[],
-                                                                            const PylithInt aOff_x[],
-                                                                            const PylithScalar a[],
-                                                                            const PylithScalar a_t[],
-                                                                            const PylithScalar a_x[],
-                                                                            const PylithReal t,
-                                                                            const PylithScalar x[],
-                                                                            const PylithInt numConstants,
-                                                                            const PylithScalar constants[],
-                                                                            PylithScalar g1[]) {
+pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pedot(const PylithInt dim,
+                                                             const PylithInt numS,
+                                                             const PylithInt numA,
+                                                             const PylithInt sOff[],
+                                                             const PylithInt sOff_x[],
+                                                             const PylithScalar s[],
+                                                             const PylithScalar s_t[],
+                                                             const PylithScalar s_x[],
+                                                             const PylithInt aOff[],
+                                                             const PylithInt aOff_x[],
+                                                             const PylithScalar a[],
+                                                             const PylithScalar a_t[],
+                                                             const PylithScalar a_x[],
+                                                             const PylithReal t,
+                                                             const PylithReal utshift,
+                                                             const PylithScalar x[],
+                                                             const PylithInt numConstants,
+                                                             const PylithScalar constants[],
+                                                             PylithScalar Jf0[]) {
     const PylithInt _dim = 3;
 
-    // Incoming solution field.
-    const PylithInt i_pressure = 1;
-
-    // Incoming auxiliary field.
-
-    // Poroelasticity
-    const PylithInt i_fluidViscosity = 2;
-
+    // Incoming re-packed auxiliary field.
     // IsotropicLinearPoroelasticity
-    const PylithInt i_tensorPermeability = numA - 1;
+    const PylithInt i_biotCoefficient = numA - 3;
 
-    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
+    // Run Checks
+    assert(_dim == dim);
+    assert(numS >= 3);
+    assert(numA >= 3);
+    assert(aOff);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(Jf0);
 
-    const PylithScalar* vectorPermeability = &a[aOff[i_tensorPermeability]];
-    const PylithScalar fluidViscosity = a[aOff[i_fluidViscosity]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
 
-    PylithScalar tensorPermeability[9];
-    tensorPermeability[0] = vectorPermeability[0];
-    tensorPermeability[1] = vectorPermeability[3];
-    tensorPermeability[2] = vectorPermeability[5];
-    tensorPermeability[3] = vectorPermeability[3];
-    tensorPermeability[4] = vectorPermeability[1];
-    tensorPermeability[5] = vectorPermeability[4];
-    tensorPermeability[6] = vectorPermeability[5];
-    tensorPermeability[7] = vectorPermeability[4];
-    tensorPermeability[8] = vectorPermeability[2];
+    Jf0[0] += biotCoefficient;
+} // Jf0pedot
 
-    for (PylithInt i = 0; i < _dim; ++i) {
-        for (PylithInt j = 0; j < _dim; j++) {
-            g1[i] -= (tensorPermeability[i*_dim+j] / fluidViscosity) * (pressure_x[j]);
-        } // for
-    } // for
-} // g1p_tensor_permeability
 
+// ============================== RHS Residual =================================
 
 // ----------------------------------------------------------------------
 // g1v function for isotropic linear Poroelasticity WITHOUT reference stress and strain.
@@ -5509,4 +2620,411 @@ pylith::fekernels::IsotropicLinearPoroelasticity3D::updatePorosityExplicit(const
 } // updatePorosityExplicit
 
 
+// =====================================================================================================================
+// Kernels for isotropic, linear poroelasticity that depend on the optional auxiliary subfields.
+// =====================================================================================================================
+namespace pylith {
+    namespace fekernels {
+        namespace _IsotropicLinearPoroelasticityKernels {
+            // Indices of required auxiliary subfields.
+            static const PylithInt i_fluidDensity = 1;
+            static const PylithInt i_fluidViscosity = 2;
+            static const PylithInt i_bodyForce = 4;
+        } // _IsotropicLinearPoroelasticityKernels
+    } // fekernels
+} // pylith
+
+// ----------------------------------------------------------------------
+// f0p function for implicit time stepping.
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::f0p_implicit(const PylithInt dim,
+                                                                                               const PylithInt numS,
+                                                                                               const PylithInt numA,
+                                                                                               const PylithInt sOff[],
+                                                                                               const PylithInt sOff_x[],
+                                                                                               const PylithScalar s[],
+                                                                                               const PylithScalar s_t[],
+                                                                                               const PylithScalar s_x[],
+                                                                                               const PylithInt aOff[],
+                                                                                               const PylithInt aOff_x[],
+                                                                                               const PylithScalar a[],
+                                                                                               const PylithScalar a_t[],
+                                                                                               const PylithScalar a_x[],
+                                                                                               const PylithReal t,
+                                                                                               const PylithScalar x[],
+                                                                                               const PylithInt numConstants,
+                                                                                               const PylithScalar constants[],
+                                                                                               PylithScalar f0[]) {
+    // Incoming re-packed solution field.
+    const PylithInt i_pressure = 1;
+    const PylithInt i_trace_strain = 2;
+
+    // Incoming re-packed auxiliary field.
+    const PylithInt i_source = 4 + USE_BODY_FORCE + USE_GRAVITY;
+
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_biotCoefficient = numA - 3;
+    const PylithInt i_biotModulus = numA - 2;
+
+    // Run Checks
+    assert(DIM == dim);
+    assert(numS >= 3);
+    assert(numA >= 9 + USE_BODY_FORCE + USE_GRAVITY + USE_SOURCE_DENSITY);
+    assert(sOff);
+    assert(sOff[i_pressure] >= 0);
+    assert(sOff[i_trace_strain] >= 0);
+    assert(aOff);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(aOff[i_biotModulus] >= 0);
+    assert(!USE_SOURCE_DENSITY || aOff[i_source] >= 0);
+    assert(f0);
+
+    if (s_t) {
+        const PylithScalar pressure_t = s_t[sOff[i_pressure]];
+        const PylithScalar trace_strain_t = s_t[sOff[i_trace_strain]];
+
+        const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+        const PylithScalar biotModulus = a[aOff[i_biotModulus]];
+
+        f0[0] += biotCoefficient * trace_strain_t + pressure_t / biotModulus;
+    } // if
+    if (USE_SOURCE_DENSITY) {
+        f0[0] -= a[aOff[i_source]];
+    } // if
+} // f0p_implicit
+
+
+// -----------------------------------------------------------------------------
+/* Calculate Darcy flow rate for isotropic linear poroelasticity.
+ *
+ * darcyFlow = -k / mu_f (grad(p) - f - rho_f g)
+ */
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::f1p(const PylithInt dim,
+                                                                                      const PylithInt numS,
+                                                                                      const PylithInt numA,
+                                                                                      const PylithInt sOff[],
+                                                                                      const PylithInt sOff_x[],
+                                                                                      const PylithScalar s[],
+                                                                                      const PylithScalar s_t[],
+                                                                                      const PylithScalar s_x[],
+                                                                                      const PylithInt aOff[],
+                                                                                      const PylithInt aOff_x[],
+                                                                                      const PylithScalar a[],
+                                                                                      const PylithScalar a_t[],
+                                                                                      const PylithScalar a_x[],
+                                                                                      const PylithReal t,
+                                                                                      const PylithScalar x[],
+                                                                                      const PylithInt numConstants,
+                                                                                      const PylithScalar constants[],
+                                                                                      PylithScalar f1[]) {
+    // Incoming solution field.
+    const PylithInt i_pressure = 1;
+
+    // Run Checks
+    assert(DIM == dim);
+    assert(numS >= 2);
+    assert(numA >= 9 + USE_BODY_FORCE + USE_GRAVITY + USE_SOURCE_DENSITY);
+    assert(sOff_x);
+    assert(sOff_x[i_pressure] >= 0);
+    assert(aOff);
+    assert(f1);
+
+    PylithScalar mobility[DIM*DIM];
+    _mobility(numA, aOff, a, mobility);
+
+    PylithScalar drivingGradient[DIM];
+    _drivingGradient(sOff_x, s_x, aOff, a, drivingGradient);
+
+    for (PylithInt i = 0; i < DIM; ++i) {
+        for (PylithInt j = 0; j < DIM; ++j) {
+            f1[i] += mobility[i*DIM+j] * drivingGradient[j];
+        } // for
+    } // for
+} // f1p
+
+
+// ----------------------------------------------------------------------
+// Jf3pp entry function for isotropic linear poroelasticity.
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::Jf3pp(const PylithInt dim,
+                                                                                        const PylithInt numS,
+                                                                                        const PylithInt numA,
+                                                                                        const PylithInt sOff[],
+                                                                                        const PylithInt sOff_x[],
+                                                                                        const PylithScalar s[],
+                                                                                        const PylithScalar s_t[],
+                                                                                        const PylithScalar s_x[],
+                                                                                        const PylithInt aOff[],
+                                                                                        const PylithInt aOff_x[],
+                                                                                        const PylithScalar a[],
+                                                                                        const PylithScalar a_t[],
+                                                                                        const PylithScalar a_x[],
+                                                                                        const PylithReal t,
+                                                                                        const PylithReal utshift,
+                                                                                        const PylithScalar x[],
+                                                                                        const PylithInt numConstants,
+                                                                                        const PylithScalar constants[],
+                                                                                        PylithScalar Jf3[]) {
+    // Run Checks
+    assert(DIM == dim);
+    assert(numS >= 2);
+    assert(numA >= 9 + USE_BODY_FORCE + USE_GRAVITY + USE_SOURCE_DENSITY);
+    assert(aOff);
+    assert(Jf3);
+
+    PylithScalar mobility[DIM*DIM];
+    _mobility(numA, aOff, a, mobility);
+
+    for (PylithInt i = 0; i < DIM*DIM; ++i) {
+        Jf3[i] += mobility[i];
+    } // for
+} // Jf3pp
+
+
+// ----------------------------------------------------------------------
+// g0p function for explicit time stepping.
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::g0p(const PylithInt dim,
+                                                                                      const PylithInt numS,
+                                                                                      const PylithInt numA,
+                                                                                      const PylithInt sOff[],
+                                                                                      const PylithInt sOff_x[],
+                                                                                      const PylithScalar s[],
+                                                                                      const PylithScalar s_t[],
+                                                                                      const PylithScalar s_x[],
+                                                                                      const PylithInt aOff[],
+                                                                                      const PylithInt aOff_x[],
+                                                                                      const PylithScalar a[],
+                                                                                      const PylithScalar a_t[],
+                                                                                      const PylithScalar a_x[],
+                                                                                      const PylithReal t,
+                                                                                      const PylithScalar x[],
+                                                                                      const PylithInt numConstants,
+                                                                                      const PylithScalar constants[],
+                                                                                      PylithScalar g0[]) {
+    // Incoming re-packed solution field.
+    const PylithInt i_velocity = 2;
+
+    // Incoming re-packed auxiliary field.
+    const PylithInt i_source = 4 + USE_BODY_FORCE + USE_GRAVITY;
+
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_biotCoefficient = numA - 3;
+
+    // Run Checks
+    assert(DIM == dim);
+    assert(numS >= 3);
+    assert(numA >= 9 + USE_BODY_FORCE + USE_GRAVITY + USE_SOURCE_DENSITY);
+    assert(sOff_x);
+    assert(sOff_x[i_velocity] >= 0);
+    assert(aOff);
+    assert(aOff[i_biotCoefficient] >= 0);
+    assert(!USE_SOURCE_DENSITY || aOff[i_source] >= 0);
+    assert(g0);
+
+    const PylithScalar* velocity_x = &s_x[sOff_x[i_velocity]];
+    const PylithScalar biotCoefficient = a[aOff[i_biotCoefficient]];
+
+    PylithScalar trace_strain_t = 0.0;
+    for (PylithInt d = 0; d < DIM; ++d) {
+        trace_strain_t += velocity_x[d*DIM+d];
+    } // for
+
+    if (USE_SOURCE_DENSITY) {
+        g0[0] += a[aOff[i_source]];
+    } // if
+    g0[0] -= biotCoefficient * trace_strain_t;
+} // g0p
+
+
+// -----------------------------------------------------------------------------
+/* Calculate Darcy flow rate for isotropic linear poroelasticity.
+ *
+ * darcyFlow = -k / mu_f (grad(p) - f - rho_f g)
+ */
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::g1p(const PylithInt dim,
+                                                                                      const PylithInt numS,
+                                                                                      const PylithInt numA,
+                                                                                      const PylithInt sOff[],
+                                                                                      const PylithInt sOff_x[],
+                                                                                      const PylithScalar s[],
+                                                                                      const PylithScalar s_t[],
+                                                                                      const PylithScalar s_x[],
+                                                                                      const PylithInt aOff[],
+                                                                                      const PylithInt aOff_x[],
+                                                                                      const PylithScalar a[],
+                                                                                      const PylithScalar a_t[],
+                                                                                      const PylithScalar a_x[],
+                                                                                      const PylithReal t,
+                                                                                      const PylithScalar x[],
+                                                                                      const PylithInt numConstants,
+                                                                                      const PylithScalar constants[],
+                                                                                      PylithScalar g1[]) {
+    // Incoming solution field.
+    const PylithInt i_pressure = 1;
+
+    // Run Checks
+    assert(DIM == dim);
+    assert(numS >= 2);
+    assert(numA >= 9 + USE_BODY_FORCE + USE_GRAVITY + USE_SOURCE_DENSITY);
+    assert(sOff_x);
+    assert(sOff_x[i_pressure] >= 0);
+    assert(aOff);
+    assert(g1);
+
+    PylithScalar mobility[DIM*DIM];
+    _mobility(numA, aOff, a, mobility);
+
+    PylithScalar drivingGradient[DIM];
+    _drivingGradient(sOff_x, s_x, aOff, a, drivingGradient);
+
+    for (PylithInt i = 0; i < DIM; ++i) {
+        for (PylithInt j = 0; j < DIM; ++j) {
+            g1[i] -= mobility[i*DIM+j] * drivingGradient[j];
+        } // for
+    } // for
+} // g1p
+
+
+// ----------------------------------------------------------------------
+// Compute mobility tensor, k / mu_f, at a point.
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::_mobility(const PylithInt numA,
+                                                                                            const PylithInt aOff[],
+                                                                                            const PylithScalar a[],
+                                                                                            PylithScalar mobility[]) {
+    using namespace pylith::fekernels::_IsotropicLinearPoroelasticityKernels;
+
+    // IsotropicLinearPoroelasticity
+    const PylithInt i_permeability = numA - 1;
+
+    assert(aOff[i_fluidViscosity] >= 0);
+    assert(aOff[i_permeability] >= 0);
+
+    const PylithScalar invFluidViscosity = 1.0 / a[aOff[i_fluidViscosity]];
+    const PylithScalar* permeability = &a[aOff[i_permeability]];
+
+    if (USE_TENSOR_PERMEABILITY) {
+        // Permeability is stored as a vector: [xx, yy, zz, xy] in 2D and [xx, yy, zz, xy, yz, xz] in 3D.
+        if (2 == DIM) {
+            mobility[0] = permeability[0] * invFluidViscosity;
+            mobility[1] = permeability[3] * invFluidViscosity;
+            mobility[DIM+0] = permeability[3] * invFluidViscosity;
+            mobility[DIM+1] = permeability[1] * invFluidViscosity;
+        } else {
+            assert(3 == DIM);
+            mobility[0] = permeability[0] * invFluidViscosity;
+            mobility[1] = permeability[3] * invFluidViscosity;
+            mobility[2] = permeability[5] * invFluidViscosity;
+            mobility[DIM+0] = permeability[3] * invFluidViscosity;
+            mobility[DIM+1] = permeability[1] * invFluidViscosity;
+            mobility[DIM+2] = permeability[4] * invFluidViscosity;
+            mobility[2*DIM+0] = permeability[5] * invFluidViscosity;
+            mobility[2*DIM+1] = permeability[4] * invFluidViscosity;
+            mobility[2*DIM+2] = permeability[2] * invFluidViscosity;
+        } // if/else
+    } else {
+        const PylithScalar isotropicMobility = permeability[0] * invFluidViscosity;
+        for (PylithInt i = 0; i < DIM*DIM; ++i) {
+            mobility[i] = 0.0;
+        } // for
+        for (PylithInt i = 0; i < DIM; ++i) {
+            mobility[i*DIM+i] = isotropicMobility;
+        } // for
+    } // if/else
+} // _mobility
+
+
+// ----------------------------------------------------------------------
+// Compute pressure gradient minus body force and fluid weight at a point.
+template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+void
+pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY,
+                                                        USE_TENSOR_PERMEABILITY>::_drivingGradient(const PylithInt sOff_x[],
+                                                                                                   const PylithScalar s_x[],
+                                                                                                   const PylithInt aOff[],
+                                                                                                   const PylithScalar a[],
+                                                                                                   PylithScalar drivingGradient[]) {
+    using namespace pylith::fekernels::_IsotropicLinearPoroelasticityKernels;
+
+    // Incoming solution field.
+    const PylithInt i_pressure = 1;
+
+    // Incoming auxiliary field.
+    const PylithInt i_gravityField = 4 + USE_BODY_FORCE;
+
+    const PylithScalar* pressure_x = &s_x[sOff_x[i_pressure]];
+    for (PylithInt i = 0; i < DIM; ++i) {
+        drivingGradient[i] = pressure_x[i];
+    } // for
+
+    if (USE_BODY_FORCE) {
+        assert(aOff[i_bodyForce] >= 0);
+        const PylithScalar* bodyForce = &a[aOff[i_bodyForce]];
+        for (PylithInt i = 0; i < DIM; ++i) {
+            drivingGradient[i] -= bodyForce[i];
+        } // for
+    } // if
+
+    if (USE_GRAVITY) {
+        assert(aOff[i_fluidDensity] >= 0);
+        assert(aOff[i_gravityField] >= 0);
+        const PylithScalar fluidDensity = a[aOff[i_fluidDensity]];
+        const PylithScalar* gravityField = &a[aOff[i_gravityField]];
+        for (PylithInt i = 0; i < DIM; ++i) {
+            drivingGradient[i] -= fluidDensity * gravityField[i];
+        } // for
+    } // if
+} // _drivingGradient
+
+
+// ----------------------------------------------------------------------
+// Explicit instantiation for plane strain and 3D with all combinations of optional auxiliary subfields.
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, false, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, false, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, false, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, false, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, true, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, true, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, true, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, false, true, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, false, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, false, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, false, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, false, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, true, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, true, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, true, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<2, true, true, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, false, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, false, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, false, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, false, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, true, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, true, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, true, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, false, true, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, false, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, false, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, false, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, false, true, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, true, false, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, true, false, true>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, true, true, false>;
+template class pylith::fekernels::IsotropicLinearPoroelasticityKernels<3, true, true, true, true>;
+
 // End of file
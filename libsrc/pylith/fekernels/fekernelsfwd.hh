@@ -67,6 +67,8 @@ namespace pylith {
         class IsotropicLinearPoroelasticity;
         class IsotropicLinearPoroelasticityPlaneStrain;
         class IsotropicLinearPoroelasticity3D;
+        template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+        class IsotropicLinearPoroelasticityKernels;
 
         class TimeDependentFn;
         class NeumannTimeDependent;
@@ -107,6 +107,86 @@ pylith::materials::AuxiliaryFactoryViscoelastic::addMaxwellTimeGeneralizedMaxwel
 } // addMaxwellTimeGeneralizedMaxwell
 
 
+// ------------------------------------------------------------------------------------------------
+// Add Maxwell factors subfield to auxiliary fields.
+void
+pylith::materials::AuxiliaryFactoryViscoelastic::addMaxwellFactors(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addMaxwellFactors(void)");
+
+    const char* subfieldName = "maxwell_factors";
+    const char* componentNames[2] = {
+        "maxwell_decay_factor",
+        "maxwell_integration_factor"
+    };
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::OTHER;
+    description.numComponents = 2;
+    description.componentNames.resize(2);
+    for (int i = 0; i < 2; ++i) {
+        description.componentNames[i] = componentNames[i];
+    } // for
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    // Factors are derived from the Maxwell time and the time step; there is no query. We store them at
+    // the quadrature points, so the exponential decay factors are evaluated exactly at the points
+    // where they are used instead of being interpolated from the basis of the Maxwell time.
+    const pylith::topology::FieldBase::Discretization& discretizationTime = getSubfieldDiscretization("maxwell_time");
+    const pylith::topology::FieldBase::Discretization discretization(0, discretizationTime.quadOrder, discretizationTime.dimension,
+                                                                     -1, discretizationTime.isFaultOnly, discretizationTime.cellBasis,
+                                                                     pylith::topology::FieldBase::POINT_SPACE, false);
+    _field->subfieldAdd(description, discretization);
+
+    PYLITH_METHOD_END;
+} // addMaxwellFactors
+
+
+// ------------------------------------------------------------------------------------------------
+// Add Maxwell factors subfield for Generalized Maxwell model to auxiliary fields.
+void
+pylith::materials::AuxiliaryFactoryViscoelastic::addMaxwellFactorsGeneralizedMaxwell(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addMaxwellFactorsGeneralizedMaxwell(void)");
+
+    const char* subfieldName = "maxwell_factors";
+    const char* componentNames[6] = {
+        "maxwell_decay_factor_1",
+        "maxwell_decay_factor_2",
+        "maxwell_decay_factor_3",
+        "maxwell_integration_factor_1",
+        "maxwell_integration_factor_2",
+        "maxwell_integration_factor_3"
+    };
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::OTHER;
+    description.numComponents = 6;
+    description.componentNames.resize(6);
+    for (int i = 0; i < 6; ++i) {
+        description.componentNames[i] = componentNames[i];
+    } // for
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    // Factors are derived from the Maxwell times and the time step; there is no query. We store them at
+    // the quadrature points, so the exponential decay factors are evaluated exactly at the points
+    // where they are used instead of being interpolated from the basis of the Maxwell times.
+    const pylith::topology::FieldBase::Discretization& discretizationTime = getSubfieldDiscretization("maxwell_time");
+    const pylith::topology::FieldBase::Discretization discretization(0, discretizationTime.quadOrder, discretizationTime.dimension,
+                                                                     -1, discretizationTime.isFaultOnly, discretizationTime.cellBasis,
+                                                                     pylith::topology::FieldBase::POINT_SPACE, false);
+    _field->subfieldAdd(description, discretization);
+
+    PYLITH_METHOD_END;
+} // addMaxwellFactorsGeneralizedMaxwell
+
+
 // ------------------------------------------------------------------------------------------------
 // Add shear modulus ratio subfield for generalized Maxwell model to auxiliary fields.
 void
@@ -46,6 +46,16 @@ public:
     /// Add Maxwell time subfield for Generalized Maxwell to auxiliary subfields.
     void addMaxwellTimeGeneralizedMaxwell(void);
 
+    /** Add Maxwell factors subfield to auxiliary subfields.
+     *
+     * The decay and integration factors for the viscous strain are computed from the Maxwell time
+     * whenever the time step changes.
+     */
+    void addMaxwellFactors(void);
+
+    /// Add Maxwell factors subfield for Generalized Maxwell to auxiliary subfields.
+    void addMaxwellFactorsGeneralizedMaxwell(void);
+
     /// Add shear modulus ratio subfield for Generalized Maxwell to auxiliary subfields.
     void addShearModulusRatioGeneralizedMaxwell(void);
 
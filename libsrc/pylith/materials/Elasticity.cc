@@ -195,6 +195,9 @@ pylith::materials::Elasticity::createAuxiliaryField(const pylith::topology::Fiel
         auxiliaryFactory->addGravityField(_gravityField);
     } // if
     _rheology->addAuxiliarySubfields();
+    if (_useCompactUniformAuxiliary) {
+        auxiliaryFactory->compactUniformSubfields();
+    } // if
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
@@ -275,17 +278,12 @@ pylith::materials::Elasticity::getSolverDefaults(const bool isParallel,
                 options->add("-fieldsplit_displacement_pc_type", "lu");
                 options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "lu");
             } else {
-#if 1
-                options->add("-fieldsplit_displacement_pc_type", "ml");
-                options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "ml");
-#else
                 options->add("-fieldsplit_displacement_pc_type", "gamg");
                 options->add("-fieldsplit_displacement_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_displacement_mg_levels_ksp_type", "richardson");
                 options->add("-fieldsplit_lagrange_multiplier_fault_pc_type", "gamg");
                 options->add("-fieldsplit_lagrange_multiplier_fault_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_lagrange_multiplier_fault_mg_levels_ksp_type", "richardson");
-#endif
             } // if/else
         } // if/else
         break;
@@ -301,6 +299,15 @@ pylith::materials::Elasticity::getSolverDefaults(const bool isParallel,
 } // getSolverDefaults
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the LHS Jacobian for the material symmetric?
+bool
+pylith::materials::Elasticity::isJacobianSymmetric(void) const {
+    // Dynamic formulations add the inertia and (for IMEX) interface terms to the Jacobian.
+    return (pylith::problems::Physics::QUASISTATIC == _formulation) && _rheology && _rheology->isJacobianSymmetric();
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Get residual kernels for an interior interface bounding material.
 std::vector<pylith::materials::Material::InterfaceResidualKernels>
@@ -577,7 +584,7 @@ pylith::materials::Elasticity::_setKernelsJacobian(pylith::feassemble::Integrato
 
 
 // ------------------------------------------------------------------------------------------------
-// Set kernels for computing updated state variables in auxiliary field.
+// Set kernels for computing updated state variables and time step dependent subfields in auxiliary field.
 void
 pylith::materials::Elasticity::_setKernelsUpdateStateVars(pylith::feassemble::IntegratorDomain* integrator,
                                                           const topology::Field& solution) const {
@@ -592,6 +599,11 @@ pylith::materials::Elasticity::_setKernelsUpdateStateVars(pylith::feassemble::In
 
     integrator->setKernelsUpdateStateVars(kernels);
 
+    std::vector<ProjectKernels> kernelsTimeStep;
+    _rheology->addKernelsUpdateTimeStepVars(&kernelsTimeStep, coordsys);
+
+    integrator->setKernelsUpdateTimeStepVars(kernelsTimeStep);
+
     PYLITH_METHOD_END;
 } // _setKernelsUpdateStateVars
 
@@ -110,6 +110,12 @@ public:
     pylith::utils::PetscOptions* getSolverDefaults(const bool isParallel,
                                                    const bool hasFault) const;
 
+    /** Is the LHS Jacobian for the material symmetric?
+     *
+     * @returns True for the quasistatic formulation with a rheology that has a symmetric Jacobian.
+     */
+    bool isJacobianSymmetric(void) const;
+
     /** Get residual kernels for an interior interface bounding material.
      *
      * @param[in] solution Solution field.
@@ -168,7 +174,7 @@ private:
     void _setKernelsJacobian(pylith::feassemble::IntegratorDomain* integrator,
                              const pylith::topology::Field& solution) const;
 
-    /** Set kernels for computing updated state variables in auxiliary field.
+    /** Set kernels for computing updated state variables and time step dependent subfields in auxiliary field.
      *
      * @param[out] integrator Integrator for material.
      * @param[in] solution Solution field.
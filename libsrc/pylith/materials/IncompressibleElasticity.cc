@@ -183,6 +183,9 @@ pylith::materials::IncompressibleElasticity::createAuxiliaryField(const pylith::
         auxiliaryFactory->addGravityField(_gravityField);
     } // if
     _rheology->addAuxiliarySubfields();
+    if (_useCompactUniformAuxiliary) {
+        auxiliaryFactory->compactUniformSubfields();
+    } // if
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
@@ -197,4 +197,12 @@ pylith::materials::IsotropicLinearElasticity::getKernelCauchyStressVector(const
 } // getKernelDerivedCauchyStress
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the LHS Jacobian for the rheology symmetric?
+bool
+pylith::materials::IsotropicLinearElasticity::isJacobianSymmetric(void) const {
+    return true;
+} // isJacobianSymmetric
+
+
 // End of file
@@ -109,6 +109,12 @@ public:
      */
     PetscPointFunc getKernelCauchyStressVector(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Is the LHS Jacobian for the rheology symmetric?
+     *
+     * @returns True (elastic constants have major and minor symmetries).
+     */
+    bool isJacobianSymmetric(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -106,7 +106,8 @@ pylith::materials::IsotropicLinearGenMaxwell::addAuxiliarySubfields(void) {
     _auxiliaryFactory->addBulkModulus();
     _auxiliaryFactory->addMaxwellTimeGeneralizedMaxwell(); // 3
     _auxiliaryFactory->addShearModulusRatioGeneralizedMaxwell(); // 4
-    _auxiliaryFactory->addViscousStrainGeneralizedMaxwell(); // 5
+    _auxiliaryFactory->addMaxwellFactorsGeneralizedMaxwell(); // 5
+    _auxiliaryFactory->addViscousStrainGeneralizedMaxwell(); // 6
     _auxiliaryFactory->addTotalStrain();
 
     PYLITH_METHOD_END;
@@ -251,4 +252,21 @@ pylith::materials::IsotropicLinearGenMaxwell::addKernelsUpdateStateVars(std::vec
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Add kernels for updating auxiliary subfields that depend on the time step.
+void
+pylith::materials::IsotropicLinearGenMaxwell::addKernelsUpdateTimeStepVars(std::vector<ProjectKernels>* kernels,
+                                                                           const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("addKernelsUpdateTimeStepVars(kernels="<<kernels<<", coordsys="<<coordsys<<")");
+
+    assert(kernels);
+    size_t prevNumKernels = kernels->size();
+    kernels->resize(prevNumKernels + 1);
+    (*kernels)[prevNumKernels+0] = ProjectKernels("maxwell_factors", pylith::fekernels::IsotropicLinearGenMaxwell::maxwellFactors);
+
+    PYLITH_METHOD_END;
+} // addKernelsUpdateTimeStepVars
+
+
 // End of file
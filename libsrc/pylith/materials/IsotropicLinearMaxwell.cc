@@ -105,6 +105,7 @@ pylith::materials::IsotropicLinearMaxwell::addAuxiliarySubfields(void) {
     _auxiliaryFactory->addShearModulus();
     _auxiliaryFactory->addBulkModulus();
     _auxiliaryFactory->addMaxwellTime();
+    _auxiliaryFactory->addMaxwellFactors();
     _auxiliaryFactory->addViscousStrain();
     _auxiliaryFactory->addTotalStrain();
 
@@ -250,4 +251,21 @@ pylith::materials::IsotropicLinearMaxwell::addKernelsUpdateStateVars(std::vector
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Add kernels for updating auxiliary subfields that depend on the time step.
+void
+pylith::materials::IsotropicLinearMaxwell::addKernelsUpdateTimeStepVars(std::vector<ProjectKernels>* kernels,
+                                                                        const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("addKernelsUpdateTimeStepVars(kernels="<<kernels<<", coordsys="<<coordsys<<")");
+
+    assert(kernels);
+    size_t prevNumKernels = kernels->size();
+    kernels->resize(prevNumKernels + 1);
+    (*kernels)[prevNumKernels+0] = ProjectKernels("maxwell_factors", pylith::fekernels::IsotropicLinearMaxwell::maxwellFactors);
+
+    PYLITH_METHOD_END;
+} // addKernelsUpdateTimeStepVars
+
+
 // End of file
@@ -34,6 +34,103 @@
 // ---------------------------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace materials {
+        class _IsotropicLinearPoroelasticity {
+public:
+
+            /// Kernels that depend on the optional auxiliary subfields.
+            struct Kernels {
+                PetscPointFunc f0p_implicit;
+                PetscPointFunc f1p;
+                PetscPointJac Jf3pp;
+                PetscPointFunc g0p;
+                PetscPointFunc g1p;
+            }; // Kernels
+
+            /** Get kernels for the spatial dimension and optional auxiliary subfields.
+             *
+             * @param[in] spaceDim Spatial dimension.
+             * @param[in] useBodyForce Auxiliary field includes body force.
+             * @param[in] useGravity Auxiliary field includes gravity field.
+             * @param[in] useSourceDensity Auxiliary field includes source density.
+             * @param[in] useTensorPermeability Permeability is a tensor.
+             *
+             * @returns Kernels (NULL if spatial dimension is not supported).
+             */
+            static
+            Kernels getKernels(const int spaceDim,
+                               const bool useBodyForce,
+                               const bool useGravity,
+                               const bool useSourceDensity,
+                               const bool useTensorPermeability) {
+                const Kernels nullKernels = { NULL, NULL, NULL, NULL, NULL };
+                return (3 == spaceDim) ? _select<3>(useBodyForce, useGravity, useSourceDensity, useTensorPermeability) :
+                       (2 == spaceDim) ? _select<2>(useBodyForce, useGravity, useSourceDensity, useTensorPermeability) :
+                       nullKernels;
+            } // getKernels
+
+private:
+
+            // Convert runtime flags into template arguments, one flag at a time.
+            template<int DIM>
+            static
+            Kernels _select(const bool useBodyForce,
+                            const bool useGravity,
+                            const bool useSourceDensity,
+                            const bool useTensorPermeability) {
+                return useBodyForce ?
+                       _select<DIM, true>(useGravity, useSourceDensity, useTensorPermeability) :
+                       _select<DIM, false>(useGravity, useSourceDensity, useTensorPermeability);
+            } // _select
+
+            template<int DIM, bool USE_BODY_FORCE>
+            static
+            Kernels _select(const bool useGravity,
+                            const bool useSourceDensity,
+                            const bool useTensorPermeability) {
+                return useGravity ?
+                       _select<DIM, USE_BODY_FORCE, true>(useSourceDensity, useTensorPermeability) :
+                       _select<DIM, USE_BODY_FORCE, false>(useSourceDensity, useTensorPermeability);
+            } // _select
+
+            template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY>
+            static
+            Kernels _select(const bool useSourceDensity,
+                            const bool useTensorPermeability) {
+                return useSourceDensity ?
+                       _select<DIM, USE_BODY_FORCE, USE_GRAVITY, true>(useTensorPermeability) :
+                       _select<DIM, USE_BODY_FORCE, USE_GRAVITY, false>(useTensorPermeability);
+            } // _select
+
+            template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY>
+            static
+            Kernels _select(const bool useTensorPermeability) {
+                return useTensorPermeability ?
+                       _kernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY, true>() :
+                       _kernels<DIM, USE_BODY_FORCE, USE_GRAVITY, USE_SOURCE_DENSITY, false>();
+            } // _select
+
+            template<int DIM, bool USE_BODY_FORCE, bool USE_GRAVITY, bool USE_SOURCE_DENSITY, bool USE_TENSOR_PERMEABILITY>
+            static
+            Kernels _kernels(void) {
+                typedef pylith::fekernels::IsotropicLinearPoroelasticityKernels<DIM, USE_BODY_FORCE, USE_GRAVITY,
+                                                                                USE_SOURCE_DENSITY, USE_TENSOR_PERMEABILITY> kernels_t;
+                const Kernels kernels = {
+                    kernels_t::f0p_implicit,
+                    kernels_t::f1p,
+                    kernels_t::Jf3pp,
+                    kernels_t::g0p,
+                    kernels_t::g1p,
+                };
+                return kernels;
+            } // _kernels
+
+        }; // _IsotropicLinearPoroelasticity
+    } // materials
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::materials::IsotropicLinearPoroelasticity::IsotropicLinearPoroelasticity(void) :
@@ -142,60 +239,10 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelg0p(const spatialdata
                                                                const bool _gravityField,
                                                                const bool _useSourceDensity) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getKernelf0p="<<typeid(coordsys).name()<<")");
-
-    const int spaceDim = coordsys->getSpaceDim();
-    const int bitBodyForce = _useBodyForce ? 0x1 : 0x0;
-    const int bitGravity = _gravityField ? 0x2 : 0x0;
-    const int bitSourceDensity = _useSourceDensity ? 0x4 : 0x0;
-    const int bitUse = bitBodyForce | bitGravity | bitSourceDensity;
+    PYLITH_COMPONENT_DEBUG("getKernelg0p(coordsys="<<typeid(coordsys).name()<<")");
 
-    PetscPointFunc g0p = NULL;
-
-    switch (bitUse) {
-    case 0x0:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p :
-              NULL;
-        break;
-    case 0x1:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p :
-              NULL;
-        break;
-    case 0x2:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p :
-              NULL;
-        break;
-    case 0x4:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source :
-              NULL; // aOff for sourceDensity is 3
-        break;
-    case 0x3:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p :
-              NULL;
-        break;
-    case 0x5:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_body :
-              NULL; // aOff for sourceDensity is 4
-        break;
-    case 0x6:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_grav :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav :
-              NULL; // aOff for sourceDensity is 4
-        break;
-    case 0x7:
-        g0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g0p_source_grav_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav_body :
-              NULL; // aOff for sourceDensity is 5
-        break;
-    default:
-        PYLITH_COMPONENT_LOGICERROR("Unknown case (bitUse=" << bitUse << ") for Poroelasticity RHS residual kernels.");
-    } // switch
+    const PetscPointFunc g0p = _IsotropicLinearPoroelasticity::getKernels(coordsys->getSpaceDim(), _useBodyForce, _gravityField,
+                                                                          _useSourceDensity, _useTensorPermeability).g0p;
 
     PYLITH_METHOD_RETURN(g0p);
 } // getKernelg0p
@@ -205,45 +252,16 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelg0p(const spatialdata
 // Get darcy velocity kernel
 PetscPointFunc
 pylith::materials::IsotropicLinearPoroelasticity::getKernelg1p_explicit(const spatialdata::geocoords::CoordSys* coordsys,
+                                                                        const bool _useBodyForce,
                                                                         const bool _gravityField) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getKernelg1p_implicit="<<typeid(coordsys).name()<<")");
-
-    const int spaceDim = coordsys->getSpaceDim();
-    const int bitTensorPermeability = _useTensorPermeability ? 0x1 : 0x0;
-    const int bitGravityField = _gravityField ? 0x2 : 0x0;
-    const int bitUse = bitTensorPermeability | bitGravityField;
+    PYLITH_COMPONENT_DEBUG("getKernelg1p_explicit(coordsys="<<typeid(coordsys).name()<<")");
 
-    PetscPointFunc g1p = NULL;
-
-    switch (bitUse) {
-    case 0x0:
-        g1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p :
-              NULL;
-        break;
-    case 0x1:
-        g1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_tensor_permeability :
-              NULL;
-        break;
-    case 0x2:
-        g1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_gravity :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity :
-              NULL;
-        break;
-    case 0x3:
-        g1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::g1p_gravity_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity_tensor_permeability :
-              NULL;
-        break;
-    default:
-        PYLITH_COMPONENT_ERROR("Unknown combination of flags for  _useTensorPermeability="<<_useTensorPermeability<<", _gravityField="<<_gravityField<<").");
-        throw std::logic_error("Unknown combination of flags.");
-    } // switch
+    const PetscPointFunc g1p = _IsotropicLinearPoroelasticity::getKernels(coordsys->getSpaceDim(), _useBodyForce, _gravityField,
+                                                                          false, _useTensorPermeability).g1p;
 
     PYLITH_METHOD_RETURN(g1p);
-} // getKernelg1p_implicit
+} // getKernelg1p_explicit
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -306,60 +324,10 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelf0p_implicit(const sp
                                                                         const bool _gravityField,
                                                                         const bool _useSourceDensity) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getKernelf0p="<<typeid(coordsys).name()<<")");
-
-    const int spaceDim = coordsys->getSpaceDim();
-    const int bitBodyForce = _useBodyForce ? 0x1 : 0x0;
-    const int bitGravity = _gravityField ? 0x2 : 0x0;
-    const int bitSourceDensity = _useSourceDensity ? 0x4 : 0x0;
-    const int bitUse = bitBodyForce | bitGravity | bitSourceDensity;
+    PYLITH_COMPONENT_DEBUG("getKernelf0p_implicit(coordsys="<<typeid(coordsys).name()<<")");
 
-    PetscPointFunc f0p = NULL;
-
-    switch (bitUse) {
-    case 0x0:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
-        break;
-    case 0x1:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
-        break;
-    case 0x2:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
-        break;
-    case 0x4:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source :
-              NULL; // aOff for sourceDensity is 3
-        break;
-    case 0x3:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit :
-              NULL;
-        break;
-    case 0x5:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_body :
-              NULL; // aOff for sourceDensity is 4
-        break;
-    case 0x6:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav :
-              NULL; // aOff for sourceDensity is 4
-        break;
-    case 0x7:
-        f0p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav_body :
-              NULL; // aOff for sourceDensity is 5
-        break;
-    default:
-        PYLITH_COMPONENT_LOGICERROR("Unknown case (bitUse=" << bitUse << ") for Poroelasticity LHS residual kernels.");
-    } // switch
+    const PetscPointFunc f0p = _IsotropicLinearPoroelasticity::getKernels(coordsys->getSpaceDim(), _useBodyForce, _gravityField,
+                                                                          _useSourceDensity, _useTensorPermeability).f0p_implicit;
 
     PYLITH_METHOD_RETURN(f0p);
 } // getKernelf0p_implicit
@@ -405,62 +373,10 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelf1p_implicit(const sp
                                                                         const bool _useBodyForce,
                                                                         const bool _gravityField) const {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("getKernelf1p_implicit="<<typeid(coordsys).name()<<")");
+    PYLITH_COMPONENT_DEBUG("getKernelf1p_implicit(coordsys="<<typeid(coordsys).name()<<")");
 
-    const int spaceDim = coordsys->getSpaceDim();
-    const int bitTensorPermeability = _useTensorPermeability ? 0x1 : 0x0;
-    const int bitBodyForce = _useBodyForce ? 0x2 : 0x0;    
-    const int bitGravityField = _gravityField ? 0x4 : 0x0;
-    const int bitUse = bitTensorPermeability | bitBodyForce | bitGravityField;
-
-    PetscPointFunc f1p = NULL;
-
-    switch (bitUse) {
-    case 0x0:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p :
-              NULL;
-        break;
-    case 0x1:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_tensor_permeability :
-              NULL;
-        break;
-    case 0x2:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body :
-              NULL;
-        break;
-    case 0x3:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_tensor_permeability :
-              NULL;
-        break;
-    case 0x4:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity :
-              NULL;
-        break;
-    case 0x5:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_gravity_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity_tensor_permeability :
-              NULL;
-        break;
-    case 0x6:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity :
-              NULL;
-        break;
-    case 0x7:
-        f1p = (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::f1p_body_gravity_tensor_permeability :
-              (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity_tensor_permeability :
-              NULL;
-        break;
-
-    default:
-        PYLITH_COMPONENT_ERROR("Unknown combination of flags for  _useTensorPermeability="<<_useTensorPermeability<<", _useBodyForce="<<_useBodyForce<<", _gravityField="<<_gravityField<<").");
-        throw std::logic_error("Unknown combination of flags.");
-    } // switch
+    const PetscPointFunc f1p = _IsotropicLinearPoroelasticity::getKernels(coordsys->getSpaceDim(), _useBodyForce, _gravityField,
+                                                                          false, _useTensorPermeability).f1p;
 
     PYLITH_METHOD_RETURN(f1p);
 } // getKernelf1p_implicit
@@ -534,6 +450,23 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelJf0pp(const spatialda
 } // getKernelJf0pp
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get specific storage kernel with fixed-stress stabilization for LHS Jacobian preconditioner F(t,s, \dot{s}).
+PetscPointJac
+pylith::materials::IsotropicLinearPoroelasticity::getKernelJf0ppFixedStress(const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getKernelJf0ppFixedStress(coordsys="<<typeid(coordsys).name()<<")");
+
+    const int spaceDim = coordsys->getSpaceDim();
+    PetscPointJac Jf0pp =
+        (3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf0pp_fixedstress :
+        (2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf0pp_fixedstress :
+        NULL;
+
+    PYLITH_METHOD_RETURN(Jf0pp);
+} // getKernelJf0ppFixedStress
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Get Darcy Conductivity kernel for LHS Jacobian
 PetscPointJac
@@ -541,16 +474,11 @@ pylith::materials::IsotropicLinearPoroelasticity::getKernelJf3pp(const spatialda
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("getKernelJf3pp(coordsys="<<typeid(coordsys).name()<<")");
 
-    const int spaceDim = coordsys->getSpaceDim();
-    PetscPointJac Jf3pp =
-        (!_useTensorPermeability && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp :
-        (!_useTensorPermeability && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp :
-        (_useTensorPermeability && 3 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticity3D::Jf3pp_tensor_permeability :
-        (_useTensorPermeability && 2 == spaceDim) ? pylith::fekernels::IsotropicLinearPoroelasticityPlaneStrain::Jf3pp_tensor_permeability :
-        NULL;
+    const PetscPointJac Jf3pp = _IsotropicLinearPoroelasticity::getKernels(coordsys->getSpaceDim(), false, false,
+                                                                           false, _useTensorPermeability).Jf3pp;
 
     PYLITH_METHOD_RETURN(Jf3pp);
-} // getKerneJf3pp
+} // getKernelJf3pp
 
 
 // ---------------------------------------------------------------------------------------------------------------------
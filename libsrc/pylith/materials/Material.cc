@@ -29,6 +29,7 @@
 // Default constructor.
 pylith::materials::Material::Material(void) :
     _gravityField(NULL),
+    _useCompactUniformAuxiliary(false),
     _description("") {}
 
 
@@ -79,6 +80,24 @@ pylith::materials::Material::setGravityField(spatialdata::spatialdb::GravityFiel
 } // setGravityField
 
 
+// ------------------------------------------------------------------------------------------------
+// Use basis order 0 for auxiliary subfields from a uniform spatial database.
+void
+pylith::materials::Material::useCompactUniformAuxiliary(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useCompactUniformAuxiliary(value="<<value<<")");
+
+    _useCompactUniformAuxiliary = value;
+} // useCompactUniformAuxiliary
+
+
+// ------------------------------------------------------------------------------------------------
+// Use basis order 0 for auxiliary subfields from a uniform spatial database?
+bool
+pylith::materials::Material::useCompactUniformAuxiliary(void) const {
+    return _useCompactUniformAuxiliary;
+} // useCompactUniformAuxiliary
+
+
 // ------------------------------------------------------------------------------------------------
 // Set body force kernels (intended for use in MMS tests).
 void
@@ -108,6 +127,14 @@ pylith::materials::Material::getSolverDefaults(const bool isParallel,
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the LHS Jacobian for the material symmetric?
+bool
+pylith::materials::Material::isJacobianSymmetric(void) const {
+    return false;
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Get residual kernels for an interior interface bounding material.
 std::vector<pylith::materials::Material::InterfaceResidualKernels>
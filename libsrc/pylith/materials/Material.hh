@@ -93,6 +93,21 @@ public:
      */
     void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+    /** Use basis order 0 for auxiliary subfields (material properties) from a uniform spatial database.
+     *
+     * This overrides the basis order of read-only subfields filled from a UniformDB; state variables
+     * keep the basis order specified.
+     *
+     * @param[in] value True to use basis order 0 for read-only auxiliary subfields from a uniform spatial database.
+     */
+    void useCompactUniformAuxiliary(const bool value);
+
+    /** Use basis order 0 for auxiliary subfields (material properties) from a uniform spatial database?
+     *
+     * @returns True if using basis order 0 for read-only auxiliary subfields from a uniform spatial database.
+     */
+    bool useCompactUniformAuxiliary(void) const;
+
     /** Set body force kernels (intended for use in MMS tests).
      *
      * @param[in] kernels Array of body force kernels.
@@ -117,6 +132,13 @@ public:
     pylith::utils::PetscOptions* getSolverDefaults(const bool isParallel,
                                                    const bool hasFault) const;
 
+    /** Is the LHS Jacobian for the material symmetric?
+     *
+     * @returns True if the LHS Jacobian kernels yield a symmetric Jacobian, false otherwise.
+     */
+    virtual
+    bool isJacobianSymmetric(void) const;
+
     /** Get residual kernels for an interior interface bounding material.
      *
      * @param[in] solution Solution field.
@@ -142,6 +164,7 @@ protected:
 
     spatialdata::spatialdb::GravityField* _gravityField; ///< Gravity field for gravitational body forces.
     std::vector<pylith::feassemble::IntegratorDomain::ResidualKernels> _mmsBodyForceKernels;
+    bool _useCompactUniformAuxiliary; ///< Use basis order 0 for auxiliary subfields from a uniform spatial database.
 
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
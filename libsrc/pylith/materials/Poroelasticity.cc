@@ -54,6 +54,7 @@ pylith::materials::Poroelasticity::Poroelasticity(void) :
     _useReferenceState(false),
     _useSourceDensity(false),
     _useStateVars(false),
+    _useFixedStressSplit(false),
     _rheology(NULL),
     _derivedFactory(new pylith::materials::DerivedFactoryElasticity) {
     pylith::utils::PyreComponent::setName("poroelasticity");
@@ -131,6 +132,23 @@ pylith::materials::Poroelasticity::useStateVars(void) const {
 } // useStateVars
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split preconditioner?
+void
+pylith::materials::Poroelasticity::useFixedStressSplit(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useFixedStressSplit(value=" << value << ")");
+    _useFixedStressSplit = value;
+} // useFixedStressSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use fixed-stress split preconditioner?
+bool
+pylith::materials::Poroelasticity::useFixedStressSplit(void) const {
+    return _useFixedStressSplit;
+} // useFixedStressSplit
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set bulk rheology.
 void
@@ -175,6 +193,19 @@ pylith::materials::Poroelasticity::verifyConfiguration(const pylith::topology::F
             throw std::runtime_error("Cannot find 'velocity' field in solution; required for material 'Poroelasticity' with inertia.");
         } // if
     } // switch
+
+    if (_useFixedStressSplit) {
+        if (QUASISTATIC != _formulation) {
+            throw std::runtime_error("Fixed-stress split preconditioner for material 'Poroelasticity' requires the quasistatic formulation.");
+        } // if
+        if (_useStateVars) {
+            throw std::runtime_error("Fixed-stress split preconditioner for material 'Poroelasticity' does not support updating state variables.");
+        } // if
+        if (solution.getSubfieldNames().size() != 3) {
+            throw std::runtime_error("Fixed-stress split preconditioner for material 'Poroelasticity' requires a solution with only "
+                                     "displacement, pressure, and trace_strain subfields.");
+        } // if
+    } // if
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -243,6 +274,9 @@ pylith::materials::Poroelasticity::createAuxiliaryField(const pylith::topology::
         auxiliaryFactory->addSourceDensity(); // +1
     } // if
     _rheology->addAuxiliarySubfields();
+    if (_useCompactUniformAuxiliary) {
+        auxiliaryFactory->compactUniformSubfields();
+    } // if
 
     auxiliaryField->subfieldsSetup();
     auxiliaryField->createDiscretization();
@@ -301,7 +335,27 @@ pylith::materials::Poroelasticity::getSolverDefaults(const bool isParallel,
     case pylith::problems::Physics::QUASISTATIC:
         options->add("-ts_type", "beuler");
 
-        if (!hasFault) {
+        if (_useFixedStressSplit) {
+            // Fixed-stress split: solve the stabilized pressure block, then the displacement block
+            // with the updated pressure, and then the trace strain block (mass matrix).
+            options->add("-pc_type", "fieldsplit");
+            options->add("-pc_fieldsplit_type", "multiplicative");
+            options->add("-pc_fieldsplit_0_fields", "1");
+            options->add("-pc_fieldsplit_1_fields", "0");
+            options->add("-pc_fieldsplit_2_fields", "2");
+
+            options->add("-fieldsplit_0_ksp_type", "preonly");
+            options->add("-fieldsplit_1_ksp_type", "preonly");
+            options->add("-fieldsplit_2_ksp_type", "preonly");
+
+            if (!isParallel) {
+                options->add("-fieldsplit_0_pc_type", "lu");
+            } else {
+                options->add("-fieldsplit_0_pc_type", "gamg");
+            } // if/else
+            options->add("-fieldsplit_1_pc_type", "gamg");
+            options->add("-fieldsplit_2_pc_type", "jacobi");
+        } else if (!hasFault) {
             if (!isParallel) {
                 options->add("-pc_type", "lu");
             } else {
@@ -464,7 +518,7 @@ pylith::materials::Poroelasticity::_setKernelsResidual(pylith::feassemble::Integ
         const PetscPointFunc f0p = _rheology->getKernelf0p_explicit(coordsys);
         const PetscPointFunc f1p = NULL;
         const PetscPointFunc g0p = _rheology->getKernelg0p(coordsys, _useBodyForce, _gravityField, _useSourceDensity);
-        const PetscPointFunc g1p = _rheology->getKernelg1p_explicit(coordsys, _gravityField); // Darcy velocity
+        const PetscPointFunc g1p = _rheology->getKernelg1p_explicit(coordsys, _useBodyForce, _gravityField); // Darcy velocity
 
         // Velocity
         const PetscPointFunc f0v = pylith::fekernels::Poroelasticity::f0v_explicit;
@@ -851,6 +905,18 @@ pylith::materials::Poroelasticity::_setKernelsJacobian(pylith::feassemble::Integ
     assert(integrator);
     integrator->setKernelsJacobian(kernels, solution);
 
+    if (_useFixedStressSplit) {
+        // Fixed-stress split: the preconditioner matches the Jacobian except for the pressure block,
+        // which includes the biot_coefficient^2 / drained_bulk_modulus stabilization term.
+        std::vector<JacobianKernels> kernelsPrecond(kernels);
+        for (size_t i = 0; i < kernelsPrecond.size(); ++i) {
+            if (("pressure" == kernelsPrecond[i].subfieldTrial) && ("pressure" == kernelsPrecond[i].subfieldBasis)) {
+                kernelsPrecond[i].j0 = _rheology->getKernelJf0ppFixedStress(coordsys);
+            } // if
+        } // for
+        integrator->setKernelsJacobianPrecond(kernelsPrecond, solution);
+    } // if
+
     PYLITH_METHOD_END;
 } // _setKernelsJacobian
 
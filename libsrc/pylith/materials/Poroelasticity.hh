@@ -79,6 +79,18 @@ public:
      */
     bool useStateVars(void) const;
 
+    /** Use fixed-stress split preconditioner?
+     *
+     * @param[in] value Flag indicating to use the fixed-stress split preconditioner.
+     */
+    void useFixedStressSplit(const bool value);
+
+    /** Use fixed-stress split preconditioner?
+     *
+     * @returns True if using the fixed-stress split preconditioner, false otherwise.
+     */
+    bool useFixedStressSplit(void) const;
+
     /** Use reference stress and strain in computation of stress and
      * strain?
      *
@@ -211,6 +223,7 @@ private:
     bool _useReferenceState; ///< Flag to use reference stress and strain.
     bool _useSourceDensity; ///< Flag to use source density.
     bool _useStateVars; ///< Flag to update auxiliary fields.
+    bool _useFixedStressSplit; ///< Flag to use fixed-stress split preconditioner.
     pylith::materials::RheologyPoroelasticity* _rheology; ///< Bulk rheology for elasticity.
     pylith::materials::DerivedFactoryElasticity* _derivedFactory; ///< Factory for creating derived fields.
 
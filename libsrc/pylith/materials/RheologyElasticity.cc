@@ -56,6 +56,14 @@ pylith::materials::RheologyElasticity::getLHSJacobianTriggers(void) const {
 } // getLHSJacobianTriggers
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the LHS Jacobian for the rheology symmetric?
+bool
+pylith::materials::RheologyElasticity::isJacobianSymmetric(void) const {
+    return false;
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Update kernel constants.
 void
@@ -84,4 +92,18 @@ pylith::materials::RheologyElasticity::addKernelsUpdateStateVars(std::vector<pyl
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Add kernels for updating auxiliary subfields that depend on the time step.
+void
+pylith::materials::RheologyElasticity::addKernelsUpdateTimeStepVars(std::vector<pylith::feassemble::IntegratorDomain::ProjectKernels>* kernels,
+                                                                    const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("addKernelsUpdateTimeStepVars(kernels="<<kernels<<", coordsys="<<typeid(coordsys).name()<<") empty method");
+
+    // Default is to do nothing.
+
+    PYLITH_METHOD_END;
+} // addKernelsUpdateTimeStepVars
+
+
 // End of file
@@ -103,6 +103,13 @@ public:
      */
     int getLHSJacobianTriggers(void) const;
 
+    /** Is the LHS Jacobian for the rheology symmetric?
+     *
+     * @returns True if the elastic constants kernel yields a symmetric Jacobian, false otherwise.
+     */
+    virtual
+    bool isJacobianSymmetric(void) const;
+
     /** Get stress kernel for derived field.
      *
      * @param[in] coordsys Coordinate system.
@@ -121,6 +128,15 @@ public:
     void addKernelsUpdateStateVars(std::vector<pylith::feassemble::IntegratorDomain::ProjectKernels>* kernels,
                                    const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Add kernels for updating auxiliary subfields that depend on the time step.
+     *
+     * @param[inout] kernels Array of kernels for updating time step dependent subfields.
+     * @param[in] coordsys Coordinate system.
+     */
+    virtual
+    void addKernelsUpdateTimeStepVars(std::vector<pylith::feassemble::IntegratorDomain::ProjectKernels>* kernels,
+                                      const spatialdata::geocoords::CoordSys* coordsys) const;
+
     /** Update kernel constants.
      *
      * @param[inout] kernelConstants Array of constants used in integration kernels.
@@ -0,0 +1,655 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "petscdmplex.h"
+
+#include <algorithm> // USES std::fill(), std::min()
+#include <cassert> // USES assert()
+#include <cstdint> // USES uint64_t, int64_t
+#include <cstring> // USES memcpy()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterVTU {
+public:
+
+            /** Get byte order of binary data.
+             *
+             * @returns Name of byte order in VTK XML files.
+             */
+            static
+            const char* byteOrder(void) {
+                const uint16_t value = 1;
+                return (1 == *reinterpret_cast<const unsigned char*>(&value)) ? "LittleEndian" : "BigEndian";
+            } // byteOrder
+
+            /** Get VTK type for PylithScalar.
+             *
+             * @returns Name of VTK type.
+             */
+            static
+            const char* scalarType(void) {
+                return (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+            } // scalarType
+
+            /** Append block of binary data with UInt64 header giving size of block.
+             *
+             * @param[inout] data Appended data.
+             * @param[in] values Values to append.
+             * @param[in] numBytes Size of values in bytes.
+             */
+            static
+            void appendBlock(std::vector<char>* data,
+                             const void* values,
+                             const size_t numBytes) {
+                assert(data);
+                const uint64_t header = numBytes;
+                const size_t offset = data->size();
+                data->resize(offset + sizeof(header) + numBytes);
+                memcpy(&(*data)[offset], &header, sizeof(header));
+                if (numBytes > 0) {
+                    memcpy(&(*data)[offset+sizeof(header)], values, numBytes);
+                } // if
+            } // appendBlock
+
+            /** Get size of block of binary data including header.
+             *
+             * @param[in] values Values of field.
+             * @returns Size of block in bytes.
+             */
+            static
+            size_t blockSize(const std::vector<PylithScalar>& values) {
+                return sizeof(uint64_t) + values.size()*sizeof(PylithScalar);
+            } // blockSize
+
+            /** Get VTK cell type for PETSc polytope type.
+             *
+             * @param[in] ct PETSc polytope type.
+             * @returns VTK cell type.
+             */
+            static
+            unsigned char cellType(const DMPolytopeType ct) {
+                switch (ct) {
+                case DM_POLYTOPE_POINT:
+                    return 1; // VTK_VERTEX
+                case DM_POLYTOPE_SEGMENT:
+                    return 3; // VTK_LINE
+                case DM_POLYTOPE_TRIANGLE:
+                    return 5; // VTK_TRIANGLE
+                case DM_POLYTOPE_QUADRILATERAL:
+                    return 9; // VTK_QUAD
+                case DM_POLYTOPE_TETRAHEDRON:
+                    return 10; // VTK_TETRA
+                case DM_POLYTOPE_HEXAHEDRON:
+                    return 12; // VTK_HEXAHEDRON
+                case DM_POLYTOPE_TRI_PRISM:
+                    return 13; // VTK_WEDGE
+                default: {
+                    std::ostringstream msg;
+                    msg << "Unsupported cell type '" << DMPolytopeTypes[ct] << "' for VTK XML output.";
+                    throw std::logic_error(msg.str());
+                } // default
+                } // switch
+                return 0;
+            } // cellType
+
+            /** Get filename without directory.
+             *
+             * @param[in] filename Name of file.
+             * @returns Filename without directory.
+             */
+            static
+            std::string basename(const std::string& filename) {
+                const size_t pos = filename.find_last_of('/');
+                return (pos != std::string::npos) ? filename.substr(pos+1) : filename;
+            } // basename
+
+        }; // _DataWriterVTU
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterVTU::DataWriterVTU(void) :
+    _timeConstant(1.0),
+    _filename("output.vtu"),
+    _timeFormat("%f"),
+    _dm(NULL),
+    _isOpenTimeStep(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterVTU::~DataWriterVTU(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterVTU::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    closeTimeStep(); // Insure time step is closed.
+    close(); // Insure clean up.
+    DataWriter::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterVTU::DataWriterVTU(const DataWriterVTU& w) :
+    DataWriter(w),
+    _timeConstant(w._timeConstant),
+    _filename(w._filename),
+    _timeFormat(w._timeFormat),
+    _dm(NULL),
+    _isOpenTimeStep(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set value used to normalize time stamp in name of VTK files.
+void
+pylith::meshio::DataWriterVTU::timeConstant(const PylithScalar value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Time used to normalize time stamp in VTK data files must be "
+            << "positive.\nCurrent value is " << value << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+    _timeConstant = value;
+
+    PYLITH_METHOD_END;
+} // timeConstant
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterVTU::open(const pylith::topology::Mesh& mesh,
+                                    const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriter::open(mesh, isInfo);
+
+    // Save handle for actions required in openTimeStep() and close();
+    PetscErrorCode err = 0;
+    err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    _dm = mesh.getDM();assert(_dm);
+    err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+
+    _setupTopology(mesh);
+    _stepTimes.clear();
+    _stepFilenames.clear();
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterVTU::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_isOpen) {
+        assert(_dm);
+        PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    } // if
+    _vertices.clear();
+    _cells.clear();
+    _topologyData.clear();
+    _topologyHeader.clear();
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterVTU::openTimeStep(const PylithScalar t,
+                                            const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_dm && _dm == mesh.getDM());
+    assert(_isOpen && !_isOpenTimeStep);
+
+    _stepFilenameRoot = _vtuFilenameRoot(t);
+    _vertexFields.clear();
+    _cellFields.clear();
+    if (!DataWriter::_isInfo) {
+        _stepTimes.push_back(t * _timeScale / _timeConstant);
+        _stepFilenames.push_back(_DataWriterVTU::basename(_stepFilenameRoot + ".pvtu"));
+    } // if
+
+    _isOpenTimeStep = true;
+
+    PYLITH_METHOD_END;
+} // openTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+/// Cleanup after writing data for a time step.
+void
+pylith::meshio::DataWriterVTU::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_isOpenTimeStep) {
+        assert(_dm);
+        MPI_Comm comm = PETSC_COMM_SELF;
+        PetscMPIInt commRank = 0, commSize = 1;
+        PetscErrorCode err = PetscObjectGetComm((PetscObject) _dm, &comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+        err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+        std::ostringstream pieceFilename;
+        pieceFilename << _stepFilenameRoot << "_p" << commRank << ".vtu";
+        _writePiece(pieceFilename.str());
+
+        if (!commRank) {
+            _writeIndex(_stepFilenameRoot + ".pvtu", _stepFilenameRoot, commSize);
+            if (!DataWriter::_isInfo) {
+                _writeCollection();
+            } // if
+        } // if
+    } // if
+
+    _vertexFields.clear();
+    _cellFields.clear();
+    _isOpenTimeStep = false;
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterVTU::writeVertexField(const PylithScalar t,
+                                                const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _vertexFields.push_back(DataArray());
+    _getValues(&_vertexFields.back(), subfield, _vertices);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterVTU::writeCellField(const PylithScalar t,
+                                              const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_isOpen && _isOpenTimeStep);
+
+    _cellFields.push_back(DataArray());
+    _getValues(&_cellFields.back(), subfield, _cells);
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Create binary block with coordinates of vertices and cells owned by this process.
+void
+pylith::meshio::DataWriterVTU::_setupTopology(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscErrorCode err = 0;
+
+    PetscInt cellHeight = 0, cStart = 0, cEnd = 0, vStart = 0, vEnd = 0;
+    err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+    // Cells owned by this process (excluding cohesive cells) and the vertices in their closures.
+    PetscIS globalCellNumbers = NULL;
+    const PetscInt* gcell = NULL;
+    err = DMPlexGetCellNumbering(dmMesh, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> vertexIndices(vEnd-vStart, -1);
+    std::vector<int64_t> connectivity;
+    std::vector<int64_t> offsets;
+    std::vector<unsigned char> types;
+    std::vector<PetscInt> cone;
+    _vertices.clear();
+    _cells.clear();
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        if ((gcell[c-cStart] < 0) || pylith::topology::MeshOps::isCohesiveCell(dmMesh, c)) { continue; }
+
+        DMPolytopeType ct;
+        PetscInt closureSize = 0, *closure = NULL;
+        err = DMPlexGetCellType(dmMesh, c, &ct);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        cone.clear();
+        for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+            if ((closure[cl] >= vStart) && (closure[cl] < vEnd)) {
+                cone.push_back(closure[cl]);
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        assert(cone.size() > 0);
+        err = DMPlexInvertCell(ct, &cone[0]);PYLITH_CHECK_ERROR(err);
+
+        for (size_t iV = 0; iV < cone.size(); ++iV) {
+            PetscInt& index = vertexIndices[cone[iV]-vStart];
+            if (index < 0) {
+                index = _vertices.size();
+                _vertices.push_back(cone[iV]);
+            } // if
+            connectivity.push_back(index);
+        } // for
+        offsets.push_back(connectivity.size());
+        types.push_back(_DataWriterVTU::cellType(ct));
+        _cells.push_back(c);
+    } // for
+    err = ISRestoreIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+
+    // Coordinates of vertices (VTK requires 3 components).
+    PylithReal lengthScale = 1.0;
+    err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+    const size_t numVertices = _vertices.size();
+    std::vector<PylithScalar> coordinates(numVertices*3, 0.0);
+    pylith::topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    for (size_t iV = 0; iV < numVertices; ++iV) {
+        const PetscInt off = coordsVisitor.sectionOffset(_vertices[iV]);
+        const PetscInt dof = coordsVisitor.sectionDof(_vertices[iV]);
+        assert(dof <= 3);
+        for (PetscInt d = 0; d < dof; ++d) {
+            coordinates[iV*3+d] = lengthScale * coordsArray[off+d];
+        } // for
+    } // for
+
+    const size_t numCells = _cells.size();
+    _topologyData.clear();
+    const size_t offsetPoints = _topologyData.size();
+    _DataWriterVTU::appendBlock(&_topologyData, numVertices ? &coordinates[0] : NULL, coordinates.size()*sizeof(PylithScalar));
+    const size_t offsetConnectivity = _topologyData.size();
+    _DataWriterVTU::appendBlock(&_topologyData, numCells ? &connectivity[0] : NULL, connectivity.size()*sizeof(int64_t));
+    const size_t offsetOffsets = _topologyData.size();
+    _DataWriterVTU::appendBlock(&_topologyData, numCells ? &offsets[0] : NULL, offsets.size()*sizeof(int64_t));
+    const size_t offsetTypes = _topologyData.size();
+    _DataWriterVTU::appendBlock(&_topologyData, numCells ? &types[0] : NULL, types.size()*sizeof(unsigned char));
+
+    std::ostringstream header;
+    header << "      <Points>\n"
+           << "        <DataArray type=\"" << _DataWriterVTU::scalarType() << "\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << offsetPoints << "\"/>\n"
+           << "      </Points>\n"
+           << "      <Cells>\n"
+           << "        <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" << offsetConnectivity << "\"/>\n"
+           << "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" << offsetOffsets << "\"/>\n"
+           << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << offsetTypes << "\"/>\n"
+           << "      </Cells>\n";
+    _topologyHeader = header.str();
+
+    PYLITH_METHOD_END;
+} // _setupTopology
+
+
+// ------------------------------------------------------------------------------------------------
+// Get values of subfield at points.
+void
+pylith::meshio::DataWriterVTU::_getValues(DataArray* dataArray,
+                                          const pylith::meshio::OutputSubfield& subfield,
+                                          const std::vector<PetscInt>& points) {
+    PYLITH_METHOD_BEGIN;
+    assert(dataArray);
+
+    const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+    const int numComponents = description.numComponents;
+    // VTK requires 3 components for vectors.
+    const bool padVector = (pylith::topology::FieldBase::VECTOR == description.vectorFieldType) && (numComponents < 3);
+    dataArray->name = description.label;
+    dataArray->numComponents = padVector ? 3 : numComponents;
+    dataArray->values.resize(points.size()*dataArray->numComponents);
+    std::fill(dataArray->values.begin(), dataArray->values.end(), 0.0);
+
+    // Get values at points shared with other processes from local vector.
+    PetscDM dmSubfield = subfield.getDM();assert(dmSubfield);
+    PetscSection section = NULL;
+    PetscVec localVec = NULL;
+    const PetscScalar* localArray = NULL;
+    PetscErrorCode err = 0;
+    err = DMGetLocalSection(dmSubfield, &section);PYLITH_CHECK_ERROR(err);
+    err = DMGetLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(localVec, &localArray);PYLITH_CHECK_ERROR(err);
+
+    const size_t numPoints = points.size();
+    const int stride = dataArray->numComponents;
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        PetscInt dof = 0, off = 0;
+        err = PetscSectionGetDof(section, points[iPoint], &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, points[iPoint], &off);PYLITH_CHECK_ERROR(err);
+        const PetscInt numValues = std::min(dof, PetscInt(numComponents));
+        for (PetscInt iComponent = 0; iComponent < numValues; ++iComponent) {
+            dataArray->values[iPoint*stride+iComponent] = localArray[off+iComponent];
+        } // for
+    } // for
+
+    err = VecRestoreArrayRead(localVec, &localArray);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _getValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Write VTK XML unstructured grid file for this process.
+void
+pylith::meshio::DataWriterVTU::_writePiece(const std::string& filename) const {
+    PYLITH_METHOD_BEGIN;
+
+    std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open VTK file '" << filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const char* scalarType = _DataWriterVTU::scalarType();
+    size_t offset = _topologyData.size();
+
+    fout << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << _DataWriterVTU::byteOrder()
+         << "\" header_type=\"UInt64\">\n"
+         << "  <UnstructuredGrid>\n"
+         << "    <Piece NumberOfPoints=\"" << _vertices.size() << "\" NumberOfCells=\"" << _cells.size() << "\">\n";
+    fout << "      <PointData>\n";
+    for (size_t i = 0; i < _vertexFields.size(); ++i) {
+        fout << "        <DataArray type=\"" << scalarType << "\" Name=\"" << _vertexFields[i].name
+             << "\" NumberOfComponents=\"" << _vertexFields[i].numComponents << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += _DataWriterVTU::blockSize(_vertexFields[i].values);
+    } // for
+    fout << "      </PointData>\n"
+         << "      <CellData>\n";
+    for (size_t i = 0; i < _cellFields.size(); ++i) {
+        fout << "        <DataArray type=\"" << scalarType << "\" Name=\"" << _cellFields[i].name
+             << "\" NumberOfComponents=\"" << _cellFields[i].numComponents << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += _DataWriterVTU::blockSize(_cellFields[i].values);
+    } // for
+    fout << "      </CellData>\n"
+         << _topologyHeader
+         << "    </Piece>\n"
+         << "  </UnstructuredGrid>\n"
+         << "  <AppendedData encoding=\"raw\">\n"
+         << "_";
+
+    // Geometry and connectivity, followed by fields in the same order as the header.
+    if (_topologyData.size() > 0) {
+        fout.write(&_topologyData[0], _topologyData.size());
+    } // if
+    const std::vector<DataArray>* fields[2] = { &_vertexFields, &_cellFields };
+    for (size_t iGroup = 0; iGroup < 2; ++iGroup) {
+        for (size_t i = 0; i < fields[iGroup]->size(); ++i) {
+            const std::vector<PylithScalar>& values = (*fields[iGroup])[i].values;
+            const uint64_t numBytes = values.size()*sizeof(PylithScalar);
+            fout.write(reinterpret_cast<const char*>(&numBytes), sizeof(numBytes));
+            if (numBytes > 0) {
+                fout.write(reinterpret_cast<const char*>(&values[0]), numBytes);
+            } // if
+        } // for
+    } // for
+
+    fout << "\n  </AppendedData>\n"
+         << "</VTKFile>\n";
+    if (!fout.good()) {
+        std::ostringstream msg;
+        msg << "Error while writing VTK file '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // _writePiece
+
+
+// ------------------------------------------------------------------------------------------------
+// Write VTK XML parallel unstructured grid file for current time step.
+void
+pylith::meshio::DataWriterVTU::_writeIndex(const std::string& filename,
+                                           const std::string& filenameRoot,
+                                           const int numProcs) const {
+    PYLITH_METHOD_BEGIN;
+
+    std::ofstream fout(filename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open VTK file '" << filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const char* scalarType = _DataWriterVTU::scalarType();
+    fout << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << _DataWriterVTU::byteOrder()
+         << "\" header_type=\"UInt64\">\n"
+         << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+         << "    <PPointData>\n";
+    for (size_t i = 0; i < _vertexFields.size(); ++i) {
+        fout << "      <PDataArray type=\"" << scalarType << "\" Name=\"" << _vertexFields[i].name
+             << "\" NumberOfComponents=\"" << _vertexFields[i].numComponents << "\"/>\n";
+    } // for
+    fout << "    </PPointData>\n"
+         << "    <PCellData>\n";
+    for (size_t i = 0; i < _cellFields.size(); ++i) {
+        fout << "      <PDataArray type=\"" << scalarType << "\" Name=\"" << _cellFields[i].name
+             << "\" NumberOfComponents=\"" << _cellFields[i].numComponents << "\"/>\n";
+    } // for
+    fout << "    </PCellData>\n"
+         << "    <PPoints>\n"
+         << "      <PDataArray type=\"" << scalarType << "\" NumberOfComponents=\"3\"/>\n"
+         << "    </PPoints>\n";
+    const std::string& pieceRoot = _DataWriterVTU::basename(filenameRoot);
+    for (int iProc = 0; iProc < numProcs; ++iProc) {
+        fout << "    <Piece Source=\"" << pieceRoot << "_p" << iProc << ".vtu\"/>\n";
+    } // for
+    fout << "  </PUnstructuredGrid>\n"
+         << "</VTKFile>\n";
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // _writeIndex
+
+
+// ------------------------------------------------------------------------------------------------
+// Write VTK collection file with all time steps.
+void
+pylith::meshio::DataWriterVTU::_writeCollection(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    // Rewrite the entire file so that it is complete if the simulation ends early.
+    const size_t indexExt = _filename.find(".vtu");
+    const std::string& filename = std::string(_filename, 0, indexExt) + ".pvd";
+    std::ofstream fout(filename.c_str());
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open VTK file '" << filename << "' for writing.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    assert(_stepTimes.size() == _stepFilenames.size());
+    fout << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"Collection\" version=\"1.0\" byte_order=\"" << _DataWriterVTU::byteOrder() << "\">\n"
+         << "  <Collection>\n";
+    fout.precision(16);
+    for (size_t i = 0; i < _stepTimes.size(); ++i) {
+        fout << "    <DataSet timestep=\"" << _stepTimes[i] << "\" group=\"\" part=\"0\" file=\"" << _stepFilenames[i] << "\"/>\n";
+    } // for
+    fout << "  </Collection>\n"
+         << "</VTKFile>\n";
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // _writeCollection
+
+
+// ------------------------------------------------------------------------------------------------
+// Generate root of filenames for time step.
+std::string
+pylith::meshio::DataWriterVTU::_vtuFilenameRoot(const PylithScalar t) const {
+    PYLITH_METHOD_BEGIN;
+
+    std::ostringstream filename;
+    const int indexExt = _filename.find(".vtu");
+    if (!DataWriter::_isInfo) {
+        // If data with multiple time steps, then add time stamp to filename
+        char sbuffer[256];
+        sprintf(sbuffer, _timeFormat.c_str(), t * _timeScale / _timeConstant);
+        std::string timestamp(sbuffer);
+        const size_t pos = timestamp.find(".");
+        if (pos != std::string::npos) {
+            timestamp.erase(pos, 1);
+        } // if
+        filename << std::string(_filename, 0, indexExt) << "_t" << timestamp;
+    } else {
+        filename << std::string(_filename, 0, indexExt) << "_info";
+    } // if/else
+
+    PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _vtuFilenameRoot
+
+
+// End of file
@@ -0,0 +1,235 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterVTU.hh
+ *
+ * @brief Object for writing finite-element data to partitioned VTK XML
+ * files.
+ *
+ * Each process writes the cells it owns to its own VTK XML unstructured
+ * grid file (.vtu) with the values stored as raw binary appended data.
+ * The root process writes a parallel unstructured grid file (.pvtu) for
+ * each time step that references the files from all processes and a
+ * collection file (.pvd) with the time stamps of all time steps.
+ *
+ * The VTK XML format does not allow the geometry and connectivity to be
+ * shared among files, so we build the binary block with the vertex
+ * coordinates and cells once in open() and copy it verbatim into the
+ * file for each time step. This saves traversing the mesh at each time
+ * step but not disk space; every file still contains the geometry. The
+ * values of the fields are cached until closeTimeStep(), because the
+ * header of the file must describe all of the fields before the
+ * appended data.
+ */
+
+#if !defined(pylith_meshio_datawritervtu_hh)
+#define pylith_meshio_datawritervtu_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+// DataWriterVTU --------------------------------------------------------
+/// Object for writing finite-element data to partitioned VTK XML files.
+class pylith::meshio::DataWriterVTU : public DataWriter {
+    friend class TestDataWriterVTU; // unit testing
+    friend class TestDataWriterVTUMesh; // unit testing
+    friend class TestDataWriterVTUMaterial; // unit testing
+    friend class TestDataWriterVTUSubmesh; // unit testing
+    friend class TestDataWriterVTUPoints; // unit testing
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterVTU(void);
+
+    /// Destructor
+    ~DataWriterVTU(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for VTK files.
+     *
+     * @param[in] filename Name of VTK file.
+     */
+    void filename(const char* filename);
+
+    /** Set time format for time stamp in name of VTK files.
+     *
+     * @param[in] format C style time format for filename.
+     */
+    void timeFormat(const char* format);
+
+    /** Set value used to normalize time stamp in name of VTK files.
+     *
+     * Time stamp is divided by this value (time in seconds).
+     *
+     * @param[in] value Value (time in seconds) used to normalize time stamp in
+     * filename.
+     */
+    void timeConstant(const PylithScalar value);
+
+    /** Prepare for writing files.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output files.
+    void close(void);
+
+    /** Prepare file for data at a new time step.
+     *
+     * @param[in] t Time stamp for new data
+     * @param[in] mesh Finite-element mesh.
+     */
+    void openTimeStep(const PylithScalar t,
+                      const topology::Mesh& mesh);
+
+    /// Cleanup after writing data for a time step.
+    void closeTimeStep(void);
+
+    /** Write field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& field);
+
+    /** Write field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+    /// Values of a field for the points in the local file.
+    struct DataArray {
+        std::string name; ///< Name of field.
+        int numComponents; ///< Number of components.
+        std::vector<PylithScalar> values; ///< Values of field [numPoints*numComponents].
+    }; // DataArray
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterVTU(const DataWriterVTU& w);
+
+    /** Create binary block with coordinates of vertices and cells owned by this process.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    void _setupTopology(const pylith::topology::Mesh& mesh);
+
+    /** Get values of subfield at points.
+     *
+     * @param[out] dataArray Values of subfield.
+     * @param[in] subfield Subfield with values.
+     * @param[in] points Points in mesh.
+     */
+    static
+    void _getValues(DataArray* dataArray,
+                    const pylith::meshio::OutputSubfield& subfield,
+                    const std::vector<PetscInt>& points);
+
+    /** Write VTK XML unstructured grid file for this process.
+     *
+     * @param[in] filename Name of file.
+     */
+    void _writePiece(const std::string& filename) const;
+
+    /** Write VTK XML parallel unstructured grid file for current time step.
+     *
+     * @param[in] filename Name of file.
+     * @param[in] filenameRoot Root of names of files for processes.
+     * @param[in] numProcs Number of processes.
+     */
+    void _writeIndex(const std::string& filename,
+                     const std::string& filenameRoot,
+                     const int numProcs) const;
+
+    /// Write VTK collection file with all time steps.
+    void _writeCollection(void) const;
+
+    /** Generate root of filenames (no extension) for time step.
+     *
+     * @param[in] t Time in seconds.
+     */
+    std::string _vtuFilenameRoot(const PylithScalar t) const;
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    const DataWriterVTU& operator=(const DataWriterVTU&); ///< Not implemented
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    /// Time value (in seconds) used to normalize time stamp.
+    PylithScalar _timeConstant;
+
+    std::string _filename; ///< Name of VTK file.
+    std::string _timeFormat; ///< C style time format for time stamp.
+
+    PetscDM _dm; ///< Handle to PETSc DM for mesh
+
+    std::vector<PetscInt> _vertices; ///< Vertices in local file.
+    std::vector<PetscInt> _cells; ///< Cells in local file.
+    std::vector<char> _topologyData; ///< Appended data for coordinates and cells in local file.
+    std::string _topologyHeader; ///< XML elements for coordinates and cells in local file.
+
+    std::vector<DataArray> _vertexFields; ///< Vertex fields for current time step.
+    std::vector<DataArray> _cellFields; ///< Cell fields for current time step.
+
+    std::string _stepFilenameRoot; ///< Root of filenames for current time step.
+    std::vector<PylithScalar> _stepTimes; ///< Time stamps of time steps written.
+    pylith::string_vector _stepFilenames; ///< Names of .pvtu files of time steps written.
+
+    bool _isOpenTimeStep; ///< true if called openTimeStep().
+
+}; // DataWriterVTU
+
+#include "DataWriterVTU.icc" // inline methods
+
+#endif // pylith_meshio_datawritervtu_hh
+
+// End of file
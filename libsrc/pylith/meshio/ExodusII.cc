@@ -368,6 +368,111 @@ pylith::meshio::ExodusII::getVar(int* values,
   PYLITH_METHOD_END;
 } // getVar
 
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of PylithScalars.
+void
+pylith::meshio::ExodusII::getVar(PylithScalar* values,
+				 const size_t* start,
+				 const size_t* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing real variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  size_t size = 1;
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    size *= count[iDim];
+  } // for
+  if (!size) {
+    PYLITH_METHOD_END;
+  } // if
+  assert(values);
+
+  if (sizeof(PylithScalar) == sizeof(double)) {
+    err = nc_get_vara_double(_file, vid, start, count, values);
+  } else {
+    assert(0);
+    throw std::logic_error("Unknown size of PylithScalar in ExodusII::getVar().");
+  } // if/else
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of ints.
+void
+pylith::meshio::ExodusII::getVar(int* values,
+				 const size_t* start,
+				 const size_t* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing integer variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  size_t size = 1;
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    size *= count[iDim];
+  } // for
+  if (!size) {
+    PYLITH_METHOD_END;
+  } // if
+  assert(values);
+
+  err = nc_get_vara_int(_file, vid, start, count, values);
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
 // ----------------------------------------------------------------------
 // Get values for variable as an array of strings.
 void
@@ -133,6 +133,40 @@ public :
 	      int ndims,
 	      const char* name) const;
 
+  /** Get hyperslab of values for variable as an array of PylithScalars.
+   *
+   * Used for parallel reads in which each process reads only a
+   * contiguous portion of a variable.
+   *
+   * @param values Array of values.
+   * @param start Starting index for each dimension of variable.
+   * @param count Number of values to read along each dimension of variable.
+   * @param ndims Number of dimension for variable.
+   * @param name Name of variable.
+   */
+  void getVar(PylithScalar* values,
+	      const size_t* start,
+	      const size_t* count,
+	      int ndims,
+	      const char* name) const;
+
+  /** Get hyperslab of values for variable as an array of ints.
+   *
+   * Used for parallel reads in which each process reads only a
+   * contiguous portion of a variable.
+   *
+   * @param values Array of values.
+   * @param start Starting index for each dimension of variable.
+   * @param count Number of values to read along each dimension of variable.
+   * @param ndims Number of dimension for variable.
+   * @param name Name of variable.
+   */
+  void getVar(int* values,
+	      const size_t* start,
+	      const size_t* count,
+	      int ndims,
+	      const char* name) const;
+
   /** Get values for variable as an array of strings.
    *
    * @param values Array of values.
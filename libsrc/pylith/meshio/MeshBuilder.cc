@@ -96,4 +96,123 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 } // buildMesh
 
 
+// ----------------------------------------------------------------------
+// Set vertices and cells in distributed mesh.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+                                               int_array* vertexNumbers,
+                                               const scalar_array& coordinates,
+                                               const int numVertices,
+                                               const int spaceDim,
+                                               const int_array& cells,
+                                               const int numCells,
+                                               const int numCorners,
+                                               const int meshDim) { // buildMeshParallel
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(vertexNumbers);
+    assert(coordinates.size() == size_t(numVertices*spaceDim));
+    assert(cells.size() == size_t(numCells*numCorners));
+    MPI_Comm comm = mesh->getComm();
+    PetscErrorCode err;
+
+    { // Check to make sure every vertex is in at least one cell.
+      // This is required by PETSc. Vertices are distributed, so
+      // count references to the local block of vertices across all processes.
+        PetscInt numVerticesGlobal = 0;
+        PetscInt numVerticesLocal = numVertices;
+        err = MPI_Allreduce(&numVerticesLocal, &numVerticesGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+        PetscLayout layout = NULL;
+        const PetscInt* ranges = NULL;
+        err = PetscLayoutCreateFromSizes(comm, numVerticesLocal, numVerticesGlobal, 1, &layout);PYLITH_CHECK_ERROR(err);
+        err = PetscLayoutGetRanges(layout, &ranges);PYLITH_CHECK_ERROR(err);
+
+        // Mark referenced vertices owned by other processes using a star forest.
+        const size_t size = cells.size();
+        PetscSFNode* remote = (size > 0) ? new PetscSFNode[size] : NULL;
+        for (size_t i = 0; i < size; ++i) {
+            PetscMPIInt owner = 0;
+            err = PetscLayoutFindOwner(layout, cells[i], &owner);PYLITH_CHECK_ERROR(err);
+            remote[i].rank = owner;
+            remote[i].index = cells[i] - ranges[owner];
+        } // for
+        PetscSF sfVertices = NULL;
+        err = PetscSFCreate(comm, &sfVertices);PYLITH_CHECK_ERROR(err);
+        err = PetscSFSetGraph(sfVertices, numVerticesLocal, size, NULL, PETSC_COPY_VALUES, remote, PETSC_COPY_VALUES);PYLITH_CHECK_ERROR(err);
+        delete[] remote;remote = NULL;
+
+        PetscInt* vertexInCell = (numVerticesLocal > 0) ? new PetscInt[numVerticesLocal] : NULL;
+        PetscInt* ones = (size > 0) ? new PetscInt[size] : NULL;
+        for (PetscInt i = 0; i < numVerticesLocal; ++i) {
+            vertexInCell[i] = 0;
+        } // for
+        for (size_t i = 0; i < size; ++i) {
+            ones[i] = 1;
+        } // for
+        err = PetscSFReduceBegin(sfVertices, MPIU_INT, ones, vertexInCell, MPI_SUM);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(sfVertices, MPIU_INT, ones, vertexInCell, MPI_SUM);PYLITH_CHECK_ERROR(err);
+        PetscInt count = 0;
+        for (PetscInt i = 0; i < numVerticesLocal; ++i) {
+            if (!vertexInCell[i]) {
+                ++count;
+            } // if
+        } // for
+        delete[] vertexInCell;vertexInCell = NULL;
+        delete[] ones;ones = NULL;
+        err = PetscSFDestroy(&sfVertices);PYLITH_CHECK_ERROR(err);
+        err = PetscLayoutDestroy(&layout);PYLITH_CHECK_ERROR(err);
+
+        PetscInt countGlobal = 0;
+        err = MPI_Allreduce(&count, &countGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+        if (countGlobal > 0) {
+            std::ostringstream msg;
+            msg << "Mesh contains " << countGlobal << " vertices that are not in any cells.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // check
+
+    int_array cellsOriented(cells);
+    if (meshDim == 3) {
+        DMPolytopeType ct = DM_POLYTOPE_UNKNOWN;
+        switch (numCorners) {
+        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+        default: break;
+        } // switch
+        if (ct != DM_POLYTOPE_UNKNOWN) {
+            const PetscInt bound = numCells*numCorners;
+            for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+                err = DMPlexInvertCell(ct, &cellsOriented[coff]);PYLITH_CHECK_ERROR(err);
+            } // for
+        } // if
+    } // if
+
+    /* DMPlex */
+    PetscDM dmMesh = NULL;
+    PetscBool interpolate = PETSC_TRUE;
+    PetscInt* verticesAdj = NULL;
+    const PetscInt* cellsArray = (numCells > 0) ? &cellsOriented[0] : NULL;
+    const PetscReal* coordsArray = (numVertices > 0) ? &coordinates[0] : NULL;
+    err = DMPlexCreateFromCellListParallelPetsc(comm, meshDim, numCells, numVertices, PETSC_DECIDE, numCorners, interpolate,
+                                                cellsArray, spaceDim, coordsArray, NULL, &verticesAdj, &dmMesh);PYLITH_CHECK_ERROR(err);
+
+    // Local vertices are numbered in the order of the sorted global vertex numbers.
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt numVerticesAdj = vEnd - vStart;
+    vertexNumbers->resize(numVerticesAdj);
+    for (PetscInt i = 0; i < numVerticesAdj; ++i) {
+        (*vertexNumbers)[i] = verticesAdj[i];
+    } // for
+    err = PetscFree(verticesAdj);PYLITH_CHECK_ERROR(err);
+
+    err = DMPlexDistributeSetDefault(dmMesh, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // buildMeshParallel
+
 // End of file
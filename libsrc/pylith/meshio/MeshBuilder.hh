@@ -72,6 +72,36 @@ void buildMesh(topology::Mesh* mesh,
                const int numCorners,
                const int meshDim,
                const bool isParallel =false);
+
+/** Build distributed mesh topology and set vertex coordinates from
+ * slabs of the cell and vertex arrays read independently on each process.
+ *
+ * Each process provides a contiguous block of vertices (in rank order)
+ * and a block of cells. The indices of the vertices in the cells are
+ * global, zero based indices.
+ *
+ * @param[out] mesh PyLith finite-element mesh.
+ * @param[out] vertexNumbers Global indices of vertices in the local mesh, sorted
+ *   to match the order of the local vertices in the mesh.
+ * @param[in] coordinates Array of coordinates of vertices owned by this process.
+ * @param[in] numVertices Number of vertices owned by this process.
+ * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+ * @param[in] cells Array of global indices of vertices in local cells.
+ * @param[in] numCells Number of local cells.
+ * @param[in] numCorners Number of vertices per cell.
+ * @param[in] meshDim Dimension of cells in mesh.
+ */
+static
+void buildMeshParallel(topology::Mesh* mesh,
+                       int_array* vertexNumbers,
+                       const scalar_array& coordinates,
+                       const int numVertices,
+                       const int spaceDim,
+                       const int_array& cells,
+                       const int numCells,
+                       const int numCorners,
+                       const int meshDim);
+
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
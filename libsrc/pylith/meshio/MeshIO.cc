@@ -246,28 +246,26 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
 
+    // Meshes read in serial only have cells on process 0; meshes read in
+    // parallel have cells on every process.
     PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
     PetscErrorCode err = 0;
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
 
-    if (!_mesh->getCommRank()) {
-        PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
-        topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
-        const PetscInt cStart = cellsStratum.begin();
-        const PetscInt cEnd = cellsStratum.end();
-
-        if (size_t(cellsStratum.size()) != materialIds.size()) {
-            std::ostringstream msg;
-            msg << "Mismatch in size of materials identifier array ("
-                << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
-            throw std::runtime_error(msg.str());
-        } // if
-        for (PetscInt c = cStart; c < cEnd; ++c) {
-            err = DMSetLabelValue(dmMesh, labelName, c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
-        } // for
-    } else {
-        err = DMCreateLabel(dmMesh, labelName);PYLITH_CHECK_ERROR(err);
-    } // if/else
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+
+    if (size_t(cellsStratum.size()) != materialIds.size()) {
+        std::ostringstream msg;
+        msg << "Mismatch in size of materials identifier array ("
+            << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    err = DMCreateLabel(dmMesh, labelName);PYLITH_CHECK_ERROR(err);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        err = DMSetLabelValue(dmMesh, labelName, c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
+    } // for
 
     PYLITH_METHOD_END;
 } // _setMaterials
@@ -29,16 +29,46 @@
 
 #include "petsc.h" // USES MPI_Comm
 
+#include <algorithm> // USES std::lower_bound()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES std::typeid
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _MeshIOCubit {
+public:
+
+            /** Get contiguous block of items assigned to a process.
+             *
+             * Matches the PETSc convention for splitting ownership, so blocks of vertices
+             * are consistent with the layout PETSc uses when building a mesh in parallel.
+             *
+             * @param[out] start Index of first item in block.
+             * @param[out] count Number of items in block.
+             * @param[in] numItems Total number of items.
+             * @param[in] commRank Rank of process.
+             * @param[in] commSize Number of processes.
+             */
+            static
+            void getBlock(int* start,
+                          int* count,
+                          const int numItems,
+                          const int commRank,
+                          const int commSize);
+
+        }; // _MeshIOCubit
+    } // meshio
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::MeshIOCubit::MeshIOCubit(void) :
     _filename(""),
-    _useNodesetNames(true) { // constructor
+    _useNodesetNames(true),
+    _useParallelRead(false) { // constructor
     PyreComponent::setName("meshiocubit");
 } // constructor
 
@@ -71,6 +101,11 @@ pylith::meshio::MeshIOCubit::_read(void) {
 
     assert(_mesh);
 
+    if (_useParallelRead) {
+        _readParallel();
+        PYLITH_METHOD_END;
+    } // if
+
     const int commRank = _mesh->getCommRank();
     int meshDim = 0;
     int spaceDim = 0;
@@ -117,6 +152,65 @@ pylith::meshio::MeshIOCubit::_read(void) {
 } // read
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh with each process reading a contiguous block of cells and vertices.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readParallel()");
+
+    assert(_mesh);
+
+    int commSize = 1;
+    const int commRank = _mesh->getCommRank();
+    PetscErrorCode err = MPI_Comm_size(_mesh->getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    try {
+        ExodusII exofile(_filename.c_str());
+
+        const int meshDim = exofile.getDim("num_dim");
+        const int spaceDim = meshDim;
+        const int numVerticesGlobal = exofile.getDim("num_nodes");
+        const int numCellsGlobal = exofile.getDim("num_elem");
+        PYLITH_COMPONENT_INFO_ROOT("Reading " << numVerticesGlobal << " vertices and " << numCellsGlobal
+                                              << " cells in parallel on " << commSize << " processes.");
+
+        int vStart = 0;
+        int numVertices = 0;
+        _MeshIOCubit::getBlock(&vStart, &numVertices, numVerticesGlobal, commRank, commSize);
+        scalar_array coordinates;
+        _readVerticesBlock(exofile, &coordinates, vStart, numVertices, spaceDim);
+
+        int cStart = 0;
+        int numCells = 0;
+        int numCorners = 0;
+        int_array cells;
+        int_array materialIds;
+        _MeshIOCubit::getBlock(&cStart, &numCells, numCellsGlobal, commRank, commSize);
+        _readCellsBlock(exofile, &cells, &materialIds, cStart, numCells, &numCorners);
+        _orientCells(&cells, numCells, numCorners, meshDim);
+
+        int_array vertexNumbers;
+        MeshBuilder::buildMeshParallel(_mesh, &vertexNumbers, coordinates, numVertices, spaceDim, cells, numCells,
+                                       numCorners, meshDim);
+        _setMaterials(materialIds);
+
+        _readGroups(exofile, &vertexNumbers);
+    } catch (std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while reading Cubit Exodus file '" << _filename << "' in parallel.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown error while reading Cubit Exodus file '" << _filename << "' in parallel.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write mesh to file.
 void
@@ -195,6 +289,57 @@ pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
 } // _readVertices
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read block of mesh vertices.
+void
+pylith::meshio::MeshIOCubit::_readVerticesBlock(ExodusII& exofile,
+                                                scalar_array* coordinates,
+                                                const int vStart,
+                                                const int numVertices,
+                                                const int spaceDim) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readVerticesBlock(exofile="<<typeid(exofile).name()<<", coordinates="<<coordinates<<", vStart="<<vStart<<", numVertices="<<numVertices<<", spaceDim="<<spaceDim<<")");
+
+    assert(coordinates);
+
+    coordinates->resize(numVertices * spaceDim);
+    scalar_array buffer(numVertices);
+    if (exofile.hasVar("coord", NULL)) {
+        const int ndims = 2;
+        size_t start[2];
+        size_t count[2];
+        start[1] = vStart;
+        count[0] = 1;
+        count[1] = numVertices;
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            start[0] = iDim;
+            exofile.getVar(&buffer[0], start, count, ndims, "coord");
+
+            for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+                (*coordinates)[iVertex*spaceDim+iDim] = buffer[iVertex];
+            } // for
+        } // for
+    } else {
+        const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+
+        const int ndims = 1;
+        size_t start[1];
+        size_t count[1];
+        start[0] = vStart;
+        count[0] = numVertices;
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            exofile.getVar(&buffer[0], start, count, ndims, coordNames[iDim]);
+
+            for (int iVertex = 0; iVertex < numVertices; ++iVertex) {
+                (*coordinates)[iVertex*spaceDim+iDim] = buffer[iVertex];
+            } // for
+        } // for
+    } // else
+
+    PYLITH_METHOD_END;
+} // _readVerticesBlock
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Read mesh cells.
 void
@@ -267,12 +412,91 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
 } // _readCells
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read block of mesh cells.
+void
+pylith::meshio::MeshIOCubit::_readCellsBlock(ExodusII& exofile,
+                                             int_array* cells,
+                                             int_array* materialIds,
+                                             const int cStart,
+                                             const int numCells,
+                                             int* numCorners) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readCellsBlock(exofile="<<typeid(exofile).name()<<", cells="<<cells<<", materialIds="<<materialIds<<", cStart="<<cStart<<", numCells="<<numCells<<", numCorners="<<numCorners<<")");
+
+    assert(cells);
+    assert(materialIds);
+    assert(numCorners);
+
+    const int numMaterials = exofile.getDim("num_el_blk");
+
+    int_array blockIds(numMaterials);
+    int ndims = 1;
+    int dims[2];
+    dims[0] = numMaterials;
+    dims[1] = 0;
+    exofile.getVar(&blockIds[0], dims, ndims, "eb_prop1");
+
+    // Number of corners must be known on every process, even if it has no cells.
+    *numCorners = exofile.getDim("num_nod_per_el1");
+    cells->resize(numCells * (*numCorners));
+    materialIds->resize(numCells);
+
+    const int cEnd = cStart + numCells;
+    for (int iMaterial = 0, blockStart = 0; iMaterial < numMaterials; ++iMaterial) {
+        std::ostringstream varname;
+        varname << "num_nod_per_el" << iMaterial+1;
+        if (exofile.getDim(varname.str().c_str()) != *numCorners) {
+            std::ostringstream msg;
+            msg << "All materials must have the same number of vertices per cell.\n"
+                << "Expected " << *numCorners << " vertices per cell, but block "
+                << blockIds[iMaterial] << " has "
+                << exofile.getDim(varname.str().c_str())
+                << " vertices.";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        varname.str("");
+        varname << "num_el_in_blk" << iMaterial+1;
+        const int blockSize = exofile.getDim(varname.str().c_str());
+        const int blockEnd = blockStart + blockSize;
+
+        // Read portion of this block that overlaps with the local block of cells.
+        const int readStart = std::max(cStart, blockStart);
+        const int readEnd = std::min(cEnd, blockEnd);
+        if (readStart < readEnd) {
+            varname.str("");
+            varname << "connect" << iMaterial+1;
+            ndims = 2;
+            size_t start[2];
+            size_t count[2];
+            start[0] = readStart - blockStart;
+            start[1] = 0;
+            count[0] = readEnd - readStart;
+            count[1] = *numCorners;
+            exofile.getVar(&(*cells)[(readStart-cStart) * (*numCorners)], start, count, ndims, varname.str().c_str());
+
+            for (int i = readStart; i < readEnd; ++i) {
+                (*materialIds)[i-cStart] = blockIds[iMaterial];
+            } // for
+        } // if
+
+        blockStart = blockEnd;
+    } // for
+
+    *cells -= 1; // use zero index
+
+    PYLITH_METHOD_END;
+} // _readCellsBlock
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Read mesh groups.
 void
-pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
+pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile,
+                                         const int_array* vertexNumbers) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_COMPONENT_DEBUG("_readGroups(exofile="<<typeid(exofile).name()<<")");
+    PYLITH_COMPONENT_DEBUG("_readGroups(exofile="<<typeid(exofile).name()<<", vertexNumbers="<<vertexNumbers<<")");
 
     const int numGroups = exofile.getDim("num_node_sets");
 
@@ -308,6 +532,22 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
         std::sort(&points[0], &points[0]+nodesetSize);
         points -= 1; // use zero index
 
+        if (vertexNumbers) {
+            // Keep only vertices in local mesh and convert to local indices.
+            const int* vBegin = (vertexNumbers->size() > 0) ? &(*vertexNumbers)[0] : NULL;
+            const int* vEnd = vBegin + vertexNumbers->size();
+            int numLocal = 0;
+            for (size_t i = 0; i < nodesetSize; ++i) {
+                const int* v = std::lower_bound(vBegin, vEnd, points[i]);
+                if ((v != vEnd) && (*v == points[i])) {
+                    points[numLocal++] = v - vBegin;
+                } // if
+            } // for
+            const int_array localPoints(points[std::slice(0, numLocal, 1)]);
+            points.resize(numLocal);
+            points = localPoints;
+        } // if
+
         GroupPtType type = VERTEX;
         if (_useNodesetNames) {
             _setGroup(groupNames[iGroup], type, points);
@@ -454,4 +694,23 @@ pylith::meshio::MeshIOCubit::_orientCells(int_array* const cells,
 } // _orientCells
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get contiguous block of items assigned to a process.
+void
+pylith::meshio::_MeshIOCubit::getBlock(int* start,
+                                       int* count,
+                                       const int numItems,
+                                       const int commRank,
+                                       const int commSize) {
+    assert(start);
+    assert(count);
+    assert(commSize > 0);
+
+    const int numPerProc = numItems / commSize;
+    const int remainder = numItems % commSize;
+    *count = numPerProc + ((commRank < remainder) ? 1 : 0);
+    *start = commRank*numPerProc + std::min(commRank, remainder);
+} // getBlock
+
+
 // End of file
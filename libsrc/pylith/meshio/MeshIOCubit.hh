@@ -62,6 +62,22 @@ public:
      */
     void setUseNodesetNames(const bool flag);
 
+    /** Set flag on whether every process reads a portion of the mesh.
+     *
+     * If true, each process reads a contiguous block of the cells and
+     * vertices and builds its piece of the mesh, so the full mesh is
+     * never assembled on a single process.
+     *
+     * @param flag True to read the mesh in parallel.
+     */
+    void setUseParallelRead(const bool flag);
+
+    /** Get flag on whether every process reads a portion of the mesh.
+     *
+     * @returns True if reading mesh in parallel, false otherwise.
+     */
+    bool getUseParallelRead(void) const;
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -74,6 +90,9 @@ protected:
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
+    /// Read mesh with each process reading a contiguous block of cells and vertices.
+    void _readParallel(void);
+
     /** Read mesh vertices.
      *
      * @param ncfile Cubit Exodus file.
@@ -86,6 +105,20 @@ private:
                        int* numVertices,
                        int* spaceDim) const;
 
+    /** Read block of mesh vertices.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param coordinates Pointer to array of vertex coordinates.
+     * @param vStart Index of first vertex in block.
+     * @param numVertices Number of vertices in block.
+     * @param spaceDim Dimension of coordinates vector space.
+     */
+    void _readVerticesBlock(ExodusII& filein,
+                            scalar_array* coordinates,
+                            const int vStart,
+                            const int numVertices,
+                            const int spaceDim) const;
+
     /** Read mesh cells.
      *
      * @param ncfile Cubit Exodus file.
@@ -100,11 +133,33 @@ private:
                     int* numCells,
                     int* numCorners) const;
 
+    /** Read block of mesh cells.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param pCells Pointer to array of indices of cell vertices
+     * @param pMaterialIds Pointer to array of material identifiers
+     * @param cStart Index of first cell in block.
+     * @param numCells Number of cells in block.
+     * @param pNumCorners Pointer to number of corners
+     */
+    void _readCellsBlock(ExodusII& filein,
+                         int_array* pCells,
+                         int_array* pMaterialIds,
+                         const int cStart,
+                         const int numCells,
+                         int* numCorners) const;
+
     /** Read point groups.
+     *
+     * If vertexNumbers is not NULL, the vertices in the groups are
+     * global indices and only those present in the local mesh are
+     * added to the groups.
      *
      * @param ncfile Cubit Exodus file.
+     * @param vertexNumbers Sorted global indices of vertices in local mesh.
      */
-    void _readGroups(ExodusII& filein);
+    void _readGroups(ExodusII& filein,
+                     const int_array* vertexNumbers=NULL);
 
     /** Write mesh dimensions.
      *
@@ -142,6 +197,7 @@ private:
 
     std::string _filename; ///< Name of file
     bool _useNodesetNames; ///< True to use node set names instead of ids.
+    bool _useParallelRead; ///< True if each process reads a portion of the mesh.
 
 }; // MeshIOCubit
 
@@ -28,6 +28,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -41,7 +42,16 @@ pylith::meshio::OutputObserver::OutputObserver(void) :
     _timeScale(1.0),
     _writer(NULL),
     _trigger(NULL),
-    _outputBasisOrder(1) {}
+    _outputBasisOrder(1),
+    _logger(new pylith::utils::EventLogger),
+    _eventWriteStep(0),
+    _eventWriteField(0) {
+    assert(_logger);
+    _logger->setClassName("OutputObserver");
+    _logger->initialize();
+    _eventWriteStep = _logger->registerEvent("Py-OuOb-writeStep");
+    _eventWriteField = _logger->registerEvent("Py-OuOb-writeField");
+} // constructor
 
 
 // ------------------------------------------------------------------------------------------------
@@ -67,6 +77,7 @@ pylith::meshio::OutputObserver::deallocate(void) {
     _subfields.clear();
 
     _writer = NULL; // :TODO: Use shared pointer
+    delete _logger;_logger = NULL;
     _trigger = NULL; // :TODO: Use shared pointer
 
 } // deallocate
@@ -159,6 +170,8 @@ pylith::meshio::OutputObserver::_appendField(const PylithReal t,
                                              const pylith::meshio::OutputSubfield& subfield) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_appendField(t="<<t<<", subfield="<<typeid(subfield).name()<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventWriteField);
 
     // Use basis order from subfield since requested basis order for output may be greater than original basis order.
     const int basisOrder = subfield.getBasisOrder();
@@ -178,6 +191,8 @@ pylith::meshio::OutputObserver::_appendField(const PylithReal t,
             );
     } // switch
 
+    _logger->eventEnd(_eventWriteField);
+
     PYLITH_METHOD_END;
 } // _appendField
 
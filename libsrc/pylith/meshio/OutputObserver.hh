@@ -30,6 +30,7 @@
 #include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
 #include "pylith/utils/array.hh" // HASA string_vector
 #include <map> // HASA std::map
 
@@ -117,6 +118,10 @@ protected:
     OutputTrigger* _trigger; ///< Trigger for deciding how often to write output.
     int _outputBasisOrder; ///< Basis order for output.
 
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    int _eventWriteStep; ///< Identifier for logging event for writing a time step.
+    int _eventWriteField; ///< Identifier for logging event for writing a field.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -187,12 +187,17 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
                                       const PylithInt tindex,
                                       const pylith::topology::Field& solution,
                                       const bool infoOnly) {
+    assert(_logger);
     if (infoOnly) {
+        _logger->eventBegin(_eventWriteStep);
         _writeInfo();
+        _logger->eventEnd(_eventWriteStep);
     } else {
         assert(_trigger);
         if (_trigger->shouldWrite(t, tindex)) {
+            _logger->eventBegin(_eventWriteStep);
             _writeDataStep(t, tindex, solution);
+            _logger->eventEnd(_eventWriteStep);
         } // if
     } // if/else
 } // update
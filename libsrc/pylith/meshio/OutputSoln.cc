@@ -127,7 +127,10 @@ pylith::meshio::OutputSoln::update(const PylithReal t,
                                    const pylith::topology::Field& solution) {
     assert(_trigger);
     if (_trigger->shouldWrite(t, tindex)) {
+        assert(_logger);
+        _logger->eventBegin(_eventWriteStep);
         _writeSolnStep(t, tindex, solution);
+        _logger->eventEnd(_eventWriteStep);
     } // if
 } // update
 
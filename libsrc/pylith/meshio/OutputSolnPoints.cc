@@ -37,14 +37,39 @@
 #include "spatialdata/geocoords/Converter.hh" // USES Converter
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::sort(), std::equal_range()
+#include <utility> // USES std::pair
+#include <cmath> // USES pow(), floor()
 #include <cassert> // USES assert()
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _OutputSolnPoints {
+public:
+
+            /// Comparison of bins for searching (compares only keys).
+            class BinCompare {
+public:
+
+                bool operator()(const std::pair<long long, PylithInt>& a,
+                                const std::pair<long long, PylithInt>& b) const {
+                    return a.first < b.first;
+                } // operator()
+
+            }; // BinCompare
+
+        }; // _OutputSolnPoints
+    } // meshio
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSolnPoints::OutputSolnPoints(void) :
     _pointMesh(NULL),
     _pointSoln(NULL),
-    _interpolator(NULL) {
+    _interpolator(NULL),
+    _interpolationWeightsStride(0) {
     PyreComponent::setName("outputsolnpoints");
 } // constructor
 
@@ -67,6 +92,10 @@ pylith::meshio::OutputSolnPoints::deallocate(void) {
     if (_interpolator) {
         PetscErrorCode err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
     } // if
+    _interpolationCells.resize(0);
+    _interpolationWeights.resize(0);
+    _interpolationFieldSizes.resize(0);
+    _interpolationWeightsStride = 0;
 
     delete _pointMesh;_pointMesh = NULL;
     delete _pointSoln;_pointSoln = NULL;
@@ -183,6 +212,9 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
     err = DMInterpolationCreate(comm, &_interpolator);PYLITH_CHECK_ERROR(err);
     err = DMInterpolationSetDim(_interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
     err = DMInterpolationAddPoints(_interpolator, _pointNames.size(), (PetscReal*) &_pointCoords[0]);PYLITH_CHECK_ERROR(err);
+
+    // Use grid hash to locate points in cells rather than a search over all cells.
+    err = DMPlexSetUseHashLocation(dmSoln, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     const PetscBool pointsAllProcs = PETSC_TRUE;
     const PetscBool ignoreOutsideDomain = PETSC_FALSE;
     err = DMInterpolationSetUp(_interpolator, dmSoln, pointsAllProcs, ignoreOutsideDomain);PYLITH_CHECK_ERROR(err);
@@ -200,23 +232,16 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
         pointsLocal, numPointsLocal, cs, lengthScale, comm);
 
     // Upate point names to only local points.
+    const PylithReal tolerance = 1.0e-6;
+    pylith::int_array indicesLocal;
+    _matchPoints(&indicesLocal, pointsLocal, numPointsLocal, _pointCoords, spaceDim, tolerance);
     pylith::string_vector pointNamesLocal(numPointsLocal);
-    const size_t numPoints = _pointNames.size();
     for (size_t iPointLocal = 0; iPointLocal < numPointsLocal; ++iPointLocal) {
-        // Find point in array of all points to get index for point name.
-        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
-            const PylithReal tolerance = 1.0e-6;
-            PylithReal dist = 0.0;
-            for (int iDim = 0; iDim < spaceDim; ++iDim) {
-                dist += pow(_pointCoords[iPoint*spaceDim+iDim] - pointsLocal[iPointLocal*spaceDim+iDim], 2);
-            } // for
-            if (sqrt(dist) < tolerance) {
-                pointNamesLocal[iPointLocal] = _pointNames[iPoint];
-                break;
-            } // if
-        } // for
+        if (indicesLocal[iPointLocal] >= 0) {
+            pointNamesLocal[iPointLocal] = _pointNames[indicesLocal[iPointLocal]];
+        } // if
     } // for
-    err = VecGetArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
 
     _pointNames = pointNamesLocal;
     _pointCoords.resize(0);
@@ -232,6 +257,7 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
         } // if
     } // for
     err = DMInterpolationSetDof(_interpolator, numDof);PYLITH_CHECK_ERROR(err);
+    _setupInterpolationWeights(solution);
 
     delete _pointSoln;_pointSoln = new pylith::topology::Field(*_pointMesh);
     for (size_t i = 0; i < subfieldNames.size(); ++i) {
@@ -249,6 +275,102 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
 } // setupInterpolator
 
 
+// ------------------------------------------------------------------------------------------------
+// Cache cells and basis functions at local points for interpolation.
+void
+pylith::meshio::OutputSolnPoints::_setupInterpolationWeights(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    assert(_interpolator);
+
+    _interpolationCells.resize(0);
+    _interpolationWeights.resize(0);
+    _interpolationFieldSizes.resize(0);
+    _interpolationWeightsStride = 0;
+
+    // Use same discretization as DMInterpolationEvaluate(); fall back to it if a field does not
+    // use a finite-element discretization.
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscDS ds = NULL;
+    PetscInt numFields = 0;
+    err = DMGetDS(dmSoln, &ds);PYLITH_CHECK_ERROR(err);
+    if (!ds) {
+        PYLITH_METHOD_END;
+    } // if
+    err = PetscDSGetNumFields(ds, &numFields);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        PetscObject obj = NULL;
+        PetscClassId id;
+        err = PetscDSGetDiscretization(ds, iField, &obj);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectGetClassId(obj, &id);PYLITH_CHECK_ERROR(err);
+        if (id != PETSCFE_CLASSID) {
+            PYLITH_METHOD_END;
+        } // if
+    } // for
+
+    PetscInt coordDim = 0;
+    err = DMGetCoordinateDim(dmSoln, &coordDim);PYLITH_CHECK_ERROR(err);
+    const PetscInt numPointsLocal = _interpolator->n;
+
+    pylith::int_array fieldSizes(2*numFields);
+    size_t stride = 0;
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        PetscFE fe = NULL;
+        PetscInt numBasis = 0, numComponents = 0;
+        err = PetscDSGetDiscretization(ds, iField, (PetscObject*) &fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetDimension(fe, &numBasis);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetNumComponents(fe, &numComponents);PYLITH_CHECK_ERROR(err);
+        fieldSizes[2*iField+0] = numBasis;
+        fieldSizes[2*iField+1] = numComponents;
+        stride += numBasis * numComponents;
+    } // for
+
+    pylith::int_array cells(numPointsLocal);
+    pylith::real_array weights(numPointsLocal * stride);
+    const PetscScalar* pointsLocal = NULL;
+    err = VecGetArrayRead(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const PetscInt cell = _interpolator->cells[iPoint];
+        cells[iPoint] = cell;
+        if (cell < 0) {
+            continue;
+        } // if
+
+        PetscReal pointCoords[3], refCoords[3];
+        for (PetscInt iDim = 0; iDim < coordDim; ++iDim) {
+            pointCoords[iDim] = PetscRealPart(pointsLocal[iPoint*coordDim+iDim]);
+        } // for
+        err = DMPlexCoordinatesToReference(dmSoln, cell, 1, pointCoords, refCoords);PYLITH_CHECK_ERROR(err);
+
+        size_t offset = iPoint * stride;
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            PetscFE fe = NULL;
+            PetscTabulation tabulation = NULL;
+            err = PetscDSGetDiscretization(ds, iField, (PetscObject*) &fe);PYLITH_CHECK_ERROR(err);
+            err = PetscFECreateTabulation(fe, 1, 1, refCoords, 0, &tabulation);PYLITH_CHECK_ERROR(err);
+            const size_t size = tabulation->Nb * tabulation->Nc;
+            assert(size_t(fieldSizes[2*iField+0] * fieldSizes[2*iField+1]) == size);
+            for (size_t i = 0; i < size; ++i) {
+                weights[offset+i] = tabulation->T[0][i];
+            } // for
+            offset += size;
+            err = PetscTabulationDestroy(&tabulation);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+
+    _interpolationCells.resize(cells.size());
+    _interpolationCells = cells;
+    _interpolationWeights.resize(weights.size());
+    _interpolationWeights = weights;
+    _interpolationFieldSizes.resize(fieldSizes.size());
+    _interpolationFieldSizes = fieldSizes;
+    _interpolationWeightsStride = stride;
+
+    PYLITH_METHOD_END;
+} // _setupInterpolationWeights
+
+
 // ------------------------------------------------------------------------------------------------
 // Append finite-element field to file.
 void
@@ -257,13 +379,154 @@ pylith::meshio::OutputSolnPoints::_interpolateField(const pylith::topology::Fiel
     assert(_pointSoln);
 
     PetscErrorCode err;
-    err = DMInterpolationEvaluate(_interpolator, solution.getDM(), solution.getLocalVector(),
-                                  _pointSoln->getLocalVector());PYLITH_CHECK_ERROR(err);
+    if (!_interpolationFieldSizes.size()) {
+        err = DMInterpolationEvaluate(_interpolator, solution.getDM(), solution.getLocalVector(),
+                                      _pointSoln->getLocalVector());PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    // Weighted sum of values in closure of cell containing each point using cached basis functions.
+    PetscDM dmSoln = solution.getDM();assert(dmSoln);
+    PetscVec solutionVec = solution.getLocalVector();
+    const PetscInt numDof = _interpolator->dof;
+    const size_t numPointsLocal = _interpolationCells.size();
+    const size_t numFields = _interpolationFieldSizes.size() / 2;
+    PetscScalar* interpolantArray = NULL;
+    err = VecGetArrayWrite(_pointSoln->getLocalVector(), &interpolantArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const PetscInt cell = _interpolationCells[iPoint];
+        if (cell < 0) {
+            continue;
+        } // if
+
+        PetscScalar* closureArray = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexVecGetClosure(dmSoln, NULL, solutionVec, cell, &closureSize, &closureArray);PYLITH_CHECK_ERROR(err);
+        const PylithReal* weights = &_interpolationWeights[iPoint*_interpolationWeightsStride];
+        PetscScalar* interpolant = &interpolantArray[iPoint*numDof];
+        PetscInt closureOffset = 0, componentOffset = 0;
+        for (size_t iField = 0; iField < numFields; ++iField) {
+            const PetscInt numBasis = _interpolationFieldSizes[2*iField+0];
+            const PetscInt numComponents = _interpolationFieldSizes[2*iField+1];
+            for (PetscInt iComp = 0; iComp < numComponents; ++iComp) {
+                PetscScalar value = 0.0;
+                for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                    value += closureArray[closureOffset+iBasis] * weights[iBasis*numComponents+iComp];
+                } // for
+                interpolant[componentOffset+iComp] = value;
+            } // for
+            weights += numBasis * numComponents;
+            closureOffset += numBasis;
+            componentOffset += numComponents;
+        } // for
+        assert(componentOffset == numDof);
+        assert(closureOffset == closureSize);
+        err = DMPlexVecRestoreClosure(dmSoln, NULL, solutionVec, cell, &closureSize, &closureArray);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayWrite(_pointSoln->getLocalVector(), &interpolantArray);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // appendVertexField
 
 
+// ------------------------------------------------------------------------------------------------
+// Find index of matching point in array of points.
+void
+pylith::meshio::OutputSolnPoints::_matchPoints(pylith::int_array* indices,
+                                                const PylithScalar* targets,
+                                                const size_t numTargets,
+                                                const pylith::scalar_array& points,
+                                                const int spaceDim,
+                                                const PylithReal tolerance) {
+    PYLITH_METHOD_BEGIN;
+    assert(indices);
+    assert(spaceDim > 0 && spaceDim <= 3);
+
+    indices->resize(numTargets);
+    (*indices) = -1;
+    const size_t numPoints = points.size() / spaceDim;
+    if (!numPoints || !numTargets) {
+        PYLITH_METHOD_END;
+    } // if
+    assert(targets);
+
+    // Uniform grid over bounding box of points with about one point per bin. Bins must be at
+    // least as large as the tolerance, so matching points are in the same or adjacent bins.
+    PylithReal coordsMin[3], coordsMax[3];
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        coordsMin[iDim] = coordsMax[iDim] = points[iDim];
+    } // for
+    for (size_t iPoint = 1; iPoint < numPoints; ++iPoint) {
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            coordsMin[iDim] = std::min(coordsMin[iDim], points[iPoint*spaceDim+iDim]);
+            coordsMax[iDim] = std::max(coordsMax[iDim], points[iPoint*spaceDim+iDim]);
+        } // for
+    } // for
+    const long numBinsDim = std::max(1L, long(floor(pow(double(numPoints), 1.0/spaceDim))));
+    PylithReal binSize = tolerance;
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        binSize = std::max(binSize, (coordsMax[iDim] - coordsMin[iDim]) / numBinsDim);
+    } // for
+
+    typedef std::pair<long long, PylithInt> bin_type;
+    std::vector<bin_type> bins(numPoints);
+    long binIndex[3];
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        long long key = 0;
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            binIndex[iDim] = std::min(numBinsDim-1, long(floor((points[iPoint*spaceDim+iDim] - coordsMin[iDim]) / binSize)));
+            key = key * numBinsDim + binIndex[iDim];
+        } // for
+        bins[iPoint] = bin_type(key, PylithInt(iPoint));
+    } // for
+    std::sort(bins.begin(), bins.end());
+
+    const PylithReal tolerance2 = tolerance * tolerance;
+    for (size_t iTarget = 0; iTarget < numTargets; ++iTarget) {
+        const PylithScalar* target = &targets[iTarget*spaceDim];
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            binIndex[iDim] = long(floor((target[iDim] - coordsMin[iDim]) / binSize));
+        } // for
+
+        // Check bins adjacent to bin containing target (including bins at the boundary of the grid).
+        PylithInt match = -1;
+        const int numNeighbors = (1 == spaceDim) ? 3 : (2 == spaceDim) ? 9 : 27;
+        for (int iNeighbor = 0; iNeighbor < numNeighbors; ++iNeighbor) {
+            long long key = 0;
+            bool inGrid = true;
+            for (int iDim = 0, offsets = iNeighbor; iDim < spaceDim; ++iDim, offsets /= 3) {
+                const long index = std::min(numBinsDim-1, binIndex[iDim] + offsets % 3 - 1);
+                if ((index < 0) || (binIndex[iDim] + offsets % 3 - 1 > numBinsDim)) {
+                    inGrid = false;
+                    break;
+                } // if
+                key = key * numBinsDim + index;
+            } // for
+            if (!inGrid) {
+                continue;
+            } // if
+
+            const std::pair<std::vector<bin_type>::const_iterator, std::vector<bin_type>::const_iterator> range =
+                std::equal_range(bins.begin(), bins.end(), bin_type(key, -1), _OutputSolnPoints::BinCompare());
+            for (std::vector<bin_type>::const_iterator iter = range.first; iter != range.second; ++iter) {
+                const PylithInt iPoint = iter->second;
+                PylithReal dist2 = 0.0;
+                for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                    const PylithReal delta = points[iPoint*spaceDim+iDim] - target[iDim];
+                    dist2 += delta * delta;
+                } // for
+                if ((dist2 < tolerance2) && ((match < 0) || (iPoint < match))) {
+                    match = iPoint;
+                } // if
+            } // for
+        } // for
+        (*indices)[iTarget] = match;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _matchPoints
+
+
 // ------------------------------------------------------------------------------------------------
 // Write dataset with names of points to file.
 void
@@ -94,6 +94,16 @@ private:
      */
     void _setupInterpolator(const pylith::topology::Field& solution);
 
+    /** Cache cells and basis functions at local points for interpolation.
+     *
+     * The cells containing the points are known after setting up the interpolator, so we tabulate
+     * the basis functions at the points once. Interpolation is then a weighted sum of the values
+     * in the closure of each cell.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _setupInterpolationWeights(const pylith::topology::Field& solution);
+
     /** Interpolate solution field.
      *
      * @param[in] solution Solution field to interpolate.
@@ -103,6 +113,26 @@ private:
     /// Write dataset with names of points to file.
     void _writePointNames(void);
 
+    /** Find index of matching point in array of points.
+     *
+     * The points are binned into a uniform grid, so each search only checks points in the
+     * bins adjacent to the bin containing the target point.
+     *
+     * @param[out] indices Index of matching point for each target point (-1 if no match).
+     * @param[in] targets Coordinates of target points [numTargets * spaceDim].
+     * @param[in] numTargets Number of target points.
+     * @param[in] points Coordinates of points to search [numPoints * spaceDim].
+     * @param[in] spaceDim Spatial dimension of coordinates.
+     * @param[in] tolerance Maximum distance between matching points.
+     */
+    static
+    void _matchPoints(pylith::int_array* indices,
+                      const PylithScalar* targets,
+                      const size_t numTargets,
+                      const pylith::scalar_array& points,
+                      const int spaceDim,
+                      const PylithReal tolerance);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -111,6 +141,10 @@ private:
     pylith::topology::Mesh* _pointMesh; ///< Mesh for points (no cells).
     pylith::topology::Field* _pointSoln; ///< Solution field at points.
     DMInterpolationInfo _interpolator; ///< Field interpolator.
+    pylith::int_array _interpolationCells; ///< Cell containing each local point.
+    pylith::real_array _interpolationWeights; ///< Basis functions at local points [numPointsLocal * weightsStride].
+    pylith::int_array _interpolationFieldSizes; ///< Number of basis functions and components for each field.
+    size_t _interpolationWeightsStride; ///< Number of basis function values for each point.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -29,6 +29,7 @@
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include <typeinfo> // USES typeid()
+#include <stdexcept> // USES std::logic_error
 
 // ------------------------------------------------------------------------------------------------
 // Constructor
@@ -37,7 +38,15 @@ pylith::meshio::OutputSubfield::OutputSubfield(void) :
     _vector(NULL),
     _fn(pylith::fekernels::Solution::passThruSubfield),
     _label(NULL),
-    _labelValue(0) {}
+    _labelValue(0),
+    _extractFieldIS(NULL),
+    _extractSubfieldIS(NULL),
+    _projectFieldIS(NULL),
+    _projectSubfieldIS(NULL),
+    _projectSection(NULL),
+    _projectUseLabel(false),
+    _usePlan(false),
+    _isPointSpace(false) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -54,6 +63,11 @@ pylith::meshio::OutputSubfield::deallocate(void) {
     PetscErrorCode err;
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_extractFieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_extractSubfieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_projectFieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_projectSubfieldIS);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&_projectSection);PYLITH_CHECK_ERROR(err);
 
     _label = NULL; // Destroyed by DMDestroy()
 } // deallocate
@@ -77,6 +91,16 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     subfield->_discretization.dimension = mesh.getDimension();
     // Basis order of output should be less than or equai to the basis order of the computed field.
     subfield->_discretization.basisOrder = std::min(basisOrder, info.fe.basisOrder);
+    // Projection of subfield with same basis as the field reduces to copying values.
+    subfield->_usePlan = (subfield->_discretization.basisOrder == info.fe.basisOrder) &&
+                         (pylith::topology::FieldBase::POLYNOMIAL_SPACE == info.fe.feSpace);
+    // Values stored at quadrature points are output as cell averages.
+    if (pylith::topology::FieldBase::POINT_SPACE == info.fe.feSpace) {
+        subfield->_isPointSpace = true;
+        subfield->_discretization.feSpace = pylith::topology::FieldBase::POLYNOMIAL_SPACE;
+        subfield->_discretization.basisOrder = 0;
+        subfield->_discretization.isBasisContinuous = false;
+    } // if
 
     PetscErrorCode err;
     err = DMClone(mesh.getDM(), &subfield->_dm);PYLITH_CHECK_ERROR(err);
@@ -132,6 +156,26 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
 
+    // Create plan for extracting subfield from local vector of field.
+    PetscInt storageSize = 0;
+    err = VecGetLocalSize(subfield->_vector, &storageSize);PYLITH_CHECK_ERROR(err);
+    PetscInt* fieldIndices = NULL;
+    PetscInt* subfieldIndices = NULL;
+    err = PetscMalloc1(storageSize, &fieldIndices);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(storageSize, &subfieldIndices);PYLITH_CHECK_ERROR(err);
+    PetscInt indexVec = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt fieldOffset = fieldVisitor.sectionOffset(point);
+        const PetscInt numDof = fieldVisitor.sectionDof(point);
+        for (PetscInt iDof = 0; iDof < numDof && indexVec < storageSize; ++iDof, ++indexVec) {
+            fieldIndices[indexVec] = fieldOffset + iDof;
+            subfieldIndices[indexVec] = indexVec;
+        } // for
+    } // for
+    assert(indexVec == storageSize);
+    err = ISCreateGeneral(PETSC_COMM_SELF, indexVec, fieldIndices, PETSC_OWN_POINTER, &subfield->_extractFieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, indexVec, subfieldIndices, PETSC_OWN_POINTER, &subfield->_extractSubfieldIS);PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_RETURN(subfield);
 }
 
@@ -196,6 +240,16 @@ pylith::meshio::OutputSubfield::project(const PetscVec& fieldVector) {
     assert(fieldVector);
     assert(_vector);
 
+    if (_isPointSpace) {
+        _averageQuadPoints(fieldVector, false);
+        PYLITH_METHOD_END;
+    } // if
+
+    if (_usePlan && _createProjectPlan(fieldVector, false)) {
+        _copyWithPlan(fieldVector, _projectFieldIS, _projectSubfieldIS);
+        PYLITH_METHOD_END;
+    } // if
+
     PetscErrorCode err;
     const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
 
@@ -215,6 +269,16 @@ pylith::meshio::OutputSubfield::projectWithLabel(const PetscVec& fieldVector) {
     assert(_vector);
     assert(_label);
 
+    if (_isPointSpace) {
+        _averageQuadPoints(fieldVector, true);
+        PYLITH_METHOD_END;
+    } // if
+
+    if (_usePlan && _createProjectPlan(fieldVector, true)) {
+        _copyWithPlan(fieldVector, _projectFieldIS, _projectSubfieldIS);
+        PYLITH_METHOD_END;
+    } // if
+
     PetscErrorCode err;
     const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
 
@@ -232,6 +296,11 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
                                                 const PetscInt subfieldIndex) {
     PYLITH_METHOD_BEGIN;
 
+    if (_extractFieldIS && (subfieldIndex == _subfieldIndex)) {
+        _copyWithPlan(field.getLocalVector(), _extractFieldIS, _extractSubfieldIS);
+        PYLITH_METHOD_END;
+    } // if
+
     PetscErrorCode err;
     PetscSection subfieldSection = NULL;
     PetscInt storageSize = 0;
@@ -267,4 +336,313 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
 } // extractSubfield
 
 
+// ------------------------------------------------------------------------------------------------
+// Create plan for copying subfield values from global PETSc vector with subfields.
+bool
+pylith::meshio::OutputSubfield::_createProjectPlan(const PetscVec& fieldVector,
+                                                   const bool useLabel) {
+    PYLITH_METHOD_BEGIN;
+    assert(fieldVector);
+
+    PetscErrorCode err;
+    PetscDM fieldDM = NULL;
+    PetscSection fieldGlobalSection = NULL;
+    err = VecGetDM(fieldVector, &fieldDM);PYLITH_CHECK_ERROR(err);
+    if (!fieldDM) {
+        _usePlan = false;
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    err = DMGetGlobalSection(fieldDM, &fieldGlobalSection);PYLITH_CHECK_ERROR(err);
+    if ((_projectSection == fieldGlobalSection) && (_projectUseLabel == useLabel)) {
+        PYLITH_METHOD_RETURN(true);
+    } // if
+    err = ISDestroy(&_projectFieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_projectSubfieldIS);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&_projectSection);PYLITH_CHECK_ERROR(err);
+
+    // Subfield mesh must be the field mesh (shared topology) or a submesh of the field mesh.
+    PetscSection fieldConeSection = NULL, subfieldConeSection = NULL;
+    err = DMPlexGetConeSection(fieldDM, &fieldConeSection);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetConeSection(_dm, &subfieldConeSection);PYLITH_CHECK_ERROR(err);
+    PetscIS fieldSubpointIS = NULL, subpointIS = NULL;
+    err = DMPlexGetSubpointIS(fieldDM, &fieldSubpointIS);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSubpointIS(_dm, &subpointIS);PYLITH_CHECK_ERROR(err);
+    const bool isSameMesh = fieldConeSection == subfieldConeSection;
+    const bool isSubmesh = !isSameMesh && subpointIS && !fieldSubpointIS;
+    if (!isSameMesh && !isSubmesh) {
+        _usePlan = false;
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscSection fieldLocalSection = NULL;
+    PetscSection subfieldGlobalSection = NULL;
+    PetscInt fieldStart = 0, fieldEnd = 0, subfieldStart = 0, subfieldEnd = 0;
+    err = DMGetLocalSection(fieldDM, &fieldLocalSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(_dm, &subfieldGlobalSection);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(fieldVector, &fieldStart, &fieldEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_vector, &subfieldStart, &subfieldEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscIS pointsIS = NULL;
+    PetscInt numPoints = 0;
+    const PetscInt* points = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    if (useLabel) {
+        assert(_label);
+        err = DMLabelGetStratumIS(_label, _labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (pointsIS) {
+            err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        } // if
+    } else {
+        err = PetscSectionGetChart(subfieldGlobalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        numPoints = pEnd - pStart;
+    } // if/else
+
+    PetscInt fieldChartStart = 0, fieldChartEnd = 0;
+    PetscBool includesConstraints = PETSC_TRUE;
+    err = PetscSectionGetChart(fieldLocalSection, &fieldChartStart, &fieldChartEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetIncludesConstraints(fieldGlobalSection, &includesConstraints);PYLITH_CHECK_ERROR(err);
+    PetscInt numSubpoints = 0;
+    const PetscInt* subpoints = NULL;
+    if (isSubmesh) {
+        err = ISGetLocalSize(subpointIS, &numSubpoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscInt subfieldSize = 0;
+    err = VecGetLocalSize(_vector, &subfieldSize);PYLITH_CHECK_ERROR(err);
+    PetscInt* fieldIndices = NULL;
+    PetscInt* subfieldIndices = NULL;
+    err = PetscMalloc1(subfieldSize, &fieldIndices);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(subfieldSize, &subfieldIndices);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numComponents = _description.numComponents;
+    bool isValid = true;
+    PetscInt numIndices = 0;
+    for (PetscInt iPoint = 0; iPoint < numPoints && isValid; ++iPoint) {
+        const PetscInt point = points ? points[iPoint] : pStart + iPoint;
+        PetscInt subfieldDof = 0, subfieldOffset = 0;
+        err = PetscSectionGetDof(subfieldGlobalSection, point, &subfieldDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(subfieldGlobalSection, point, &subfieldOffset);PYLITH_CHECK_ERROR(err);
+        if ((subfieldDof <= 0) || (subfieldOffset < 0)) { continue; } // Not owned or no values.
+
+        // Copying values is only unambiguous with at most one node per point (no orientation).
+        const PetscInt fieldPoint = subpoints ? (point < numSubpoints ? subpoints[point] : -1) : point;
+        if ((subfieldDof > numComponents) || (fieldPoint < fieldChartStart) || (fieldPoint >= fieldChartEnd)) {
+            isValid = false;
+            break;
+        } // if
+        PetscInt fieldDof = 0, fieldPointOffset = 0, fieldSubfieldOffset = 0, fieldGlobalOffset = 0;
+        err = PetscSectionGetFieldDof(fieldLocalSection, fieldPoint, _subfieldIndex, &fieldDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(fieldLocalSection, fieldPoint, &fieldPointOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(fieldLocalSection, fieldPoint, _subfieldIndex, &fieldSubfieldOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(fieldGlobalSection, fieldPoint, &fieldGlobalOffset);PYLITH_CHECK_ERROR(err);
+        if ((fieldDof != subfieldDof) || (fieldGlobalOffset < 0)) {
+            isValid = false;
+            break;
+        } // if
+
+        // Layout of the point in the global vector matches the local section, except that the
+        // global vector omits constrained DOF unless it is an output vector.
+        PetscInt fieldIndex = fieldGlobalOffset + fieldSubfieldOffset - fieldPointOffset - fieldStart;
+        if (!includesConstraints) {
+            PetscInt fieldConstraintDof = 0;
+            err = PetscSectionGetFieldConstraintDof(fieldLocalSection, fieldPoint, _subfieldIndex, &fieldConstraintDof);PYLITH_CHECK_ERROR(err);
+            if (fieldConstraintDof > 0) {
+                isValid = false;
+                break;
+            } // if
+            for (PetscInt iField = 0; iField < _subfieldIndex; ++iField) {
+                err = PetscSectionGetFieldConstraintDof(fieldLocalSection, fieldPoint, iField, &fieldConstraintDof);PYLITH_CHECK_ERROR(err);
+                fieldIndex -= fieldConstraintDof;
+            } // for
+        } // if
+        for (PetscInt iDof = 0; iDof < subfieldDof; ++iDof, ++numIndices) {
+            assert(numIndices < subfieldSize);
+            fieldIndices[numIndices] = fieldIndex + iDof;
+            subfieldIndices[numIndices] = subfieldOffset - subfieldStart + iDof;
+        } // for
+    } // for
+
+    if (subpoints) {
+        err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (points) {
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+
+    // DMProjectField() is collective, so all processes must either use the plan or not.
+    int isValidLocal = isValid ? 1 : 0;
+    int isValidAll = 0;
+    err = MPI_Allreduce(&isValidLocal, &isValidAll, 1, MPI_INT, MPI_MIN, PetscObjectComm((PetscObject)_dm));PYLITH_CHECK_ERROR(err);
+    isValid = isValidAll > 0;
+    if (!isValid) {
+        err = PetscFree(fieldIndices);PYLITH_CHECK_ERROR(err);
+        err = PetscFree(subfieldIndices);PYLITH_CHECK_ERROR(err);
+        _usePlan = false;
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    err = ISCreateGeneral(PETSC_COMM_SELF, numIndices, fieldIndices, PETSC_OWN_POINTER, &_projectFieldIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, numIndices, subfieldIndices, PETSC_OWN_POINTER, &_projectSubfieldIS);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectReference((PetscObject)fieldGlobalSection);PYLITH_CHECK_ERROR(err);
+    _projectSection = fieldGlobalSection;
+    _projectUseLabel = useLabel;
+
+    PYLITH_METHOD_RETURN(true);
+} // _createProjectPlan
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy subfield values using plan.
+void
+pylith::meshio::OutputSubfield::_copyWithPlan(const PetscVec& fieldVector,
+                                              const PetscIS fieldIS,
+                                              const PetscIS subfieldIS) {
+    PYLITH_METHOD_BEGIN;
+    assert(fieldVector);
+    assert(_vector);
+    assert(fieldIS);
+    assert(subfieldIS);
+
+    PetscErrorCode err;
+    PetscInt numIndices = 0;
+    const PetscInt* fieldIndices = NULL;
+    const PetscInt* subfieldIndices = NULL;
+    err = ISGetLocalSize(fieldIS, &numIndices);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(fieldIS, &fieldIndices);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(subfieldIS, &subfieldIndices);PYLITH_CHECK_ERROR(err);
+
+    const PetscScalar* fieldArray = NULL;
+    PetscScalar* subfieldArray = NULL;
+    err = VecGetArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+
+    // Dimensionalize values while copying subfield.
+    const PylithReal scale = _description.scale;
+    for (PetscInt i = 0; i < numIndices; ++i) {
+        subfieldArray[subfieldIndices[i]] = fieldArray[fieldIndices[i]] * scale;
+    } // for
+
+    err = VecRestoreArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(subfieldIS, &subfieldIndices);PYLITH_CHECK_ERROR(err);
+    err = ISRestoreIndices(fieldIS, &fieldIndices);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _copyWithPlan
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute cell averages of subfield values stored at quadrature points.
+void
+pylith::meshio::OutputSubfield::_averageQuadPoints(const PetscVec& fieldVector,
+                                                   const bool useLabel) {
+    PYLITH_METHOD_BEGIN;
+    assert(fieldVector);
+    assert(_vector);
+
+    PetscErrorCode err;
+    PetscDM fieldDM = NULL;
+    err = VecGetDM(fieldVector, &fieldDM);PYLITH_CHECK_ERROR(err);
+    PetscSection fieldConeSection = NULL, subfieldConeSection = NULL;
+    if (fieldDM) {
+        err = DMPlexGetConeSection(fieldDM, &fieldConeSection);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetConeSection(_dm, &subfieldConeSection);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (!fieldDM || (fieldConeSection != subfieldConeSection)) {
+        throw std::logic_error("Output of subfields with values at quadrature points is only supported on the mesh of the field.");
+    } // if
+
+    // Quadrature weights for subfield.
+    PetscDS fieldDS = NULL;
+    PetscObject fieldFE = NULL;
+    PetscQuadrature quadrature = NULL;
+    PetscInt numQuadPts = 0;
+    const PetscReal* quadWeights = NULL;
+    err = DMGetDS(fieldDM, &fieldDS);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetDiscretization(fieldDS, _subfieldIndex, &fieldFE);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetQuadrature((PetscFE)fieldFE, &quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, &quadWeights);PYLITH_CHECK_ERROR(err);
+    PylithReal weightsSum = 0.0;
+    for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+        weightsSum += quadWeights[iQuad];
+    } // for
+    assert(weightsSum > 0.0);
+
+    PetscSection fieldLocalSection = NULL, fieldGlobalSection = NULL, subfieldGlobalSection = NULL;
+    PetscInt fieldStart = 0, fieldEnd = 0, subfieldStart = 0, subfieldEnd = 0;
+    err = DMGetLocalSection(fieldDM, &fieldLocalSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(fieldDM, &fieldGlobalSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(_dm, &subfieldGlobalSection);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(fieldVector, &fieldStart, &fieldEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_vector, &subfieldStart, &subfieldEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscIS pointsIS = NULL;
+    PetscInt numPoints = 0;
+    const PetscInt* points = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    if (useLabel) {
+        assert(_label);
+        err = DMLabelGetStratumIS(_label, _labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (pointsIS) {
+            err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        } // if
+    } else {
+        err = PetscSectionGetChart(subfieldGlobalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        numPoints = pEnd - pStart;
+    } // if/else
+
+    const PetscScalar* fieldArray = NULL;
+    PetscScalar* subfieldArray = NULL;
+    err = VecGetArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+
+    // Dimensionalize values while averaging subfield.
+    const PylithReal scale = _description.scale / weightsSum;
+    const PetscInt numComponents = _description.numComponents;
+    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const PetscInt point = points ? points[iPoint] : pStart + iPoint;
+        PetscInt subfieldDof = 0, subfieldOffset = 0;
+        err = PetscSectionGetDof(subfieldGlobalSection, point, &subfieldDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(subfieldGlobalSection, point, &subfieldOffset);PYLITH_CHECK_ERROR(err);
+        if ((subfieldDof <= 0) || (subfieldOffset < 0)) { continue; } // Not owned or no values.
+        assert(subfieldDof == numComponents);
+
+        PetscInt fieldDof = 0, fieldPointOffset = 0, fieldSubfieldOffset = 0, fieldGlobalOffset = 0;
+        err = PetscSectionGetFieldDof(fieldLocalSection, point, _subfieldIndex, &fieldDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(fieldLocalSection, point, &fieldPointOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(fieldLocalSection, point, _subfieldIndex, &fieldSubfieldOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(fieldGlobalSection, point, &fieldGlobalOffset);PYLITH_CHECK_ERROR(err);
+        if ((fieldDof != numQuadPts*numComponents) || (fieldGlobalOffset < 0)) { continue; }
+
+        // Values are ordered by quadrature point and then component.
+        const PetscScalar* cellValues = &fieldArray[fieldGlobalOffset + fieldSubfieldOffset - fieldPointOffset - fieldStart];
+        PetscScalar* cellAverage = &subfieldArray[subfieldOffset - subfieldStart];
+        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            cellAverage[iComponent] = 0.0;
+        } // for
+        for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                cellAverage[iComponent] += quadWeights[iQuad] * cellValues[iQuad*numComponents+iComponent];
+            } // for
+        } // for
+        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            cellAverage[iComponent] *= scale;
+        } // for
+    } // for
+
+    err = VecRestoreArray(_vector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    if (points) {
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _averageQuadPoints
+
+
 // End of file
@@ -132,6 +132,41 @@ private:
     // Constructor.
     OutputSubfield(void);
 
+    /** Create plan for copying subfield values from global PETSc vector with subfields.
+     *
+     * The plan is only created when projection reduces to copying values, i.e., the basis order
+     * of the subfield matches the basis order of the field, each point has at most one node, and
+     * the subfield mesh is the field mesh or a submesh of it. Values of constrained DOF are not
+     * in a global vector that excludes constrained DOF, so we do not create a plan if the subfield
+     * has constrained DOF in such a vector.
+     *
+     * @param[in] fieldVector Global PETSc vector with subfields.
+     * @param[in] useLabel Restrict plan to points in label.
+     * @returns True if plan was created, false otherwise.
+     */
+    bool _createProjectPlan(const PetscVec& fieldVector,
+                            const bool useLabel);
+
+    /** Copy subfield values using plan.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     * @param[in] fieldIS Indices of subfield values in local array of field vector.
+     * @param[in] subfieldIS Indices of subfield values in local array of subfield vector.
+     */
+    void _copyWithPlan(const PetscVec& fieldVector,
+                       const PetscIS fieldIS,
+                       const PetscIS subfieldIS);
+
+    /** Compute cell averages of subfield values stored at quadrature points.
+     *
+     * @pre Subfield mesh must be the field mesh.
+     *
+     * @param[in] fieldVector Global PETSc vector with subfields.
+     * @param[in] useLabel Restrict averaging to cells in label.
+     */
+    void _averageQuadPoints(const PetscVec& fieldVector,
+                            const bool useLabel);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -145,6 +180,15 @@ protected:
     PetscDMLabel _label; ///< PETSc label associated with subfield.
     PetscInt _labelValue; ///< Value of PETSc label associated with subfield.
 
+    PetscIS _extractFieldIS; ///< Indices of subfield values in local array of field for extractSubfield().
+    PetscIS _extractSubfieldIS; ///< Indices of subfield values in local array of subfield for extractSubfield().
+    PetscIS _projectFieldIS; ///< Indices of subfield values in local array of field vector for projection.
+    PetscIS _projectSubfieldIS; ///< Indices of subfield values in local array of subfield vector for projection.
+    PetscSection _projectSection; ///< Global section of field vector used to create projection plan.
+    bool _projectUseLabel; ///< True if projection plan is restricted to points in label.
+    bool _usePlan; ///< True if projection can use plan instead of DMProjectField().
+    bool _isPointSpace; ///< True if subfield values are stored at quadrature points.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -64,6 +64,7 @@ namespace pylith {
 
         class DataWriter;
         class DataWriterVTK;
+        class DataWriterVTU;
         class DataWriterHDF5;
         class DataWriterHDF5Ext;
 
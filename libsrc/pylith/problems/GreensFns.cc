@@ -29,10 +29,12 @@
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/ProgressMonitorStep.hh" // USES ProgressMonitorStep
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petscsnes.h" // USES PetscSNES
+#include "petscksp.h" // USES PetscKSP
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
@@ -59,11 +61,20 @@ pylith::problems::GreensFns::GreensFns(void) :
     _faultImpulses(NULL),
     _integratorImpulses(NULL),
     _snes(NULL),
+    _projectionBasisSize(32),
+    _useProjection(false),
     _monitor(NULL) {
     PyreComponent::setName(_GreensFns::pyreComponent);
 
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
+
+    assert(_logger);
+    _stageSolve = _logger->registerStage("Solve");
+    _eventImpulse = _logger->registerEvent("Py-GrFn-impulse");
+    _eventPoststep = _logger->registerEvent("Py-GrFn-poststep");
+    _eventResidual = _logger->registerEvent("Py-GrFn-computeResidual");
+    _eventJacobian = _logger->registerEvent("Py-GrFn-computeJacobian");
 } // constructor
 
 
@@ -88,6 +99,12 @@ pylith::problems::GreensFns::deallocate(void) {
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
 
     PetscErrorCode err = SNESDestroy(&_snes);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < _basisSolution.size(); ++i) {
+        err = VecDestroy(&_basisSolution[i]);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&_basisImage[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _basisSolution.clear();
+    _basisImage.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -133,6 +150,30 @@ pylith::problems::GreensFns::getFaultLabelValue(void) const {
 } // getFaultLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Set maximum number of previous Green's functions in projection basis for initial guess.
+void
+pylith::problems::GreensFns::setProjectionBasisSize(const int value) {
+    PYLITH_COMPONENT_DEBUG("setProjectionBasisSize(value="<<value<<")");
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Size of projection basis for initial guess ("<<value<<") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _projectionBasisSize = value;
+} // setProjectionBasisSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get maximum number of previous Green's functions in projection basis for initial guess.
+int
+pylith::problems::GreensFns::getProjectionBasisSize(void) const {
+    return _projectionBasisSize;
+} // getProjectionBasisSize
+
+
 // ------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -238,11 +279,14 @@ pylith::problems::GreensFns::initialize(void) {
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, 1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, 0.0);
 
+    PetscMat jacobianMat = NULL;
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
         PYLITH_COMPONENT_DEBUG("Setting PetscSNES callbacks SNESSetFunction() and SNESSetJacobian().");
         err = SNESSetFunction(_snes, NULL, computeResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = SNESSetJacobian(_snes, NULL, NULL, computeJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        jacobianMat = _createJacobianMatrix();
+        err = SNESSetJacobian(_snes, jacobianMat, jacobianMat, computeJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
         err = SNESSetType(_snes, SNESKSPONLY);PYLITH_CHECK_ERROR(err);
         err = SNESSetLagJacobian(_snes, -2);PYLITH_CHECK_ERROR(err);
         break;
@@ -257,7 +301,11 @@ pylith::problems::GreensFns::initialize(void) {
     } // default
     } // switch
 
-    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
+    // The projection basis provides the initial guess for the linear solver, so we do not want
+    // the PETSc initial guess (KSPGuess) defaults.
+    const int petscDefaults = (LINEAR == _solverType) ?
+                              _petscDefaults & ~pylith::utils::PetscDefaults::INITIAL_GUESS : _petscDefaults;
+    pylith::utils::PetscDefaults::set(*solution, _materials[0], petscDefaults, _isJacobianSPD);
     err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
     err = SNESSetUp(_snes);PYLITH_CHECK_ERROR(err);
 
@@ -323,6 +371,11 @@ pylith::problems::GreensFns::solve(void) {
         numImpulsesGlobal += numImpulses[iProc];
     } // for
 
+    assert(_logger);
+    _logger->stagePush(_stageSolve);
+    if (LINEAR == _solverType) {
+        _setupLinearSolve();
+    } // if
     const PylithReal tolerance = 1.0e-4;
     for (int iProc = 0, iImpulseGlobal = 0; iProc < mpiNumProcs; ++iProc) {
         for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal, ++iImpulseGlobal) {
@@ -331,15 +384,22 @@ pylith::problems::GreensFns::solve(void) {
             } // if
 
             // Update impulse on fault
+            _logger->eventBegin(_eventImpulse);
             const PetscReal impulseReal = (mpiRank == iProc) ? iImpulseLocal + tolerance : -1.0;
             _integratorImpulses->setState(impulseReal);
 
-            err = SNESSolve(_snes, residual->getGlobalVector(), solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
+            if (LINEAR == _solverType) {
+                _solveLinear();
+            } else {
+                err = SNESSolve(_snes, residual->getGlobalVector(), solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
+            } // if/else
+            _logger->eventEnd(_eventImpulse);
             solution->scatterVectorToLocal(solution->getGlobalVector());
             solution->scatterLocalToOutput();
             poststep(size_t(iImpulseGlobal), numImpulsesGlobal);
         } // for
     } // for
+    _logger->stagePop();
 
     PYLITH_METHOD_END;
 } // solve
@@ -352,6 +412,8 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
                                       const size_t numImpulses) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("poststep(impulse"<<impulse<<")");
+    assert(_logger);
+    _logger->eventBegin(_eventPoststep);
 
     // Get current solution. ParaView needs valid times.
     const PetscReal t = impulse / _normalizer->getTimeScale();
@@ -383,6 +445,8 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
         _monitor->update(impulse, 0, numImpulses);
     } // if
 
+    _logger->eventEnd(_eventPoststep);
+
     PYLITH_METHOD_END;
 } // poststep
 
@@ -421,6 +485,8 @@ pylith::problems::GreensFns::computeResidual(PetscVec residualVec,
     assert(residualVec);
     assert(solutionVec);
     assert(_integrationData);
+    assert(_logger);
+    _logger->eventBegin(_eventResidual);
     pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);
     assert(residual);
 
@@ -439,6 +505,8 @@ pylith::problems::GreensFns::computeResidual(PetscVec residualVec,
     PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
     residual->scatterLocalToVector(residualVec, ADD_VALUES);
 
+    _logger->eventEnd(_eventResidual);
+
     PYLITH_METHOD_END;
 } // computeResidual
 
@@ -454,6 +522,8 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
 
     assert(jacobianMat);
     assert(solutionVec);
+    assert(_logger);
+    _logger->eventBegin(_eventJacobian);
 
     assert(_integrationData);
     pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
@@ -489,10 +559,162 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    _setSchurPrecond(_snes, precondMat);
+
+    _logger->eventEnd(_eventJacobian);
+
     PYLITH_METHOD_END;
 } // computeJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute Jacobian and set operators for linear solver.
+void
+pylith::problems::GreensFns::_setupLinearSolve(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupLinearSolve()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    // The operator does not change with the impulses, so we assemble the Jacobian and set up the
+    // preconditioner (e.g., factorization) once for all impulses.
+    PetscErrorCode err = 0;
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    err = SNESGetJacobian(_snes, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    assert(jacobianMat);
+    assert(precondMat);
+
+    PetscVec solutionVec = solution->getGlobalVector();
+    err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    computeJacobian(jacobianMat, precondMat, solutionVec);
+
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+
+    // A direct solve gains nothing from an initial guess.
+    PetscBool isPreOnly = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)ksp, KSPPREONLY, &isPreOnly);PYLITH_CHECK_ERROR(err);
+    _useProjection = _projectionBasisSize > 0 && !isPreOnly;
+    if (_useProjection) {
+        err = KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupLinearSolve
+
+
+// ------------------------------------------------------------------------------------------------
+// Solve for one impulse using linear solver.
+void
+pylith::problems::GreensFns::_solveLinear(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_solveLinear()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    PetscVec rhsVec = NULL;
+    err = SNESGetFunction(_snes, &rhsVec, NULL, NULL);PYLITH_CHECK_ERROR(err);assert(rhsVec);
+
+    // Right-hand side is -F(0), which includes the impulse and any boundary values.
+    PetscVec solutionVec = solution->getGlobalVector();
+    err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    computeResidual(rhsVec, solutionVec);
+    err = VecScale(rhsVec, -1.0);PYLITH_CHECK_ERROR(err);
+
+    // Initial guess x0 = V W^T b minimizes |b - A x0| over the span of the previous solutions,
+    // where W = A V has orthonormal columns.
+    const PetscInt basisSize = _basisImage.size();
+    if (_useProjection && (basisSize > 0)) {
+        PetscScalar* coefs = NULL;
+        err = PetscMalloc1(basisSize, &coefs);PYLITH_CHECK_ERROR(err);
+        err = VecMDot(rhsVec, basisSize, &_basisImage[0], coefs);PYLITH_CHECK_ERROR(err);
+        err = VecMAXPY(solutionVec, basisSize, coefs, &_basisSolution[0]);PYLITH_CHECK_ERROR(err);
+        err = PetscFree(coefs);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    err = KSPSolve(ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+
+    if (_useProjection) {
+        _updateProjectionBasis(solutionVec);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _solveLinear
+
+
+// ------------------------------------------------------------------------------------------------
+// Add solution to projection basis.
+void
+pylith::problems::GreensFns::_updateProjectionBasis(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_updateProjectionBasis(solutionVec="<<solutionVec<<")");
+
+    const PetscInt basisSize = _basisImage.size();
+    if (basisSize >= _projectionBasisSize) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscKSP ksp = NULL;
+    err = SNESGetKSP(_snes, &ksp);PYLITH_CHECK_ERROR(err);
+    PetscMat jacobianMat = NULL;
+    err = KSPGetOperators(ksp, &jacobianMat, NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscVec solnVec = NULL;
+    PetscVec imageVec = NULL;
+    err = VecDuplicate(solutionVec, &solnVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &imageVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, solnVec);PYLITH_CHECK_ERROR(err);
+    err = MatMult(jacobianMat, solnVec, imageVec);PYLITH_CHECK_ERROR(err);
+
+    PylithReal normOrig = 0.0;
+    err = VecNorm(imageVec, NORM_2, &normOrig);PYLITH_CHECK_ERROR(err);
+
+    // Orthogonalize image against previous images using classical Gram-Schmidt with
+    // reorthogonalization, applying the same operations to the solution.
+    if (basisSize > 0) {
+        PetscScalar* coefs = NULL;
+        err = PetscMalloc1(basisSize, &coefs);PYLITH_CHECK_ERROR(err);
+        for (int iPass = 0; iPass < 2; ++iPass) {
+            err = VecMDot(imageVec, basisSize, &_basisImage[0], coefs);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < basisSize; ++i) {
+                coefs[i] *= -1.0;
+            } // for
+            err = VecMAXPY(imageVec, basisSize, coefs, &_basisImage[0]);PYLITH_CHECK_ERROR(err);
+            err = VecMAXPY(solnVec, basisSize, coefs, &_basisSolution[0]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = PetscFree(coefs);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Discard solutions that are (nearly) linearly dependent on the basis.
+    const PylithReal tolerance = 1.0e-10;
+    PylithReal norm = 0.0;
+    err = VecNorm(imageVec, NORM_2, &norm);PYLITH_CHECK_ERROR(err);
+    if (norm <= tolerance * normOrig) {
+        err = VecDestroy(&solnVec);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&imageVec);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    err = VecScale(imageVec, 1.0/norm);PYLITH_CHECK_ERROR(err);
+    err = VecScale(solnVec, 1.0/norm);PYLITH_CHECK_ERROR(err);
+    _basisSolution.push_back(solnVec);
+    _basisImage.push_back(imageVec);
+
+    PYLITH_METHOD_END;
+} // _updateProjectionBasis
+
+
 // ------------------------------------------------------------------------------------------------
 // Callback static method for computing residual.
 PetscErrorCode
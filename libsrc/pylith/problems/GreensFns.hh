@@ -70,6 +70,20 @@ public:
      */
     int getFaultLabelValue(void) const;
 
+    /** Set maximum number of previous Green's functions in projection basis for initial guess.
+     *
+     * Only used with the linear solver.
+     *
+     * @param[in] value Maximum number of vectors in basis (0 to disable).
+     */
+    void setProjectionBasisSize(const int value);
+
+    /** Get maximum number of previous Green's functions in projection basis for initial guess.
+     *
+     * @returns Maximum number of vectors in basis.
+     */
+    int getProjectionBasisSize(void) const;
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for Green's functions simulation.
@@ -152,6 +166,25 @@ public:
                                    PetscMat precondMat,
                                    void* context);
 
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Compute Jacobian and set operators for linear solver.
+    void _setupLinearSolve(void);
+
+    /** Solve for one impulse using linear solver.
+     *
+     * We solve A x = -F(0) with an initial guess from the projection of the right-hand side onto
+     * the space spanned by the images of previous solutions.
+     */
+    void _solveLinear(void);
+
+    /** Add solution to projection basis.
+     *
+     * @param[in] solutionVec PETSc Vec with solution for impulse.
+     */
+    void _updateProjectionBasis(PetscVec solutionVec);
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -161,8 +194,18 @@ private:
     pylith::feassemble::Integrator* _integratorImpulses; ///< Integrator for Green's functions impulses.
 
     PetscSNES _snes; ///< PETSc SNES solver.
+    std::vector<PetscVec> _basisSolution; ///< Previous solutions scaled so their images are orthonormal.
+    std::vector<PetscVec> _basisImage; ///< Orthonormal images (A x) of previous solutions.
+    int _projectionBasisSize; ///< Maximum number of vectors in projection basis.
+    bool _useProjection; ///< True if using projection basis for initial guess.
     pylith::problems::ProgressMonitorStep* _monitor; ///< Monitor for simulation progress.
 
+    int _stageSolve; ///< Logging stage for solve.
+    int _eventImpulse; ///< Logging event for solving for one impulse.
+    int _eventPoststep; ///< Logging event for poststep.
+    int _eventResidual; ///< Logging event for computing residual.
+    int _eventJacobian; ///< Logging event for computing Jacobian.
+
 }; // GreensFns
 
 #endif // pylith_problems_greensfns_hh
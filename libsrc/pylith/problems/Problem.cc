@@ -27,7 +27,10 @@
 
 #include "pylith/materials/Material.hh" // USES Material
 #include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/faults/FaultOps.hh" // USES FaultOps
 #include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/bc/DirichletTimeDependent.hh" // USES DirichletTimeDependent
+#include "pylith/bc/DirichletUserFn.hh" // USES DirichletUserFn
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
@@ -39,9 +42,16 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
+#include "petscsnes.h" // USES PetscSNES
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include <set> // USES std::set
+#include <algorithm> // USES std::max()
+#include <iomanip> // USES std::setw()
+#include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
 
@@ -60,6 +70,29 @@ public:
             void createNullSpace(const pylith::topology::Field* solution,
                                  const char* subfieldName);
 
+            /** Set discretization of solution on coarse levels of mesh from uniform refinement.
+             *
+             * The coarse DM of the solution DM (and each coarser level) is replaced by a clone of the
+             * coarse mesh with the fields and essential boundary conditions of the solution, so that
+             * PCMG can create the interpolation between levels.
+             *
+             * @param[inout] solution Solution field.
+             */
+            static
+            void createCoarseDiscretization(const pylith::topology::Field* solution);
+
+            /** Set block size of global vector for solution.
+             *
+             * The block size is the number of unconstrained degrees of freedom per point if it is
+             * the same for all points with unconstrained degrees of freedom on all processes; otherwise
+             * it is 1. This matches the block size PETSc uses when creating the Jacobian from the DM.
+             *
+             * @param[inout] solution Solution field.
+             * @returns Block size.
+             */
+            static
+            PetscInt setBlockSize(pylith::topology::Field* solution);
+
             /** Set data needed to integrate domain faces on interior interface.
              *
              * @param[inout] solution Solution field.
@@ -87,9 +120,16 @@ pylith::problems::Problem::Problem() :
     _normalizer(NULL),
     _gravityField(NULL),
     _observers(new pylith::problems::ObserversSoln),
+    _logger(new pylith::utils::EventLogger),
     _formulation(pylith::problems::Physics::QUASISTATIC),
     _solverType(LINEAR),
-    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING) {}
+    _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING),
+    _matrixType("default"),
+    _isJacobianSPD(false),
+    _schurPrecondMat(NULL) {
+    _logger->setClassName("Problem");
+    _logger->initialize();
+} // constructor
 
 
 // ------------------------------------------------------------------------------------------------
@@ -119,9 +159,12 @@ pylith::problems::Problem::deallocate(void) {
     delete _normalizer;_normalizer = NULL;
     _gravityField = NULL; // Held by Python. :KLUDGE: :TODO: Use shared pointer.
     delete _observers;_observers = NULL;
+    delete _logger;_logger = NULL;
 
     pylith::topology::FieldOps::deallocate();
 
+    PetscErrorCode err = MatDestroy(&_schurPrecondMat);PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -165,6 +208,29 @@ pylith::problems::Problem::getSolverType(void) const {
 } // getSolverType
 
 
+// ------------------------------------------------------------------------------------------------
+// Set PETSc matrix type for Jacobian.
+void
+pylith::problems::Problem::setMatrixType(const char* value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setMatrixType(value="<<value<<")");
+
+    assert(value);
+    const std::string matrixType(value);
+    if ((matrixType != "default") && (matrixType != MATAIJ) && (matrixType != MATBAIJ) && (matrixType != MATSBAIJ)) {
+        PYLITH_COMPONENT_LOGICERROR("Unknown matrix type '" << matrixType << "'.");
+    } // if
+    _matrixType = matrixType;
+} // setMatrixType
+
+
+// ------------------------------------------------------------------------------------------------
+// Get PETSc matrix type for Jacobian.
+const char*
+pylith::problems::Problem::getMatrixType(void) const {
+    return _matrixType.c_str();
+} // getMatrixType
+
+
 // ------------------------------------------------------------------------------------------------
 // Specify whether to set defaults for PETSc solver appropriate for problem.
 void
@@ -412,8 +478,10 @@ pylith::problems::Problem::initialize(void) {
     pylith::topology::Field* solution = _integrationData->getField("solution");
     assert(solution);
 
-    // Initialize solution field.
-    PetscErrorCode err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
+    // Initialize solution field. Set matrix type before options, so -dm_mat_type takes precedence.
+    const bool useDefaultMatType = "default" == _matrixType;
+    PetscErrorCode err = DMSetMatType(solution->getDM(), useDefaultMatType ? MATAIJ : _matrixType.c_str());PYLITH_CHECK_ERROR(err);
+    err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
     _setupSolution();
     pylith::topology::CoordsVisitor::optimizeClosure(solution->getDM());
 
@@ -433,9 +501,37 @@ pylith::problems::Problem::initialize(void) {
         _constraints[i]->initialize(*solution);
     } // for
 
+    // Use symmetric storage for a symmetric positive definite Jacobian with the default direct solver.
+    _isJacobianSPD = _checkJacobianSPD();
+    int numProcs = 1;
+    err = MPI_Comm_size(solution->getMesh().getComm(), &numProcs);PYLITH_CHECK_ERROR(err);
+    const bool isParallel = (numProcs > 1) || (_petscDefaults & pylith::utils::PetscDefaults::PARALLEL);
+    if (_isJacobianSPD && useDefaultMatType && !isParallel && (_petscDefaults & pylith::utils::PetscDefaults::SOLVER)) {
+        MatType matType = NULL;
+        err = DMGetMatType(solution->getDM(), &matType);PYLITH_CHECK_ERROR(err);
+        PetscBool isAIJ = PETSC_FALSE, hasPCType = PETSC_FALSE;
+        err = PetscStrcmp(matType, MATAIJ, &isAIJ);PYLITH_CHECK_ERROR(err);
+        err = PetscOptionsHasName(NULL, NULL, "-pc_type", &hasPCType);PYLITH_CHECK_ERROR(err);
+        if (isAIJ && !hasPCType) { // Not overridden by -dm_mat_type and using default preconditioner.
+            err = DMSetMatType(solution->getDM(), MATSBAIJ);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if
+
     solution->allocate();
     solution->createGlobalVector();
     solution->createOutputVector();
+    const PetscInt blockSize = _Problem::setBlockSize(solution);
+    _Problem::createCoarseDiscretization(solution);
+
+    pythia::journal::info_t info(PyreComponent::getName());
+    if (info.state()) {
+        MatType matType = NULL;
+        err = DMGetMatType(solution->getDM(), &matType);PYLITH_CHECK_ERROR(err);
+        info << pythia::journal::at(__HERE__)
+             << "Using matrix type '" << matType << "' with block size " << blockSize << " for Jacobian"
+             << (_isJacobianSPD ? " (symmetric positive definite)." : ".")
+             << pythia::journal::endl;
+    } // if
 
     switch (_formulation) {
     case pylith::problems::Physics::DYNAMIC:
@@ -459,6 +555,130 @@ pylith::problems::Problem::initialize(void) {
 } // initialize
 
 
+// ------------------------------------------------------------------------------------------------
+// Finalize problem.
+void
+pylith::problems::Problem::finalize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::finalize()");
+
+    if (pylith::utils::EventLogger::isLoggingActive()) {
+        _writePerformanceSummary();
+    } // if
+
+    PYLITH_METHOD_END;
+} // finalize
+
+
+// ------------------------------------------------------------------------------------------------
+// Set approximate Schur complement preconditioner for the fault Lagrange multipliers.
+void
+pylith::problems::Problem::_setSchurPrecond(PetscSNES snes,
+                                            PetscMat precondMat) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setSchurPrecond(snes="<<snes<<", precondMat="<<precondMat<<")");
+
+    assert(snes);
+    assert(precondMat);
+
+    PetscErrorCode err = 0;
+    PetscKSP ksp = NULL;
+    PetscPC pc = NULL;
+    err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+
+    PetscBool isFieldSplit = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isFieldSplit);PYLITH_CHECK_ERROR(err);
+    if (!isFieldSplit) { PYLITH_METHOD_END; }
+
+    PCCompositeType splitType = PC_COMPOSITE_ADDITIVE;
+    err = PCFieldSplitGetType(pc, &splitType);PYLITH_CHECK_ERROR(err);
+    if (PC_COMPOSITE_SCHUR != splitType) { PYLITH_METHOD_END; }
+
+    PCFieldSplitSchurPreType schurPreType = PC_FIELDSPLIT_SCHUR_PRE_SELF;
+    PetscMat schurPreMat = NULL;
+    err = PCFieldSplitGetSchurPre(pc, &schurPreType, &schurPreMat);PYLITH_CHECK_ERROR(err);
+    if (PC_FIELDSPLIT_SCHUR_PRE_USER != schurPreType) { PYLITH_METHOD_END; }
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    if ((solution->getSubfieldNames().size() != 2) ||
+        !solution->hasSubfield("displacement") ||
+        !solution->hasSubfield("lagrange_multiplier_fault")) {
+        PYLITH_COMPONENT_WARNING("Ignoring user preconditioner for Schur complement. User preconditioner for Schur complement "
+                                 << "is only supported for solutions with displacement and fault Lagrange multiplier subfields.");
+        PYLITH_METHOD_END;
+    } // if
+
+    std::vector<pylith::feassemble::IntegratorInterface*> integratorsInterface;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::feassemble::IntegratorInterface* integrator = dynamic_cast<pylith::feassemble::IntegratorInterface*>(_integrators[i]);
+        if (integrator) {
+            integratorsInterface.push_back(integrator);
+        } // if
+    } // for
+
+    pylith::faults::FaultOps::createSchurPrecond(&_schurPrecondMat, precondMat, *solution, integratorsInterface);
+    err = PCFieldSplitSetSchurPre(pc, PC_FIELDSPLIT_SCHUR_PRE_USER, _schurPrecondMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setSchurPrecond
+
+
+// ------------------------------------------------------------------------------------------------
+// Create matrix for Jacobian from solution DM.
+PetscMat
+pylith::problems::Problem::_createJacobianMatrix(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createJacobianMatrix()");
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField("solution");assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscMat jacobianMat = NULL;
+    err = DMCreateMatrix(solution->getDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    // Symmetric block storage holds only the upper triangle, so drop the values we insert below
+    // the diagonal.
+    PetscBool isSymmetricBlock = PETSC_FALSE;
+    err = PetscObjectTypeCompareAny((PetscObject)jacobianMat, &isSymmetricBlock, MATSEQSBAIJ, MATMPISBAIJ, "");PYLITH_CHECK_ERROR(err);
+    if (isSymmetricBlock) {
+        err = MatSetOption(jacobianMat, MAT_IGNORE_LOWER_TRIANGULAR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_isJacobianSPD) {
+        err = MatSetOption(jacobianMat, MAT_SPD, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = MatSetOption(jacobianMat, MAT_SPD_ETERNAL, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(jacobianMat);
+} // _createJacobianMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Create separate matrix for Jacobian preconditioner if needed.
+PetscMat
+pylith::problems::Problem::_createPrecondMatrix(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createPrecondMatrix()");
+
+    bool hasPrecond = false;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (_integrators[i]->hasLHSJacobianPrecond()) {
+            hasPrecond = true;
+            break;
+        } // if
+    } // for
+
+    PetscMat precondMat = (hasPrecond) ? _createJacobianMatrix() : NULL;
+
+    PYLITH_METHOD_RETURN(precondMat);
+} // _createPrecondMatrix
+
+
 // ------------------------------------------------------------------------------------------------
 // Check material and interface ids.
 void
@@ -489,6 +709,43 @@ pylith::problems::Problem::_checkMaterialLabels(void) const {
 } // _checkMaterialLabels
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether Jacobian is symmetric positive definite.
+bool
+pylith::problems::Problem::_checkJacobianSPD(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    if ((pylith::problems::Physics::QUASISTATIC != _formulation) || (_interfaces.size() > 0)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    for (size_t i = 0; i < _materials.size(); ++i) {
+        assert(_materials[i]);
+        if (!_materials[i]->isJacobianSymmetric()) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    for (size_t i = 0; i < _integrators.size(); ++i) {
+        assert(_integrators[i]);
+        if (_integrators[i]->hasLHSJacobian() && !dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i])) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    // Without a Dirichlet boundary condition, rigid body motion is in the null space, so the
+    // Jacobian is only positive semidefinite.
+    bool hasDirichletBC = false;
+    for (size_t i = 0; i < _bc.size() && !hasDirichletBC; ++i) {
+        assert(_bc[i]);
+        hasDirichletBC = dynamic_cast<pylith::bc::DirichletTimeDependent*>(_bc[i]) ||
+                         dynamic_cast<pylith::bc::DirichletUserFn*>(_bc[i]);
+    } // for
+
+    PYLITH_METHOD_RETURN(hasDirichletBC);
+} // _checkJacobianSPD
+
+
 // ------------------------------------------------------------------------------------------------
 // Create array of integrators from materials, interfaces, and boundary conditions.
 void
@@ -622,6 +879,75 @@ pylith::problems::Problem::_setupSolution(void) {
 } // _setupSolution
 
 
+// ------------------------------------------------------------------------------------------------
+// Write summary of performance of physics implementations to info journal.
+void
+pylith::problems::Problem::_writePerformanceSummary(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    // Collect events from integrators and constraints. Events for the same physics share a name
+    // and PETSc event, so we only include each event once.
+    std::vector<const pylith::feassemble::PhysicsImplementation*> implementations;
+    implementations.insert(implementations.end(), _integrators.begin(), _integrators.end());
+    implementations.insert(implementations.end(), _constraints.begin(), _constraints.end());
+
+    std::set<int> eventIds;
+    std::vector<std::string> eventNames;
+    std::vector<int> eventOrder;
+    for (size_t i = 0; i < implementations.size(); ++i) {
+        const pylith::utils::EventLogger* logger = implementations[i] ? implementations[i]->getEventLogger() : NULL;
+        if (!logger) { continue; }
+
+        const std::map<std::string,int>& events = logger->getEvents();
+        for (std::map<std::string,int>::const_iterator iter = events.begin(); iter != events.end(); ++iter) {
+            if (eventIds.insert(iter->second).second) {
+                eventNames.push_back(iter->first);
+                eventOrder.push_back(iter->second);
+            } // if
+        } // for
+    } // for
+    const size_t numEvents = eventOrder.size();
+    if (!numEvents) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Times and counts are maximum over processes; flops are summed over processes.
+    std::vector<double> timeLocal(numEvents), flopsLocal(numEvents), countLocal(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+        int count = 0;
+        pylith::utils::EventLogger::getEventPerfInfo(&count, &timeLocal[i], &flopsLocal[i], eventOrder[i]);
+        countLocal[i] = count;
+    } // for
+    std::vector<double> timeGlobal(numEvents), flopsGlobal(numEvents), countGlobal(numEvents);
+    PetscErrorCode err = 0;
+    err = MPI_Allreduce(&timeLocal[0], &timeGlobal[0], numEvents, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&flopsLocal[0], &flopsGlobal[0], numEvents, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&countLocal[0], &countGlobal[0], numEvents, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);PYLITH_CHECK_ERROR(err);
+
+    size_t nameWidth = 5;
+    for (size_t i = 0; i < numEvents; ++i) {
+        nameWidth = std::max(nameWidth, eventNames[i].length());
+    } // for
+
+    std::ostringstream msg;
+    msg << "Performance summary of physics implementations (time and count are maximum over processes).\n"
+        << "    " << std::left << std::setw(nameWidth) << "Event" << std::right
+        << std::setw(10) << "Count" << std::setw(14) << "Time (s)" << std::setw(14) << "Flops" << std::setw(12) << "Mflop/s";
+    for (size_t i = 0; i < numEvents; ++i) {
+        if (countGlobal[i] <= 0.0) { continue; }
+        const double mflops = (timeGlobal[i] > 0.0) ? 1.0e-6 * flopsGlobal[i] / timeGlobal[i] : 0.0;
+        msg << "\n    " << std::left << std::setw(nameWidth) << eventNames[i] << std::right
+            << std::setw(10) << int(countGlobal[i])
+            << std::scientific << std::setprecision(4)
+            << std::setw(14) << timeGlobal[i] << std::setw(14) << flopsGlobal[i]
+            << std::fixed << std::setprecision(1) << std::setw(12) << mflops;
+    } // for
+    PYLITH_COMPONENT_INFO_ROOT(msg.str());
+
+    PYLITH_METHOD_END;
+} // _writePerformanceSummary
+
+
 // ------------------------------------------------------------------------------------------------
 // Create null space for solution subfield.
 void
@@ -654,6 +980,120 @@ pylith::problems::_Problem::createNullSpace(const pylith::topology::Field* solut
 } // createNullSpace
 
 
+// ------------------------------------------------------------------------------------------------
+// Set discretization of solution on coarse levels of mesh from uniform refinement.
+void
+pylith::problems::_Problem::createCoarseDiscretization(const pylith::topology::Field* solution) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscDM dmFine = solution->getDM();
+    PetscDM dmCoarseMesh = NULL;
+    err = DMGetCoarseDM(dmFine, &dmCoarseMesh);PYLITH_CHECK_ERROR(err);
+    while (dmCoarseMesh) {
+        // Hold reference to coarse mesh, because replacing the coarse DM of the finer level may
+        // release it.
+        err = PetscObjectReference((PetscObject)dmCoarseMesh);PYLITH_CHECK_ERROR(err);
+
+        PetscDM dmCoarse = NULL;
+        err = DMClone(dmCoarseMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        // Fields restricted to a label (cohesive cells) must use the label in the coarse mesh.
+        PetscInt numFields = 0;
+        err = DMGetNumFields(dmFine, &numFields);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            PetscDMLabel fineLabel = NULL;
+            PetscDMLabel coarseLabel = NULL;
+            PetscObject disc = NULL;
+            err = DMGetField(dmFine, iField, &fineLabel, &disc);PYLITH_CHECK_ERROR(err);
+            if (fineLabel) {
+                const char* labelName = NULL;
+                err = PetscObjectGetName((PetscObject)fineLabel, &labelName);PYLITH_CHECK_ERROR(err);
+                err = DMGetLabel(dmCoarse, labelName, &coarseLabel);PYLITH_CHECK_ERROR(err);assert(coarseLabel);
+            } // if
+            err = DMSetField(dmCoarse, iField, coarseLabel, disc);PYLITH_CHECK_ERROR(err);
+
+            PetscBool useCone = PETSC_FALSE, useClosure = PETSC_FALSE;
+            err = DMGetAdjacency(dmFine, iField, &useCone, &useClosure);PYLITH_CHECK_ERROR(err);
+            err = DMSetAdjacency(dmCoarse, iField, useCone, useClosure);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = DMCreateDS(dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        // Essential boundary conditions determine the constrained DOF in the coarse sections.
+        PetscInt numDS = 0;
+        err = DMGetNumDS(dmFine, &numDS);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDS = 0; iDS < numDS; ++iDS) {
+            PetscDS dsFine = NULL;
+            PetscDS dsCoarse = NULL;
+            err = DMGetRegionNumDS(dmFine, iDS, NULL, NULL, &dsFine);PYLITH_CHECK_ERROR(err);
+            err = DMGetRegionNumDS(dmCoarse, iDS, NULL, NULL, &dsCoarse);PYLITH_CHECK_ERROR(err);
+            err = PetscDSCopyBoundary(dsFine, PETSC_DETERMINE, NULL, dsCoarse);PYLITH_CHECK_ERROR(err);
+            err = PetscDSUpdateBoundaryLabels(dsCoarse, dmCoarse);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        PetscDM dmNextCoarseMesh = NULL;
+        err = DMGetCoarseDM(dmCoarseMesh, &dmNextCoarseMesh);PYLITH_CHECK_ERROR(err);
+
+        err = DMSetCoarseDM(dmFine, dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmCoarse);PYLITH_CHECK_ERROR(err); // Finer level holds reference.
+        err = DMGetCoarseDM(dmFine, &dmFine);PYLITH_CHECK_ERROR(err);
+
+        // Next coarser mesh (if any) is replaced by its discretization in the next iteration.
+        err = DMSetCoarseDM(dmFine, dmNextCoarseMesh);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmCoarseMesh);PYLITH_CHECK_ERROR(err);
+        dmCoarseMesh = dmNextCoarseMesh;
+    } // while
+
+    PYLITH_METHOD_END;
+} // createCoarseDiscretization
+
+
+// ------------------------------------------------------------------------------------------------
+// Set block size of global vector for solution.
+PetscInt
+pylith::problems::_Problem::setBlockSize(pylith::topology::Field* solution) {
+    PYLITH_METHOD_BEGIN;
+    assert(solution);
+
+    PetscErrorCode err = 0;
+    PetscSection globalSection = solution->getGlobalSection();assert(globalSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscInt blockSize = -1;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0, offset = 0;
+        err = PetscSectionGetOffset(globalSection, point, &offset);PYLITH_CHECK_ERROR(err);
+        if (offset < 0) { continue; } // Not owned.
+        err = PetscSectionGetDof(globalSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintDof(globalSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        const PetscInt numFree = dof - cdof;
+        if (numFree <= 0) { continue; }
+        if (blockSize < 0) {
+            blockSize = numFree;
+        } else if (numFree != blockSize) {
+            blockSize = 1;
+            break;
+        } // if/else
+    } // for
+
+    // Block size must be the same on all processes (processes without degrees of freedom do not vote).
+    PetscInt localRange[2] = { PETSC_MIN_INT, PETSC_MIN_INT };
+    if (blockSize > 0) {
+        localRange[0] = -blockSize;
+        localRange[1] = blockSize;
+    } // if
+    PetscInt globalRange[2] = { 0, 0 };
+    err = MPI_Allreduce(localRange, globalRange, 2, MPIU_INT, MPI_MAX, solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    blockSize = ((globalRange[1] > 0) && (-globalRange[0] == globalRange[1])) ? globalRange[1] : 1;
+
+    err = VecSetBlockSize(solution->getGlobalVector(), blockSize);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(blockSize);
+} // setBlockSize
+
+
 // ------------------------------------------------------------------------------------------------
 // Set data needed to integrate domain faces on interior interface.
 void
@@ -41,6 +41,7 @@
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // HASA GravityField
 
 #include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
 #include "spatialdata/units/unitsfwd.hh" // HASA Nondimensional
 
 #include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
@@ -49,9 +50,12 @@
 
 #include "pylith/utils/array.hh" // HASA std::vector
 
+#include <string> // HASA std::string
+
 class pylith::problems::Problem : public pylith::utils::PyreComponent {
     friend class TestProblem; // unit testing
     friend class pylith::testing::MMSTest; // MMS testing
+    friend class pylith::testing::Benchmark; // performance benchmarks
 
     // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -97,6 +101,23 @@ public:
      */
     SolverTypeEnum getSolverType(void) const;
 
+    /** Set PETSc matrix type for Jacobian.
+     *
+     * Block matrix types (baij, sbaij) use the block size of the solution, which is the number of
+     * unconstrained degrees of freedom per point when it is the same at every point. The default
+     * type is sbaij in serial when the Jacobian is symmetric positive definite and PETSc solver
+     * defaults are used; otherwise it is aij.
+     *
+     * @param[in] value Name of PETSc matrix type (default, aij, baij, or sbaij).
+     */
+    void setMatrixType(const char* value);
+
+    /** Get PETSc matrix type for Jacobian.
+     *
+     * @returns Name of PETSc matrix type.
+     */
+    const char* getMatrixType(void) const;
+
     /** Specify which default PETSc options to use.
      *
      * @param[in] flags Flags indicating which default PETSc options to set.
@@ -186,6 +207,41 @@ public:
     virtual
     void initialize(void);
 
+    /** Finalize problem.
+     *
+     * If PETSc logging is active (for example, -log_view), write a summary of the number of calls,
+     * time, and flops for each physics implementation to the info journal.
+     */
+    void finalize(void);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Set approximate Schur complement preconditioner for the fault Lagrange multipliers.
+     *
+     * The preconditioner is only created if the solver uses a Schur complement PCFIELDSPLIT with a user
+     * supplied preconditioner for the Schur complement (-pc_fieldsplit_schur_precondition user) and the
+     * solution contains the displacement and fault Lagrange multiplier subfields.
+     *
+     * @param[in] snes PETSc nonlinear solver.
+     * @param[in] precondMat Assembled preconditioner for Jacobian.
+     */
+    void _setSchurPrecond(PetscSNES snes,
+                          PetscMat precondMat);
+
+    /** Create matrix for Jacobian from solution DM.
+     *
+     * @returns PETSc matrix for Jacobian (caller is responsible for destroying it).
+     */
+    PetscMat _createJacobianMatrix(void) const;
+
+    /** Create separate matrix for Jacobian preconditioner if any integrator has preconditioner kernels.
+     *
+     * @returns PETSc matrix for Jacobian preconditioner (caller is responsible for destroying it) or
+     * NULL if the Jacobian is used as the preconditioner.
+     */
+    PetscMat _createPrecondMatrix(void) const;
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -201,10 +257,14 @@ protected:
     std::vector<pylith::feassemble::Integrator*> _integrators; ///< Array of integrators.
     std::vector<pylith::feassemble::Constraint*> _constraints; ///< Array of constraints.
     pylith::problems::ObserversSoln* _observers; ///< Subscribers of solution updates.
+    pylith::utils::EventLogger* _logger; ///< Event logger.
 
     pylith::problems::Physics::FormulationEnum _formulation; ///< Formulation for equations.
     SolverTypeEnum _solverType; ///< Problem (solver) type.
     int _petscDefaults; ///< Flags for PETSc default options for problem.
+    std::string _matrixType; ///< PETSc matrix type for Jacobian.
+    bool _isJacobianSPD; ///< True if Jacobian is symmetric positive definite.
+    PetscMat _schurPrecondMat; ///< Approximate Schur complement for fault Lagrange multipliers.
 
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -212,6 +272,17 @@ private:
     /// Check material and interface label values.
     void _checkMaterialLabels(void) const;
 
+    /** Check whether Jacobian is symmetric positive definite.
+     *
+     * The Jacobian is symmetric positive definite for the quasistatic formulation without interior
+     * interfaces when every material has a symmetric Jacobian, only materials contribute to the
+     * Jacobian (Dirichlet boundary conditions are constraints), and at least one Dirichlet boundary
+     * condition removes rigid body motion.
+     *
+     * @returns True if Jacobian is symmetric positive definite, false otherwise.
+     */
+    bool _checkJacobianSPD(void) const;
+
     /// Create array of integrators from materials, interfaces, and boundary conditions.
     void _createIntegrators(void);
 
@@ -221,6 +292,9 @@ private:
     /// Setup solution subfields and discretization.
     void _setupSolution(void);
 
+    /// Write summary of performance of physics implementations to info journal.
+    void _writePerformanceSummary(void) const;
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -25,11 +25,15 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/faults/FaultOps.hh" // USES FaultOps
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/InitialCondition.hh" // USES InitialCondition
 #include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -38,6 +42,8 @@
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include <cassert> // USES assert()
+#include <cmath> // USES sqrt(), log2(), pow()
+#include <algorithm> // USES std::min(), std::max()
 #include <iostream> // USES std::cout in debugging
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -47,6 +53,29 @@ namespace pylith {
 public:
 
             static const char* pyreComponent;
+
+            /** Get average of values of auxiliary subfield over closure of cell.
+             *
+             * @param[in] visitor Visitor for auxiliary subfield.
+             * @param[in] cell Cell in mesh.
+             * @returns Average value.
+             */
+            static
+            PylithReal cellAverage(const pylith::topology::VecVisitorMesh& visitor,
+                                   const PetscInt cell);
+
+            /** Get minimum distance between vertices of cell.
+             *
+             * @param[in] visitor Visitor for coordinates.
+             * @param[in] cell Cell in mesh.
+             * @param[in] spaceDim Spatial dimension of coordinates.
+             * @returns Minimum distance between vertices.
+             */
+            static
+            PylithReal cellMinVertexDistance(const pylith::topology::CoordsVisitor& visitor,
+                                             const PetscInt cell,
+                                             const int spaceDim);
+
         }; // _TimeDependent
 
         const char* _TimeDependent::pyreComponent = "timedependent";
@@ -64,13 +93,27 @@ pylith::problems::TimeDependent::TimeDependent(void) :
     _monitor(NULL),
     _needNewLHSJacobian(true),
     _haveNewLHSJacobian(false),
-    _shouldNotifyIC(false) {
+    _shouldNotifyIC(false),
+    _useLocalTimeStepping(false),
+    _rateClassResidualVec(NULL) {
     PyreComponent::setName(_TimeDependent::pyreComponent);
 
+    _rateClassDOFIS[RATE_SLOW] = NULL;
+    _rateClassDOFIS[RATE_FAST] = NULL;
+
     _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_state, -1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_residual, -1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse, -1.0);
+
+    assert(_logger);
+    _stageSolve = _logger->registerStage("Solve");
+    _eventPoststep = _logger->registerEvent("Py-TiDe-poststep");
+    _eventRHSResidual = _logger->registerEvent("Py-TiDe-computeRHSResidual");
+    _eventLHSResidual = _logger->registerEvent("Py-TiDe-computeLHSResidual");
+    _eventLHSJacobian = _logger->registerEvent("Py-TiDe-computeLHSJacobian");
+    _eventLHSJacobianLumpedInv = _logger->registerEvent("Py-TiDe-computeLHSJacobianLumpedInv");
 } // constructor
 
 
@@ -93,6 +136,15 @@ pylith::problems::TimeDependent::deallocate(void) {
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
 
+    for (int iRate = 0; iRate < 2; ++iRate) {
+        err = ISDestroy(&_rateClassDOFIS[iRate]);PYLITH_CHECK_ERROR(err);
+        for (size_t i = 0; i < _rateClassCellsIS[iRate].size(); ++i) {
+            err = ISDestroy(&_rateClassCellsIS[iRate][i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        _rateClassCellsIS[iRate].clear();
+    } // for
+    err = VecDestroy(&_rateClassResidualVec);PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -220,6 +272,24 @@ pylith::problems::TimeDependent::setShouldNotifyIC(const bool value) {
 } // setShouldNotifyIC
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local (multirate) time stepping with explicit time stepping.
+void
+pylith::problems::TimeDependent::useLocalTimeStepping(const bool value) {
+    PYLITH_COMPONENT_DEBUG("useLocalTimeStepping(value="<<value<<")");
+
+    _useLocalTimeStepping = value;
+} // useLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Use local (multirate) time stepping with explicit time stepping?
+bool
+pylith::problems::TimeDependent::useLocalTimeStepping(void) const {
+    return _useLocalTimeStepping;
+} // useLocalTimeStepping
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -285,6 +355,12 @@ pylith::problems::TimeDependent::verifyConfiguration(void) const {
         _ic[i]->verifyConfiguration(*solution);
     } // for
 
+    if (_useLocalTimeStepping && (pylith::problems::Physics::DYNAMIC != _formulation)) {
+        std::ostringstream msg;
+        msg << "Local time stepping is only supported with the 'dynamic' formulation.";
+        throw std::runtime_error(msg.str());
+    } // if
+
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -365,16 +441,25 @@ pylith::problems::TimeDependent::initialize(void) {
     PYLITH_COMPONENT_DEBUG("Setting PetscTS callback for poststep().");
     err = TSSetPostStep(_ts, poststep);PYLITH_CHECK_ERROR(err);
 
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeIFunction() and computeIJacobian().");
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        jacobianMat = _createJacobianMatrix();
+        precondMat = _createPrecondMatrix();
+        err = TSSetIJacobian(_ts, jacobianMat, (precondMat) ? precondMat : jacobianMat, computeLHSJacobian,
+                             (void*)this);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&precondMat);PYLITH_CHECK_ERROR(err);
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeLHSJacobian() and computeLHSFunction().");
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        jacobianMat = _createJacobianMatrix();
+        err = TSSetIJacobian(_ts, jacobianMat, jacobianMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
         err = TSSetEquationType(_ts, TS_EQ_EXPLICIT);PYLITH_CHECK_ERROR(err);
         pylith::faults::FaultOps::createDAEMassWeighting(_integrationData);
     case pylith::problems::Physics::DYNAMIC: {
@@ -393,7 +478,11 @@ pylith::problems::TimeDependent::initialize(void) {
     } // default
     } // switch
 
-    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
+    if (_useLocalTimeStepping) {
+        _setupLocalTimeStepping(*solution);
+    } // if
+
+    pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults, _isJacobianSPD);
     err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
     err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
 
@@ -417,6 +506,9 @@ pylith::problems::TimeDependent::initialize(void) {
         PetscDSView(prob, PETSC_VIEWER_STDOUT_SELF);
     } // if
 
+    // Update auxiliary subfields that depend on the time step before writing the initial conditions.
+    _setTimeStep(_startTime / timeScale, _dtInitial / timeScale);
+
     if (_shouldNotifyIC) {
         _notifyObserversInitialSoln();
     } // if
@@ -436,7 +528,10 @@ pylith::problems::TimeDependent::solve(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("solve()");
 
+    assert(_logger);
+    _logger->stagePush(_stageSolve);
     PetscErrorCode err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
+    _logger->stagePop();
 
     PYLITH_METHOD_END;
 } // solve
@@ -448,6 +543,8 @@ void
 pylith::problems::TimeDependent::poststep(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("poststep()");
+    assert(_logger);
+    _logger->eventBegin(_eventPoststep);
 
     // Get current solution. After first time step, t==dt, and tindex==1.
     PetscErrorCode err;
@@ -487,6 +584,8 @@ pylith::problems::TimeDependent::poststep(void) {
         _monitor->update(t*timeScale, _startTime, _endTime);
     } // if
 
+    _logger->eventEnd(_eventPoststep);
+
     PYLITH_METHOD_END;
 } // poststep
 
@@ -530,53 +629,47 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscVec residualVec,
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("computeRHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
 
-    assert(residualVec);
-    assert(solutionVec);
-    assert(_integrationData);
+    assert(_logger);
+    _logger->eventBegin(_eventRHSResidual);
 
-    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, t);
+    const std::vector<PetscIS>* cellsIS = NULL;
+    _computeRHSResidual(residualVec, t, dt, solutionVec, cellsIS);
 
-    // Update PyLith view of the solution.
-    const PetscVec solutionDotVec = NULL;
-    setSolutionLocal(t, solutionVec, solutionDotVec);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+    _logger->eventEnd(_eventRHSResidual);
 
-    const bool hasLumpedJacobianInverse = _integrationData->hasField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
-    if (hasLumpedJacobianInverse) {
-        const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
-        computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
-    } // if
+    PYLITH_METHOD_END;
+} // computeRHSResidual
 
-    // Sum residual contributions across integrators.
-    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
-    residual->zeroLocal();
-    const size_t numIntegrators = _integrators.size();
-    assert(numIntegrators > 0); // must have at least 1 integrator
-    for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeRHSResidual(residual, *_integrationData);
-    } // for
 
-    // Assemble residual values across processes.
-    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
-    residual->scatterLocalToVector(residualVec, ADD_VALUES);
+// ----------------------------------------------------------------------
+// Compute RHS residual for G(t,s) for degrees of freedom in a rate class.
+void
+pylith::problems::TimeDependent::computeRHSResidualRateClass(PetscVec residualVec,
+                                                             const PylithReal t,
+                                                             const PylithReal dt,
+                                                             PetscVec solutionVec,
+                                                             const RateClassEnum rateClass) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeRHSResidualRateClass(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", rateClass="<<rateClass<<")");
 
-    if (hasLumpedJacobianInverse) {
-        // Multiply RHS, G(t,s), by M^{-1}
-        const pylith::topology::Field* jacobianLumpedInv =
-            _integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);assert(jacobianLumpedInv);
-        err = VecPointwiseMult(residualVec, jacobianLumpedInv->getGlobalVector(), residualVec);PYLITH_CHECK_ERROR(err);
-    } // if
+    assert(residualVec);
+    assert(_rateClassResidualVec);
+    assert(_rateClassDOFIS[rateClass]);
+    assert(_logger);
+    _logger->eventBegin(_eventRHSResidual);
+
+    // Integrate only over cells adjacent to degrees of freedom in rate class.
+    _computeRHSResidual(_rateClassResidualVec, t, dt, solutionVec, &_rateClassCellsIS[rateClass]);
+
+    PetscVec residualSubVec = NULL;
+    PetscErrorCode err = VecGetSubVector(_rateClassResidualVec, _rateClassDOFIS[rateClass], &residualSubVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(residualSubVec, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(_rateClassResidualVec, _rateClassDOFIS[rateClass], &residualSubVec);PYLITH_CHECK_ERROR(err);
+
+    _logger->eventEnd(_eventRHSResidual);
 
-    pythia::journal::debug_t debug("timedependent.view_residual");
-    if (debug.state()) {
-        residual->view("RHS RESIDUAL");
-        std::cout << "RHS RESIDUAL GLOBAL VEC" << std::endl;
-        VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
-    } // if
     PYLITH_METHOD_END;
-} // computeRHSResidual
+} // computeRHSResidualRateClass
 
 
 // ----------------------------------------------------------------------
@@ -594,6 +687,8 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
     assert(solutionVec);
     assert(solutionDotVec);
     assert(_integrationData);
+    assert(_logger);
+    _logger->eventBegin(_eventLHSResidual);
 
     if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
 
@@ -601,6 +696,7 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
     setSolutionLocal(t, solutionVec, solutionDotVec);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+    if (dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_state)) { _setTimeStep(t, dt); }
 
     // Sum residual across integrators.
     pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
@@ -624,6 +720,8 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
         VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
     } // if
 
+    _logger->eventEnd(_eventLHSResidual);
+
     PYLITH_METHOD_END;
 } // computeLHSResidual
 
@@ -653,6 +751,8 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
         PYLITH_METHOD_END;
     } // if
     PYLITH_COMPONENT_DEBUG("NEW LHS Jacobian; t=" << t << ", dt=" << dt);
+    assert(_logger);
+    _logger->eventBegin(_eventLHSJacobian);
 
     assert(_integrationData);
     const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
@@ -671,6 +771,7 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
 
     // Update PyLith view of the solution.
     setSolutionLocal(t, solutionVec, solutionDotVec);
+    if (dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_state)) { _setTimeStep(t, dt); }
 
     // Sum Jacobian contributions across integrators.
     const size_t numIntegrators = _integrators.size();
@@ -691,6 +792,12 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    PetscSNES snes = NULL;
+    err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+    _setSchurPrecond(snes, precondMat);
+
+    _logger->eventEnd(_eventLHSJacobian);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
@@ -721,6 +828,8 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
         } // if
     } // for
     if (!needNewLHSJacobianLumped) { PYLITH_METHOD_END; }
+    assert(_logger);
+    _logger->eventBegin(_eventLHSJacobianLumpedInv);
 
     // Set jacobian to zero.
     pylith::topology::Field* jacobianLumpedInv = _integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
@@ -732,6 +841,7 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
+    if (dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_state)) { _setTimeStep(t, dt); }
 
     // Sum Jacobian contributions across integrators.
     for (size_t i = 0; i < numIntegrators; ++i) {
@@ -745,6 +855,8 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
     } // if
 
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse, dt);
+    _logger->eventEnd(_eventLHSJacobianLumpedInv);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobianLumpedInv
 
@@ -773,6 +885,56 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscTS ts,
 } // computeRHSResidual
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), in slow rate class.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualSlow(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualSlow(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+
+    // Use time step of the problem rather than the time step of the rate class.
+    PylithReal dt;
+    PetscErrorCode err = TSGetTimeStep(problem->getPetscTS(), &dt);PYLITH_CHECK_ERROR(err);
+
+    problem->computeRHSResidualRateClass(residualVec, t, dt, solutionVec, RATE_SLOW);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualSlow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), in fast rate class.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualFast(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualFast(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+
+    // Use time step of the problem rather than the time step of the rate class.
+    PylithReal dt;
+    PetscErrorCode err = TSGetTimeStep(problem->getPetscTS(), &dt);PYLITH_CHECK_ERROR(err);
+
+    problem->computeRHSResidualRateClass(residualVec, t, dt, solutionVec, RATE_FAST);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualFast
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Callback static method for computing residual for LHS, F(t,s,\dot{s}).
 PetscErrorCode
@@ -889,6 +1051,28 @@ pylith::problems::TimeDependent::_setState(const PylithReal t) {
 } // _setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Update auxiliary field values of system that depend on the time step.
+void
+pylith::problems::TimeDependent::_setTimeStep(const PylithReal t,
+                                              const PylithReal dt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setTimeStep(t="<<t<<", dt="<<dt<<")");
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->setTimeStep(t, dt, *solution);
+    } // for
+
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_state, dt);
+
+    PYLITH_METHOD_END;
+} // _setTimeStep
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Notify observers with solution corresponding to initial conditions.
 void
@@ -921,4 +1105,352 @@ pylith::problems::TimeDependent::_notifyObserversInitialSoln(void) {
 } // _notifyObserversInitialSoln
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Sum RHS residual contributions across integrators and assemble into global vector.
+void
+pylith::problems::TimeDependent::_computeRHSResidual(PetscVec residualVec,
+                                                     const PylithReal t,
+                                                     const PylithReal dt,
+                                                     PetscVec solutionVec,
+                                                     const std::vector<PetscIS>* cellsIS) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeRHSResidual(t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", cellsIS="<<cellsIS<<")");
+
+    assert(residualVec);
+    assert(solutionVec);
+    assert(_integrationData);
+
+    if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, t);
+
+    // Update PyLith view of the solution.
+    const PetscVec solutionDotVec = NULL;
+    setSolutionLocal(t, solutionVec, solutionDotVec);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+    if (dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_state)) { _setTimeStep(t, dt); }
+
+    const bool hasLumpedJacobianInverse = _integrationData->hasField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
+    if (hasLumpedJacobianInverse) {
+        const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
+        computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
+    } // if
+
+    // Sum residual contributions across integrators.
+    pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
+    residual->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    assert(numIntegrators > 0); // must have at least 1 integrator
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::feassemble::IntegratorDomain* integratorDomain =
+            (cellsIS) ? dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]) : NULL;
+        if (integratorDomain) {
+            assert(cellsIS->size() == numIntegrators);
+            integratorDomain->computeRHSResidual(residual, *_integrationData, (*cellsIS)[i]);
+        } else {
+            _integrators[i]->computeRHSResidual(residual, *_integrationData);
+        } // if/else
+    } // for
+
+    // Assemble residual values across processes.
+    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    residual->scatterLocalToVector(residualVec, ADD_VALUES);
+
+    if (hasLumpedJacobianInverse) {
+        // Multiply RHS, G(t,s), by M^{-1}
+        const pylith::topology::Field* jacobianLumpedInv =
+            _integrationData->getField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);assert(jacobianLumpedInv);
+        err = VecPointwiseMult(residualVec, jacobianLumpedInv->getGlobalVector(), residualVec);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    pythia::journal::debug_t debug("timedependent.view_residual");
+    if (debug.state()) {
+        residual->view("RHS RESIDUAL");
+        std::cout << "RHS RESIDUAL GLOBAL VEC" << std::endl;
+        VecView(residualVec, PETSC_VIEWER_STDOUT_SELF);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _computeRHSResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Group cells into rate classes and set up splits for multirate time stepping.
+void
+pylith::problems::TimeDependent::_setupLocalTimeStepping(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupLocalTimeStepping(solution="<<solution.getLabel()<<")");
+
+    pylith::real_array dtStable;
+    _computeStableTimeStepCells(&dtStable, solution);
+
+    PetscErrorCode err = 0;
+    const MPI_Comm comm = solution.getMesh().getComm();
+    const size_t numCells = dtStable.size();
+    PylithReal dtStableMinLocal = PETSC_MAX_REAL;
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        dtStableMinLocal = std::min(dtStableMinLocal, dtStable[iCell]);
+    } // for
+    PylithReal dtStableMin = PETSC_MAX_REAL;
+    err = MPI_Allreduce(&dtStableMinLocal, &dtStableMin, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    if (dtStableMin >= PETSC_MAX_REAL) {
+        PYLITH_COMPONENT_LOGICERROR("Could not compute stable time step for any cells with local time stepping.");
+    } // if
+
+    // Group cells into power-of-two rate classes, k = floor(log2(dtStable/dtStableMin)). Cells in class 0
+    // limit the time step and are in the fast rate class; all other cells are in the slow rate class. Any
+    // degree of freedom in the closure of a fast cell is in the fast rate class.
+    const int maxRateClasses = 8;
+    pylith::int_array rateClassSizeLocal(0, maxRateClasses);
+    PetscDM dmSoln = solution.getDM();
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    assert(size_t(cEnd - cStart) == numCells);
+
+    PetscVec markerLocalVec = NULL;
+    err = DMGetLocalVector(dmSoln, &markerLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(markerLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        const PylithReal dtCell = dtStable[cell-cStart];
+        if (dtCell >= PETSC_MAX_REAL) { continue; }
+        const int rateClass = std::min(std::max(int(floor(log2(dtCell / dtStableMin))), 0), maxRateClasses-1);
+        ++rateClassSizeLocal[rateClass];
+        if (rateClass > 0) { continue; }
+
+        PetscScalar* markerCell = NULL;
+        PetscInt markerSize = 0;
+        err = DMPlexVecGetClosure(dmSoln, NULL, markerLocalVec, cell, &markerSize, &markerCell);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < markerSize; ++i) {
+            markerCell[i] = 1.0;
+        } // for
+        err = DMPlexVecSetClosure(dmSoln, NULL, markerLocalVec, cell, markerCell, INSERT_ALL_VALUES);PYLITH_CHECK_ERROR(err);
+        err = DMPlexVecRestoreClosure(dmSoln, NULL, markerLocalVec, cell, &markerSize, &markerCell);PYLITH_CHECK_ERROR(err);
+    } // for
+    pylith::int_array rateClassSize(0, maxRateClasses);
+    err = MPI_Allreduce(&rateClassSizeLocal[0], &rateClassSize[0], maxRateClasses, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    // Assemble markers so degrees of freedom shared across processes are classified consistently.
+    PetscVec markerVec = NULL;
+    err = DMGetGlobalVector(dmSoln, &markerVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(markerVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, markerLocalVec, ADD_VALUES, markerVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, markerLocalVec, ADD_VALUES, markerVec);PYLITH_CHECK_ERROR(err);
+
+    PetscInt indexStart = 0, indexEnd = 0;
+    err = VecGetOwnershipRange(markerVec, &indexStart, &indexEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> rateClassIndices[2];
+    const PetscScalar* markerArray = NULL;
+    err = VecGetArrayRead(markerVec, &markerArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < indexEnd-indexStart; ++i) {
+        const int rateClass = (markerArray[i] > 0.5) ? RATE_FAST : RATE_SLOW;
+        rateClassIndices[rateClass].push_back(indexStart+i);
+    } // for
+    err = VecRestoreArrayRead(markerVec, &markerArray);PYLITH_CHECK_ERROR(err);
+
+    for (int iRate = 0; iRate < 2; ++iRate) {
+        const PetscInt numIndices = rateClassIndices[iRate].size();
+        const PetscInt* indices = (numIndices > 0) ? &rateClassIndices[iRate][0] : NULL;
+        err = ISDestroy(&_rateClassDOFIS[iRate]);PYLITH_CHECK_ERROR(err);
+        err = ISCreateGeneral(comm, numIndices, indices, PETSC_COPY_VALUES, &_rateClassDOFIS[iRate]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Cells adjacent to degrees of freedom in each rate class. Constrained degrees of freedom are not
+    // in the global vector, so they retain the value -1.
+    err = VecSet(markerLocalVec, -1.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, markerVec, INSERT_VALUES, markerLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, markerVec, INSERT_VALUES, markerLocalVec);PYLITH_CHECK_ERROR(err);
+
+    const size_t numIntegrators = _integrators.size();
+    for (int iRate = 0; iRate < 2; ++iRate) {
+        for (size_t i = 0; i < _rateClassCellsIS[iRate].size(); ++i) {
+            err = ISDestroy(&_rateClassCellsIS[iRate][i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        _rateClassCellsIS[iRate].resize(numIntegrators);
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            _rateClassCellsIS[iRate][i] = NULL;
+        } // for
+    } // for
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]);
+        if (!integrator) { continue; }
+
+        PetscIS cellsIS = integrator->getCellsIS();
+        PetscInt numIntegratorCells = 0;
+        const PetscInt* cells = NULL;
+        if (cellsIS) {
+            err = ISGetLocalSize(cellsIS, &numIntegratorCells);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+        } // if
+        std::vector<PetscInt> rateClassCells[2];
+        for (PetscInt iCell = 0; iCell < numIntegratorCells; ++iCell) {
+            const PetscInt cell = cells[iCell];
+            PetscScalar* markerCell = NULL;
+            PetscInt markerSize = 0;
+            bool hasFast = false, hasSlow = false;
+            err = DMPlexVecGetClosure(dmSoln, NULL, markerLocalVec, cell, &markerSize, &markerCell);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDOF = 0; iDOF < markerSize; ++iDOF) {
+                if (markerCell[iDOF] > 0.5) {
+                    hasFast = true;
+                } else if (markerCell[iDOF] > -0.5) {
+                    hasSlow = true;
+                } // if/else
+            } // for
+            err = DMPlexVecRestoreClosure(dmSoln, NULL, markerLocalVec, cell, &markerSize, &markerCell);PYLITH_CHECK_ERROR(err);
+            if (hasSlow) { rateClassCells[RATE_SLOW].push_back(cell); }
+            if (hasFast) { rateClassCells[RATE_FAST].push_back(cell); }
+        } // for
+        if (cellsIS) {
+            err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        for (int iRate = 0; iRate < 2; ++iRate) {
+            const PetscInt numRateCells = rateClassCells[iRate].size();
+            const PetscInt* rateCells = (numRateCells > 0) ? &rateClassCells[iRate][0] : NULL;
+            err = ISCreateGeneral(PETSC_COMM_SELF, numRateCells, rateCells, PETSC_COPY_VALUES,
+                                  &_rateClassCellsIS[iRate][i]);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+
+    err = DMRestoreGlobalVector(dmSoln, &markerVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &markerLocalVec);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&_rateClassResidualVec);PYLITH_CHECK_ERROR(err);
+    err = DMCreateGlobalVector(dmSoln, &_rateClassResidualVec);PYLITH_CHECK_ERROR(err);
+
+    // Multirate partitioned Runge-Kutta advances the fast rate class with two substeps per time step.
+    assert(_ts);
+    err = TSSetType(_ts, TSMPRK);PYLITH_CHECK_ERROR(err);
+    err = TSMPRKSetType(_ts, TSMPRK2A22);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "slow", _rateClassDOFIS[RATE_SLOW]);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "fast", _rateClassDOFIS[RATE_FAST]);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "slow", NULL, computeRHSResidualSlow, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "fast", NULL, computeRHSResidualFast, (void*)this);PYLITH_CHECK_ERROR(err);
+
+    assert(_normalizer);
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    std::ostringstream msg;
+    msg << "Local time stepping with stable time step of " << dtStableMin*timeScale << " s for smallest cells.";
+    for (int iRate = 0; iRate < maxRateClasses; ++iRate) {
+        if (rateClassSize[iRate] > 0) {
+            msg << "\n    Rate class " << iRate << " (dt >= " << dtStableMin*pow(2.0, iRate)*timeScale << " s): "
+                << rateClassSize[iRate] << " cells";
+        } // if
+    } // for
+    PYLITH_COMPONENT_INFO_ROOT(msg.str());
+    if (_dtInitial / timeScale > 2.0*dtStableMin) {
+        PYLITH_COMPONENT_WARNING("Time step (" << _dtInitial << " s) exceeds twice the stable time step of the fast rate class ("
+                                               << 2.0*dtStableMin*timeScale << " s).");
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute stable time step for each cell from the auxiliary field of the materials.
+void
+pylith::problems::TimeDependent::_computeStableTimeStepCells(pylith::real_array* dtStable,
+                                                             const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeStableTimeStepCells(dtStable="<<dtStable<<", solution="<<solution.getLabel()<<")");
+
+    assert(dtStable);
+
+    PetscDM dmSoln = solution.getDM();
+    PetscInt cStart = 0, cEnd = 0;
+    PetscErrorCode err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmSoln, &spaceDim);PYLITH_CHECK_ERROR(err);
+    dtStable->resize(cEnd - cStart);
+    *dtStable = PETSC_MAX_REAL;
+
+    pylith::topology::CoordsVisitor coordsVisitor(dmSoln);
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_integrators[i]);
+        if (!integrator) { continue; }
+
+        // The stable time step is the minimum distance between vertices divided by the dilatational
+        // wave speed, vp = sqrt((K + 4/3 mu) / density).
+        const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+        if (!auxiliaryField->hasSubfield("density") || !auxiliaryField->hasSubfield("shear_modulus") ||
+            !auxiliaryField->hasSubfield("bulk_modulus")) {
+            std::ostringstream msg;
+            msg << "Local time stepping requires auxiliary subfields 'density', 'shear_modulus', and 'bulk_modulus' "
+                << "for all materials.";
+            throw std::runtime_error(msg.str());
+        } // if
+        pylith::topology::VecVisitorMesh densityVisitor(*auxiliaryField, "density");
+        pylith::topology::VecVisitorMesh shearModulusVisitor(*auxiliaryField, "shear_modulus");
+        pylith::topology::VecVisitorMesh bulkModulusVisitor(*auxiliaryField, "bulk_modulus");
+
+        PetscIS cellsIS = integrator->getCellsIS();
+        if (!cellsIS) { continue; }
+        PetscInt numCells = 0;
+        const PetscInt* cells = NULL;
+        err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+            const PetscInt cell = cells[iCell];
+            const PylithReal density = _TimeDependent::cellAverage(densityVisitor, cell);
+            const PylithReal shearModulus = _TimeDependent::cellAverage(shearModulusVisitor, cell);
+            const PylithReal bulkModulus = _TimeDependent::cellAverage(bulkModulusVisitor, cell);
+            assert(density > 0.0);
+            const PylithReal vp = sqrt((bulkModulus + 4.0/3.0*shearModulus) / density);
+            const PylithReal h = _TimeDependent::cellMinVertexDistance(coordsVisitor, cell, spaceDim);
+            (*dtStable)[cell-cStart] = h / vp;
+        } // for
+        err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _computeStableTimeStepCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get average of values of auxiliary subfield over closure of cell.
+PylithReal
+pylith::problems::_TimeDependent::cellAverage(const pylith::topology::VecVisitorMesh& visitor,
+                                              const PetscInt cell) {
+    PetscScalar* valuesCell = NULL;
+    PetscInt valuesSize = 0;
+    visitor.getClosure(&valuesCell, &valuesSize, cell);
+    PylithReal value = 0.0;
+    for (PetscInt i = 0; i < valuesSize; ++i) {
+        value += valuesCell[i];
+    } // for
+    value /= valuesSize;
+    visitor.restoreClosure(&valuesCell, &valuesSize, cell);
+
+    return value;
+} // cellAverage
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get minimum distance between vertices of cell.
+PylithReal
+pylith::problems::_TimeDependent::cellMinVertexDistance(const pylith::topology::CoordsVisitor& visitor,
+                                                        const PetscInt cell,
+                                                        const int spaceDim) {
+    PetscScalar* coordsCell = NULL;
+    PetscInt coordsSize = 0;
+    visitor.getClosure(&coordsCell, &coordsSize, cell);
+    const PetscInt numVertices = coordsSize / spaceDim;
+    PylithReal distanceMin = PETSC_MAX_REAL;
+    for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+        for (PetscInt jVertex = iVertex+1; jVertex < numVertices; ++jVertex) {
+            PylithReal distance2 = 0.0;
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                const PylithReal delta = coordsCell[jVertex*spaceDim+iDim] - coordsCell[iVertex*spaceDim+iDim];
+                distance2 += delta*delta;
+            } // for
+            distanceMin = std::min(distanceMin, sqrt(distance2));
+        } // for
+    } // for
+    visitor.restoreClosure(&coordsCell, &coordsSize, cell);
+
+    return distanceMin;
+} // cellMinVertexDistance
+
+
 // End of file
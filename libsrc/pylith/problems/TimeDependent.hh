@@ -32,6 +32,15 @@ class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
 
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Rate classes for local time stepping.
+    enum RateClassEnum {
+        RATE_SLOW=0, ///< Degrees of freedom advanced with the time step.
+        RATE_FAST=1, ///< Degrees of freedom advanced with substeps of the time step.
+    };
+
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -108,6 +117,21 @@ public:
      */
     void setShouldNotifyIC(const bool value);
 
+    /** Use local (multirate) time stepping with explicit time stepping.
+     *
+     * Cells are grouped into rate classes based on their stable time step. Degrees of freedom in
+     * cells with the smallest stable time steps are advanced with substeps of the time step.
+     *
+     * @param[in] value True if using local time stepping, false otherwise.
+     */
+    void useLocalTimeStepping(const bool value);
+
+    /** Use local (multirate) time stepping with explicit time stepping?
+     *
+     * @returns True if using local time stepping, false otherwise.
+     */
+    bool useLocalTimeStepping(void) const;
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -170,6 +194,20 @@ public:
                             const PetscReal dt,
                             PetscVec solutionVec);
 
+    /** Compute RHS residual, G(t,s), for degrees of freedom in a rate class with local time stepping.
+     *
+     * @param[out] residualVec PETSc Vec for residual of degrees of freedom in rate class.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] rateClass Rate class for degrees of freedom.
+     */
+    void computeRHSResidualRateClass(PetscVec residualVec,
+                                     const PetscReal t,
+                                     const PetscReal dt,
+                                     PetscVec solutionVec,
+                                     const RateClassEnum rateClass);
+
     /** Compute LHS residual, F(t,s,\dot{s}) and assemble into global vector.
      *
      * @param[out] residualVec PETSc Vec for residual.
@@ -229,6 +267,36 @@ public:
                                       PetscVec residualVec,
                                       void* context);
 
+    /** Callback static method for computing residual for RHS, G(t,s), in slow rate class.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of degrees of freedom in slow rate class.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualSlow(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
+    /** Callback static method for computing residual for RHS, G(t,s), in fast rate class.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of degrees of freedom in fast rate class.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualFast(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
     /** Callback static method for computing residual for LHS, F(t,s,\dot{s}).
      *
      * @param[in] ts PETSc time stepper.
@@ -286,9 +354,45 @@ private:
      */
     void _setState(const PylithReal t);
 
+    /** Update auxiliary field values of system that depend on the time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     */
+    void _setTimeStep(const PylithReal t,
+                      const PylithReal dt);
+
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /** Sum RHS residual contributions across integrators and assemble into global vector.
+     *
+     * @param[out] residualVec PETSc Vec for residual.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     * @param[in] cellsIS Cells for each integrator over which to integrate (NULL for all cells).
+     */
+    void _computeRHSResidual(PetscVec residualVec,
+                             const PetscReal t,
+                             const PetscReal dt,
+                             PetscVec solutionVec,
+                             const std::vector<PetscIS>* cellsIS);
+
+    /** Group cells into rate classes and set up splits for multirate time stepping.
+     *
+     * @param[in] solution Solution field.
+     */
+    void _setupLocalTimeStepping(const pylith::topology::Field& solution);
+
+    /** Compute stable time step for each cell from the auxiliary field of the materials.
+     *
+     * @param[out] dtStable Stable time step for each cell (PETSC_MAX_REAL for cells without materials).
+     * @param[in] solution Solution field.
+     */
+    void _computeStableTimeStepCells(pylith::real_array* dtStable,
+                                     const pylith::topology::Field& solution);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -303,6 +407,18 @@ private:
     bool _needNewLHSJacobian; ///< True if need to recompute LHS Jacobian.
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
     bool _shouldNotifyIC;
+    bool _useLocalTimeStepping; ///< Use local (multirate) time stepping.
+
+    PetscIS _rateClassDOFIS[2]; ///< Global degrees of freedom in each rate class.
+    std::vector<PetscIS> _rateClassCellsIS[2]; ///< Cells of each integrator adjacent to degrees of freedom in each rate class.
+    PetscVec _rateClassResidualVec; ///< Global vector for RHS residual with local time stepping.
+
+    int _stageSolve; ///< Logging stage for solve.
+    int _eventPoststep; ///< Logging event for poststep.
+    int _eventRHSResidual; ///< Logging event for computing RHS residual.
+    int _eventLHSResidual; ///< Logging event for computing LHS residual.
+    int _eventLHSJacobian; ///< Logging event for computing LHS Jacobian.
+    int _eventLHSJacobianLumpedInv; ///< Logging event for computing inverse of lumped LHS Jacobian.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -24,11 +24,14 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
 #include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
 #include "pylith/meshio/DataWriter.hh" // USES DataWriter
 #include "pylith/utils/journals.hh" // pythia::journal
 
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::min
 #include <cstring> // USES strlen()
 #include <strings.h> // USES strcasecmp()
 #include <stdexcept> // USES std::runtime_error
@@ -59,6 +62,37 @@ public:
                                              pylith::faults::FaultCohesive* faults[],
                                              const int numFaults);
 
+            /** Count fault vertices that are not in the closure of any local fault face.
+             *
+             * A fault face is a face with all of its vertices on the fault.
+             *
+             * @param[in] dmMesh PETSc DM for the current mesh.
+             * @param[in] faults Array of fault interfaces.
+             * @param[in] numFaults Number of fault interfaces.
+             *
+             * @returns Number of fault vertices without a local fault face containing them.
+             */
+            static
+            PetscInt countUncoveredFaultVertices(PetscDM dmMesh,
+                                                 pylith::faults::FaultCohesive* faults[],
+                                                 const int numFaults);
+
+            /** Set partition of cells using a space-filling curve through the cell centroids.
+             *
+             * The cells along the curve are split into contiguous pieces with equal numbers of
+             * cells (exactly if all cells are on one process, otherwise approximately using a
+             * global histogram of the keys). We assume all local cells are owned by the process,
+             * which holds for a mesh on a single process and for a mesh read in parallel.
+             *
+             * @param[inout] partitioner PETSc partitioner.
+             * @param[in] dmMesh PETSc DM for the current mesh.
+             * @param[in] curve Type of space-filling curve.
+             */
+            static
+            void setPartitionSFC(PetscPartitioner partitioner,
+                                 const PetscDM dmMesh,
+                                 const pylith::topology::SpaceFillingCurve::CurveEnum curve);
+
         }; // _Distributor
     } // topology
 } // pylith
@@ -97,7 +131,13 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     PetscPartitioner partitioner = 0;
     PetscDM dmOrig = origMesh.getDM();assert(dmOrig);
     err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
-    err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    if (0 == strcasecmp(partitionerName, "hilbert")) {
+        _Distributor::setPartitionSFC(partitioner, dmOrig, SpaceFillingCurve::HILBERT);
+    } else if (0 == strcasecmp(partitionerName, "morton")) {
+        _Distributor::setPartitionSFC(partitioner, dmOrig, SpaceFillingCurve::MORTON);
+    } else {
+        err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     if (0 == commRank) {
         info << pythia::journal::at(__HERE__)
@@ -118,6 +158,86 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
 } // distribute
 
 
+// ------------------------------------------------------------------------------------------------
+// Add overlap to a distributed mesh so that the fault faces are local before inserting cohesive cells.
+void
+pylith::topology::Distributor::distributeFaultOverlap(pylith::topology::Mesh* const mesh,
+                                                      pylith::faults::FaultCohesive* faults[],
+                                                      const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    if (0 == mesh->getCommRank()) {
+        pythia::journal::info_t info("mesh_distributor");
+        info << pythia::journal::at(__HERE__)
+             << "Adding fault faces to overlap of distributed mesh." << pythia::journal::endl;
+    } // if
+
+    // Each round sends the cells around the shared fault vertices to the processes sharing them.
+    // A leaf only sends to its root, so fault faces on one leaf reach another leaf in the second
+    // round. Cells added to the overlap may bring new fault vertices, so we allow a few more rounds.
+    const int maxRounds = 4;
+    PetscErrorCode err = 0;
+    MPI_Comm comm = mesh->getComm();
+    PetscDM dmMesh = mesh->getDM();
+    err = PetscObjectReference((PetscObject)dmMesh);PYLITH_CHECK_ERROR(err);
+    PetscInt numUncovered = 0;
+    for (int iRound = 0; iRound <= maxRounds; ++iRound) {
+        const PetscInt numUncoveredLocal = _Distributor::countUncoveredFaultVertices(dmMesh, faults, numFaults);
+        err = MPI_Allreduce(&numUncoveredLocal, &numUncovered, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+        if (!numUncovered || (iRound == maxRounds)) {
+            break;
+        } // if
+
+        PetscDM dmOverlap = NULL;
+        err = _Distributor::distributeOverlap(&dmOverlap, dmMesh, faults, numFaults);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+        dmMesh = dmOverlap;
+    } // for
+    if (numUncovered > 0) {
+        err = DMDestroy(&dmMesh);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Could not add fault faces to the overlap of the distributed mesh for " << numUncovered
+            << " fault vertices after " << maxRounds << " rounds. Check that every vertex on each fault "
+            << "belongs to a face with all of its vertices on the fault.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    err = DMPlexDistributeSetDefault(dmMesh, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMViewFromOptions(dmMesh, NULL, "-pylith_dist_dm_view");PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_END;
+} // distributeFaultOverlap
+
+
+// ------------------------------------------------------------------------------------------------
+// Add overlap to a distributed mesh after inserting cohesive cells.
+void
+pylith::topology::Distributor::distributeOverlap(pylith::topology::Mesh* const mesh,
+                                                 pylith::faults::FaultCohesive* faults[],
+                                                 const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    if (0 == mesh->getCommRank()) {
+        pythia::journal::info_t info("mesh_distributor");
+        info << pythia::journal::at(__HERE__)
+             << "Adding overlap for faults to distributed mesh." << pythia::journal::endl;
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscDM dmNew = NULL;
+    err = _Distributor::distributeOverlap(&dmNew, mesh->getDM(), faults, numFaults);PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistributeSetDefault(dmNew, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
+    err = DMViewFromOptions(dmNew, NULL, "-pylith_dist_dm_view");PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmNew);
+
+    PYLITH_METHOD_END;
+} // distributeOverlap
+
+
 // ------------------------------------------------------------------------------------------------
 // Write partitioning info for distributed mesh.
 void
@@ -192,6 +312,171 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
 } // write
 
 
+// ------------------------------------------------------------------------------------------------
+// Set partition of cells using a space-filling curve through the cell centroids.
+void
+pylith::topology::_Distributor::setPartitionSFC(PetscPartitioner partitioner,
+                                                const PetscDM dmMesh,
+                                                const pylith::topology::SpaceFillingCurve::CurveEnum curve) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PetscObjectComm((PetscObject) dmMesh);
+    PetscMPIInt numPartitions = 0;
+    err = MPI_Comm_size(comm, &numPartitions);PYLITH_CHECK_ERROR(err);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmMesh, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+    // Cohesive cells are not included in the partitioner graph, so we skip them.
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetSimplexOrBoxCells(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt numCells = cEnd - cStart;
+
+    std::vector<unsigned long long> keys;
+    std::vector<PetscInt> order;
+    const bool useGlobalBoundingBox = true;
+    SpaceFillingCurve::computeCellKeys(&keys, dmMesh, cStart, cEnd, curve, useGlobalBoundingBox);
+    SpaceFillingCurve::sortKeys(&order, keys);
+
+    PetscInt numCellsGlobal = 0, numCellsMax = 0;
+    err = MPI_Allreduce(&numCells, &numCellsGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&numCells, &numCellsMax, 1, MPIU_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> cellPartition(numCells, 0);
+    if (numCellsMax == numCellsGlobal) {
+        // All cells are on one process, so split the sorted cells into equal pieces.
+        for (PetscInt i = 0; i < numCells; ++i) {
+            cellPartition[order[i]] = PetscInt((long long)(i) * numPartitions / numCellsGlobal);
+        } // for
+    } else {
+        // Assign contiguous ranges of the curve (buckets) to partitions using a global histogram.
+        int bucketBits = 16;
+        while (((1 << bucketBits) < 64*numPartitions) && (bucketBits < 22)) {
+            ++bucketBits;
+        } // while
+        const int numBuckets = 1 << bucketBits;
+        const int bucketShift = spaceDim * SpaceFillingCurve::getNumBits(spaceDim) - bucketBits;assert(bucketShift >= 0);
+
+        std::vector<PetscInt> countsLocal(numBuckets, 0);
+        std::vector<PetscInt> counts(numBuckets, 0);
+        for (PetscInt i = 0; i < numCells; ++i) {
+            ++countsLocal[keys[i] >> bucketShift];
+        } // for
+        err = MPI_Allreduce(&countsLocal[0], &counts[0], numBuckets, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+        std::vector<PetscInt> bucketPartition(numBuckets, 0);
+        long long offset = 0;
+        for (int iBucket = 0; iBucket < numBuckets; ++iBucket) {
+            const long long partition = (offset + counts[iBucket] / 2) * numPartitions / numCellsGlobal;
+            bucketPartition[iBucket] = PetscInt(std::min(partition, (long long)(numPartitions-1)));
+            offset += counts[iBucket];
+        } // for
+        for (PetscInt i = 0; i < numCells; ++i) {
+            cellPartition[i] = bucketPartition[keys[i] >> bucketShift];
+        } // for
+    } // if/else
+
+    // Group cells by partition, retaining the order along the curve within each partition.
+    std::vector<PetscInt> sizes(numPartitions, 0);
+    std::vector<PetscInt> offsets(numPartitions, 0);
+    std::vector<PetscInt> points(numCells);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        ++sizes[cellPartition[i]];
+    } // for
+    for (PetscMPIInt iPartition = 1; iPartition < numPartitions; ++iPartition) {
+        offsets[iPartition] = offsets[iPartition-1] + sizes[iPartition-1];
+    } // for
+    for (PetscInt i = 0; i < numCells; ++i) {
+        const PetscInt cell = order[i];
+        points[offsets[cellPartition[cell]]++] = cell;
+    } // for
+
+    err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerShellSetPartition(partitioner, numPartitions, &sizes[0], numCells > 0 ? &points[0] : NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setPartitionSFC
+
+
+// ------------------------------------------------------------------------------------------------
+// Count fault vertices that are not in the closure of any local fault face.
+PetscInt
+pylith::topology::_Distributor::countUncoveredFaultVertices(PetscDM dmMesh,
+                                                            pylith::faults::FaultCohesive* faults[],
+                                                            const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+    assert(dmMesh);
+
+    PetscErrorCode err = 0;
+    PetscInt vStart = 0, vEnd = 0, fStart = 0, fEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmMesh, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numUncovered = 0;
+    for (int iFault = 0; iFault < numFaults; ++iFault) {
+        assert(faults[iFault]);
+        PetscDMLabel label = NULL;
+        err = DMGetLabel(dmMesh, faults[iFault]->getSurfaceLabelName(), &label);PYLITH_CHECK_ERROR(err);
+        if (!label) {
+            continue;
+        } // if
+        const PetscInt labelValue = faults[iFault]->getSurfaceLabelValue();
+
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(label, labelValue, &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (!pointsIS) {
+            continue;
+        } // if
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const PetscInt vertex = points[iPoint];
+            if ((vertex < vStart) || (vertex >= vEnd)) {
+                continue;
+            } // if
+
+            bool isCovered = false;
+            PetscInt* star = NULL;
+            PetscInt starSize = 0;
+            err = DMPlexGetTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iStar = 0; iStar < starSize && !isCovered; ++iStar) {
+                const PetscInt face = star[2*iStar];
+                if ((face < fStart) || (face >= fEnd)) {
+                    continue;
+                } // if
+                PetscInt* closure = NULL;
+                PetscInt closureSize = 0;
+                isCovered = true;
+                err = DMPlexGetTransitiveClosure(dmMesh, face, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+                for (PetscInt iClosure = 0; iClosure < closureSize; ++iClosure) {
+                    const PetscInt closurePoint = closure[2*iClosure];
+                    if ((closurePoint < vStart) || (closurePoint >= vEnd)) {
+                        continue;
+                    } // if
+                    PetscInt value = 0;
+                    err = DMLabelGetValue(label, closurePoint, &value);PYLITH_CHECK_ERROR(err);
+                    if (value != labelValue) {
+                        isCovered = false;
+                        break;
+                    } // if
+                } // for
+                err = DMPlexRestoreTransitiveClosure(dmMesh, face, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+            if (!isCovered) {
+                ++numUncovered;
+            } // if
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_RETURN(numUncovered);
+} // countUncoveredFaultVertices
+
+
 // ------------------------------------------------------------------------------------------------
 // This is a copy of DMPlexDistributeOverlap()
 PetscErrorCode
@@ -222,14 +507,20 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
     PetscDMLabel* ovExcludeLabels = (numFaults > 0) ? new PetscDMLabel[numFaults] : NULL;
     PetscInt* ovExcludeLabelValues = (numFaults > 0) ? new PetscInt[numFaults] : NULL;
 
+    // The cohesive labels do not exist before the cohesive cells are inserted.
+    PetscInt numIncludeLabels = 0, numExcludeLabels = 0;
     for (int i = 0; i < numFaults; ++i) {
         const char* surfaceLabelName = faults[i]->getSurfaceLabelName();
-        err = DMGetLabel(dmMesh, surfaceLabelName, &ovIncludeLabels[i]);PYLITH_CHECK_ERROR(err);
-        ovIncludeLabelValues[i] = faults[i]->getSurfaceLabelValue();
+        err = DMGetLabel(dmMesh, surfaceLabelName, &ovIncludeLabels[numIncludeLabels]);PYLITH_CHECK_ERROR(err);
+        if (ovIncludeLabels[numIncludeLabels]) {
+            ovIncludeLabelValues[numIncludeLabels++] = faults[i]->getSurfaceLabelValue();
+        } // if
 
         const char* cohesiveLabelName = faults[i]->getCohesiveLabelName();
-        err = DMGetLabel(dmMesh, cohesiveLabelName, &ovExcludeLabels[i]);PYLITH_CHECK_ERROR(err);
-        ovExcludeLabelValues[i] = faults[i]->getCohesiveLabelValue();
+        err = DMGetLabel(dmMesh, cohesiveLabelName, &ovExcludeLabels[numExcludeLabels]);PYLITH_CHECK_ERROR(err);
+        if (ovExcludeLabels[numExcludeLabels]) {
+            ovExcludeLabelValues[numExcludeLabels++] = faults[i]->getCohesiveLabelValue();
+        } // if
     } // for
 
     PetscCall(PetscObjectGetComm((PetscObject)dmMesh,&comm));
@@ -239,8 +530,8 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
     PetscCall(PetscSectionCreate(comm, &rootSection));
     PetscCall(PetscSectionCreate(comm, &leafSection));
     PetscCall(DMPlexDistributeOwnership(dmMesh, rootSection, &rootrank, leafSection, &leafrank));
-    PetscCall(DMPlexCreateOverlapLabelFromLabels(dmMesh, numFaults, ovIncludeLabels, ovIncludeLabelValues,
-                                                 numFaults, ovExcludeLabels, ovExcludeLabelValues, rootSection, rootrank, leafSection, leafrank, &lblOverlap));
+    PetscCall(DMPlexCreateOverlapLabelFromLabels(dmMesh, numIncludeLabels, ovIncludeLabels, ovIncludeLabelValues,
+                                                 numExcludeLabels, ovExcludeLabels, ovExcludeLabelValues, rootSection, rootrank, leafSection, leafrank, &lblOverlap));
 
     delete[] ovIncludeLabels;ovIncludeLabels = NULL;
     delete[] ovIncludeLabelValues;ovIncludeLabelValues = NULL;
@@ -51,7 +51,8 @@ public:
      * @param[in] origMesh Mesh to distribute.
      * @param[in] faults Array of fault interfaces.
      * @param[in] numFaults Number of fault interfaces.
-     * @param[in] partitionerName Name of PETSc partitioner to use in distributing mesh.
+     * @param[in] partitionerName Name of PETSc partitioner to use in distributing mesh or name of
+     *   space-filling curve ('hilbert' or 'morton') to use in partitioning the cells.
      */
     static
     void distribute(pylith::topology::Mesh* const newMesh,
@@ -60,6 +61,37 @@ public:
                     const int numFaults,
                     const char* partitionerName);
 
+    /** Add overlap to a distributed mesh so that the fault faces are local before inserting cohesive cells.
+     *
+     * Used when the cohesive cells are inserted into the distributed mesh (distributed without the
+     * faults). A process with a fault vertex but none of the fault faces containing it cannot tell
+     * which cells are on which side of the fault, so we add the cells around shared fault vertices
+     * to the overlap until every process with a fault vertex also has a fault face containing it.
+     *
+     * @param[inout] mesh Distributed mesh without cohesive cells.
+     * @param[in] faults Array of fault interfaces.
+     * @param[in] numFaults Number of fault interfaces.
+     */
+    static
+    void distributeFaultOverlap(pylith::topology::Mesh* const mesh,
+                                pylith::faults::FaultCohesive* faults[],
+                                const int numFaults);
+
+    /** Add overlap to a distributed mesh after inserting cohesive cells.
+     *
+     * Used when the cohesive cells are inserted into the distributed mesh (distributed without the
+     * faults). The overlap includes cells adjacent to the faults so that the cells on both sides of
+     * each cohesive cell are local to the process with the cohesive cell.
+     *
+     * @param[inout] mesh Distributed mesh with cohesive cells.
+     * @param[in] faults Array of fault interfaces.
+     * @param[in] numFaults Number of fault interfaces.
+     */
+    static
+    void distributeOverlap(pylith::topology::Mesh* const mesh,
+                           pylith::faults::FaultCohesive* faults[],
+                           const int numFaults);
+
     /** Write partitioning info for distributed mesh.
      *
      * @param writer Data writer for partition information.
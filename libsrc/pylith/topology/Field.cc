@@ -519,6 +519,20 @@ pylith::topology::Field::subfieldAdd(const Description& description,
 } // subfieldAdd
 
 
+// ------------------------------------------------------------------------------------------------
+// Update discretization of subfield.
+void
+pylith::topology::Field::subfieldUpdateDiscretization(const char* name,
+                                                      const Discretization& discretization) {
+    PYLITH_METHOD_BEGIN;
+
+    getSubfieldInfo(name); // Verify subfield exists.
+    _subfields[name].fe = discretization;
+
+    PYLITH_METHOD_END;
+} // subfieldUpdateDiscretization
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::topology::Field::subfieldsSetup(void) {
@@ -228,6 +228,16 @@ public:
     void subfieldAdd(const Description& description,
                      const Discretization& discretization);
 
+    /** Update discretization of subfield.
+     *
+     * Should be preceded by a call to subfieldAdd() for the subfield and followed by a call to subfieldsSetup().
+     *
+     * @param[in] name Name of subfield.
+     * @param[in] discretization Discretization information for subfield.
+     */
+    void subfieldUpdateDiscretization(const char* name,
+                                      const Discretization& discretization);
+
     /** Setup sections for subfields.
      *
      * Should be preceded by calls to subfieldAdd() and followed by calls to allocate().
@@ -31,6 +31,31 @@
 
 #include "petscdm.h" // USES PetscDM
 
+#include <cmath> // USES fabs()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _FieldOps {
+public:
+
+            /** Check whether quadrature points of subfield match those of target subfields with the same dimension.
+             *
+             * @param[in] target Field with target subfields.
+             * @param[in] auxiliary Field with subfield.
+             * @param[in] subfieldIndex Index of subfield in auxiliary field.
+             * @returns True if quadrature points match, false otherwise.
+             */
+            static
+            bool hasSameQuadraturePoints(const pylith::topology::Field& target,
+                                         const pylith::topology::Field& auxiliary,
+                                         const PetscInt subfieldIndex);
+
+        }; // _FieldOps
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
 std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE> pylith::topology::FieldOps::feStore = std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE>();
 
 void
@@ -65,17 +90,33 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         const PetscBool useTensor = pylith::topology::FieldBase::TENSOR_BASIS == feKey.cellBasis ? PETSC_TRUE : PETSC_FALSE;
         const PetscBool basisContinuity = feKey.isBasisContinuous ? PETSC_TRUE : PETSC_FALSE;
 
+        // Create quadrature
+        PetscQuadrature quadrature = NULL;
+        PetscQuadrature faceQuadrature = NULL;
+        DMPolytopeType ct;
+        switch (dim) {
+          case 0: ct = DM_POLYTOPE_POINT;break;
+          case 1: ct = DM_POLYTOPE_SEGMENT;break;
+          case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
+          case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
+          default: throw std::logic_error("Cannot handle dimension");
+        }
+        err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+
         // Create space
         PetscSpace space = NULL;
         err = PetscSpaceCreate(PETSC_COMM_SELF, &space);PYLITH_CHECK_ERROR(err);assert(space);
-        err = PetscSpaceSetType(space, feKey.feSpace == FieldBase::POLYNOMIAL_SPACE ?
-                                PETSCSPACEPOLYNOMIAL : PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
         err = PetscSpaceSetNumComponents(space, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);
+        err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
         if (feKey.feSpace == FieldBase::POLYNOMIAL_SPACE) {
+            err = PetscSpaceSetType(space, PETSCSPACEPOLYNOMIAL);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
             err = PetscSpacePolynomialSetTensor(space, useTensor);PYLITH_CHECK_ERROR(err);
-        } // if
-        err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
+        } else {
+            // Values are stored at the quadrature points, so the space is the set of quadrature points.
+            err = PetscSpaceSetType(space, PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
+            err = PetscSpacePointSetPoints(space, quadrature);PYLITH_CHECK_ERROR(err);
+        } // if/else
         err = PetscSpaceSetUp(space);PYLITH_CHECK_ERROR(err);
 
         // Create dual space
@@ -86,10 +127,37 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         err = PetscDualSpaceSetDM(dualspace, dmCell);PYLITH_CHECK_ERROR(err);
         err = DMDestroy(&dmCell);PYLITH_CHECK_ERROR(err);
         err = PetscDualSpaceSetNumComponents(dualspace, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
+        if (feKey.feSpace == FieldBase::POLYNOMIAL_SPACE) {
+            err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
+        } else {
+            // Point evaluation of each component at each quadrature point (cell-interior dofs ordered by
+            // quadrature point and then component).
+            PetscInt numPoints = 0;
+            const PetscReal* points = NULL;
+            err = PetscQuadratureGetData(quadrature, NULL, NULL, &numPoints, &points, NULL);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACESIMPLE);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSimpleSetDimension(dualspace, numPoints*numComponents);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0, iFunctional = 0; iPoint < numPoints; ++iPoint) {
+                for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent, ++iFunctional) {
+                    PetscQuadrature functional = NULL;
+                    PetscReal* fPoints = NULL;
+                    PetscReal* fWeights = NULL;
+                    err = PetscMalloc1(dim, &fPoints);PYLITH_CHECK_ERROR(err);
+                    err = PetscCalloc1(numComponents, &fWeights);PYLITH_CHECK_ERROR(err);
+                    for (PetscInt d = 0; d < dim; ++d) {
+                        fPoints[d] = points[iPoint*dim+d];
+                    } // for
+                    fWeights[iComponent] = 1.0;
+                    err = PetscQuadratureCreate(PETSC_COMM_SELF, &functional);PYLITH_CHECK_ERROR(err);
+                    err = PetscQuadratureSetData(functional, dim, numComponents, 1, fPoints, fWeights);PYLITH_CHECK_ERROR(err);
+                    err = PetscDualSpaceSimpleSetFunctional(dualspace, iFunctional, functional);PYLITH_CHECK_ERROR(err);
+                    err = PetscQuadratureDestroy(&functional);PYLITH_CHECK_ERROR(err);
+                } // for
+            } // for
+        } // if/else
         err = PetscDualSpaceSetUp(dualspace);PYLITH_CHECK_ERROR(err);
 
         // Create element
@@ -102,24 +170,11 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         err = PetscSpaceDestroy(&space);PYLITH_CHECK_ERROR(err);
         err = PetscDualSpaceDestroy(&dualspace);PYLITH_CHECK_ERROR(err);
 
-        // Create quadrature
-        PetscQuadrature quadrature = NULL;
-        PetscQuadrature faceQuadrature = NULL;
-        DMPolytopeType ct;
-        switch (dim) {
-          case 0: ct = DM_POLYTOPE_POINT;break;
-          case 1: ct = DM_POLYTOPE_SEGMENT;break;
-          case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
-          case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
-          default: throw std::logic_error("Cannot handle dimension");
-        }
-        err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
         err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
         err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
         err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
         err = PetscQuadratureDestroy(&faceQuadrature);PYLITH_CHECK_ERROR(err);
 
-        assert(feKey.feSpace == FieldBase::POLYNOMIAL_SPACE);
         pylith::topology::FieldOps::feStore.insert(std::pair<FieldBase::Discretization, pylith::topology::FE>(feKey, fe));
     } else {
         throw std::logic_error("FieldOps::createFE() :TODO: Can't reuse PetscFE due to naming of fields, so make a deep copy of fe.");
@@ -184,6 +239,14 @@ pylith::topology::FieldOps::checkDiscretization(const pylith::topology::Field& t
             } else {
                 quadOrder = sinfo.fe.quadOrder;
             } // else
+            if ((pylith::topology::FieldBase::POINT_SPACE == sinfo.fe.feSpace) &&
+                !_FieldOps::hasSameQuadraturePoints(target, auxiliary, sinfo.index)) {
+                std::ostringstream msg;
+                msg << "Subfield '" << subfieldNames[i] << "' in auxiliary field '" << auxiliary.getLabel()
+                    << "' stores values at quadrature points, so its quadrature points must match the quadrature points of the "
+                    << "subfields in the target field '" << target.getLabel() << "'. Check the quadrature order and cell basis of the subfield.";
+                throw std::runtime_error(msg.str());
+            } // if
         } // for
     } // auxiliary subfields
 
@@ -262,4 +325,51 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether quadrature points of subfield match those of target subfields with the same dimension.
+bool
+pylith::topology::_FieldOps::hasSameQuadraturePoints(const pylith::topology::Field& target,
+                                                     const pylith::topology::Field& auxiliary,
+                                                     const PetscInt subfieldIndex) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscObject auxiliaryFE = NULL;
+    PetscQuadrature auxiliaryQuadrature = NULL;
+    PetscInt auxiliaryDim = 0, auxiliaryNumPoints = 0;
+    const PetscReal* auxiliaryPoints = NULL;
+    err = DMGetField(auxiliary.getDM(), subfieldIndex, NULL, &auxiliaryFE);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetQuadrature((PetscFE)auxiliaryFE, &auxiliaryQuadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureGetData(auxiliaryQuadrature, &auxiliaryDim, NULL, &auxiliaryNumPoints, &auxiliaryPoints, NULL);PYLITH_CHECK_ERROR(err);
+
+    const pylith::string_vector& subfieldNames = target.getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        const pylith::topology::Field::SubfieldInfo& sinfo = target.getSubfieldInfo(subfieldNames[i].c_str());
+        PetscObject targetFE = NULL;
+        PetscQuadrature targetQuadrature = NULL;
+        PetscInt targetDim = 0, targetNumPoints = 0;
+        const PetscReal* targetPoints = NULL;
+        err = DMGetField(target.getDM(), sinfo.index, NULL, &targetFE);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetQuadrature((PetscFE)targetFE, &targetQuadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureGetData(targetQuadrature, &targetDim, NULL, &targetNumPoints, &targetPoints, NULL);PYLITH_CHECK_ERROR(err);
+        if (targetDim != auxiliaryDim) { continue; }
+
+        if (targetNumPoints != auxiliaryNumPoints) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+        const PylithReal tolerance = 1.0e-10;
+        for (PetscInt iCoord = 0; iCoord < targetNumPoints*targetDim; ++iCoord) {
+            if (fabs(targetPoints[iCoord] - auxiliaryPoints[iCoord]) > tolerance) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+        } // for
+        PYLITH_METHOD_RETURN(true);
+    } // for
+
+    // No target subfields with the same dimension.
+    PYLITH_METHOD_RETURN(false);
+} // hasSameQuadraturePoints
+
+
 // End of file
@@ -53,12 +53,14 @@ pylith::topology::FieldQuery::FieldQuery(const Field& field) :
     _functions(NULL),
     _contexts(NULL),
     _contextPtrs(NULL),
-    _logger(new pylith::utils::EventLogger) {
+    _logger(new pylith::utils::EventLogger),
+    _eventQueryDB(0),
+    _eventQueryPoint(0) {
     assert(_logger);
     _logger->setClassName("FieldQuery");
     _logger->initialize();
-    _logger->registerEvent("Py-FdQu-queryDB");
-    _logger->registerEvent("Py-FdQu-queryPt");
+    _eventQueryDB = _logger->registerEvent("Py-FdQu-queryDB");
+    _eventQueryPoint = _logger->registerEvent("Py-FdQu-queryPt");
 } // constructor
 
 
@@ -187,6 +189,7 @@ pylith::topology::FieldQuery::openDB(spatialdata::spatialdb::SpatialDB* db,
         _contexts[index].valueScale = description.scale;
         _contexts[index].validator = description.validator;
         _contexts[index].logger = _logger;
+        _contexts[index].eventQueryPoint = _eventQueryPoint;
 
         _contextPtrs[index] = &_contexts[index];
     } // for
@@ -202,15 +205,14 @@ pylith::topology::FieldQuery::queryDB(void) {
     PYLITH_METHOD_BEGIN;
 
     assert(_logger);
-    const PylithInt queryEvent = _logger->getEventId("Py-FdQu-queryDB");
-    _logger->eventBegin(queryEvent);
+    _logger->eventBegin(_eventQueryDB);
 
     PetscErrorCode err = 0;
     PetscReal dummyTime = 0.0;
     err = DMProjectFunctionLocal(_field.getDM(), dummyTime, _functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
                                  _field.getLocalVector());PYLITH_CHECK_ERROR(err);
 
-    _logger->eventEnd(queryEvent);
+    _logger->eventEnd(_eventQueryDB);
 
     PYLITH_METHOD_END;
 } // queryDB
@@ -224,8 +226,7 @@ pylith::topology::FieldQuery::queryDBLabel(const char* labelName,
     PYLITH_METHOD_BEGIN;
 
     assert(_logger);
-    const PylithInt queryEvent = _logger->getEventId("Py-FdQu-queryDB");
-    _logger->eventBegin(queryEvent);
+    _logger->eventBegin(_eventQueryDB);
 
     PetscErrorCode err = 0;
     PetscReal dummyTime = 0.0;
@@ -244,7 +245,7 @@ pylith::topology::FieldQuery::queryDBLabel(const char* labelName,
                                       numSubfields, &subfieldIndices[0], _functions, (void**)_contextPtrs,
                                       INSERT_ALL_VALUES, _field.getLocalVector());PYLITH_CHECK_ERROR(err);
 
-    _logger->eventEnd(queryEvent);
+    _logger->eventEnd(_eventQueryDB);
 
     PYLITH_METHOD_END;
 } // queryDBLabel
@@ -290,8 +291,7 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
     } // if
 
     assert(queryctx->logger);
-    const PylithInt pointFnEvent = queryctx->logger->getEventId("Py-FdQu-queryPt");
-    queryctx->logger->eventBegin(pointFnEvent);
+    queryctx->logger->eventBegin(queryctx->eventQueryPoint);
 
     // Dimensionalize query location coordinates.
     assert(queryctx->lengthScale > 0);
@@ -355,7 +355,7 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         values[i] /= queryctx->valueScale;
     } // for
 
-    queryctx->logger->eventEnd(pointFnEvent);
+    queryctx->logger->eventEnd(queryctx->eventQueryPoint);
 
     PYLITH_METHOD_RETURN(0);
 } // queryDBPointFn
@@ -200,6 +200,7 @@ private:
         convertfn_type converter; ///< Function to convert values to subfield (optional).
         pylith::topology::FieldBase::validatorfn_type validator; ///< Function to validate values (optional).
         pylith::utils::EventLogger* logger;
+        int eventQueryPoint; ///< Identifier for logging event for query at point.
 
         DBQueryContext(void) :
             db(NULL),
@@ -209,7 +210,8 @@ private:
             description("unknown"),
             converter(NULL),
             validator(NULL),
-            logger(NULL) {}
+            logger(NULL),
+            eventQueryPoint(0) {}
 
 
     }; // DBQueryStruct
@@ -226,6 +228,8 @@ private:
     DBQueryContext** _contextPtrs; ///< Array of pointers to contexts.
 
     pylith::utils::EventLogger* _logger;
+    int _eventQueryDB; ///< Identifier for logging event for query of spatial database.
+    int _eventQueryPoint; ///< Identifier for logging event for query at point.
 
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
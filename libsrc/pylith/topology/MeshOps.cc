@@ -33,6 +33,124 @@
 
 #include <algorithm> // USES std::sort, std::find
 #include <map> // USES std::map
+#include <set> // USES std::set
+#include <vector> // USES std::vector
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _MeshOps {
+public:
+
+            /** Get cells in mesh.
+             *
+             * @param[out] cells Array of cells.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cellHeight Height of cells in DM.
+             */
+            static
+            void getCells(pylith::int_array* cells,
+                          const PetscDM dm,
+                          const PetscInt cellHeight);
+
+            /** Get points in closure of cells.
+             *
+             * @param[out] points Array of points.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cells Array of cells.
+             */
+            static
+            void getClosurePoints(pylith::int_array* points,
+                                  const PetscDM dm,
+                                  const pylith::int_array& cells);
+
+            /** Check cell type and cone size of cells.
+             *
+             * @param[inout] numErrors Number of errors.
+             * @param[inout] msg Description of first error.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cells Array of cells.
+             */
+            static
+            void checkConeSizes(PetscInt* numErrors,
+                                std::ostringstream* msg,
+                                const PetscDM dm,
+                                const pylith::int_array& cells);
+
+            /** Check number of vertices in closure of cells.
+             *
+             * @param[inout] numErrors Number of errors.
+             * @param[inout] msg Description of first error.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cells Array of cells.
+             */
+            static
+            void checkSkeleton(PetscInt* numErrors,
+                               std::ostringstream* msg,
+                               const PetscDM dm,
+                               const pylith::int_array& cells);
+
+            /** Check symmetry of cones and supports of points.
+             *
+             * @param[inout] numErrors Number of errors.
+             * @param[inout] msg Description of first error.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] points Array of points.
+             */
+            static
+            void checkSymmetry(PetscInt* numErrors,
+                               std::ostringstream* msg,
+                               const PetscDM dm,
+                               const pylith::int_array& points);
+
+            /** Check orientation of cells (positive Jacobian determinant). Cohesive cells are skipped.
+             *
+             * @param[inout] numErrors Number of errors.
+             * @param[inout] msg Description of first error.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cells Array of cells.
+             * @param[in] stride Check every stride-th cell.
+             */
+            static
+            void checkOrientation(PetscInt* numErrors,
+                                  std::ostringstream* msg,
+                                  const PetscDM dm,
+                                  const pylith::int_array& cells,
+                                  const size_t stride);
+
+            /** Check that cone sizes and cell types of ghost points match those of their owners.
+             *
+             * @param[inout] numErrors Number of errors.
+             * @param[inout] msg Description of first error.
+             * @param[in] dm PETSc DM for mesh.
+             */
+            static
+            void checkGhosts(PetscInt* numErrors,
+                             std::ostringstream* msg,
+                             const PetscDM dm);
+
+            /** Throw exception on all processes if any process found errors.
+             *
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] numErrors Number of errors on this process.
+             * @param[in] msg Description of first error on this process.
+             */
+            static
+            void reduceErrors(const PetscDM dm,
+                              const PetscInt numErrors,
+                              const std::ostringstream& msg);
+
+            static const size_t numSampleCells; ///< Number of cells per process sampled in basic checks.
+
+        }; // _MeshOps
+        const size_t _MeshOps::numSampleCells = 1000;
+    } // topology
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+pylith::topology::MeshOps::CheckTopologyLevel pylith::topology::MeshOps::_checkTopologyLevel =
+    pylith::topology::MeshOps::CHECK_TOPOLOGY_FULL;
+
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Create subdomain mesh using label.
@@ -225,6 +343,17 @@ pylith::topology::MeshOps::nondimensionalize(Mesh* const mesh,
     err = DMPlexSetScale(dmMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(dmMesh, NULL, "-pylith_nondim_dm_view");PYLITH_CHECK_ERROR(err);
 
+    // Coarse levels of mesh from uniform refinement have their own coordinates.
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    while (dmCoarse) {
+        PetscVec coarseCoordVec = NULL;
+        err = DMGetCoordinatesLocal(dmCoarse, &coarseCoordVec);PYLITH_CHECK_ERROR(err);assert(coarseCoordVec);
+        err = VecScale(coarseCoordVec, 1.0/lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMPlexSetScale(dmCoarse, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
     const PetscInt dim = mesh->getDimension();
     if (dim < 1) {
         PYLITH_METHOD_END;
@@ -253,9 +382,40 @@ pylith::topology::MeshOps::nondimensionalize(Mesh* const mesh,
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Check topology of mesh.
+// Set level of checks of mesh topology.
+void
+pylith::topology::MeshOps::setCheckTopologyLevel(const CheckTopologyLevel value) {
+    _checkTopologyLevel = value;
+} // setCheckTopologyLevel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get level of checks of mesh topology.
+pylith::topology::MeshOps::CheckTopologyLevel
+pylith::topology::MeshOps::getCheckTopologyLevel(void) {
+    return _checkTopologyLevel;
+} // getCheckTopologyLevel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check topology of mesh using the current level of checks.
 void
 pylith::topology::MeshOps::checkTopology(const Mesh& mesh) {
+    checkTopology(mesh, _checkTopologyLevel);
+} // checkTopology
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check topology of mesh.
+void
+pylith::topology::MeshOps::checkTopology(const Mesh& mesh,
+                                         const CheckTopologyLevel level) {
+    PYLITH_METHOD_BEGIN;
+
+    if (CHECK_TOPOLOGY_NONE == level) {
+        PYLITH_METHOD_END;
+    } // if
+
     PetscDM dmMesh = mesh.getDM();assert(dmMesh);
 
     DMLabel subpointMap;
@@ -264,17 +424,92 @@ pylith::topology::MeshOps::checkTopology(const Mesh& mesh) {
 
     PetscErrorCode err;
     err = DMViewFromOptions(dmMesh, NULL, "-pylith_checktopo_dm_view");PYLITH_CHECK_ERROR(err);
-    err = DMPlexCheckGeometry(dmMesh);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of the mesh.");
-    err = DMPlexCheckSymmetry(dmMesh);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of mesh associated with symmetry of adjacency information.");
 
-    err = DMPlexCheckSkeleton(dmMesh, cellHeight);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of mesh cells.");
+    PetscInt numErrors = 0;
+    std::ostringstream msg;
+    switch (level) {
+    case CHECK_TOPOLOGY_BASIC: {
+        pylith::int_array cells;
+        _MeshOps::getCells(&cells, dmMesh, cellHeight);
+        const size_t stride = std::max(cells.size() / _MeshOps::numSampleCells, size_t(1));
+        _MeshOps::checkConeSizes(&numErrors, &msg, dmMesh, cells);
+        _MeshOps::checkOrientation(&numErrors, &msg, dmMesh, cells, stride);
+        break;
+    } // BASIC
+    case CHECK_TOPOLOGY_LOCAL: {
+        pylith::int_array cells;
+        _MeshOps::getCells(&cells, dmMesh, cellHeight);
+        PetscInt pStart = 0, pEnd = 0;
+        err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        pylith::int_array points(pEnd-pStart);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            points[point-pStart] = point;
+        } // for
+        _MeshOps::checkConeSizes(&numErrors, &msg, dmMesh, cells);
+        _MeshOps::checkSkeleton(&numErrors, &msg, dmMesh, cells);
+        _MeshOps::checkSymmetry(&numErrors, &msg, dmMesh, points);
+        _MeshOps::checkOrientation(&numErrors, &msg, dmMesh, cells, 1);
+        break;
+    } // LOCAL
+    case CHECK_TOPOLOGY_FULL: {
+        err = DMPlexCheckGeometry(dmMesh);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of the mesh.");
+        err = DMPlexCheckSymmetry(dmMesh);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of mesh associated with symmetry of adjacency information.");
+
+        err = DMPlexCheckSkeleton(dmMesh, cellHeight);PYLITH_CHECK_ERROR_MSG(err, "Error in topology of mesh cells.");
+
+        /* Other check functions that we are not using:
+         *
+         * DMPlexCheckFaces() - not compatible with cohesive cells.
+         *
+         * DMPlexCheckInterfaceCones() - very slow
+         */
+        break;
+    } // FULL
+    default: {
+        std::ostringstream msg;
+        msg << "Unknown level of checks of mesh topology (" << level << ").";
+        throw std::logic_error(msg.str());
+    } // default
+    } // switch
+    _MeshOps::checkGhosts(&numErrors, &msg, dmMesh);
+    _MeshOps::reduceErrors(dmMesh, numErrors, msg);
 
-    /* Other check functions that we are not using:
-     *
-     * DMPlexCheckFaces() - not compatible with cohesive cells.
-     *
-     * DMPlexCheckInterfaceCones() - very slow
-     */
+    PYLITH_METHOD_END;
+} // checkTopology
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check topology of cells in mesh using the current level of checks.
+void
+pylith::topology::MeshOps::checkTopology(const Mesh& mesh,
+                                         const pylith::int_array& cells) {
+    PYLITH_METHOD_BEGIN;
+
+    if (CHECK_TOPOLOGY_NONE == _checkTopologyLevel) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscErrorCode err;
+    err = DMViewFromOptions(dmMesh, NULL, "-pylith_checktopo_dm_view");PYLITH_CHECK_ERROR(err);
+
+    PetscInt numErrors = 0;
+    std::ostringstream msg;
+    _MeshOps::checkConeSizes(&numErrors, &msg, dmMesh, cells);
+    if (CHECK_TOPOLOGY_BASIC == _checkTopologyLevel) {
+        const size_t stride = std::max(cells.size() / _MeshOps::numSampleCells, size_t(1));
+        _MeshOps::checkOrientation(&numErrors, &msg, dmMesh, cells, stride);
+    } else {
+        pylith::int_array points;
+        _MeshOps::getClosurePoints(&points, dmMesh, cells);
+        _MeshOps::checkSkeleton(&numErrors, &msg, dmMesh, cells);
+        _MeshOps::checkSymmetry(&numErrors, &msg, dmMesh, points);
+        _MeshOps::checkOrientation(&numErrors, &msg, dmMesh, cells, 1);
+    } // if/else
+    _MeshOps::checkGhosts(&numErrors, &msg, dmMesh);
+    _MeshOps::reduceErrors(dmMesh, numErrors, msg);
+
+    PYLITH_METHOD_END;
 } // checkTopology
 
 
@@ -465,4 +700,359 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
 } // checkMaterialIds
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check to make sure cells with the same material label value are numbered consecutively.
+void
+pylith::topology::MeshOps::checkMaterialCellsConsecutive(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscDMLabel dmLabel = NULL;
+    const char* const labelName = pylith::topology::Mesh::cells_label_name;
+    err = DMGetLabel(dmMesh, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(dmLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(dmLabel, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 1; iPoint < numPoints; ++iPoint) {
+            if (points[iPoint] - points[iPoint-1] != 1) {
+                std::ostringstream msg;
+                msg << "Cells for label '" << labelName << "' with value " << values[iValue] << " are not consecutive ("
+                    << points[iPoint] << " and " << points[iPoint-1] << ").";
+
+                // Cleanup
+                err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+                err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+                err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+                err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+                throw std::runtime_error(msg.str());
+            } // if
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // checkMaterialCellsConsecutive
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get cells in mesh.
+void
+pylith::topology::_MeshOps::getCells(pylith::int_array* cells,
+                                     const PetscDM dm,
+                                     const PetscInt cellHeight) {
+    PYLITH_METHOD_BEGIN;
+    assert(cells);
+
+    PetscInt cStart = 0, cEnd = 0;
+    PetscErrorCode err = DMPlexGetHeightStratum(dm, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    cells->resize(cEnd-cStart);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        (*cells)[cell-cStart] = cell;
+    } // for
+
+    PYLITH_METHOD_END;
+} // getCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get points in closure of cells.
+void
+pylith::topology::_MeshOps::getClosurePoints(pylith::int_array* points,
+                                             const PetscDM dm,
+                                             const pylith::int_array& cells) {
+    PYLITH_METHOD_BEGIN;
+    assert(points);
+
+    PetscErrorCode err;
+    std::set<PetscInt> closurePoints;
+    for (size_t i = 0; i < cells.size(); ++i) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dm, cells[i], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize*2; iPoint += 2) {
+            closurePoints.insert(closure[iPoint]);
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cells[i], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    points->resize(closurePoints.size());
+    size_t index = 0;
+    for (std::set<PetscInt>::const_iterator iter = closurePoints.begin(); iter != closurePoints.end(); ++iter, ++index) {
+        (*points)[index] = *iter;
+    } // for
+
+    PYLITH_METHOD_END;
+} // getClosurePoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check cell type and cone size of cells.
+void
+pylith::topology::_MeshOps::checkConeSizes(PetscInt* numErrors,
+                                           std::ostringstream* msg,
+                                           const PetscDM dm,
+                                           const pylith::int_array& cells) {
+    PYLITH_METHOD_BEGIN;
+    assert(numErrors);
+    assert(msg);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const PetscInt cell = cells[i];
+        DMPolytopeType ct;
+        PetscInt coneSize = 0;
+        err = DMPlexGetCellType(dm, cell, &ct);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetConeSize(dm, cell, &coneSize);PYLITH_CHECK_ERROR(err);
+        if (DM_POLYTOPE_UNKNOWN == ct) {
+            if (!*numErrors) {
+                *msg << "Error in topology of mesh cells. Cell " << cell << " has an unknown cell type.";
+            } // if
+            ++(*numErrors);
+        } else if (coneSize != DMPolytopeTypeGetConeSize(ct)) {
+            if (!*numErrors) {
+                *msg << "Error in topology of mesh cells. Cell " << cell << " of type " << DMPolytopeTypes[ct]
+                     << " has cone size " << coneSize << " but should have cone size "
+                     << DMPolytopeTypeGetConeSize(ct) << ".";
+            } // if
+            ++(*numErrors);
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkConeSizes
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check number of vertices in closure of cells.
+void
+pylith::topology::_MeshOps::checkSkeleton(PetscInt* numErrors,
+                                          std::ostringstream* msg,
+                                          const PetscDM dm,
+                                          const pylith::int_array& cells) {
+    PYLITH_METHOD_BEGIN;
+    assert(numErrors);
+    assert(msg);
+
+    PetscErrorCode err;
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const PetscInt cell = cells[i];
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dm, cell, &ct);PYLITH_CHECK_ERROR(err);
+        if (DM_POLYTOPE_UNKNOWN == ct) { continue; }
+
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0, numVertices = 0;
+        err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize*2; iPoint += 2) {
+            if ((closure[iPoint] >= vStart) && (closure[iPoint] < vEnd)) { ++numVertices; }
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (numVertices != DMPolytopeTypeGetNumVertices(ct)) {
+            if (!*numErrors) {
+                *msg << "Error in topology of mesh cells. Cell " << cell << " of type " << DMPolytopeTypes[ct]
+                     << " has " << numVertices << " vertices in its closure but should have "
+                     << DMPolytopeTypeGetNumVertices(ct) << " vertices.";
+            } // if
+            ++(*numErrors);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkSkeleton
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check symmetry of cones and supports of points.
+void
+pylith::topology::_MeshOps::checkSymmetry(PetscInt* numErrors,
+                                          std::ostringstream* msg,
+                                          const PetscDM dm,
+                                          const pylith::int_array& points) {
+    PYLITH_METHOD_BEGIN;
+    assert(numErrors);
+    assert(msg);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < points.size(); ++i) {
+        const PetscInt point = points[i];
+
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0;
+        err = DMPlexGetConeSize(dm, point, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dm, point, &cone);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCone = 0; iCone < coneSize; ++iCone) {
+            const PetscInt* support = NULL;
+            PetscInt supportSize = 0;
+            err = DMPlexGetSupportSize(dm, cone[iCone], &supportSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetSupport(dm, cone[iCone], &support);PYLITH_CHECK_ERROR(err);
+            if (std::find(support, support+supportSize, point) == support+supportSize) {
+                if (!*numErrors) {
+                    *msg << "Error in topology of mesh associated with symmetry of adjacency information. Point "
+                         << cone[iCone] << " is in the cone of point " << point << " but point " << point
+                         << " is not in its support.";
+                } // if
+                ++(*numErrors);
+            } // if
+        } // for
+
+        const PetscInt* support = NULL;
+        PetscInt supportSize = 0;
+        err = DMPlexGetSupportSize(dm, point, &supportSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetSupport(dm, point, &support);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+            err = DMPlexGetConeSize(dm, support[iSupport], &coneSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetCone(dm, support[iSupport], &cone);PYLITH_CHECK_ERROR(err);
+            if (std::find(cone, cone+coneSize, point) == cone+coneSize) {
+                if (!*numErrors) {
+                    *msg << "Error in topology of mesh associated with symmetry of adjacency information. Point "
+                         << support[iSupport] << " is in the support of point " << point << " but point " << point
+                         << " is not in its cone.";
+                } // if
+                ++(*numErrors);
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkSymmetry
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check orientation of cells.
+void
+pylith::topology::_MeshOps::checkOrientation(PetscInt* numErrors,
+                                             std::ostringstream* msg,
+                                             const PetscDM dm,
+                                             const pylith::int_array& cells,
+                                             const size_t stride) {
+    PYLITH_METHOD_BEGIN;
+    assert(numErrors);
+    assert(msg);
+    assert(stride > 0);
+
+    PetscErrorCode err;
+    PylithReal v0[3], J[9], invJ[9], detJ = 0.0;
+    for (size_t i = 0; i < cells.size(); i += stride) {
+        const PetscInt cell = cells[i];
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dm, cell, &ct);PYLITH_CHECK_ERROR(err);
+        if ((DM_POLYTOPE_UNKNOWN == ct) || pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { continue; }
+
+        err = DMPlexComputeCellGeometryFEM(dm, cell, NULL, v0, J, invJ, &detJ);PYLITH_CHECK_ERROR(err);
+        if (detJ <= 0.0) {
+            if (!*numErrors) {
+                *msg << "Error in topology of the mesh. Cell " << cell << " of type " << DMPolytopeTypes[ct]
+                     << " is inverted or degenerate (determinant of Jacobian is " << detJ << ").";
+            } // if
+            ++(*numErrors);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkOrientation
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check that cone sizes and cell types of ghost points match those of their owners.
+void
+pylith::topology::_MeshOps::checkGhosts(PetscInt* numErrors,
+                                        std::ostringstream* msg,
+                                        const PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(numErrors);
+    assert(msg);
+
+    PetscErrorCode err;
+    PetscSF sfPoint = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    const PetscSFNode* remotePoints = NULL;
+    err = DMGetPointSF(dm, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &numRoots, &numLeaves, &leaves, &remotePoints);PYLITH_CHECK_ERROR(err);
+    if (numRoots < 0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Encode cone size and cell type of each point in a single integer.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(0 == pStart && numRoots == pEnd);
+    std::vector<PetscInt> rootShape(pEnd, -1);
+    std::vector<PetscInt> leafShape(pEnd, -1);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        DMPolytopeType ct;
+        PetscInt coneSize = 0;
+        err = DMPlexGetCellType(dm, point, &ct);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetConeSize(dm, point, &coneSize);PYLITH_CHECK_ERROR(err);
+        rootShape[point] = coneSize*DM_NUM_POLYTOPES + ct;
+    } // for
+    PetscInt* rootData = pEnd > 0 ? &rootShape[0] : NULL;
+    PetscInt* leafData = pEnd > 0 ? &leafShape[0] : NULL;
+    err = PetscSFBcastBegin(sfPoint, MPIU_INT, rootData, leafData, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfPoint, MPIU_INT, rootData, leafData, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+        if (leafShape[point] != rootShape[point]) {
+            if (!*numErrors) {
+                *msg << "Error in topology of mesh associated with ghost points. Point " << point
+                     << " has cone size " << rootShape[point] / DM_NUM_POLYTOPES << " and cell type "
+                     << DMPolytopeTypes[rootShape[point] % DM_NUM_POLYTOPES] << " but its owner (point "
+                     << remotePoints[iLeaf].index << " on process " << remotePoints[iLeaf].rank << ") has cone size "
+                     << leafShape[point] / DM_NUM_POLYTOPES << " and cell type "
+                     << DMPolytopeTypes[leafShape[point] % DM_NUM_POLYTOPES] << ".";
+            } // if
+            ++(*numErrors);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkGhosts
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Throw exception on all processes if any process found errors.
+void
+pylith::topology::_MeshOps::reduceErrors(const PetscDM dm,
+                                         const PetscInt numErrors,
+                                         const std::ostringstream& msg) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscInt numErrorsGlobal = 0;
+    PetscErrorCode err = MPI_Allreduce(&numErrors, &numErrorsGlobal, 1, MPIU_INT, MPI_SUM,
+                                       PetscObjectComm((PetscObject) dm));PYLITH_CHECK_ERROR(err);
+    if (numErrorsGlobal > 0) {
+        std::ostringstream msgGlobal;
+        msgGlobal << "Found " << numErrorsGlobal << " error(s) in topology of mesh.\n";
+        if (numErrors > 0) {
+            msgGlobal << msg.str();
+        } else {
+            msgGlobal << "Errors were found on other processes.";
+        } // if/else
+        throw std::runtime_error(msgGlobal.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // reduceErrors
+
+
 // End of file
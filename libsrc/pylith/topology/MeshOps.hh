@@ -36,6 +36,17 @@
 class pylith::topology::MeshOps {
     friend class TestMeshOps; // unit testing
 
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Level of checks of mesh topology.
+    enum CheckTopologyLevel {
+        CHECK_TOPOLOGY_NONE=0, ///< No checks.
+        CHECK_TOPOLOGY_BASIC=1, ///< Cone sizes of all cells and orientation of a sample of cells.
+        CHECK_TOPOLOGY_LOCAL=2, ///< Cone sizes, skeleton, symmetry, and orientation of all local cells.
+        CHECK_TOPOLOGY_FULL=3, ///< PETSc checks of geometry, symmetry, and skeleton.
+    }; // CheckTopologyLevel
+
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -91,13 +102,52 @@ public:
     void nondimensionalize(Mesh* const mesh,
                            const spatialdata::units::Nondimensional& normalizer);
 
-    /** Check topology of mesh.
+    /** Set level of checks of mesh topology.
+     *
+     * @param[in] value Level of checks.
+     */
+    static
+    void setCheckTopologyLevel(const CheckTopologyLevel value);
+
+    /** Get level of checks of mesh topology.
+     *
+     * @returns Level of checks.
+     */
+    static
+    CheckTopologyLevel getCheckTopologyLevel(void);
+
+    /** Check topology of mesh using the current level of checks.
+     *
+     * The checks operate on the local points of each process. All levels other than
+     * CHECK_TOPOLOGY_NONE also check that the cone sizes and cell types of ghost points match those
+     * of their owners. The checks are collective.
      *
      * @param[in] mesh Finite-element mesh.
      */
     static
     void checkTopology(const Mesh& mesh);
 
+    /** Check topology of mesh.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] level Level of checks.
+     */
+    static
+    void checkTopology(const Mesh& mesh,
+                       const CheckTopologyLevel level);
+
+    /** Check topology of cells in mesh using the current level of checks.
+     *
+     * Used to check only the cells affected by a local change in the topology, such as inserting
+     * cohesive cells. The checks are collective.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] cells Cells to check.
+     */
+    static
+    void checkTopology(const Mesh& mesh,
+                       const pylith::int_array& cells);
+
     /** Determine is mesh contains simplex cells (i.e., line, tri, tet).
      *
      * @param[in] mesh Finite-element mesh.
@@ -150,6 +200,18 @@ public:
     void checkMaterialLabels(const Mesh& mesh,
                              pylith::int_array& labelValues);
 
+    /** Check to make sure cells with the same material label value are numbered consecutively.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    static
+    void checkMaterialCellsConsecutive(const Mesh& mesh);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    static CheckTopologyLevel _checkTopologyLevel; ///< Level of checks of mesh topology.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,558 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshOrdering.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_LOGICERROR
+
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <deque> // USES std::deque
+#include <algorithm> // USES std::sort, std::reverse
+#include <stdexcept> // USES std::logic_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _MeshOrdering {
+public:
+
+            /** Compute rank of each cell using reverse Cuthill-McKee ordering of the cell adjacency graph.
+             *
+             * @param[out] cellRank Rank of each cell in ordering.
+             * @param[in] dm PETSc DM for mesh.
+             */
+            static
+            void computeRankRCM(std::vector<PetscInt>* cellRank,
+                                const PetscDM dm);
+
+            /** Compute rank of each cell using space-filling curve through cell centroids.
+             *
+             * @param[out] cellRank Rank of each cell in ordering.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] curve Type of space-filling curve.
+             */
+            static
+            void computeRankSFC(std::vector<PetscInt>* cellRank,
+                                const PetscDM dm,
+                                const SpaceFillingCurve::CurveEnum curve);
+
+            /** Create permutation of points from the rank of each cell.
+             *
+             * @param[out] permutation Permutation of points (perm[old point] = new point).
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cellRank Rank of each cell in ordering.
+             */
+            static
+            void createPermutation(PetscIS* permutation,
+                                   const PetscDM dm,
+                                   const std::vector<PetscInt>& cellRank);
+
+            /** Permute point SF to match new numbering of points.
+             *
+             * DMPlexPermute() does not update the point SF, so we map the roots and leaves to the new
+             * numbering and set the point SF of the new DM and its coordinate DM.
+             *
+             * @param[inout] dmNew PETSc DM with new numbering.
+             * @param[in] dmOrig PETSc DM with original numbering.
+             * @param[in] permutation Permutation of points (perm[old point] = new point).
+             */
+            static
+            void permutePointSF(PetscDM dmNew,
+                                const PetscDM dmOrig,
+                                const PetscIS permutation);
+
+            /** Determine whether point is a tensor product (cohesive) point.
+             *
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] point Point in mesh.
+             * @returns True if point is a tensor product point, false otherwise.
+             */
+            static
+            bool isTensorPoint(const PetscDM dm,
+                               const PetscInt point);
+
+            /** Get cell adjacency graph (cells sharing a face).
+             *
+             * @param[out] offsets Offsets into adjacency for each cell.
+             * @param[out] adjacency Indices of adjacent cells.
+             * @param[in] dm PETSc DM for mesh.
+             */
+            static
+            void getCellGraph(std::vector<PetscInt>* offsets,
+                              std::vector<PetscInt>* adjacency,
+                              const PetscDM dm);
+
+            /// Comparison of cells for ordering.
+            class CellCompare {
+public:
+
+                CellCompare(const std::vector<PetscInt>& isTensor,
+                            const std::vector<PetscInt>& group,
+                            const std::vector<PetscInt>& rank) :
+                    _isTensor(isTensor),
+                    _group(group),
+                    _rank(rank) {}
+
+
+                bool operator()(const PetscInt a,
+                                const PetscInt b) const {
+                    if (_isTensor[a] != _isTensor[b]) { return _isTensor[a] < _isTensor[b]; }
+                    if (_group[a] != _group[b]) { return _group[a] < _group[b]; }
+                    return _rank[a] < _rank[b];
+                } // operator()
+
+
+private:
+
+                const std::vector<PetscInt>& _isTensor;
+                const std::vector<PetscInt>& _group;
+                const std::vector<PetscInt>& _rank;
+            }; // CellCompare
+
+            /// Comparison of keys for ordering.
+            class KeyCompare {
+public:
+
+                KeyCompare(const std::vector<unsigned long long>& keys) :
+                    _keys(keys) {}
+
+
+                bool operator()(const PetscInt a,
+                                const PetscInt b) const {
+                    return (_keys[a] != _keys[b]) ? _keys[a] < _keys[b] : a < b;
+                } // operator()
+
+
+private:
+
+                const std::vector<unsigned long long>& _keys;
+            }; // KeyCompare
+
+        }; // _MeshOrdering
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Reorder the local points of the mesh on each process.
+void
+pylith::topology::MeshOrdering::reorder(pylith::topology::Mesh* mesh,
+                                        const OrderingEnum ordering) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    PetscErrorCode err = 0;
+    PetscDM dmOrig = mesh->getDM();assert(dmOrig);
+
+    std::vector<PetscInt> cellRank;
+    switch (ordering) {
+    case RCM:
+        _MeshOrdering::computeRankRCM(&cellRank, dmOrig);
+        break;
+    case MORTON:
+        _MeshOrdering::computeRankSFC(&cellRank, dmOrig, SpaceFillingCurve::MORTON);
+        break;
+    case HILBERT:
+        _MeshOrdering::computeRankSFC(&cellRank, dmOrig, SpaceFillingCurve::HILBERT);
+        break;
+    default:
+        PYLITH_JOURNAL_LOGICERROR("Unknown mesh ordering '" << ordering << "'.");
+    } // switch
+
+    PetscIS permutation = NULL;
+    PetscDM dmNew = NULL;
+    _MeshOrdering::createPermutation(&permutation, dmOrig, cellRank);
+    err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+    _MeshOrdering::permutePointSF(dmNew, dmOrig, permutation);
+    err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+    err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmNew);
+
+    // Verify that all material points (cells) are consecutive.
+    pylith::topology::MeshOps::checkMaterialCellsConsecutive(*mesh);
+
+    PYLITH_METHOD_END;
+} // reorder
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute rank of each cell using reverse Cuthill-McKee ordering of the cell adjacency graph.
+void
+pylith::topology::_MeshOrdering::computeRankRCM(std::vector<PetscInt>* cellRank,
+                                                const PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(cellRank);
+
+    std::vector<PetscInt> offsets;
+    std::vector<PetscInt> adjacency;
+    getCellGraph(&offsets, &adjacency, dm);
+    const PetscInt numCells = offsets.size() - 1;
+
+    // Candidate starting cells sorted by degree.
+    std::vector<unsigned long long> degree(numCells);
+    std::vector<PetscInt> candidates(numCells);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        degree[i] = offsets[i+1] - offsets[i];
+        candidates[i] = i;
+    } // for
+    std::sort(candidates.begin(), candidates.end(), KeyCompare(degree));
+
+    std::vector<PetscInt> order;
+    order.reserve(numCells);
+    std::vector<PetscInt> level(numCells, -1);
+    std::vector<bool> isVisited(numCells, false);
+    std::vector<PetscInt> neighbors;
+    size_t iCandidate = 0;
+    while (order.size() < size_t(numCells)) {
+        while (isVisited[candidates[iCandidate]]) {
+            ++iCandidate;
+        } // while
+        PetscInt start = candidates[iCandidate];
+
+        // Find pseudo-peripheral starting cell: breadth-first search from the minimum degree cell
+        // and restart from the minimum degree cell in the last level.
+        std::vector<PetscInt> touched;
+        std::deque<PetscInt> queue;
+        queue.push_back(start);
+        level[start] = 0;
+        touched.push_back(start);
+        PetscInt maxLevel = 0;
+        while (!queue.empty()) {
+            const PetscInt cell = queue.front();queue.pop_front();
+            if ((level[cell] > maxLevel) || ((level[cell] == maxLevel) && (degree[cell] < degree[start]))) {
+                maxLevel = level[cell];
+                start = cell;
+            } // if
+            for (PetscInt i = offsets[cell]; i < offsets[cell+1]; ++i) {
+                const PetscInt neighbor = adjacency[i];
+                if ((level[neighbor] < 0) && !isVisited[neighbor]) {
+                    level[neighbor] = level[cell] + 1;
+                    touched.push_back(neighbor);
+                    queue.push_back(neighbor);
+                } // if
+            } // for
+        } // while
+        for (size_t i = 0; i < touched.size(); ++i) {
+            level[touched[i]] = -1;
+        } // for
+
+        // Cuthill-McKee ordering of connected component, visiting neighbors in order of increasing degree.
+        isVisited[start] = true;
+        queue.push_back(start);
+        while (!queue.empty()) {
+            const PetscInt cell = queue.front();queue.pop_front();
+            order.push_back(cell);
+            neighbors.clear();
+            for (PetscInt i = offsets[cell]; i < offsets[cell+1]; ++i) {
+                const PetscInt neighbor = adjacency[i];
+                if (!isVisited[neighbor]) {
+                    isVisited[neighbor] = true;
+                    neighbors.push_back(neighbor);
+                } // if
+            } // for
+            std::sort(neighbors.begin(), neighbors.end(), KeyCompare(degree));
+            queue.insert(queue.end(), neighbors.begin(), neighbors.end());
+        } // while
+    } // while
+    std::reverse(order.begin(), order.end());
+
+    cellRank->resize(numCells);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        (*cellRank)[order[i]] = i;
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeRankRCM
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute rank of each cell using space-filling curve through cell centroids.
+void
+pylith::topology::_MeshOrdering::computeRankSFC(std::vector<PetscInt>* cellRank,
+                                                const PetscDM dm,
+                                                const SpaceFillingCurve::CurveEnum curve) {
+    PYLITH_METHOD_BEGIN;
+    assert(cellRank);
+
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt numCells = cellsStratum.size();
+
+    const bool useGlobalBoundingBox = false;
+    std::vector<unsigned long long> keys;
+    SpaceFillingCurve::computeCellKeys(&keys, dm, cellsStratum.begin(), cellsStratum.end(), curve, useGlobalBoundingBox);
+
+    std::vector<PetscInt> order;
+    SpaceFillingCurve::sortKeys(&order, keys);
+
+    cellRank->resize(numCells);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        (*cellRank)[order[i]] = i;
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeRankSFC
+
+
+// ------------------------------------------------------------------------------------------------
+// Create permutation of points from the rank of each cell.
+void
+pylith::topology::_MeshOrdering::createPermutation(PetscIS* permutation,
+                                                   const PetscDM dm,
+                                                   const std::vector<PetscInt>& cellRank) {
+    PYLITH_METHOD_BEGIN;
+    assert(permutation);
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0, depth = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepth(dm, &depth);PYLITH_CHECK_ERROR(err);
+
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    const PetscInt numCells = cellsStratum.size();
+    assert(size_t(numCells) == cellRank.size());
+
+    // Order cells by (cohesive cells last, material label value, rank). Groups of cells with the
+    // same label value keep the order in which they first appear in the original numbering.
+    PetscDMLabel materialsLabel = NULL;
+    err = DMGetLabel(dm, pylith::topology::Mesh::cells_label_name, &materialsLabel);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> isTensor(numCells, 0);
+    std::vector<PetscInt> group(numCells, 0);
+    std::vector<PetscInt> cellOrder(numCells);
+    std::map<PetscInt, PetscInt> groupIndex;
+    for (PetscInt i = 0; i < numCells; ++i) {
+        PetscInt value = -1;
+        if (materialsLabel) {
+            err = DMLabelGetValue(materialsLabel, cStart+i, &value);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (groupIndex.find(value) == groupIndex.end()) {
+            const PetscInt index = groupIndex.size();
+            groupIndex[value] = index;
+        } // if
+        group[i] = groupIndex[value];
+        isTensor[i] = isTensorPoint(dm, cStart+i) ? 1 : 0;
+        cellOrder[i] = i;
+    } // for
+    std::sort(cellOrder.begin(), cellOrder.end(), CellCompare(isTensor, group, cellRank));
+
+    std::vector<PetscInt> perm(pEnd-pStart, -1);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        perm[cStart+cellOrder[i]-pStart] = cStart + i;
+    } // for
+
+    // Order points of lower dimension by first appearance in closure of the reordered cells,
+    // keeping tensor product (cohesive) points at the end of each stratum.
+    std::vector<std::vector<PetscInt> > pointsNormal(depth+1);
+    std::vector<std::vector<PetscInt> > pointsTensor(depth+1);
+    std::vector<bool> isSeen(pEnd-pStart, false);
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cStart + cellOrder[iCell];
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize*2; iPoint += 2) {
+            const PetscInt point = closure[iPoint];
+            if (((point >= cStart) && (point < cEnd)) || isSeen[point-pStart]) {
+                continue;
+            } // if
+            isSeen[point-pStart] = true;
+            PetscInt pointDepth = 0;
+            err = DMPlexGetPointDepth(dm, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+            if (isTensorPoint(dm, point)) {
+                pointsTensor[pointDepth].push_back(point);
+            } else {
+                pointsNormal[pointDepth].push_back(point);
+            } // if/else
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        PetscInt dStart = 0, dEnd = 0;
+        err = DMPlexGetDepthStratum(dm, iDepth, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+        if ((dStart == cStart) && (dEnd == cEnd)) {
+            continue;
+        } // if
+
+        // Points not in the closure of any cell retain their relative order.
+        for (PetscInt point = dStart; point < dEnd; ++point) {
+            if (!isSeen[point-pStart]) {
+                if (isTensorPoint(dm, point)) {
+                    pointsTensor[iDepth].push_back(point);
+                } else {
+                    pointsNormal[iDepth].push_back(point);
+                } // if/else
+            } // if
+        } // for
+
+        PetscInt newPoint = dStart;
+        for (size_t i = 0; i < pointsNormal[iDepth].size(); ++i, ++newPoint) {
+            perm[pointsNormal[iDepth][i]-pStart] = newPoint;
+        } // for
+        for (size_t i = 0; i < pointsTensor[iDepth].size(); ++i, ++newPoint) {
+            perm[pointsTensor[iDepth][i]-pStart] = newPoint;
+        } // for
+        assert(newPoint == dEnd);
+    } // for
+
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, &perm[0], PETSC_COPY_VALUES, permutation);PYLITH_CHECK_ERROR(err);
+    err = ISSetPermutation(*permutation);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createPermutation
+
+
+// ------------------------------------------------------------------------------------------------
+// Permute point SF to match new numbering of points.
+void
+pylith::topology::_MeshOrdering::permutePointSF(PetscDM dmNew,
+                                                const PetscDM dmOrig,
+                                                const PetscIS permutation) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscSF sfOrig = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leavesOrig = NULL;
+    const PetscSFNode* remoteOrig = NULL;
+    err = DMGetPointSF(dmOrig, &sfOrig);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfOrig, &numRoots, &numLeaves, &leavesOrig, &remoteOrig);PYLITH_CHECK_ERROR(err);
+    if (numRoots < 0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Get new numbering of remote roots.
+    const PetscInt* perm = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(0 == pStart && numRoots == pEnd);
+    std::vector<PetscInt> remoteNew(pEnd-pStart, -1);
+    err = ISGetIndices(permutation, &perm);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastBegin(sfOrig, MPIU_INT, perm, &remoteNew[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfOrig, MPIU_INT, perm, &remoteNew[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    // Leaves must be sorted by local point.
+    std::vector<PetscInt> leafOrder(numLeaves);
+    std::vector<unsigned long long> leafKeys(numLeaves);
+    for (PetscInt i = 0; i < numLeaves; ++i) {
+        const PetscInt leaf = leavesOrig ? leavesOrig[i] : i;
+        leafKeys[i] = perm[leaf];
+        leafOrder[i] = i;
+    } // for
+    std::sort(leafOrder.begin(), leafOrder.end(), KeyCompare(leafKeys));
+
+    PetscInt* leavesNew = NULL;
+    PetscSFNode* remoteNewNodes = NULL;
+    err = PetscMalloc1(numLeaves, &leavesNew);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numLeaves, &remoteNewNodes);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numLeaves; ++i) {
+        const PetscInt iOrig = leafOrder[i];
+        const PetscInt leaf = leavesOrig ? leavesOrig[iOrig] : iOrig;
+        leavesNew[i] = perm[leaf];
+        remoteNewNodes[i].rank = remoteOrig[iOrig].rank;
+        remoteNewNodes[i].index = remoteNew[leaf];
+    } // for
+    err = ISRestoreIndices(permutation, &perm);PYLITH_CHECK_ERROR(err);
+
+    PetscSF sfNew = NULL;
+    err = PetscSFCreate(PetscObjectComm((PetscObject) dmOrig), &sfNew);PYLITH_CHECK_ERROR(err);
+    err = PetscSFSetGraph(sfNew, numRoots, numLeaves, leavesNew, PETSC_OWN_POINTER, remoteNewNodes, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+    err = DMSetPointSF(dmNew, sfNew);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmCoord = NULL;
+    err = DMGetCoordinateDM(dmNew, &dmCoord);PYLITH_CHECK_ERROR(err);
+    if (dmCoord) {
+        err = DMSetPointSF(dmCoord, sfNew);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscSFDestroy(&sfNew);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // permutePointSF
+
+
+// ------------------------------------------------------------------------------------------------
+// Determine whether point is a tensor product (cohesive) point.
+bool
+pylith::topology::_MeshOrdering::isTensorPoint(const PetscDM dm,
+                                               const PetscInt point) {
+    DMPolytopeType ct;
+    PetscErrorCode err = DMPlexGetCellType(dm, point, &ct);PYLITH_CHECK_ERROR(err);
+    return (ct == DM_POLYTOPE_POINT_PRISM_TENSOR) ||
+           (ct == DM_POLYTOPE_SEG_PRISM_TENSOR) ||
+           (ct == DM_POLYTOPE_TRI_PRISM_TENSOR) ||
+           (ct == DM_POLYTOPE_QUAD_PRISM_TENSOR);
+} // isTensorPoint
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cell adjacency graph (cells sharing a face).
+void
+pylith::topology::_MeshOrdering::getCellGraph(std::vector<PetscInt>* offsets,
+                                              std::vector<PetscInt>* adjacency,
+                                              const PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(offsets);
+    assert(adjacency);
+
+    PetscErrorCode err = 0;
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    const PetscInt numCells = cellsStratum.size();
+
+    // Cells are adjacent if they share a point in their cones (faces in an interpolated mesh).
+    offsets->resize(numCells+1);
+    adjacency->clear();
+    (*offsets)[0] = 0;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0;
+        err = DMPlexGetConeSize(dm, cell, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dm, cell, &cone);PYLITH_CHECK_ERROR(err);
+        const size_t cellOffset = adjacency->size();
+        for (PetscInt iCone = 0; iCone < coneSize; ++iCone) {
+            const PetscInt* support = NULL;
+            PetscInt supportSize = 0;
+            err = DMPlexGetSupportSize(dm, cone[iCone], &supportSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetSupport(dm, cone[iCone], &support);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+                const PetscInt neighbor = support[iSupport];
+                if ((neighbor != cell) && (neighbor >= cStart) && (neighbor < cEnd) &&
+                    (std::find(adjacency->begin()+cellOffset, adjacency->end(), neighbor-cStart) == adjacency->end())) {
+                    adjacency->push_back(neighbor-cStart);
+                } // if
+            } // for
+        } // for
+        (*offsets)[cell-cStart+1] = adjacency->size();
+    } // for
+
+    PYLITH_METHOD_END;
+} // getCellGraph
+
+
+// End of file
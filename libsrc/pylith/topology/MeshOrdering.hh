@@ -0,0 +1,79 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/MeshOrdering.hh
+ *
+ * @brief Reorder the local points of a (possibly distributed) mesh on each process.
+ *
+ * In contrast to ReverseCuthillMcKee, which is applied to the serial mesh before distribution, the
+ * ordering here is computed independently on each process using only the local points, so it can
+ * be applied after distribution (including the overlap) to improve the locality of the local
+ * numbering. Cells are grouped by material label value and cohesive cells remain at the end of
+ * the cells, so all material cells remain consecutive.
+ */
+
+#if !defined(pylith_topology_meshordering_hh)
+#define pylith_topology_meshordering_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+// MeshOrdering ---------------------------------------------------------
+/// Reorder the local points of a mesh on each process.
+class pylith::topology::MeshOrdering {
+    friend class TestMeshOrdering; // unit testing
+
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Algorithm used to order the cells.
+    enum OrderingEnum {
+        RCM=0, ///< Reverse Cuthill-McKee ordering of the cell adjacency graph.
+        MORTON=1, ///< Morton (Z-order) space-filling curve through the cell centroids.
+        HILBERT=2, ///< Hilbert space-filling curve through the cell centroids.
+    }; // OrderingEnum
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Reorder the local points of the mesh on each process.
+     *
+     * The cells are ordered using the given algorithm and the points of lower dimension are
+     * ordered by their first appearance in the closure of the reordered cells. The point SF is
+     * updated to reflect the new local numbering.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] ordering Algorithm used to order the cells.
+     */
+    static
+    void reorder(pylith::topology::Mesh* mesh,
+                 const OrderingEnum ordering);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    MeshOrdering(void); ///< Not Implemented
+    MeshOrdering(const MeshOrdering&); ///< Not implemented
+    const MeshOrdering& operator=(const MeshOrdering&); ///< Not implemented
+
+}; // MeshOrdering
+
+#endif // pylith_topology_meshordering_hh
+
+// End of file
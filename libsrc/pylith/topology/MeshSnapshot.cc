@@ -0,0 +1,328 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshSnapshot.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+
+#include <string> // USES std::string
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _MeshSnapshot {
+public:
+
+            static const char* cellTypeLabelName; ///< Name of label with cell type of each point.
+            static const char* ownerLabelName; ///< Name of label with process owning each cell.
+            static const char* numProcsAttribute; ///< Name of attribute with number of processes.
+            static const char* dmNameAttribute; ///< Name of attribute with name of DM.
+
+            /** Remove label from DM and destroy it.
+             *
+             * @param[inout] dm PETSc DM for mesh.
+             * @param[in] name Name of label.
+             */
+            static
+            void removeLabel(PetscDM dm,
+                             const char* name);
+
+            /** Distribute cells to the processes given by the owner label.
+             *
+             * @param[inout] dm PETSc DM for mesh (replaced by distributed DM).
+             */
+            static
+            void restorePartition(PetscDM* dm);
+
+            /** Set cell types from cell type label.
+             *
+             * Cell types of tensor product (cohesive) points cannot be inferred from the topology,
+             * so we set them explicitly.
+             *
+             * @param[inout] dm PETSc DM for mesh.
+             */
+            static
+            void restoreCellTypes(PetscDM dm);
+
+        }; // _MeshSnapshot
+    } // topology
+} // pylith
+
+const char* pylith::topology::_MeshSnapshot::cellTypeLabelName = "pylith_snapshot_celltype";
+const char* pylith::topology::_MeshSnapshot::ownerLabelName = "pylith_snapshot_owner";
+const char* pylith::topology::_MeshSnapshot::numProcsAttribute = "pylith_snapshot_num_procs";
+const char* pylith::topology::_MeshSnapshot::dmNameAttribute = "pylith_snapshot_dm_name";
+
+// ------------------------------------------------------------------------------------------------
+// Write mesh to snapshot file.
+void
+pylith::topology::MeshSnapshot::write(const pylith::topology::Mesh& mesh,
+                                      const char* filename) {
+    PYLITH_METHOD_BEGIN;
+    assert(filename);
+
+    PetscErrorCode err = 0;
+    PetscDM dm = mesh.getDM();assert(dm);
+    PetscMPIInt commSizeMPI = 0;
+    err = MPI_Comm_size(mesh.getComm(), &commSizeMPI);PYLITH_CHECK_ERROR(err);
+    const PetscInt commSize = commSizeMPI;
+    const PetscInt commRank = mesh.getCommRank();
+
+    // Labels with cell type of each point and process owning each cell.
+    PetscDMLabel cellTypeLabel = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMCreateLabel(dm, _MeshSnapshot::cellTypeLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, _MeshSnapshot::cellTypeLabelName, &cellTypeLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dm, point, &ct);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetValue(cellTypeLabel, point, PetscInt(ct));PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PetscDMLabel ownerLabel = NULL;
+    err = DMCreateLabel(dm, _MeshSnapshot::ownerLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, _MeshSnapshot::ownerLabelName, &ownerLabel);PYLITH_CHECK_ERROR(err);
+    Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        err = DMLabelSetValue(ownerLabel, cell, commRank);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Depth and cell type labels are recomputed when loading the topology.
+    PetscBool depthOutput = PETSC_FALSE, cellTypeOutput = PETSC_FALSE;
+    err = DMGetLabelOutput(dm, "depth", &depthOutput);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabelOutput(dm, "celltype", &cellTypeOutput);PYLITH_CHECK_ERROR(err);
+    err = DMSetLabelOutput(dm, "depth", PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMSetLabelOutput(dm, "celltype", PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
+    const char* dmName = NULL;
+    err = PetscObjectGetName((PetscObject) dm, &dmName);PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(mesh.getComm(), filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMPlexTopologyView(dm, viewer);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCoordinatesView(dm, viewer);PYLITH_CHECK_ERROR(err);
+    err = DMPlexLabelsView(dm, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", _MeshSnapshot::numProcsAttribute, PETSC_INT, &commSize);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", _MeshSnapshot::dmNameAttribute, PETSC_STRING, dmName);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    err = DMSetLabelOutput(dm, "depth", depthOutput);PYLITH_CHECK_ERROR(err);
+    err = DMSetLabelOutput(dm, "celltype", cellTypeOutput);PYLITH_CHECK_ERROR(err);
+    _MeshSnapshot::removeLabel(dm, _MeshSnapshot::cellTypeLabelName);
+    _MeshSnapshot::removeLabel(dm, _MeshSnapshot::ownerLabelName);
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh from snapshot file.
+void
+pylith::topology::MeshSnapshot::read(pylith::topology::Mesh* mesh,
+                                     const char* filename,
+                                     pylith::faults::FaultCohesive* faults[],
+                                     const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    assert(filename);
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = mesh->getComm();
+    PetscMPIInt commSizeMPI = 0;
+    err = MPI_Comm_size(comm, &commSizeMPI);PYLITH_CHECK_ERROR(err);
+    const PetscInt commSize = commSizeMPI;
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numProcs = 0;
+    char* dmName = NULL;
+    err = PetscViewerHDF5ReadAttribute(viewer, "/", _MeshSnapshot::numProcsAttribute, PETSC_INT, NULL, &numProcs);PYLITH_CHECK_ERROR(err);
+    if (numProcs != commSize) {
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Mesh snapshot '" << filename << "' was written using " << numProcs << " processes, but the mesh is being read using "
+            << commSize << " processes.";
+        throw std::runtime_error(msg.str());
+    } // if
+    err = PetscViewerHDF5ReadAttribute(viewer, "/", _MeshSnapshot::dmNameAttribute, PETSC_STRING, NULL, &dmName);PYLITH_CHECK_ERROR(err);
+    const std::string name(dmName);
+    err = PetscFree(dmName);PYLITH_CHECK_ERROR(err);
+
+    // Topology must be loaded into a DM with the same name as the one that was viewed.
+    PetscDM dm = NULL;
+    PetscSF sfXC = NULL;
+    err = DMCreate(comm, &dm);PYLITH_CHECK_ERROR(err);
+    err = DMSetType(dm, DMPLEX);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) dm, name.c_str());PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMPlexTopologyLoad(dm, viewer, &sfXC);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCoordinatesLoad(dm, viewer, sfXC);PYLITH_CHECK_ERROR(err);
+    err = DMPlexLabelsLoad(dm, viewer, sfXC);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfXC);PYLITH_CHECK_ERROR(err);
+
+    if (commSize > 1) {
+        _MeshSnapshot::restorePartition(&dm);
+    } // if
+    _MeshSnapshot::removeLabel(dm, _MeshSnapshot::ownerLabelName);
+    _MeshSnapshot::restoreCellTypes(dm);
+    _MeshSnapshot::removeLabel(dm, _MeshSnapshot::cellTypeLabelName);
+
+    err = DMPlexDistributeSetDefault(dm, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMPlexReorderCohesiveSupports(dm);PYLITH_CHECK_ERROR(err);
+    err = DMViewFromOptions(dm, NULL, "-pylith_snapshot_dm_view");PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dm, name.c_str());
+
+    if ((commSize > 1) && (numFaults > 0)) {
+        Distributor::distributeOverlap(mesh, faults, numFaults);
+    } // if
+
+    PYLITH_METHOD_END;
+} // read
+
+
+// ------------------------------------------------------------------------------------------------
+// Remove label from DM and destroy it.
+void
+pylith::topology::_MeshSnapshot::removeLabel(PetscDM dm,
+                                             const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDMLabel label = NULL;
+    PetscErrorCode err = DMRemoveLabel(dm, name, &label);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // removeLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Distribute cells to the processes given by the owner label.
+void
+pylith::topology::_MeshSnapshot::restorePartition(PetscDM* dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    PetscErrorCode err = 0;
+    PetscDMLabel ownerLabel = NULL;
+    err = DMGetLabel(*dm, ownerLabelName, &ownerLabel);PYLITH_CHECK_ERROR(err);
+    if (!ownerLabel) {
+        throw std::runtime_error("Could not find label with owner of cells in mesh snapshot.");
+    } // if
+
+    // Partition label uses the process as the label value.
+    PetscDMLabel partitionLabel = NULL;
+    PetscIS valuesIS = NULL;
+    const PetscInt* values = NULL;
+    PetscInt numValues = 0;
+    err = DMLabelCreate(PETSC_COMM_SELF, "Point Partition", &partitionLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetValueIS(ownerLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        const PetscInt* points = NULL;
+        PetscInt numPoints = 0;
+        err = DMLabelGetStratumIS(ownerLabel, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            err = DMLabelSetValue(partitionLabel, points[iPoint], values[iValue]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    // Migrate points to owners (same steps as DMPlexDistribute() without partitioning).
+    PetscSF sfMigration = NULL, sfStratified = NULL, sfPoint = NULL;
+    err = DMPlexPartitionLabelClosure(*dm, partitionLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexPartitionLabelCreateSF(*dm, partitionLabel, &sfMigration);PYLITH_CHECK_ERROR(err);
+    err = DMPlexStratifyMigrationSF(*dm, sfMigration, &sfStratified);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfMigration);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&partitionLabel);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmDist = NULL;
+    const char* name = NULL;
+    err = PetscObjectGetName((PetscObject) *dm, &name);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreate(PetscObjectComm((PetscObject) *dm), &dmDist);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) dmDist, name);PYLITH_CHECK_ERROR(err);
+    err = DMPlexMigrate(*dm, sfStratified, dmDist);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreatePointSF(dmDist, sfStratified, PETSC_TRUE, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = DMSetPointSF(dmDist, sfPoint);PYLITH_CHECK_ERROR(err);
+    PetscDM dmCoord = NULL;
+    err = DMGetCoordinateDM(dmDist, &dmCoord);PYLITH_CHECK_ERROR(err);
+    if (dmCoord) {
+        err = DMSetPointSF(dmCoord, sfPoint);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscSFDestroy(&sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfStratified);PYLITH_CHECK_ERROR(err);
+
+    err = DMDestroy(dm);PYLITH_CHECK_ERROR(err);
+    *dm = dmDist;
+
+    PYLITH_METHOD_END;
+} // restorePartition
+
+
+// ------------------------------------------------------------------------------------------------
+// Set cell types from cell type label.
+void
+pylith::topology::_MeshSnapshot::restoreCellTypes(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscDMLabel cellTypeLabel = NULL;
+    err = DMGetLabel(dm, cellTypeLabelName, &cellTypeLabel);PYLITH_CHECK_ERROR(err);
+    if (!cellTypeLabel) {
+        throw std::runtime_error("Could not find label with cell types in mesh snapshot.");
+    } // if
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt value = -1;
+        err = DMLabelGetValue(cellTypeLabel, point, &value);PYLITH_CHECK_ERROR(err);
+        if (value < 0) {
+            std::ostringstream msg;
+            msg << "Missing cell type for point " << point << " in mesh snapshot.";
+            throw std::runtime_error(msg.str());
+        } // if
+        err = DMPlexSetCellType(dm, point, DMPolytopeType(value));PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // restoreCellTypes
+
+
+// End of file
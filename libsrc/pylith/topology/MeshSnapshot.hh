@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/MeshSnapshot.hh
+ *
+ * @brief Save and restore a distributed mesh (with cohesive cells) using PETSc HDF5 DMPlex storage.
+ *
+ * The snapshot holds the topology, coordinates, and labels of the mesh after reading, reordering,
+ * inserting cohesive cells, distributing, and refining, so repeated runs with the same mesh and
+ * configuration can skip these steps. The process owning each cell is stored with the mesh, so a
+ * snapshot loaded with the same number of processes has the same partition.
+ */
+
+#if !defined(pylith_topology_meshsnapshot_hh)
+#define pylith_topology_meshsnapshot_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/faults/faultsfwd.hh" // USES FaultCohesive
+
+// MeshSnapshot ---------------------------------------------------------
+/// Save and restore a distributed mesh.
+class pylith::topology::MeshSnapshot {
+    friend class TestMeshSnapshot; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Write mesh to snapshot file.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] filename Name of HDF5 file.
+     */
+    static
+    void write(const pylith::topology::Mesh& mesh,
+               const char* filename);
+
+    /** Read mesh from snapshot file.
+     *
+     * The mesh must be read with the number of processes used to write it. The overlap for the
+     * faults is added after restoring the partition.
+     *
+     * @param[inout] mesh Finite-element mesh (communicator and coordinate system must be set).
+     * @param[in] filename Name of HDF5 file.
+     * @param[in] faults Array of fault interfaces.
+     * @param[in] numFaults Number of fault interfaces.
+     */
+    static
+    void read(pylith::topology::Mesh* mesh,
+              const char* filename,
+              pylith::faults::FaultCohesive* faults[],
+              const int numFaults);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    MeshSnapshot(void); ///< Not Implemented
+    MeshSnapshot(const MeshSnapshot&); ///< Not implemented
+    const MeshSnapshot& operator=(const MeshSnapshot&); ///< Not implemented
+
+}; // MeshSnapshot
+
+#endif // pylith_topology_meshsnapshot_hh
+
+// End of file
@@ -28,6 +28,23 @@
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _RefineUniform {
+public:
+
+            /** Remove all non-cells from cells label.
+             *
+             * @param[in] dm PETSc DM for refined mesh.
+             */
+            static
+            void cleanCellsLabel(PetscDM dm);
+
+        }; // _RefineUniform
+    } // topology
+} // pylith
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::topology::RefineUniform::RefineUniform(void) {}
@@ -51,7 +68,8 @@ pylith::topology::RefineUniform::deallocate(void) {}
 void
 pylith::topology::RefineUniform::refine(Mesh* const newMesh,
                                         const Mesh& mesh,
-                                        const int levels) {
+                                        const int levels,
+                                        const bool keepHierarchy) {
     PYLITH_METHOD_BEGIN;
 
     if (levels < 1) {
@@ -78,25 +96,50 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     PetscDM dmNew = NULL;
     err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmOrig, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+    _RefineUniform::cleanCellsLabel(dmNew);
+    if (keepHierarchy) {
+        err = DMSetCoarseDM(dmNew, dmOrig);PYLITH_CHECK_ERROR(err);
+    } // if
 
     for (int i = 1; i < levels; ++i) {
         PetscDM dmCur = dmNew;dmNew = NULL;
         err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         err = DMRefine(dmCur, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+        _RefineUniform::cleanCellsLabel(dmNew);
+        if (keepHierarchy) {
+            // Finer level holds a reference to the coarser level.
+            err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
+        } // if
 
         err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
     } // for
 
     newMesh->setDM(dmNew);
 
-    // Remove all non-cells from cells label
+    // Check consistency
+    topology::MeshOps::checkTopology(*newMesh);
+
+    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
+
+    PYLITH_METHOD_END;
+} // refine
+
+
+// ----------------------------------------------------------------------
+// Remove all non-cells from cells label.
+void
+pylith::topology::_RefineUniform::cleanCellsLabel(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    PetscErrorCode err;
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
     PetscDMLabel matidLabel = NULL;
     PetscIS valuesIS = NULL;
     const PetscInt *values = NULL;
     PetscInt cStart, cEnd, labelNumValues;
-    err = DMPlexGetHeightStratum(dmNew, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMGetLabel(dmNew, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetNumValues(matidLabel, &labelNumValues);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetValueIS(matidLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
     err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
@@ -120,13 +163,8 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
 
-    // Check consistency
-    topology::MeshOps::checkTopology(*newMesh);
-
-    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
-
     PYLITH_METHOD_END;
-} // refine
+} // cleanCellsLabel
 
 
 // End of file
@@ -47,14 +47,20 @@ public :
   void deallocate(void);
 
   /** Refine mesh.
+   *
+   * If keepHierarchy is true, the original mesh and each intermediate level are retained as the
+   * coarse DM (DMGetCoarseDM()) of the next finer level, so that they can be used as the grid
+   * hierarchy for geometric multigrid.
    *
    * @param newMesh Refined mesh (result).
    * @param mesh Mesh to refine.
    * @param levels Number of levels to refine.
+   * @param keepHierarchy Retain coarse levels of mesh.
    */
   void refine(Mesh* const newMesh,
 	      const Mesh& mesh,
-	      const int levels =1);
+	      const int levels =1,
+	      const bool keepHierarchy =false);
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -0,0 +1,238 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_LOGICERROR
+
+#include <algorithm> // USES std::min, std::max, std::sort
+#include <limits> // USES std::numeric_limits
+#include <stdexcept> // USES std::logic_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _SpaceFillingCurve {
+public:
+
+            /// Comparison of keys for sorting.
+            class KeyCompare {
+public:
+
+                KeyCompare(const std::vector<unsigned long long>& keys) :
+                    _keys(keys) {}
+
+
+                bool operator()(const PetscInt a,
+                                const PetscInt b) const {
+                    return (_keys[a] != _keys[b]) ? _keys[a] < _keys[b] : a < b;
+                } // operator()
+
+
+private:
+
+                const std::vector<unsigned long long>& _keys;
+            }; // KeyCompare
+
+        }; // _SpaceFillingCurve
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Compute keys along space-filling curve for cell centroids.
+void
+pylith::topology::SpaceFillingCurve::computeCellKeys(std::vector<unsigned long long>* keys,
+                                                     const PetscDM dm,
+                                                     const PetscInt cStart,
+                                                     const PetscInt cEnd,
+                                                     const CurveEnum curve,
+                                                     const bool useGlobalBoundingBox) {
+    PYLITH_METHOD_BEGIN;
+    assert(keys);
+    assert(cEnd >= cStart);
+
+    PetscErrorCode err = 0;
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dm, &spaceDim);PYLITH_CHECK_ERROR(err);
+    assert(spaceDim > 0 && spaceDim <= 3);
+    const PetscInt numCells = cEnd - cStart;
+
+    // Compute centroids of cells (average of vertex coordinates) and bounding box.
+    scalar_array centroids(numCells*spaceDim);
+    scalar_array coordsMin(std::numeric_limits<PylithScalar>::max(), spaceDim);
+    scalar_array coordsMax(-std::numeric_limits<PylithScalar>::max(), spaceDim);
+    scalar_array coordsCell;
+    CoordsVisitor coordsVisitor(dm);
+    for (PetscInt i = 0; i < numCells; ++i) {
+        coordsVisitor.getClosure(&coordsCell, cStart+i);
+        const size_t numVertices = coordsCell.size() / spaceDim;assert(numVertices > 0);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            PylithScalar value = 0.0;
+            for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+                value += coordsCell[iVertex*spaceDim+iDim];
+            } // for
+            value /= numVertices;
+            centroids[i*spaceDim+iDim] = value;
+            coordsMin[iDim] = std::min(coordsMin[iDim], value);
+            coordsMax[iDim] = std::max(coordsMax[iDim], value);
+        } // for
+    } // for
+    if (useGlobalBoundingBox) {
+        MPI_Comm comm = PetscObjectComm((PetscObject) dm);
+        scalar_array coordsLocal(coordsMin);
+        err = MPI_Allreduce(&coordsLocal[0], &coordsMin[0], spaceDim, MPIU_SCALAR, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+        coordsLocal = coordsMax;
+        err = MPI_Allreduce(&coordsLocal[0], &coordsMax[0], spaceDim, MPIU_SCALAR, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Map centroids to integer coordinates using the same scale in all directions.
+    const int numBits = getNumBits(spaceDim);
+    const unsigned long long maxCoord = (1ULL << numBits) - 1;
+    PylithScalar extent = 0.0;
+    for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+        extent = std::max(extent, coordsMax[iDim] - coordsMin[iDim]);
+    } // for
+    const PylithScalar scale = (extent > 0.0) ? PylithScalar(maxCoord) / extent : 0.0;
+
+    keys->resize(numCells);
+    unsigned long long coordsInt[3];
+    for (PetscInt i = 0; i < numCells; ++i) {
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithScalar value = (centroids[i*spaceDim+iDim] - coordsMin[iDim]) * scale;
+            coordsInt[iDim] = std::min(maxCoord, (unsigned long long)(std::max(PylithScalar(0.0), value)));
+        } // for
+        switch (curve) {
+        case MORTON:
+            (*keys)[i] = mortonKey(coordsInt, spaceDim, numBits);
+            break;
+        case HILBERT:
+            (*keys)[i] = hilbertKey(coordsInt, spaceDim, numBits);
+            break;
+        default:
+            PYLITH_JOURNAL_LOGICERROR("Unknown space-filling curve '" << curve << "'.");
+        } // switch
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeCellKeys
+
+
+// ------------------------------------------------------------------------------------------------
+// Get indices that sort keys in ascending order.
+void
+pylith::topology::SpaceFillingCurve::sortKeys(std::vector<PetscInt>* order,
+                                              const std::vector<unsigned long long>& keys) {
+    assert(order);
+
+    const size_t numKeys = keys.size();
+    order->resize(numKeys);
+    for (size_t i = 0; i < numKeys; ++i) {
+        (*order)[i] = i;
+    } // for
+    std::sort(order->begin(), order->end(), _SpaceFillingCurve::KeyCompare(keys));
+} // sortKeys
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bits per coordinate for keys.
+int
+pylith::topology::SpaceFillingCurve::getNumBits(const int spaceDim) {
+    switch (spaceDim) {
+    case 1:
+        return 52;
+    case 2:
+        return 31;
+    case 3:
+        return 21;
+    default:
+        PYLITH_JOURNAL_LOGICERROR("Unknown spatial dimension '" << spaceDim << "'.");
+    } // switch
+    return 0;
+} // getNumBits
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute Morton key for integer coordinates.
+unsigned long long
+pylith::topology::SpaceFillingCurve::mortonKey(const unsigned long long coords[],
+                                               const int dim,
+                                               const int numBits) {
+    unsigned long long key = 0;
+    for (int iBit = numBits-1; iBit >= 0; --iBit) {
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            key = (key << 1) | ((coords[iDim] >> iBit) & 1ULL);
+        } // for
+    } // for
+    return key;
+} // mortonKey
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute Hilbert key for integer coordinates.
+unsigned long long
+pylith::topology::SpaceFillingCurve::hilbertKey(const unsigned long long coords[],
+                                                const int dim,
+                                                const int numBits) {
+    assert(dim <= 3);
+    unsigned long long x[3];
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        x[iDim] = coords[iDim];
+    } // for
+
+    // Inverse undo excess work.
+    const unsigned long long m = 1ULL << (numBits-1);
+    for (unsigned long long q = m; q > 1; q >>= 1) {
+        const unsigned long long p = q - 1;
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            if (x[iDim] & q) {
+                x[0] ^= p; // invert
+            } else {
+                const unsigned long long t = (x[0] ^ x[iDim]) & p; // exchange
+                x[0] ^= t;
+                x[iDim] ^= t;
+            } // if/else
+        } // for
+    } // for
+
+    // Gray encode.
+    for (int iDim = 1; iDim < dim; ++iDim) {
+        x[iDim] ^= x[iDim-1];
+    } // for
+    unsigned long long t = 0;
+    for (unsigned long long q = m; q > 1; q >>= 1) {
+        if (x[dim-1] & q) {
+            t ^= q - 1;
+        } // if
+    } // for
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        x[iDim] ^= t;
+    } // for
+
+    // Transposed form interleaves into key the same way as the Morton key.
+    return mortonKey(x, dim, numBits);
+} // hilbertKey
+
+
+// End of file
@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Morton (Z-order) and Hilbert space-filling curve keys for cells.
+ *
+ * The keys are used to order cells within a process (MeshOrdering) and to partition cells among
+ * processes (Distributor).
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+#include <vector> // USES std::vector
+
+// SpaceFillingCurve ----------------------------------------------------
+/// Space-filling curve keys for cells.
+class pylith::topology::SpaceFillingCurve {
+    friend class TestSpaceFillingCurve; // unit testing
+
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Type of space-filling curve.
+    enum CurveEnum {
+        MORTON=0, ///< Morton (Z-order) curve.
+        HILBERT=1, ///< Hilbert curve.
+    }; // CurveEnum
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Compute keys along space-filling curve for cell centroids.
+     *
+     * The centroid of each cell is the average of the coordinates of its vertices. Centroids are
+     * mapped to integer coordinates using the same scale in all directions so that the bounding
+     * box fits within the curve.
+     *
+     * @param[out] keys Key for each cell in [cStart, cEnd).
+     * @param[in] dm PETSc DM for mesh.
+     * @param[in] cStart First cell.
+     * @param[in] cEnd One past the last cell.
+     * @param[in] curve Type of space-filling curve.
+     * @param[in] useGlobalBoundingBox Use bounding box over all processes (true) or local cells (false).
+     */
+    static
+    void computeCellKeys(std::vector<unsigned long long>* keys,
+                         const PetscDM dm,
+                         const PetscInt cStart,
+                         const PetscInt cEnd,
+                         const CurveEnum curve,
+                         const bool useGlobalBoundingBox);
+
+    /** Get indices that sort keys in ascending order (ties are ordered by index).
+     *
+     * @param[out] order Indices of keys in sorted order.
+     * @param[in] keys Keys to sort.
+     */
+    static
+    void sortKeys(std::vector<PetscInt>* order,
+                  const std::vector<unsigned long long>& keys);
+
+    /** Get number of bits per coordinate for keys.
+     *
+     * @param[in] spaceDim Dimension of coordinate system.
+     * @returns Number of bits per coordinate.
+     */
+    static
+    int getNumBits(const int spaceDim);
+
+    /** Compute Morton key for integer coordinates.
+     *
+     * @param[in] coords Integer coordinates (length dim).
+     * @param[in] dim Number of coordinates.
+     * @param[in] numBits Number of bits per coordinate.
+     * @returns Key.
+     */
+    static
+    unsigned long long mortonKey(const unsigned long long coords[],
+                                 const int dim,
+                                 const int numBits);
+
+    /** Compute Hilbert key for integer coordinates.
+     *
+     * Uses the transpose algorithm in Skilling (2004), Programming the Hilbert curve, AIP
+     * Conference Proceedings 707, 381-387.
+     *
+     * @param[in] coords Integer coordinates (length dim).
+     * @param[in] dim Number of coordinates.
+     * @param[in] numBits Number of bits per coordinate.
+     * @returns Key.
+     */
+    static
+    unsigned long long hilbertKey(const unsigned long long coords[],
+                                  const int dim,
+                                  const int numBits);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    SpaceFillingCurve(void); ///< Not Implemented
+    SpaceFillingCurve(const SpaceFillingCurve&); ///< Not implemented
+    const SpaceFillingCurve& operator=(const SpaceFillingCurve&); ///< Not implemented
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+// End of file
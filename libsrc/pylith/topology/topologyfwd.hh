@@ -54,6 +54,9 @@ namespace pylith {
         class Distributor;
         class RefineUniform;
         class ReverseCuthillMcKee;
+        class MeshOrdering;
+        class MeshSnapshot;
+        class SpaceFillingCurve;
 
     } // topology
 } // pylith
@@ -22,10 +22,26 @@
 
 #include "error.hh" // USES PYLITH_METHOD_BEGIN/END
 
+#include <set> // USES std::set
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
 
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _EventLogger {
+public:
+
+            /// Identifiers of stages registered by any EventLogger (PETSc stages are global).
+            static std::set<int> stages;
+
+        }; // _EventLogger
+    } // utils
+} // pylith
+
+std::set<int> pylith::utils::_EventLogger::stages;
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::EventLogger::EventLogger(void) :
@@ -97,6 +113,56 @@ pylith::utils::EventLogger::getEventId(const char* name) {
 } // getEventId
 
 
+// ----------------------------------------------------------------------
+// Get performance information for event summed over all stages on this process.
+void
+pylith::utils::EventLogger::getEventPerfInfo(int* count,
+                                             double* time,
+                                             double* flops,
+                                             const int id) {
+    PYLITH_METHOD_BEGIN;
+    assert(count);
+    assert(time);
+    assert(flops);
+
+    *count = 0;
+    *time = 0.0;
+    *flops = 0.0;
+
+    // Use the public logging interface: the PETSc main stage plus the stages registered through
+    // EventLogger.
+    PetscErrorCode err = 0;
+    std::set<int> stages(_EventLogger::stages);
+    PetscLogStage mainStage = -1;
+    err = PetscLogStageGetId("Main Stage", &mainStage);PYLITH_CHECK_ERROR(err);
+    if (mainStage >= 0) {
+        stages.insert(mainStage);
+    } // if
+    for (std::set<int>::const_iterator iter = stages.begin(); iter != stages.end(); ++iter) {
+        PetscEventPerfInfo info;
+        err = PetscLogEventGetPerfInfo(*iter, id, &info);PYLITH_CHECK_ERROR(err);
+        *count += info.count;
+        *time += info.time;
+        *flops += info.flops;
+    } // for
+
+    PYLITH_METHOD_END;
+} // getEventPerfInfo
+
+
+// ----------------------------------------------------------------------
+// Check whether PETSc logging of events is active.
+bool
+pylith::utils::EventLogger::isLoggingActive(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscBool isActive = PETSC_FALSE;
+    PetscErrorCode err = PetscLogIsActive(&isActive);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(bool(isActive));
+} // isLoggingActive
+
+
 // ----------------------------------------------------------------------
 // Register stage.
 int
@@ -104,14 +170,19 @@ pylith::utils::EventLogger::registerStage(const char* name) {
     PYLITH_METHOD_BEGIN;
 
     assert(_classId);
-    int id = 0;
-    PetscErrorCode err = PetscLogStageRegister(name, &id);
+    // Stages are global, so reuse a stage registered with the same name by another logger.
+    int id = -1;
+    PetscErrorCode err = PetscLogStageGetId(name, &id);
+    if (!err && (id < 0)) {
+        err = PetscLogStageRegister(name, &id);
+    } // if
     if (err) {
         std::ostringstream msg;
         msg << "Could not register logging stage '" << name << "'.";
         throw std::runtime_error(msg.str());
     } // if
     _stages[name] = id;
+    _EventLogger::stages.insert(id);
 
     PYLITH_METHOD_RETURN(id);
 } // registerStage
@@ -96,7 +96,37 @@ public:
      */
     void eventEnd(const int id);
 
+    /** Get events registered for logging class.
+     *
+     * @returns Map of event names to event identifiers.
+     */
+    const std::map<std::string,int>& getEvents(void) const;
+
+    /** Get performance information for event summed over all stages on this process.
+     *
+     * @prerequisite PETSc logging must be active (for example, -log_view).
+     *
+     * @param[out] count Number of times event was logged.
+     * @param[out] time Time (s) spent in event.
+     * @param[out] flops Number of floating point operations in event.
+     * @param[in] id Event identifier.
+     */
+    static
+    void getEventPerfInfo(int* count,
+                          double* time,
+                          double* flops,
+                          const int id);
+
+    /** Check whether PETSc logging of events is active.
+     *
+     * @returns True if PETSc logging is active, false otherwise.
+     */
+    static
+    bool isLoggingActive(void);
+
     /** Register stage.
+     *
+     * If a stage with the same name has already been registered, its identifier is used.
      *
      * @prerequisite Must call initialize() before registerStage().
      *
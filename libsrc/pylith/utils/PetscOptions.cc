@@ -85,6 +85,15 @@ public:
             static
             void addInitialGuess(PetscOptions* options);
 
+            /** Replace default solver with one for a symmetric positive definite Jacobian.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] isParallel True if running in parallel, false otherwise.
+             */
+            static
+            void addSolverSPD(PetscOptions* options,
+                              const bool isParallel);
+
         };
     }
 }
@@ -102,7 +111,8 @@ const int pylith::utils::PetscDefaults::TESTING = 0x10;
 void
 pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
                                   const pylith::materials::Material* material,
-                                  const int flags) {
+                                  const int flags,
+                                  const bool isJacobianSPD) {
     PYLITH_METHOD_BEGIN;
     assert(material);
 
@@ -111,8 +121,8 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
     } // if
 
     PetscOptions* options = NULL;
+    const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
     if (flags & SOLVER) {
-        const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
         const bool hasFault = _PetscOptions::hasFault(solution);
         options = material->getSolverDefaults(isParallel, hasFault);
     } // if
@@ -121,6 +131,9 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
     } // if
     assert(options);
 
+    if ((flags & SOLVER) && isJacobianSPD) {
+        _PetscOptions::addSolverSPD(options, isParallel);
+    } // if
     _PetscOptions::addSolverTolerances(options);
     if (flags & INITIAL_GUESS) {
         _PetscOptions::addInitialGuess(options);
@@ -342,4 +355,23 @@ pylith::utils::_PetscOptions::addInitialGuess(PetscOptions* options) {
 } // addInitialGuess
 
 
+// ------------------------------------------------------------------------------------------------
+// Replace default solver with one for a symmetric positive definite Jacobian.
+void
+pylith::utils::_PetscOptions::addSolverSPD(PetscOptions* options,
+                                           const bool isParallel) {
+    assert(options);
+
+    options->add("-ksp_type", "cg");
+    if (!isParallel) {
+        options->add("-pc_type", "cholesky");
+    } else {
+        options->add("-pc_type", "gamg");
+        options->add("-mg_levels_ksp_type", "chebyshev");
+        options->add("-mg_levels_pc_type", "jacobi");
+    } // if/else
+
+} // addSolverSPD
+
+
 // End of file
@@ -51,11 +51,13 @@ public:
      * @param[in] solution Solution field for problem.
      * @param[in] material Solution field.
      * @param[in] flags Flags for turning on defaults for PETSc options.
+     * @param[in] isJacobianSPD True if Jacobian is symmetric positive definite.
      */
     static
     void set(const pylith::topology::Field& solution,
              const pylith::materials::Material* material,
-             const int flags);
+             const int flags,
+             const bool isJacobianSPD=false);
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
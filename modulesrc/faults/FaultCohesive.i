@@ -127,6 +127,20 @@ public:
              */
             void adjustTopology(pylith::topology::Mesh* const mesh);
 
+            /** Adjust mesh topology for multiple faults.
+             *
+             * Consecutive faults that do not share any cells are grouped together, and the cohesive cells
+             * for each group are created in a single pass.
+             *
+             * @param mesh[in] PETSc mesh.
+             * @param faults[in] Array of faults.
+             * @param numFaults[in] Number of faults.
+             */
+            static
+            void adjustTopologyMultiple(pylith::topology::Mesh* const mesh,
+                                        pylith::faults::FaultCohesive* faults[],
+                                        const int numFaults);
+
             /** Create integrator and set kernels.
              *
              * @param[in] solution Solution field.
@@ -44,6 +44,7 @@
 %include "../include/scalartypemaps.i"
 %include "../include/chararray.i"
 %include "../include/kinsrcarray.i"
+%include "../include/physicsarray.i"
 
 // Numpy interface stuff
 %{
@@ -110,6 +110,14 @@ public:
             void addKernelsUpdateStateVars(std::vector<pylith::feassemble::IntegratorDomain::ProjectKernels>* kernels,
                                            const spatialdata::geocoords::CoordSys* coordsys) const;
 
+            /** Add kernels for updating auxiliary subfields that depend on the time step.
+             *
+             * @param[inout] kernels Array of kernels for updating time step dependent subfields.
+             * @param[in] coordsys Coordinate system.
+             */
+            void addKernelsUpdateTimeStepVars(std::vector<pylith::feassemble::IntegratorDomain::ProjectKernels>* kernels,
+                                              const spatialdata::geocoords::CoordSys* coordsys) const;
+
             /** Update kernel constants.
              *
              * @param[inout] kernelConstants Array of constants used in integration kernels.
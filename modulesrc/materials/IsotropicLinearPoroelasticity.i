@@ -90,6 +90,7 @@ public:
    * @return RHS residual kernel for Darcy velocity.
    */
    PetscPointFunc getKernelg1p_explicit(const spatialdata::geocoords::CoordSys* coordsys,
+                                          const bool _useBodyForce,
                                           const bool _gravityField) const;
 
    // ---------------------------------------------------------------------------------------------------------------------
@@ -58,6 +58,18 @@ public:
              */
             void setGravityField(spatialdata::spatialdb::GravityField* const g);
 
+            /** Use basis order 0 for auxiliary subfields (material properties) from a uniform spatial database.
+             *
+             * @param[in] value True to use basis order 0 for read-only auxiliary subfields from a uniform spatial database.
+             */
+            void useCompactUniformAuxiliary(const bool value);
+
+            /** Use basis order 0 for auxiliary subfields (material properties) from a uniform spatial database?
+             *
+             * @returns True if using basis order 0 for read-only auxiliary subfields from a uniform spatial database.
+             */
+            bool useCompactUniformAuxiliary(void) const;
+
             /** Create constraint and set kernels.
              *
              * @param[in] solution Solution field.
@@ -72,6 +72,18 @@ public:
              */
             bool useStateVars(void) const;
 
+            /** Use fixed-stress split preconditioner?
+             *
+             * @param[in] value Flag indicating to use the fixed-stress split preconditioner.
+             */
+            void useFixedStressSplit(const bool value);
+
+            /** Use fixed-stress split preconditioner?
+             *
+             * @returns True if using the fixed-stress split preconditioner, false otherwise.
+             */
+            bool useFixedStressSplit(void) const;
+
             /** Set bulk rheology.
              *
              * @param[in] rheology Bulk rheology for poroelasticity.
@@ -66,6 +66,7 @@ public:
      */
      virtual
      PetscPointFunc getKernelg1p_explicit(const spatialdata::geocoords::CoordSys* coordsys,
+                                            const bool _useBodyForce,
                                             const bool _gravityField) const = 0;
 
      // ============================= LHS ==================================== //
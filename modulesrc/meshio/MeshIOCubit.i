@@ -56,6 +56,18 @@ public:
              */
             void setUseNodesetNames(const bool flag);
 
+            /** Set flag on whether every process reads a portion of the mesh.
+             *
+             * @param flag True to read the mesh in parallel.
+             */
+            void setUseParallelRead(const bool flag);
+
+            /** Get flag on whether every process reads a portion of the mesh.
+             *
+             * @returns True if reading mesh in parallel, false otherwise.
+             */
+            bool getUseParallelRead(void) const;
+
             // PROTECTED METHODS ////////////////////////////////////////////////////
 protected:
 
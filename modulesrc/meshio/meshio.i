@@ -34,6 +34,7 @@
 #include "pylith/meshio/OutputTriggerTime.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterVTU.hh"
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
@@ -88,6 +89,7 @@ import_array();
 %include "OutputTriggerTime.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterVTU.i"
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
@@ -62,6 +62,20 @@ public:
              */
             int getFaultLabelValue(void) const;
 
+            /** Set maximum number of previous Green's functions in projection basis for initial guess.
+             *
+             * Only used with the linear solver.
+             *
+             * @param[in] value Maximum number of vectors in basis (0 to disable).
+             */
+            void setProjectionBasisSize(const int value);
+
+            /** Get maximum number of previous Green's functions in projection basis for initial guess.
+             *
+             * @returns Maximum number of vectors in basis.
+             */
+            int getProjectionBasisSize(void) const;
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for Green's functions simulation.
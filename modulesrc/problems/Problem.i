@@ -69,6 +69,18 @@ public:
              */
             SolverTypeEnum getSolverType(void) const;
 
+            /** Set PETSc matrix type for Jacobian.
+             *
+             * @param[in] value Name of PETSc matrix type (default, aij, baij, or sbaij).
+             */
+            void setMatrixType(const char* value);
+
+            /** Get PETSc matrix type for Jacobian.
+             *
+             * @returns Name of PETSc matrix type.
+             */
+            const char* getMatrixType(void) const;
+
             /** Specify which default PETSc options to use.
              *
              * @param[in] flags Flags indicating which default PETSc options to set.
@@ -146,6 +158,13 @@ public:
             virtual
             void initialize(void);
 
+            /** Finalize problem.
+             *
+             * If PETSc logging is active, write a summary of the performance of each physics
+             * implementation to the info journal.
+             */
+            void finalize(void);
+
         }; // Problem
 
     } // problems
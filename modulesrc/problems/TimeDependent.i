@@ -101,6 +101,21 @@ public:
              */
             void setShouldNotifyIC(const bool value);
 
+            /** Use local (multirate) time stepping with explicit time stepping.
+             *
+             * Cells are grouped into rate classes based on their stable time step. Degrees of freedom in
+             * cells with the smallest stable time steps are advanced with substeps of the time step.
+             *
+             * @param[in] value True if using local time stepping, false otherwise.
+             */
+            void useLocalTimeStepping(const bool value);
+
+            /** Use local (multirate) time stepping with explicit time stepping?
+             *
+             * @returns True if using local time stepping, false otherwise.
+             */
+            bool useLocalTimeStepping(void) const;
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -33,6 +33,35 @@
 			    const spatialdata::units::Nondimensional& normalizer) {
     pylith::topology::MeshOps::nondimensionalize(mesh, normalizer);
   } // nondimensionalize
+
+  /** Set level of checks of mesh topology.
+   *
+   * @param value Level of checks ('none', 'basic', 'local', or 'full').
+   */
+  void
+  MeshOps_setCheckTopologyLevel(const char* value) {
+    const std::string level(value);
+    if (level == "none") {
+      pylith::topology::MeshOps::setCheckTopologyLevel(pylith::topology::MeshOps::CHECK_TOPOLOGY_NONE);
+    } else if (level == "basic") {
+      pylith::topology::MeshOps::setCheckTopologyLevel(pylith::topology::MeshOps::CHECK_TOPOLOGY_BASIC);
+    } else if (level == "local") {
+      pylith::topology::MeshOps::setCheckTopologyLevel(pylith::topology::MeshOps::CHECK_TOPOLOGY_LOCAL);
+    } else if (level == "full") {
+      pylith::topology::MeshOps::setCheckTopologyLevel(pylith::topology::MeshOps::CHECK_TOPOLOGY_FULL);
+    } else {
+      throw std::invalid_argument("Unknown level of checks of mesh topology '" + level + "'.");
+    } // if/else
+  } // setCheckTopologyLevel
+
+  /** Check topology of mesh using the current level of checks.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void
+  MeshOps_checkTopology(const pylith::topology::Mesh& mesh) {
+    pylith::topology::MeshOps::checkTopology(mesh);
+  } // checkTopology
 %}
 
 // End of file
@@ -0,0 +1,56 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/MeshOrdering.i
+ *
+ * @brief Python interface to C++ PyLith MeshOrdering object.
+ */
+
+namespace pylith {
+    namespace topology {
+        // MeshOrdering ----------------------------------------------
+        class MeshOrdering {
+            // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Algorithm used to order the cells.
+            enum OrderingEnum {
+                RCM=0, ///< Reverse Cuthill-McKee ordering of the cell adjacency graph.
+                MORTON=1, ///< Morton (Z-order) space-filling curve through the cell centroids.
+                HILBERT=2, ///< Hilbert space-filling curve through the cell centroids.
+            }; // OrderingEnum
+
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /** Reorder the local points of the mesh on each process.
+             *
+             * @param[inout] mesh PyLith finite-element mesh.
+             * @param[in] ordering Algorithm used to order the cells.
+             */
+            static
+            void reorder(pylith::topology::Mesh* mesh,
+                         const OrderingEnum ordering);
+
+        }; // MeshOrdering
+
+    } // topology
+} // pylith
+
+// End of file
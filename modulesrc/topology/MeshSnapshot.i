@@ -0,0 +1,59 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/MeshSnapshot.i
+ *
+ * @brief Python interface to C++ PyLith MeshSnapshot object.
+ */
+
+namespace pylith {
+    namespace topology {
+        // MeshSnapshot ----------------------------------------------
+        class MeshSnapshot {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /** Write mesh to snapshot file.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] filename Name of HDF5 file.
+             */
+            static
+            void write(const pylith::topology::Mesh& mesh,
+                       const char* filename);
+
+            /** Read mesh from snapshot file.
+             *
+             * @param[inout] mesh Finite-element mesh (communicator and coordinate system must be set).
+             * @param[in] filename Name of HDF5 file.
+             * @param[in] faults Array of fault interfaces.
+             * @param[in] numFaults Number of fault interfaces.
+             */
+            static
+            void read(pylith::topology::Mesh* mesh,
+                      const char* filename,
+                      pylith::faults::FaultCohesive* faults[],
+                      const int numFaults);
+
+        }; // MeshSnapshot
+
+    } // topology
+} // pylith
+
+// End of file
@@ -43,10 +43,12 @@ namespace pylith {
        * @param newMesh Refined mesh (result).
        * @param mesh Mesh to refine.
        * @param levels Number of levels to refine.
+       * @param keepHierarchy Retain coarse levels of mesh.
        */
       void refine(Mesh* const newMesh,
 		  const Mesh& mesh,
-		  const int levels =1);
+		  const int levels =1,
+		  const bool keepHierarchy =false);
 
     }; // RefineUniform
 
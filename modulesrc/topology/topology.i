@@ -28,6 +28,10 @@
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+#include "pylith/topology/MeshOrdering.hh"
+#include "pylith/topology/MeshSnapshot.hh"
+
+#include <stdexcept> // USES std::invalid_argument
 %}
 
 %include "exception.i"
@@ -61,6 +65,8 @@ import_array();
 %include "Distributor.i"
 %include "RefineUniform.i"
 %include "ReverseCuthillMcKee.i"
+%include "MeshOrdering.i"
+%include "MeshSnapshot.i"
 
 // End of file
 
@@ -41,6 +41,9 @@ class Material(Physics, ModuleMaterial):
     labelValue = pythia.pyre.inventory.int("label_value", default=1)
     labelValue.meta["tip"] = "Value of label for material."
 
+    compactUniformAux = pythia.pyre.inventory.bool("compact_uniform_auxiliary_subfields", default=False)
+    compactUniformAux.meta["tip"] = "Use basis order 0 for material properties from a uniform spatial database (overrides basis_order)."
+
     def __init__(self, name="material"):
         """Constructor.
         """
@@ -53,6 +56,7 @@ class Material(Physics, ModuleMaterial):
         ModuleMaterial.setDescription(self, self.description)
         ModuleMaterial.setLabelName(self, self.labelName)
         ModuleMaterial.setLabelValue(self, self.labelValue)
+        ModuleMaterial.useCompactUniformAuxiliary(self, self.compactUniformAux)
 
 
 # End of file
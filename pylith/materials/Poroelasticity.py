@@ -51,6 +51,9 @@ class Poroelasticity(Material, ModulePoroelasticity):
     useStateVars = pythia.pyre.inventory.bool("use_state_variables", default=False)
     useStateVars.meta['tip'] = "Update porosity state variable using compaction formulation."
 
+    useFixedStressSplit = pythia.pyre.inventory.bool("use_fixed_stress_split", default=False)
+    useFixedStressSplit.meta['tip'] = "Use fixed-stress split preconditioner (quasistatic formulation)."
+
     rheology = pythia.pyre.inventory.facility("bulk_rheology", family="poroelasticity_rheology", factory=IsotropicLinearPoroelasticity)
     rheology.meta['tip'] = "Bulk rheology for poroelastic material."
 
@@ -76,7 +79,8 @@ class Poroelasticity(Material, ModulePoroelasticity):
 
         ModulePoroelasticity.useBodyForce(self, self.useBodyForce)
         ModulePoroelasticity.useSourceDensity(self, self.useSourceDensity)
-        ModulePoroelasticity.useStateVars(self, self.useStateVars)        
+        ModulePoroelasticity.useStateVars(self, self.useStateVars)
+        ModulePoroelasticity.useFixedStressSplit(self, self.useFixedStressSplit)
 
     def _createModuleObj(self):
         """Create handle to C++ Poroelasticity.
@@ -0,0 +1,88 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterVTU as ModuleDataWriterVTU
+
+
+class DataWriterVTU(DataWriter, ModuleDataWriterVTU):
+    """
+    Writer of solution, auxiliary, and derived subfields to partitioned binary VTK XML files.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [data_writer]
+            filename = domain_solution.vtu
+            time_format = %0.2f
+            time_constant = 1.0*year
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of VTK file (.vtu)."
+
+    timeFormat = pythia.pyre.inventory.str("time_format", default="%f")
+    timeFormat.meta['tip'] = "C style format string for time stamp in filename."
+
+    from pythia.pyre.units.time import second
+    timeConstant = pythia.pyre.inventory.dimensional("time_constant", default=1.0 * second, validator=pythia.pyre.inventory.greater(0.0 * second))
+    timeConstant.meta['tip'] = "Values used to normalize time stamp in filename."
+
+    def __init__(self, name="datawritervtu"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterVTU.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+
+        ModuleDataWriterVTU.timeFormat(self, self.timeFormat)
+        ModuleDataWriterVTU.timeConstant(self, self.timeConstant.value)
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "vtu")
+        self.mkpath(filename)
+        ModuleDataWriterVTU.filename(self, filename)
+
+    def _configure(self):
+        """Configure object.
+        """
+        DataWriter._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterVTU.__init__(self)
+        return
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterVTU()
+
+
+# End of file
@@ -51,6 +51,7 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
             [pylithapp.mesh_generator.reader]
             filename = mesh_quad.exo
             use_nodeset_names = True
+            parallel_read = False
             coordsys.space_dim = 2
         """
     }
@@ -63,6 +64,9 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     useNames = pythia.pyre.inventory.bool("use_nodeset_names", default=True)
     useNames.meta['tip'] = "Use nodeset names instead of ids."
 
+    parallelRead = pythia.pyre.inventory.bool("parallel_read", default=False)
+    parallelRead.meta['tip'] = "Each process reads a portion of the mesh (avoids building entire mesh on process 0)."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
     coordsys.meta['tip'] = "Coordinate system associated with mesh."
@@ -77,6 +81,12 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
         MeshIOObj.preinitialize(self)
         ModuleMeshIOCubit.setFilename(self, self.filename)
         ModuleMeshIOCubit.setUseNodesetNames(self, self.useNames)
+        ModuleMeshIOCubit.setUseParallelRead(self, self.parallelRead)
+
+    def isParallelRead(self):
+        """Return True if each process reads a portion of the mesh.
+        """
+        return self.parallelRead
 
     def _configure(self):
         """Set members based using inventory.
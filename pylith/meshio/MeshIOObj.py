@@ -55,6 +55,12 @@ class MeshIOObj(PetscComponent, ModuleMeshIO):
         ModuleMeshIO.read(self, mesh, debug)
         return mesh
 
+    def isParallelRead(self):
+        """Return True if each process reads a portion of the mesh, so the mesh is already
+        distributed among processes after reading.
+        """
+        return False
+
     def write(self, mesh):
         """Write finite-element mesh.stored in Sieve mesh object.
 
@@ -25,6 +25,7 @@ __all__ = [
     "MeshIOLagrit",
     "DataWriter",
     "DataWriterVTK",
+    "DataWriterVTU",
     "DataWriterHDF5Ext",
     "DataWriterHDF5",
     "OutputObserver",
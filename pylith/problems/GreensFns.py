@@ -76,6 +76,10 @@ class GreensFns(Problem, ModuleGreensFns):
     faultLabelValue = pythia.pyre.inventory.int("label_value", default=1)
     faultLabelValue.meta['tip'] = "Value of label identifier for fault surface on which to impose impulses."
 
+    projectionBasisSize = pythia.pyre.inventory.int("projection_basis_size", default=32,
+                                                    validator=pythia.pyre.inventory.greaterEqual(0))
+    projectionBasisSize.meta['tip'] = "Maximum number of previous Green's functions used to form initial guess with linear solver (0 to disable)."
+
     from .ProgressMonitorStep import ProgressMonitorStep
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorStep)
@@ -99,6 +103,7 @@ class GreensFns(Problem, ModuleGreensFns):
 
         ModuleGreensFns.setFaultLabelName(self, self.faultLabelName)
         ModuleGreensFns.setFaultLabelValue(self, self.faultLabelValue)
+        ModuleGreensFns.setProjectionBasisSize(self, self.projectionBasisSize)
 
         self.progressMonitor.preinitialize()
         ModuleGreensFns.setProgressMonitor(self, self.progressMonitor)
@@ -78,6 +78,10 @@ class Problem(PetscComponent, ModuleProblem):
                                       validator=pythia.pyre.inventory.choice(["linear", "nonlinear"]))
     solverChoice.meta['tip'] = "Type of solver to use ['linear', 'nonlinear']."
 
+    matrixType = pythia.pyre.inventory.str("matrix_type", default="default",
+                                           validator=pythia.pyre.inventory.choice(["default", "aij", "baij", "sbaij"]))
+    matrixType.meta['tip'] = "PETSc matrix type for Jacobian ['default', 'aij', 'baij', 'sbaij']."
+
     petscDefaults = pythia.pyre.inventory.facility("petsc_defaults", family="petsc_defaults", factory=PetscDefaults)
     petscDefaults.meta['tip'] = "Flags controlling which default PETSc options to use."
 
@@ -140,6 +144,7 @@ class Problem(PetscComponent, ModuleProblem):
             ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR)
         else:
             raise ValueError("Unknown solver choice '%s'." % self.solverChoice)
+        ModuleProblem.setMatrixType(self, self.matrixType)
         ModuleProblem.setPetscDefaults(self, self.petscDefaults.flags());
         ModuleProblem.setNormalizer(self, self.normalizer)
         if not isinstance(self.gravityField, NullComponent):
@@ -202,6 +207,7 @@ class Problem(PetscComponent, ModuleProblem):
         from pylith.mpi.Communicator import mpi_is_root
         if mpi_is_root():
             self._info.log("Finalizing problem.")
+        ModuleProblem.finalize(self)
 
     def checkpoint(self):
         """Save problem state for restart.
@@ -94,6 +94,9 @@ class TimeDependent(Problem, ModuleTimeDependent):
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    localTimeStepping = pythia.pyre.inventory.bool("local_time_stepping", default=False)
+    localTimeStepping.meta["tip"] = "Advance cells with small stable time steps using substeps (dynamic formulation only)."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
@@ -120,6 +123,7 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        ModuleTimeDependent.useLocalTimeStepping(self, self.localTimeStepping)
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -31,8 +31,8 @@ class Distributor(PetscComponent, ModuleDistributor):
     import pythia.pyre.inventory
 
     partitioner = pythia.pyre.inventory.str("partitioner", default="chaco",
-                                     validator=pythia.pyre.inventory.choice(["chaco", "metis", "parmetis", "simple"]))
-    partitioner.meta['tip'] = "Name of mesh partitioner."
+                                     validator=pythia.pyre.inventory.choice(["chaco", "metis", "parmetis", "simple", "hilbert", "morton"]))
+    partitioner.meta['tip'] = "Name of mesh partitioner ('hilbert' and 'morton' split cells along a space-filling curve)."
 
     writePartition = pythia.pyre.inventory.bool("write_partition", default=False)
     writePartition.meta['tip'] = "Write partition information to file."
@@ -50,8 +50,11 @@ class Distributor(PetscComponent, ModuleDistributor):
         """Do minimal initialization."""
         ModuleDistributor.__init__(self)
 
-    def distribute(self, mesh, problem):
+    def distribute(self, mesh, problem, includeFaults=True):
         """Distribute a Mesh
+
+        If `includeFaults` is False, the faults are ignored in creating the overlap, because the
+        cohesive cells will be inserted after distribution (see `distributeOverlap()`).
         """
         self._setupLogging()
         logEvent = "%sdistribute" % self._loggingPrefix
@@ -63,7 +66,8 @@ class Distributor(PetscComponent, ModuleDistributor):
             partitionerName = "parmetis"
         else:
             partitionerName = self.partitioner
-        ModuleDistributor.distribute(newMesh, mesh, problem.interfaces.components(), partitionerName)
+        faults = problem.interfaces.components() if includeFaults else []
+        ModuleDistributor.distribute(newMesh, mesh, faults, partitionerName)
 
         mesh.cleanup()
 
@@ -74,6 +78,28 @@ class Distributor(PetscComponent, ModuleDistributor):
         self._eventLogger.eventEnd(logEvent)
         return newMesh
 
+    def distributeFaultOverlap(self, mesh, problem):
+        """Add fault faces to the overlap of a distributed mesh before inserting cohesive cells.
+        """
+        self._setupLogging()
+        logEvent = "%sfaultoverlap" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+
+        ModuleDistributor.distributeFaultOverlap(mesh, problem.interfaces.components())
+
+        self._eventLogger.eventEnd(logEvent)
+
+    def distributeOverlap(self, mesh, problem):
+        """Add overlap for faults to a distributed mesh after inserting cohesive cells.
+        """
+        self._setupLogging()
+        logEvent = "%soverlap" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+
+        ModuleDistributor.distributeOverlap(mesh, problem.interfaces.components())
+
+        self._eventLogger.eventEnd(logEvent)
+
     def _configure(self):
         """Set members based using inventory.
         """
@@ -87,7 +113,7 @@ class Distributor(PetscComponent, ModuleDistributor):
         logger = EventLogger()
         logger.setClassName("FE Distribution")
         logger.initialize()
-        events = ["distribute"]
+        events = ["distribute", "faultoverlap", "overlap"]
         for event in events:
             logger.registerEvent("%s%s" % (self._loggingPrefix, event))
 
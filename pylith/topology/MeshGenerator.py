@@ -43,8 +43,10 @@ class MeshGenerator(PetscComponent):
         """
         PetscComponent._configure(self)
 
-    def _adjustTopology(self, mesh, interfaces, problem):
+    def _adjustTopology(self, mesh, interfaces, problem, insertCohesiveCells=True):
         """Adjust topology for interface implementation.
+
+        If `insertCohesiveCells` is False, only set up the interfaces (the mesh already contains the cohesive cells).
         """
         logEvent = "%sadjTopo" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
@@ -57,12 +59,15 @@ class MeshGenerator(PetscComponent):
                 labelValue = material.labelValue
                 cohesiveLabelValue = max(cohesiveLabelValue, labelValue+1)
             for interface in interfaces:
-                if mpi_is_root():
-                    self._info.log("Adjusting topology for fault '%s'." % interface.labelName)
                 interface.preinitialize(problem)
                 interface.setCohesiveLabelValue(cohesiveLabelValue)
-                interface.adjustTopology(mesh)
                 cohesiveLabelValue += 1
+            if insertCohesiveCells:
+                if mpi_is_root():
+                    labels = ", ".join(["'%s'" % interface.labelName for interface in interfaces])
+                    self._info.log("Adjusting topology for faults %s." % labels)
+                from pylith.faults.faults import FaultCohesive
+                FaultCohesive.adjustTopologyMultiple(mesh, list(interfaces))
 
         self._eventLogger.eventEnd(logEvent)
 
@@ -16,6 +16,21 @@
 from .MeshGenerator import MeshGenerator
 
 
+def validateOrdering(value):
+    """Validate name of mesh ordering.
+
+    Boolean values are accepted for backward compatibility with `reorder_mesh`; True corresponds to 'rcm'.
+    """
+    ordering = value.strip().lower()
+    if ordering in ["true", "yes", "on", "1"]:
+        return "rcm"
+    if ordering in ["false", "no", "off", "0"]:
+        return "none"
+    if not ordering in ["none", "rcm", "morton", "hilbert"]:
+        raise ValueError(f"Unknown mesh ordering '{value}'. Use 'none', 'rcm', 'morton', or 'hilbert'.")
+    return ordering
+
+
 class MeshImporter(MeshGenerator):
     """
     Base class for reading a finite-element mesh from files.
@@ -25,8 +40,13 @@ class MeshImporter(MeshGenerator):
     DOC_CONFIG = {
         "cfg": """
             [pylithapp.meshimporter]
-            reorder_mesh = True
+            reorder_mesh = rcm
+            reorder_local = hilbert
+            insert_faults_after_distribution = True
+            use_snapshot = True
+            snapshot_dir = mesh_snapshots
             check_topology = True
+            check_topology_level = local
             reader = pylith.meshio.MeshIOCubit
             refiner = pylith.topology.RefineUniform
         """
@@ -34,12 +54,28 @@ class MeshImporter(MeshGenerator):
 
     import pythia.pyre.inventory
 
-    reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh = pythia.pyre.inventory.str("reorder_mesh", default="rcm", validator=validateOrdering)
+    reorderMesh.meta['tip'] = "Reorder mesh before distribution ('none', 'rcm' (reverse Cuthill-McKee), 'morton', or 'hilbert')."
+
+    reorderLocal = pythia.pyre.inventory.str("reorder_local", default="none", validator=validateOrdering)
+    reorderLocal.meta['tip'] = "Reorder local cells and vertices on each process after distribution and refinement."
+
+    insertFaultsAfterDistribution = pythia.pyre.inventory.bool("insert_faults_after_distribution", default=False)
+    insertFaultsAfterDistribution.meta['tip'] = "Insert cohesive cells for faults on each process after distribution (always used for a mesh read in parallel)."
+
+    useSnapshot = pythia.pyre.inventory.bool("use_snapshot", default=False)
+    useSnapshot.meta['tip'] = "Save the distributed mesh to a snapshot and restore it in later runs with the same mesh, configuration, and number of processes."
+
+    snapshotDir = pythia.pyre.inventory.str("snapshot_dir", default="mesh_snapshots")
+    snapshotDir.meta['tip'] = "Directory for mesh snapshots."
 
     checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
     checkTopology.meta['tip'] = "Check topology of imported mesh."
 
+    checkTopologyLevel = pythia.pyre.inventory.str("check_topology_level", default="full",
+                                                   validator=pythia.pyre.inventory.choice(["none", "basic", "local", "full"]))
+    checkTopologyLevel.meta['tip'] = "Level of checks of mesh topology ('none', 'basic', 'local', or 'full'); 'basic' and 'local' checks of the imported mesh are done after distribution."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
     reader.meta['tip'] = "Reader for mesh files."
@@ -67,6 +103,17 @@ class MeshImporter(MeshGenerator):
         self.distributor.preinitialize()
         self.refiner.preinitialize()
 
+        from pylith.topology.topology import MeshOps_setCheckTopologyLevel
+        MeshOps_setCheckTopologyLevel(self.checkTopologyLevel)
+
+        if getattr(self.refiner, "keepHierarchy", False):
+            if self.reorderLocal != "none":
+                raise ValueError("Reordering local cells and vertices ('reorder_local') is not compatible with "
+                                 "keeping the coarse levels of the mesh from refinement ('keep_hierarchy').")
+            if self.useSnapshot:
+                raise ValueError("Mesh snapshots ('use_snapshot') do not include the coarse levels of the mesh "
+                                 "from refinement ('keep_hierarchy').")
+
     def create(self, problem, faults=None):
         """Hook for creating mesh.
         """
@@ -78,44 +125,104 @@ class MeshImporter(MeshGenerator):
         logEvent = "%screate" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
 
+        from pylith.mpi.Communicator import mpi_comm_world
+        comm = mpi_comm_world()
+
+        # Restore mesh from snapshot (if available)
+        snapshotFilename = None
+        if self.useSnapshot:
+            snapshotFilename = self._getSnapshotFilename(problem, faults, comm.size)
+            import os
+            if os.path.isfile(snapshotFilename):
+                newMesh = self._readSnapshot(snapshotFilename, problem, faults)
+                from pylith.topology.topology import MeshOps_nondimensionalize
+                MeshOps_nondimensionalize(newMesh, problem.normalizer)
+                self._eventLogger.eventEnd(logEvent)
+                return newMesh
+
         # Read mesh
-        mesh = self.reader.read(self.checkTopology)
+        mesh = self.reader.read(self.checkTopology and self.checkTopologyLevel == "full")
+        isParallelRead = self.reader.isParallelRead()
+
+        insertFaultsDistributed = comm.size > 1 and (self.insertFaultsAfterDistribution or isParallelRead)
 
         # Reorder mesh
-        if self.reorderMesh:
+        if self.reorderMesh != "none" and isParallelRead:
+            if isRoot:
+                self._info.log("Skipping reordering of cells and vertices for mesh read in parallel.")
+        elif self.reorderMesh != "none":
             logEvent2 = "%sreorder" % self._loggingPrefix
             self._eventLogger.eventBegin(logEvent2)
             self._debug.log(resourceUsageString())
             if isRoot:
-                self._info.log("Reordering cells and vertices.")
-            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-            ordering = ReverseCuthillMcKee()
-            ordering.reorder(mesh)
+                self._info.log("Reordering cells and vertices using '%s'." % self.reorderMesh)
+            if self.reorderMesh == "rcm":
+                from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+                ordering = ReverseCuthillMcKee()
+                ordering.reorder(mesh)
+            else:
+                from pylith.topology.MeshOrdering import MeshOrdering
+                ordering = MeshOrdering()
+                ordering.reorder(mesh, self.reorderMesh)
             self._eventLogger.eventEnd(logEvent2)
 
         # Adjust topology
-        self._debug.log(resourceUsageString())
-        if isRoot:
-            self._info.log("Adjusting topology.")
-        self._adjustTopology(mesh, faults, problem)
+        if not insertFaultsDistributed:
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology.")
+            self._adjustTopology(mesh, faults, problem)
+        if isParallelRead and self.distributor.partitioner == "chaco":
+            raise ValueError("The 'chaco' partitioner is serial and cannot repartition a mesh read in parallel. "
+                             "Use the 'parmetis', 'simple', 'hilbert', or 'morton' partitioner.")
 
-        # Distribute mesh
-        from pylith.mpi.Communicator import mpi_comm_world
-        comm = mpi_comm_world()
+        # Distribute mesh. A mesh read in parallel is partitioned into blocks by reading order,
+        # so we repartition it.
         if comm.size > 1:
             if isRoot:
                 self._info.log("Distributing mesh.")
-            mesh = self.distributor.distribute(mesh, problem)
+            mesh = self.distributor.distribute(mesh, problem, includeFaults=not insertFaultsDistributed)
             mesh.memLoggingStage = "DistributedMesh"
 
+        # Insert cohesive cells on each process and add the overlap for the faults. Every process
+        # with a fault vertex needs a fault face containing it to split the vertex consistently.
+        if insertFaultsDistributed:
+            if faults:
+                self.distributor.distributeFaultOverlap(mesh, problem)
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology of distributed mesh.")
+            self._adjustTopology(mesh, faults, problem)
+            if faults:
+                self.distributor.distributeOverlap(mesh, problem)
+
+        # Check topology of the local mesh on each process.
+        if self.checkTopology and self.checkTopologyLevel in ["basic", "local"]:
+            if isRoot:
+                self._info.log("Checking topology of mesh ('%s' checks)." % self.checkTopologyLevel)
+            from pylith.topology.topology import MeshOps_checkTopology
+            MeshOps_checkTopology(mesh)
+
         # Refine mesh (if necessary)
         newMesh = self.refiner.refine(mesh)
         if not newMesh == mesh:
             mesh.cleanup()
             newMesh.memLoggingStage = "RefinedMesh"
 
-        # Can't reorder mesh again, because we do not have routine to
-        # unmix normal and hybrid cells.
+        # Reorder local points on each process (keeps cohesive cells at the end).
+        if self.reorderLocal != "none":
+            logEvent2 = "%sreorderlocal" % self._loggingPrefix
+            self._eventLogger.eventBegin(logEvent2)
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Reordering local cells and vertices on each process using '%s'." % self.reorderLocal)
+            from pylith.topology.MeshOrdering import MeshOrdering
+            ordering = MeshOrdering()
+            ordering.reorder(newMesh, self.reorderLocal)
+            self._eventLogger.eventEnd(logEvent2)
+
+        if snapshotFilename:
+            self._writeSnapshot(snapshotFilename, newMesh)
 
         # Nondimensionalize mesh (coordinates of vertices).
         from pylith.topology.topology import MeshOps_nondimensionalize
@@ -124,6 +231,76 @@ class MeshImporter(MeshGenerator):
         self._eventLogger.eventEnd(logEvent)
         return newMesh
 
+    def _getSnapshotFilename(self, problem, faults, numProcs):
+        """Get name of snapshot file for mesh.
+
+        The name includes a hash of the mesh files (name, size, and modification time), the
+        configuration of the steps creating the mesh, and the number of processes. The contents of
+        the mesh files are not hashed, so changes that preserve the size and modification time are
+        not detected.
+        """
+        import hashlib
+        import os
+
+        key = hashlib.sha256()
+        for attr in ["filename", "filenameGmv", "filenamePset"]:
+            filename = getattr(self.reader, attr, None)
+            if filename:
+                stat = os.stat(filename)
+                key.update(f"{os.path.abspath(filename)}:{stat.st_size}:{stat.st_mtime_ns}".encode())
+        config = [
+            self.reader.__class__.__name__,
+            self.reorderMesh,
+            self.reorderLocal,
+            self.insertFaultsAfterDistribution,
+            self.distributor.partitioner,
+            self.refiner.__class__.__name__,
+            getattr(self.refiner, "levels", 0),
+            numProcs,
+            [material.labelValue for material in problem.materials.components()],
+        ]
+        for fault in faults or []:
+            config += [fault.__class__.__name__, fault.labelName, fault.labelValue, fault.edgeName, fault.edgeValue]
+        key.update(repr(config).encode())
+        return os.path.join(self.snapshotDir, f"mesh-{key.hexdigest()[:16]}.h5")
+
+    def _readSnapshot(self, filename, problem, faults):
+        """Restore mesh from snapshot.
+        """
+        from pylith.mpi.Communicator import mpi_is_root, petsc_comm_world
+        if mpi_is_root():
+            self._info.log(f"Restoring mesh from snapshot '{filename}'.")
+
+        logEvent = "%ssnapshot" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+
+        # Interfaces must be set up (cohesive label values) before adding the overlap for faults.
+        from pylith.topology.Mesh import Mesh
+        from pylith.topology.topology import MeshSnapshot
+        mesh = Mesh(dim=self.reader.coordsys.getSpaceDim(), comm=petsc_comm_world())
+        mesh.setCoordSys(self.reader.coordsys)
+        self._adjustTopology(mesh, faults, problem, insertCohesiveCells=False)
+        MeshSnapshot.read(mesh, filename, faults or [])
+
+        self._eventLogger.eventEnd(logEvent)
+        return mesh
+
+    def _writeSnapshot(self, filename, mesh):
+        """Save mesh to snapshot.
+        """
+        import os
+        from pylith.mpi.Communicator import mpi_is_root, mpi_comm_world
+        if mpi_is_root():
+            self._info.log(f"Saving mesh to snapshot '{filename}'.")
+            os.makedirs(os.path.dirname(filename) or ".", exist_ok=True)
+        mpi_comm_world().barrier()
+
+        logEvent = "%ssnapshot" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+        from pylith.topology.topology import MeshSnapshot
+        MeshSnapshot.write(mesh, filename)
+        self._eventLogger.eventEnd(logEvent)
+
     def _configure(self):
         """Set members based on inventory.
         """
@@ -134,6 +311,8 @@ class MeshImporter(MeshGenerator):
         """
         MeshGenerator._setupLogging(self)
         self._eventLogger.registerEvent("%sreorder" % self._loggingPrefix)
+        self._eventLogger.registerEvent("%sreorderlocal" % self._loggingPrefix)
+        self._eventLogger.registerEvent("%ssnapshot" % self._loggingPrefix)
 
 
 # FACTORIES ////////////////////////////////////////////////////////////
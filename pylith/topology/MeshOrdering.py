@@ -0,0 +1,43 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .topology import MeshOrdering as ModuleMeshOrdering
+
+
+class MeshOrdering(ModuleMeshOrdering):
+    """
+    Reordering of local mesh cells and vertices on each process (applied after distribution).
+    """
+
+    ORDERINGS = {
+        "rcm": ModuleMeshOrdering.RCM,
+        "morton": ModuleMeshOrdering.MORTON,
+        "hilbert": ModuleMeshOrdering.HILBERT,
+    }
+
+    def __init__(self):
+        """Constructor.
+        """
+        return
+
+    def reorder(self, mesh, ordering):
+        """Reorder local points of mesh using ordering algorithm with given name.
+        """
+        if not ordering in self.ORDERINGS:
+            raise ValueError(f"Unknown mesh ordering '{ordering}'. Known orderings: {', '.join(self.ORDERINGS.keys())}.")
+        ModuleMeshOrdering.reorder(mesh, self.ORDERINGS[ordering])
+
+
+# End of file
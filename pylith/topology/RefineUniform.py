@@ -28,6 +28,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
             # Refine mesh twice to reduce size of cell edges by a factor of 4.
             [pylithapp.mesh_generator.refiner]
             levels = 2
+            keep_hierarchy = False
         """
     }
 
@@ -36,6 +37,9 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     levels = pythia.pyre.inventory.int("levels", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
     levels.meta['tip'] = "Number of refinement levels."
 
+    keepHierarchy = pythia.pyre.inventory.bool("keep_hierarchy", default=False)
+    keepHierarchy.meta['tip'] = "Retain coarse levels of mesh for use as geometric multigrid hierarchy."
+
     def __init__(self, name="refineuniform"):
         """Constructor.
         """
@@ -61,7 +65,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
         from .Mesh import Mesh
         newMesh = Mesh()
         newMesh.setCoordSys(mesh.getCoordSys())
-        ModuleRefineUniform.refine(self, newMesh, mesh, self.levels)
+        ModuleRefineUniform.refine(self, newMesh, mesh, self.levels, self.keepHierarchy)
         mesh.cleanup()
 
         self._eventLogger.eventEnd(logEvent)
@@ -25,6 +25,7 @@ __all__ = [
     "Fields",
     "MeshGenerator",
     "MeshImporter",
+    "MeshOrdering",
     "MeshRefiner",
     "RefineUniform",
     "ReverseCuthillMcKee",
@@ -0,0 +1,972 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "Benchmark.hh" // implementation of class methods
+
+#include "MeshIOBox.hh" // USES MeshIOBox
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/materials/Elasticity.hh" // USES Elasticity
+#include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/materials/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/faults/KinSrcStep.hh" // USES KinSrcStep
+#include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
+#include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/meshio/DataWriterVTK.hh" // USES DataWriterVTK
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldQuery.hh" // USES FieldQuery
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/utils/PylithVersion.hh" // USES PylithVersion
+
+#include "spatialdata/spatialdb/UserFunctionDB.hh" // USES UserFunctionDB
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "petscmat.h" // USES PetscMat
+
+#include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
+#include <iomanip> // USES std::setprecision()
+#include <iostream> // USES std::ostream
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+#include <glob.h> // USES glob()
+#include <sys/stat.h> // USES stat()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace testing {
+        class _Benchmark {
+public:
+
+            // Material properties
+            static double density(const double x,
+                                  const double y,
+                                  const double z) {
+                return 2500.0;
+            } // density
+
+            static double density2D(const double x,
+                                    const double y) {
+                return density(x, y, 0.0);
+            } // density2D
+
+            static double vs(const double x,
+                             const double y,
+                             const double z) {
+                return 3000.0;
+            } // vs
+
+            static double vs2D(const double x,
+                               const double y) {
+                return vs(x, y, 0.0);
+            } // vs2D
+
+            static double vp(const double x,
+                             const double y,
+                             const double z) {
+                return sqrt(3.0)*vs(x, y, z);
+            } // vp
+
+            static double vp2D(const double x,
+                               const double y) {
+                return vp(x, y, 0.0);
+            } // vp2D
+
+            static double viscosity(const double x,
+                                    const double y,
+                                    const double z) {
+                return 7.5e+18;
+            } // viscosity
+
+            static double viscosity2D(const double x,
+                                      const double y) {
+                return viscosity(x, y, 0.0);
+            } // viscosity2D
+
+            static double shearModulusRatio(const double x,
+                                            const double y,
+                                            const double z) {
+                return 0.25;
+            } // shearModulusRatio
+
+            static double shearModulusRatio2D(const double x,
+                                              const double y) {
+                return shearModulusRatio(x, y, 0.0);
+            } // shearModulusRatio2D
+
+            // Fault rupture
+            static double zero(const double x,
+                               const double y,
+                               const double z) {
+                return 0.0;
+            } // zero
+
+            static double zero2D(const double x,
+                                 const double y) {
+                return 0.0;
+            } // zero2D
+
+            static double slip(const double x,
+                               const double y,
+                               const double z) {
+                return -1.5;
+            } // slip
+
+            static double slip2D(const double x,
+                                 const double y) {
+                return slip(x, y, 0.0);
+            } // slip2D
+
+            // Displacement field for queries.
+            static double disp_x(const double x,
+                                 const double y,
+                                 const double z) {
+                return 1.0e-3*x + 2.0e-4*y;
+            } // disp_x
+
+            static double disp_x2D(const double x,
+                                   const double y) {
+                return disp_x(x, y, 0.0);
+            } // disp_x2D
+
+            static double disp_y(const double x,
+                                 const double y,
+                                 const double z) {
+                return -3.0e-4*x + 1.0e-3*y;
+            } // disp_y
+
+            static double disp_y2D(const double x,
+                                   const double y) {
+                return disp_y(x, y, 0.0);
+            } // disp_y2D
+
+            static double disp_z(const double x,
+                                 const double y,
+                                 const double z) {
+                return 5.0e-4*z;
+            } // disp_z
+
+            /** Get peak resident memory (maximum over processes).
+             *
+             * @param[in] comm MPI communicator.
+             * @returns Peak memory (MB).
+             */
+            static double getPeakMemory(MPI_Comm comm) {
+                PetscLogDouble memLocal = 0.0;
+                PetscErrorCode err = PetscMemoryGetMaximumUsage(&memLocal);PYLITH_CHECK_ERROR(err);
+                if (memLocal <= 0.0) { // Fall back to current usage if not tracking maximum usage.
+                    err = PetscMemoryGetCurrentUsage(&memLocal);PYLITH_CHECK_ERROR(err);
+                } // if
+                double mem = 0.0;
+                double memLocalMB = memLocal / (1024.0*1024.0);
+                err = MPI_Allreduce(&memLocalMB, &mem, 1, MPI_DOUBLE, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+                return mem;
+            } // getPeakMemory
+
+            /** Get total size of files matching pattern (on process 0).
+             *
+             * @param[in] pattern Shell pattern for names of files.
+             * @param[in] comm MPI communicator.
+             * @returns Size of files (MB).
+             */
+            static double getDiskUsage(const char* pattern,
+                                       MPI_Comm comm) {
+                int rank = 0;
+                MPI_Comm_rank(comm, &rank);
+                double bytes = 0.0;
+                if (!rank) {
+                    glob_t files;
+                    if (0 == glob(pattern, 0, NULL, &files)) {
+                        for (size_t i = 0; i < files.gl_pathc; ++i) {
+                            struct stat info;
+                            if (0 == stat(files.gl_pathv[i], &info)) {
+                                bytes += info.st_size;
+                            } // if
+                        } // for
+                    } // if
+                    globfree(&files);
+                } // if
+                PetscErrorCode err = MPI_Bcast(&bytes, 1, MPI_DOUBLE, 0, comm);PYLITH_CHECK_ERROR(err);
+                return bytes / (1024.0*1024.0);
+            } // getDiskUsage
+
+        }; // _Benchmark
+    } // testing
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::testing::Benchmark::Benchmark(void) :
+    _dimension(2),
+    _numCellsPerEdge(64),
+    _basisOrder(1),
+    _numRepeat(10),
+    _matrixType("aij"),
+    _rheologyName("elastic"),
+    _outputFilename("benchmark_output.h5"),
+    _mesh(NULL),
+    _solution(NULL),
+    _problem(NULL),
+    _material(NULL),
+    _rheology(NULL),
+    _fault(NULL),
+    _kinSrc(NULL),
+    _materialDB(NULL),
+    _faultDB(NULL),
+    _cs(NULL),
+    _normalizer(NULL),
+    _solutionDotVec(NULL),
+    _jacobianMat(NULL) {
+    PyreComponent::setName("benchmark");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::testing::Benchmark::~Benchmark(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::testing::Benchmark::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    err = VecDestroy(&_solutionDotVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    delete _problem;_problem = NULL;
+    delete _solution;_solution = NULL;
+    delete _material;_material = NULL;
+    delete _rheology;_rheology = NULL;
+    delete _fault;_fault = NULL;
+    delete _kinSrc;_kinSrc = NULL;
+    delete _materialDB;_materialDB = NULL;
+    delete _faultDB;_faultDB = NULL;
+    delete _mesh;_mesh = NULL;
+    delete _cs;_cs = NULL;
+    delete _normalizer;_normalizer = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set dimension of box mesh.
+void
+pylith::testing::Benchmark::setDimension(const int value) {
+    if ((value < 2) || (value > 3)) {
+        std::ostringstream msg;
+        msg << "Dimension for benchmarks (" << value << ") must be 2 or 3.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _dimension = value;
+} // setDimension
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of cells along each edge of box mesh.
+void
+pylith::testing::Benchmark::setNumCellsPerEdge(const int value) {
+    if ((value < 2) || (value % 2)) {
+        std::ostringstream msg;
+        msg << "Number of cells along each edge (" << value << ") must be a positive, even number.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _numCellsPerEdge = value;
+} // setNumCellsPerEdge
+
+
+// ------------------------------------------------------------------------------------------------
+// Set basis order for solution field.
+void
+pylith::testing::Benchmark::setBasisOrder(const int value) {
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Basis order for solution (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _basisOrder = value;
+} // setBasisOrder
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of repetitions for each benchmark.
+void
+pylith::testing::Benchmark::setNumRepeat(const int value) {
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of repetitions (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _numRepeat = value;
+} // setNumRepeat
+
+
+// ------------------------------------------------------------------------------------------------
+// Set PETSc matrix type for Jacobian.
+void
+pylith::testing::Benchmark::setMatrixType(const char* value) {
+    _matrixType = value;
+} // setMatrixType
+
+
+// ------------------------------------------------------------------------------------------------
+// Set bulk rheology for material.
+void
+pylith::testing::Benchmark::setRheology(const char* value) {
+    if ((std::string("elastic") != value) && (std::string("genmaxwell") != value)) {
+        std::ostringstream msg;
+        msg << "Unknown rheology '" << value << "' for benchmarks. Use 'elastic' or 'genmaxwell'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _rheologyName = value;
+} // setRheology
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of HDF5 file for output benchmark.
+void
+pylith::testing::Benchmark::setOutputFilename(const char* value) {
+    _outputFilename = value;
+} // setOutputFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Set up problem and run all benchmarks.
+void
+pylith::testing::Benchmark::run(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _results.clear();
+    _initialize();
+
+    _benchmarkDomainResidual();
+    _benchmarkDomainJacobian();
+    _benchmarkMatMult();
+    _benchmarkInterface();
+    _benchmarkQuery();
+    _benchmarkOutput();
+
+    PYLITH_METHOD_END;
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Get results of benchmarks.
+const std::vector<pylith::testing::Benchmark::Result>&
+pylith::testing::Benchmark::getResults(void) const {
+    return _results;
+} // getResults
+
+
+// ------------------------------------------------------------------------------------------------
+// Write configuration and results in JSON format.
+void
+pylith::testing::Benchmark::writeJSON(std::ostream& sout) const {
+    int numProcs = 1;
+    MPI_Comm_size(PETSC_COMM_WORLD, &numProcs);
+
+    sout << std::setprecision(6)
+         << "{\n"
+         << "  \"pylith_version\": \"" << pylith::utils::PylithVersion::version() << "\",\n"
+         << "  \"git_revision\": \"" << pylith::utils::PylithVersion::gitRevision() << "\",\n"
+         << "  \"configuration\": {\n"
+         << "    \"dimension\": " << _dimension << ",\n"
+         << "    \"cell\": \"" << ((2 == _dimension) ? "quad" : "hex") << "\",\n"
+         << "    \"cells_per_edge\": " << _numCellsPerEdge << ",\n"
+         << "    \"basis_order\": " << _basisOrder << ",\n"
+         << "    \"matrix_type\": \"" << _matrixType << "\",\n"
+         << "    \"rheology\": \"" << _rheologyName << "\",\n"
+         << "    \"num_repeat\": " << _numRepeat << ",\n"
+         << "    \"num_procs\": " << numProcs << "\n"
+         << "  },\n"
+         << "  \"benchmarks\": [";
+    for (size_t i = 0; i < _results.size(); ++i) {
+        const Result& result = _results[i];
+        const double timePerRepeat = result.time / result.numRepeat;
+        const double cellsPerSecond = (timePerRepeat > 0.0) ? result.numCells / timePerRepeat : 0.0;
+        const double dofsPerSecond = (timePerRepeat > 0.0) ? result.numDOF / timePerRepeat : 0.0;
+        sout << ((i > 0) ? ",\n" : "\n")
+             << "    {\n"
+             << "      \"name\": \"" << result.name << "\",\n"
+             << "      \"num_cells\": " << result.numCells << ",\n"
+             << "      \"num_dofs\": " << result.numDOF << ",\n"
+             << "      \"num_repeat\": " << result.numRepeat << ",\n"
+             << "      \"time\": " << result.time << ",\n"
+             << "      \"cells_per_second\": " << cellsPerSecond << ",\n"
+             << "      \"dofs_per_second\": " << dofsPerSecond << ",\n"
+             << "      \"peak_memory_mb\": " << result.peakMemory << ",\n"
+             << "      \"disk_usage_mb\": " << result.diskUsage << "\n"
+             << "    }";
+    } // for
+    sout << "\n  ]\n"
+         << "}\n";
+} // writeJSON
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh, material, fault, and problem.
+void
+pylith::testing::Benchmark::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    deallocate();
+
+    _normalizer = new spatialdata::units::Nondimensional;assert(_normalizer);
+    _normalizer->setLengthScale(1.0e+03);
+    _normalizer->setTimeScale(2.0);
+    _normalizer->setPressureScale(2.25e+10);
+    _normalizer->computeDensityScale();
+
+    _cs = new spatialdata::geocoords::CSCart;assert(_cs);
+    _cs->setSpaceDim(_dimension);
+
+    // Mesh
+    _mesh = new pylith::topology::Mesh;assert(_mesh);
+    MeshIOBox iohandler;
+    iohandler.setDimension(_dimension);
+    iohandler.setNumCellsPerEdge(_numCellsPerEdge);
+    iohandler.read(_mesh);
+    _mesh->setCoordSys(_cs);
+    pylith::topology::MeshOps::nondimensionalize(_mesh, *_normalizer);
+
+    // Material
+    _materialDB = new spatialdata::spatialdb::UserFunctionDB;assert(_materialDB);
+    _materialDB->setDescription("material auxiliary field spatial database");
+    if (2 == _dimension) {
+        _materialDB->addValue("density", _Benchmark::density2D, "kg/m**3");
+        _materialDB->addValue("vs", _Benchmark::vs2D, "m/s");
+        _materialDB->addValue("vp", _Benchmark::vp2D, "m/s");
+    } else {
+        _materialDB->addValue("density", _Benchmark::density, "kg/m**3");
+        _materialDB->addValue("vs", _Benchmark::vs, "m/s");
+        _materialDB->addValue("vp", _Benchmark::vp, "m/s");
+    } // if/else
+    const bool isGenMaxwell = std::string("genmaxwell") == _rheologyName;
+    if (isGenMaxwell) {
+        const char* elementSuffixes[3] = { "_1", "_2", "_3" };
+        const char* strainSuffixes[6] = { "_xx", "_yy", "_zz", "_xy", "_yz", "_xz" };
+        const size_t strainSize = (2 == _dimension) ? 4 : 6;
+        for (size_t i = 0; i < 3; ++i) {
+            const std::string& viscosityName = std::string("viscosity") + elementSuffixes[i];
+            const std::string& ratioName = std::string("shear_modulus_ratio") + elementSuffixes[i];
+            if (2 == _dimension) {
+                _materialDB->addValue(viscosityName.c_str(), _Benchmark::viscosity2D, "Pa*s");
+                _materialDB->addValue(ratioName.c_str(), _Benchmark::shearModulusRatio2D, "none");
+            } else {
+                _materialDB->addValue(viscosityName.c_str(), _Benchmark::viscosity, "Pa*s");
+                _materialDB->addValue(ratioName.c_str(), _Benchmark::shearModulusRatio, "none");
+            } // if/else
+        } // for
+        for (size_t iStrain = 0; iStrain < strainSize; ++iStrain) {
+            const std::string& totalName = std::string("total_strain") + strainSuffixes[iStrain];
+            if (2 == _dimension) {
+                _materialDB->addValue(totalName.c_str(), _Benchmark::zero2D, "none");
+            } else {
+                _materialDB->addValue(totalName.c_str(), _Benchmark::zero, "none");
+            } // if/else
+            for (size_t i = 0; i < 3; ++i) {
+                const std::string& viscousName = std::string("viscous_strain") + elementSuffixes[i] + strainSuffixes[iStrain];
+                if (2 == _dimension) {
+                    _materialDB->addValue(viscousName.c_str(), _Benchmark::zero2D, "none");
+                } else {
+                    _materialDB->addValue(viscousName.c_str(), _Benchmark::zero, "none");
+                } // if/else
+            } // for
+        } // for
+    } // if
+    _materialDB->setCoordSys(*_cs);
+
+    if (isGenMaxwell) {
+        _rheology = new pylith::materials::IsotropicLinearGenMaxwell;assert(_rheology);
+    } else {
+        _rheology = new pylith::materials::IsotropicLinearElasticity;assert(_rheology);
+    } // if/else
+    _material = new pylith::materials::Elasticity;assert(_material);
+    _material->setFormulation(pylith::problems::Physics::QUASISTATIC);
+    _material->useBodyForce(false);
+    _material->setDescription(isGenMaxwell ? "Isotropic linear generalized Maxwell" : "Isotropic linear elasticity");
+    _material->setLabelValue(1);
+    _material->setBulkRheology(_rheology);
+    _material->setAuxiliaryFieldDB(_materialDB);
+    const size_t numMatAuxSubfields = isGenMaxwell ? 7 : 3;
+    const char* matAuxSubfields[7] = {
+        "density",
+        "shear_modulus",
+        "bulk_modulus",
+        "maxwell_time",
+        "shear_modulus_ratio",
+        "viscous_strain",
+        "total_strain"
+    };
+    for (size_t i = 0; i < numMatAuxSubfields; ++i) {
+        _material->setAuxiliarySubfieldDiscretization(matAuxSubfields[i], 0, _basisOrder, _dimension,
+                                                      pylith::topology::FieldBase::DEFAULT_BASIS,
+                                                      pylith::topology::FieldBase::POLYNOMIAL_SPACE, true);
+    } // for
+
+    // Fault
+    _faultDB = new spatialdata::spatialdb::UserFunctionDB;assert(_faultDB);
+    _faultDB->setDescription("fault auxiliary field spatial database");
+    if (2 == _dimension) {
+        _faultDB->addValue("initiation_time", _Benchmark::zero2D, "s");
+        _faultDB->addValue("final_slip_opening", _Benchmark::zero2D, "m");
+        _faultDB->addValue("final_slip_left_lateral", _Benchmark::slip2D, "m");
+    } else {
+        _faultDB->addValue("initiation_time", _Benchmark::zero, "s");
+        _faultDB->addValue("final_slip_opening", _Benchmark::zero, "m");
+        _faultDB->addValue("final_slip_left_lateral", _Benchmark::slip, "m");
+        _faultDB->addValue("final_slip_reverse", _Benchmark::zero, "m");
+    } // if/else
+    _faultDB->setCoordSys(*_cs);
+
+    _kinSrc = new pylith::faults::KinSrcStep;assert(_kinSrc);
+    _kinSrc->setOriginTime(0.0);
+    _kinSrc->auxFieldDB(_faultDB);
+
+    _fault = new pylith::faults::FaultCohesiveKin;assert(_fault);
+    _fault->setCohesiveLabelValue(100);
+    _fault->setSurfaceLabelName("fault");
+    const char* ruptureNames[1] = { "rupture" };
+    pylith::faults::KinSrc* ruptures[1] = { _kinSrc };
+    _fault->setEqRuptures(ruptureNames, 1, ruptures, 1);
+    _fault->setAuxiliarySubfieldDiscretization("slip", 0, _basisOrder, _dimension-1,
+                                               pylith::topology::FieldBase::DEFAULT_BASIS,
+                                               pylith::topology::FieldBase::POLYNOMIAL_SPACE, true);
+    _fault->adjustTopology(_mesh);
+
+    // Distribute mesh when running in parallel.
+    int numProcs = 1;
+    MPI_Comm_size(_mesh->getComm(), &numProcs);
+    if (numProcs > 1) {
+        pylith::topology::Mesh* meshDist = new pylith::topology::Mesh;assert(meshDist);
+        pylith::faults::FaultCohesive* faults[1] = { _fault };
+        pylith::topology::Distributor::distribute(meshDist, *_mesh, faults, 1, "hilbert");
+        delete _mesh;_mesh = meshDist;
+        _mesh->setCoordSys(_cs);
+    } // if
+
+    // Solution
+    _solution = new pylith::topology::Field(*_mesh);assert(_solution);
+    _solution->setLabel("solution");
+    pylith::problems::SolutionFactory factory(*_solution, *_normalizer);
+    factory.addDisplacement(pylith::topology::Field::Discretization(_basisOrder, _basisOrder));
+    factory.addLagrangeMultiplierFault(pylith::topology::Field::Discretization(_basisOrder, _basisOrder, _dimension-1, -1, true));
+
+    // Problem
+    _problem = new pylith::problems::TimeDependent;assert(_problem);
+    _problem->setNormalizer(*_normalizer);
+    pylith::materials::Material* materials[1] = { _material };
+    _problem->setMaterials(materials, 1);
+    pylith::faults::FaultCohesive* interfaces[1] = { _fault };
+    _problem->setInterfaces(interfaces, 1);
+    _problem->setBoundaryConditions(NULL, 0);
+    _problem->setStartTime(0.0);
+    _problem->setEndTime(1.0);
+    _problem->setInitialTimeStep(1.0);
+    _problem->setMaxTimeSteps(1);
+    _problem->setFormulation(pylith::problems::Physics::QUASISTATIC);
+    _problem->setSolverType(pylith::problems::Problem::LINEAR);
+    _problem->setMatrixType(_matrixType.c_str());
+    _problem->setSolution(_solution);
+    _problem->preinitialize(*_mesh);
+    _problem->verifyConfiguration();
+    _problem->initialize();
+
+    PetscErrorCode err = 0;
+    err = VecDuplicate(_solution->getGlobalVector(), &_solutionDotVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(_solutionDotVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecSet(_solution->getGlobalVector(), 0.0);PYLITH_CHECK_ERROR(err);
+    _jacobianMat = _problem->_createJacobianMatrix();
+
+    // Evaluate the residual and Jacobian once through the problem to set the state of the
+    // integrators and the fields in the integration data.
+    const PylithReal t = 0.0;
+    const PylithReal dt = 1.0;
+    const PylithReal s_tshift = 1.0;
+    PetscVec residualVec = NULL;
+    err = VecDuplicate(_solution->getGlobalVector(), &residualVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeLHSResidual(residualVec, t, dt, _solution->getGlobalVector(), _solutionDotVec);
+    _problem->computeLHSJacobian(_jacobianMat, _jacobianMat, t, dt, s_tshift, _solution->getGlobalVector(), _solutionDotVec);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark residual for material.
+void
+pylith::testing::Benchmark::_benchmarkDomainResidual(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    // Quasistatic elasticity has all of the residual kernels on the LHS.
+    pylith::feassemble::IntegrationData* integrationData = _problem->_integrationData;assert(integrationData);
+    pylith::topology::Field* residual = integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
+
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    err = VecGetSize(_solution->getGlobalVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+
+    double time = 0.0;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem->_integrators[i]);
+        if (!integrator) { continue; }
+
+        for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+            residual->zeroLocal();
+            PetscLogDouble tStart = 0.0, tEnd = 0.0;
+            err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+            integrator->computeLHSResidual(residual, *integrationData);
+            err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+            time += tEnd - tStart;
+        } // for
+    } // for
+    _addResult("domain_residual", _getNumCells(_material->getLabelValue()), numDOF, time);
+
+    PYLITH_METHOD_END;
+} // _benchmarkDomainResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark Jacobian for material.
+void
+pylith::testing::Benchmark::_benchmarkDomainJacobian(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    pylith::feassemble::IntegrationData* integrationData = _problem->_integrationData;assert(integrationData);
+
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    err = VecGetSize(_solution->getGlobalVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+
+    double time = 0.0;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        pylith::feassemble::IntegratorDomain* integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem->_integrators[i]);
+        if (!integrator) { continue; }
+
+        for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+            err = MatZeroEntries(_jacobianMat);PYLITH_CHECK_ERROR(err);
+            PetscLogDouble tStart = 0.0, tEnd = 0.0;
+            err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+            integrator->computeLHSJacobian(_jacobianMat, _jacobianMat, *integrationData);
+            err = MatAssemblyBegin(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            err = MatAssemblyEnd(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+            time += tEnd - tStart;
+        } // for
+    } // for
+    _addResult("domain_jacobian", _getNumCells(_material->getLabelValue()), numDOF, time);
+
+    PYLITH_METHOD_END;
+} // _benchmarkDomainJacobian
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark multiplying vector by Jacobian.
+void
+pylith::testing::Benchmark::_benchmarkMatMult(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_jacobianMat);
+
+    // Nonzero pattern of Jacobian includes the material and the fault.
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    PetscVec xVec = NULL, yVec = NULL;
+    err = VecGetSize(_solution->getGlobalVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solution->getGlobalVector(), &xVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solution->getGlobalVector(), &yVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(xVec, 1.0);PYLITH_CHECK_ERROR(err);
+
+    double time = 0.0;
+    for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+        PetscLogDouble tStart = 0.0, tEnd = 0.0;
+        err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+        err = MatMult(_jacobianMat, xVec, yVec);PYLITH_CHECK_ERROR(err);
+        err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+        time += tEnd - tStart;
+    } // for
+    err = VecDestroy(&xVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&yVec);PYLITH_CHECK_ERROR(err);
+    _addResult("jacobian_matmult", _getNumCells(_material->getLabelValue()), numDOF, time);
+
+    PYLITH_METHOD_END;
+} // _benchmarkMatMult
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark residual and Jacobian for fault.
+void
+pylith::testing::Benchmark::_benchmarkInterface(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    pylith::feassemble::IntegrationData* integrationData = _problem->_integrationData;assert(integrationData);
+    pylith::topology::Field* residual = integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
+
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    err = VecGetSize(_solution->getGlobalVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+
+    double timeResidual = 0.0;
+    double timeJacobian = 0.0;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        pylith::feassemble::IntegratorInterface* integrator = dynamic_cast<pylith::feassemble::IntegratorInterface*>(_problem->_integrators[i]);
+        if (!integrator) { continue; }
+
+        for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+            residual->zeroLocal();
+            PetscLogDouble tStart = 0.0, tEnd = 0.0;
+            err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+            integrator->computeLHSResidual(residual, *integrationData);
+            err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+            timeResidual += tEnd - tStart;
+
+            err = MatZeroEntries(_jacobianMat);PYLITH_CHECK_ERROR(err);
+            err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+            integrator->computeLHSJacobian(_jacobianMat, _jacobianMat, *integrationData);
+            err = MatAssemblyBegin(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            err = MatAssemblyEnd(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+            timeJacobian += tEnd - tStart;
+        } // for
+    } // for
+    const PylithInt numCells = _getNumCells(_fault->getCohesiveLabelValue());
+    _addResult("interface_residual", numCells, numDOF, timeResidual);
+    _addResult("interface_jacobian", numCells, numDOF, timeJacobian);
+
+    PYLITH_METHOD_END;
+} // _benchmarkInterface
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark querying spatial database for field values.
+void
+pylith::testing::Benchmark::_benchmarkQuery(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_normalizer);
+
+    const PylithReal lengthScale = _normalizer->getLengthScale();
+
+    pylith::string_vector componentNames(_dimension);
+    componentNames[0] = "displacement_x";
+    componentNames[1] = "displacement_y";
+    if (3 == _dimension) {
+        componentNames[2] = "displacement_z";
+    } // if
+    pylith::topology::Field field(*_mesh);
+    field.setLabel("query");
+    field.subfieldAdd(pylith::topology::Field::Description("displacement", "displacement", componentNames, _dimension,
+                                                           pylith::topology::Field::VECTOR, lengthScale),
+                      pylith::topology::Field::Discretization(_basisOrder, _basisOrder, _dimension));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+    field.createGlobalVector();
+
+    spatialdata::spatialdb::UserFunctionDB db;
+    db.setDescription("displacement");
+    if (2 == _dimension) {
+        db.addValue("displacement_x", _Benchmark::disp_x2D, "m");
+        db.addValue("displacement_y", _Benchmark::disp_y2D, "m");
+    } else {
+        db.addValue("displacement_x", _Benchmark::disp_x, "m");
+        db.addValue("displacement_y", _Benchmark::disp_y, "m");
+        db.addValue("displacement_z", _Benchmark::disp_z, "m");
+    } // if/else
+    db.setCoordSys(*_cs);
+
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    err = VecGetSize(field.getGlobalVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::FieldQuery query(field);
+    query.initializeWithDefaultQueries();
+    query.openDB(&db, lengthScale);
+    double time = 0.0;
+    for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+        PetscLogDouble tStart = 0.0, tEnd = 0.0;
+        err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+        query.queryDB();
+        err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+        time += tEnd - tStart;
+    } // for
+    query.closeDB(&db);
+    _addResult("query_db", _getNumCells(_material->getLabelValue()), numDOF, time);
+
+    PYLITH_METHOD_END;
+} // _benchmarkQuery
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark writing field to HDF5, VTK, and VTU files.
+void
+pylith::testing::Benchmark::_benchmarkOutput(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_solution);
+
+    _solution->scatterLocalToOutput();
+    pylith::meshio::OutputSubfield* subfield = pylith::meshio::OutputSubfield::create(*_solution, *_mesh, "displacement", 1);
+    assert(subfield);
+
+    const std::string& filenameRoot = _outputFilename.substr(0, _outputFilename.find(".h5"));
+
+    pylith::meshio::DataWriterHDF5 writerHDF5;
+    writerHDF5.filename(_outputFilename.c_str());
+    _benchmarkWriter(&writerHDF5, subfield, "output_hdf5", _outputFilename.c_str());
+
+    pylith::meshio::DataWriterVTK writerVTK;
+    writerVTK.filename((filenameRoot + "_vtk.vtk").c_str());
+    _benchmarkWriter(&writerVTK, subfield, "output_vtk", (filenameRoot + "_vtk_t*.vtk").c_str());
+
+    pylith::meshio::DataWriterVTU writerVTU;
+    writerVTU.filename((filenameRoot + "_vtu.vtu").c_str());
+    _benchmarkWriter(&writerVTU, subfield, "output_vtu", (filenameRoot + "_vtu*").c_str());
+
+    delete subfield;subfield = NULL;
+
+    PYLITH_METHOD_END;
+} // _benchmarkOutput
+
+
+// ------------------------------------------------------------------------------------------------
+// Benchmark writing field with data writer.
+void
+pylith::testing::Benchmark::_benchmarkWriter(pylith::meshio::DataWriter* writer,
+                                             pylith::meshio::OutputSubfield* subfield,
+                                             const char* name,
+                                             const char* filePattern) {
+    PYLITH_METHOD_BEGIN;
+    assert(writer);
+    assert(subfield);
+
+    PetscErrorCode err = 0;
+    PetscInt numDOF = 0;
+    err = VecGetSize(subfield->getVector(), &numDOF);PYLITH_CHECK_ERROR(err);
+
+    writer->setTimeScale(_normalizer->getTimeScale());
+    const bool isInfo = false;
+    writer->open(*_mesh, isInfo);
+    double time = 0.0;
+    for (int iRepeat = 0; iRepeat < _numRepeat; ++iRepeat) {
+        const PylithReal t = iRepeat;
+        PetscLogDouble tStart = 0.0, tEnd = 0.0;
+        err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+        writer->openTimeStep(t, *_mesh);
+        subfield->project(_solution->getOutputVector());
+        writer->writeVertexField(t, *subfield);
+        writer->closeTimeStep();
+        err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+        time += tEnd - tStart;
+    } // for
+    writer->close();
+
+    const double diskUsage = _Benchmark::getDiskUsage(filePattern, _mesh->getComm());
+    _addResult(name, _getNumCells(_material->getLabelValue()), numDOF, time, diskUsage);
+
+    PYLITH_METHOD_END;
+} // _benchmarkWriter
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of cells with label value summed over processes.
+PylithInt
+pylith::testing::Benchmark::_getNumCells(const int labelValue) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+
+    PetscErrorCode err = 0;
+    PetscInt numCellsLocal = 0;
+    err = DMGetStratumSize(_mesh->getDM(), pylith::topology::Mesh::cells_label_name, labelValue, &numCellsLocal);PYLITH_CHECK_ERROR(err);
+
+    // Count only cells owned by this process.
+    PetscSF sf = NULL;
+    PetscInt numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(_mesh->getDM(), &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    if (numLeaves > 0) {
+        for (PetscInt i = 0; i < numLeaves; ++i) {
+            const PetscInt point = leaves ? leaves[i] : i;
+            PetscInt value = 0;
+            err = DMGetLabelValue(_mesh->getDM(), pylith::topology::Mesh::cells_label_name, point, &value);PYLITH_CHECK_ERROR(err);
+            if (value == labelValue) {
+                --numCellsLocal;
+            } // if
+        } // for
+    } // if
+
+    PetscInt numCells = 0;
+    err = MPI_Allreduce(&numCellsLocal, &numCells, 1, MPIU_INT, MPI_SUM, _mesh->getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(numCells);
+} // _getNumCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Add result of benchmark.
+void
+pylith::testing::Benchmark::_addResult(const char* name,
+                                       const PylithInt numCells,
+                                       const PylithInt numDOF,
+                                       const double time,
+                                       const double diskUsage) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+
+    Result result;
+    result.name = name;
+    result.numCells = numCells;
+    result.numDOF = numDOF;
+    result.numRepeat = _numRepeat;
+    PetscErrorCode err = MPI_Allreduce((void*)&time, &result.time, 1, MPI_DOUBLE, MPI_MAX, _mesh->getComm());PYLITH_CHECK_ERROR(err);
+    result.peakMemory = _Benchmark::getPeakMemory(_mesh->getComm());
+    result.diskUsage = diskUsage;
+    _results.push_back(result);
+
+    PYLITH_COMPONENT_INFO_ROOT("Benchmark " << name << ": " << numCells << " cells, " << numDOF << " DOFs, "
+                                            << result.time/_numRepeat << " s per repetition.");
+
+    PYLITH_METHOD_END;
+} // _addResult
+
+
+// End of file
@@ -0,0 +1,241 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file tests/benchmarks/Benchmark.hh
+ *
+ * @brief Throughput benchmarks for residual and Jacobian assembly, spatial database queries, and
+ * output.
+ *
+ * The benchmarks use a quasistatic elasticity problem on a synthetic box mesh (MeshIOBox) with a
+ * through-going fault at x=0 and call the low-level routines directly:
+ *
+ * - IntegratorDomain::computeLHSResidual() and computeLHSJacobian() for the material.
+ * - IntegratorInterface::computeLHSResidual() and computeLHSJacobian() for the fault.
+ * - FieldQuery::queryDB() for a vector field.
+ * - DataWriterHDF5, DataWriterVTK, and DataWriterVTU writeVertexField() for the displacement field.
+ * - MatMult() for the Jacobian.
+ *
+ * The bulk rheology is isotropic linear elasticity (default) or isotropic linear generalized Maxwell
+ * viscoelasticity with three Maxwell elements.
+ *
+ * Results (time, cells per second, DOFs per second, peak memory, and size of output files) are
+ * written as JSON.
+ */
+
+#if !defined(pylith_testing_benchmark_hh)
+#define pylith_testing_benchmark_hh
+
+#include "pylith/utils/PyreComponent.hh" // ISA PyreComponent
+
+#include "tests/src/testingfwd.hh" // forward declarations
+
+#include "pylith/problems/problemsfwd.hh" // HOLDSA TimeDependent
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+#include "pylith/materials/materialsfwd.hh" // HOLDSA Elasticity
+#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveKin
+#include "pylith/meshio/meshiofwd.hh" // USES DataWriter, OutputSubfield
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA UserFunctionDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CSCart
+#include "spatialdata/units/unitsfwd.hh" // HOLDSA Nondimensional
+
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
+
+#include <iosfwd> // USES std::ostream
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+class pylith::testing::Benchmark : public pylith::utils::PyreComponent {
+    // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Result of one benchmark.
+    struct Result {
+        std::string name; ///< Name of benchmark.
+        PylithInt numCells; ///< Number of cells (over all processes) processed in one repetition.
+        PylithInt numDOF; ///< Number of degrees of freedom (over all processes) in one repetition.
+        int numRepeat; ///< Number of repetitions.
+        double time; ///< Total time for all repetitions (maximum over processes) (s).
+        double peakMemory; ///< Peak resident memory after benchmark (maximum over processes) (MB).
+        double diskUsage; ///< Size of output files for all repetitions (MB); 0 if no files are written.
+    }; // Result
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    Benchmark(void);
+
+    /// Destructor.
+    ~Benchmark(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set dimension of box mesh.
+     *
+     * @param[in] value Dimension of mesh (2 or 3).
+     */
+    void setDimension(const int value);
+
+    /** Set number of cells along each edge of box mesh.
+     *
+     * @param[in] value Number of cells (must be even).
+     */
+    void setNumCellsPerEdge(const int value);
+
+    /** Set basis order for solution field.
+     *
+     * @param[in] value Basis order.
+     */
+    void setBasisOrder(const int value);
+
+    /** Set number of repetitions for each benchmark.
+     *
+     * @param[in] value Number of repetitions.
+     */
+    void setNumRepeat(const int value);
+
+    /** Set PETSc matrix type for Jacobian.
+     *
+     * @param[in] value Name of matrix type (aij, baij, or sbaij).
+     */
+    void setMatrixType(const char* value);
+
+    /** Set bulk rheology for material.
+     *
+     * @param[in] value Name of rheology (elastic or genmaxwell).
+     */
+    void setRheology(const char* value);
+
+    /** Set name of HDF5 file for output benchmark.
+     *
+     * @param[in] value Name of HDF5 file.
+     */
+    void setOutputFilename(const char* value);
+
+    /// Set up problem and run all benchmarks.
+    void run(void);
+
+    /** Get results of benchmarks.
+     *
+     * @returns Array of results.
+     */
+    const std::vector<Result>& getResults(void) const;
+
+    /** Write configuration and results in JSON format.
+     *
+     * @param[in] sout Output stream.
+     */
+    void writeJSON(std::ostream& sout) const;
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Create mesh, material, fault, and problem.
+    void _initialize(void);
+
+    /// Benchmark residual for material.
+    void _benchmarkDomainResidual(void);
+
+    /// Benchmark Jacobian for material.
+    void _benchmarkDomainJacobian(void);
+
+    /// Benchmark multiplying vector by Jacobian.
+    void _benchmarkMatMult(void);
+
+    /// Benchmark residual and Jacobian for fault.
+    void _benchmarkInterface(void);
+
+    /// Benchmark querying spatial database for field values.
+    void _benchmarkQuery(void);
+
+    /// Benchmark writing field to HDF5, VTK, and VTU files.
+    void _benchmarkOutput(void);
+
+    /** Benchmark writing field with data writer.
+     *
+     * @param[in] writer Data writer.
+     * @param[in] subfield Subfield to write.
+     * @param[in] name Name of benchmark.
+     * @param[in] filePattern Shell pattern matching names of files written by data writer.
+     */
+    void _benchmarkWriter(pylith::meshio::DataWriter* writer,
+                          pylith::meshio::OutputSubfield* subfield,
+                          const char* name,
+                          const char* filePattern);
+
+    /** Get number of cells with label value summed over processes.
+     *
+     * @param[in] labelValue Value of material-id label.
+     * @returns Number of cells.
+     */
+    PylithInt _getNumCells(const int labelValue) const;
+
+    /** Add result of benchmark.
+     *
+     * @param[in] name Name of benchmark.
+     * @param[in] numCells Number of cells processed in one repetition.
+     * @param[in] numDOF Number of degrees of freedom in one repetition.
+     * @param[in] time Time for all repetitions on this process.
+     * @param[in] diskUsage Size of output files (MB).
+     */
+    void _addResult(const char* name,
+                    const PylithInt numCells,
+                    const PylithInt numDOF,
+                    const double time,
+                    const double diskUsage=0.0);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    int _dimension; ///< Dimension of mesh.
+    int _numCellsPerEdge; ///< Number of cells along each edge of box mesh.
+    int _basisOrder; ///< Basis order for solution.
+    int _numRepeat; ///< Number of repetitions for each benchmark.
+    std::string _matrixType; ///< PETSc matrix type for Jacobian.
+    std::string _rheologyName; ///< Name of bulk rheology for material.
+    std::string _outputFilename; ///< Name of HDF5 file for output benchmark.
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+    pylith::problems::TimeDependent* _problem; ///< Time-dependent problem.
+    pylith::materials::Elasticity* _material; ///< Material.
+    pylith::materials::RheologyElasticity* _rheology; ///< Bulk rheology for material.
+    pylith::faults::FaultCohesiveKin* _fault; ///< Fault.
+    pylith::faults::KinSrcStep* _kinSrc; ///< Earthquake rupture for fault.
+    spatialdata::spatialdb::UserFunctionDB* _materialDB; ///< Spatial database for material properties.
+    spatialdata::spatialdb::UserFunctionDB* _faultDB; ///< Spatial database for fault rupture.
+    spatialdata::geocoords::CSCart* _cs; ///< Coordinate system.
+    spatialdata::units::Nondimensional* _normalizer; ///< Scales for nondimensionalization.
+    PetscVec _solutionDotVec; ///< Global vector for time derivative of solution.
+    PetscMat _jacobianMat; ///< Jacobian matrix.
+
+    std::vector<Result> _results; ///< Results of benchmarks.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    Benchmark(const Benchmark&); ///< Not implemented
+    const Benchmark& operator=(const Benchmark&); ///< Not implemented
+
+}; // Benchmark
+
+#endif // pylith_testing_benchmark_hh
+
+// End of file
@@ -0,0 +1,191 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBox.hh" // implementation of class methods
+
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::testing::MeshIOBox::MeshIOBox(void) :
+    _dimension(2),
+    _numCellsPerEdge(8),
+    _edgeLength(12.0e+3) {
+    PyreComponent::setName("meshiobox");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::testing::MeshIOBox::~MeshIOBox(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Set dimension of mesh.
+void
+pylith::testing::MeshIOBox::setDimension(const int value) {
+    if ((value < 2) || (value > 3)) {
+        std::ostringstream msg;
+        msg << "Dimension of box mesh (" << value << ") must be 2 or 3.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _dimension = value;
+} // setDimension
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of cells along each edge of the box.
+void
+pylith::testing::MeshIOBox::setNumCellsPerEdge(const int value) {
+    if ((value < 2) || (value % 2)) {
+        std::ostringstream msg;
+        msg << "Number of cells along each edge of box mesh (" << value << ") must be a positive, even number.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _numCellsPerEdge = value;
+} // setNumCellsPerEdge
+
+
+// ------------------------------------------------------------------------------------------------
+// Set length of each edge of the box.
+void
+pylith::testing::MeshIOBox::setEdgeLength(const double value) {
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Length of edge of box mesh (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _edgeLength = value;
+} // setEdgeLength
+
+
+// ------------------------------------------------------------------------------------------------
+// Write mesh.
+void
+pylith::testing::MeshIOBox::_write(void) const {
+    PYLITH_COMPONENT_LOGICERROR("Writing box mesh is not supported.");
+} // _write
+
+
+// ------------------------------------------------------------------------------------------------
+// Build mesh.
+void
+pylith::testing::MeshIOBox::_read(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_read()");
+
+    const int meshDim = _dimension;
+    const int spaceDim = _dimension;
+    const int numCorners = (2 == _dimension) ? 4 : 8;
+    const int nx = _numCellsPerEdge;
+    const int nv = nx + 1;
+    const int nz = (3 == _dimension) ? nx : 1;
+    const int nvz = (3 == _dimension) ? nv : 1;
+
+    int numVertices = 0;
+    int numCells = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+    int_array groupXNeg;
+    int_array groupXPos;
+    int_array groupFault;
+
+    // Build the mesh on process 0 as done for meshes read from files.
+    if (0 == _mesh->getCommRank()) {
+        numVertices = nv * nv * nvz;
+        numCells = nx * nx * nz;
+
+        const double dx = _edgeLength / nx;
+        const double x0 = -0.5 * _edgeLength;
+        coordinates.resize(numVertices*spaceDim);
+        for (int k = 0, iVertex = 0; k < nvz; ++k) {
+            for (int j = 0; j < nv; ++j) {
+                for (int i = 0; i < nv; ++i, ++iVertex) {
+                    coordinates[iVertex*spaceDim+0] = x0 + i*dx;
+                    coordinates[iVertex*spaceDim+1] = x0 + j*dx;
+                    if (3 == spaceDim) {
+                        coordinates[iVertex*spaceDim+2] = x0 + k*dx;
+                    } // if
+                } // for
+            } // for
+        } // for
+
+        // Vertices of quadrilaterals are ordered counterclockwise. Hexahedra list the vertices of
+        // the bottom face counterclockwise followed by the vertices of the top face.
+        cells.resize(numCells*numCorners);
+        for (int k = 0, iCell = 0; k < nz; ++k) {
+            for (int j = 0; j < nx; ++j) {
+                for (int i = 0; i < nx; ++i, ++iCell) {
+                    const int v0 = i + nv*(j + nv*k);
+                    PylithInt* cell = &cells[iCell*numCorners];
+                    cell[0] = v0;
+                    cell[1] = v0 + 1;
+                    cell[2] = v0 + 1 + nv;
+                    cell[3] = v0 + nv;
+                    if (3 == meshDim) {
+                        for (int iCorner = 0; iCorner < 4; ++iCorner) {
+                            cell[4+iCorner] = cell[iCorner] + nv*nv;
+                        } // for
+                    } // if
+                } // for
+            } // for
+        } // for
+        materialIds.resize(numCells);
+        materialIds = 1;
+
+        const int numVerticesFace = nv * nvz;
+        groupXNeg.resize(numVerticesFace);
+        groupXPos.resize(numVerticesFace);
+        groupFault.resize(numVerticesFace);
+        for (int k = 0, iVertex = 0; k < nvz; ++k) {
+            for (int j = 0; j < nv; ++j, ++iVertex) {
+                groupXNeg[iVertex] = nv*(j + nv*k);
+                groupXPos[iVertex] = nx + nv*(j + nv*k);
+                groupFault[iVertex] = nx/2 + nv*(j + nv*k);
+            } // for
+        } // for
+    } // if
+
+    pylith::meshio::MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim);
+    _setMaterials(materialIds);
+    if (0 == _mesh->getCommRank()) {
+        _setGroup("boundary_xneg", VERTEX, groupXNeg);
+        _setGroup("boundary_xpos", VERTEX, groupXPos);
+        _setGroup("fault", VERTEX, groupFault);
+    } // if
+    _distributeGroups();
+
+    PYLITH_METHOD_END;
+} // _read
+
+
+// End of file
@@ -0,0 +1,91 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file tests/benchmarks/MeshIOBox.hh
+ *
+ * @brief Synthetic box mesh of quadrilateral or hexahedral cells for benchmarks.
+ *
+ * The domain is [-L/2, +L/2] in each direction with the same number of cells along each edge. All
+ * cells have material id 1. The mesh has vertex groups `boundary_xneg` and `boundary_xpos` on the
+ * -x and +x boundaries and `fault` on the plane x=0 (requires an even number of cells along each
+ * edge).
+ */
+
+#if !defined(pylith_testing_meshiobox_hh)
+#define pylith_testing_meshiobox_hh
+
+#include "tests/src/testingfwd.hh" // forward declarations
+
+#include "pylith/meshio/MeshIO.hh" // ISA MeshIO
+
+class pylith::testing::MeshIOBox : public pylith::meshio::MeshIO {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    MeshIOBox(void);
+
+    /// Destructor
+    ~MeshIOBox(void);
+
+    /** Set dimension of mesh.
+     *
+     * @param[in] value Dimension of mesh (2 or 3).
+     */
+    void setDimension(const int value);
+
+    /** Set number of cells along each edge of the box.
+     *
+     * @param[in] value Number of cells along each edge.
+     */
+    void setNumCellsPerEdge(const int value);
+
+    /** Set length of each edge of the box.
+     *
+     * @param[in] value Length of edge (m).
+     */
+    void setEdgeLength(const double value);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Write mesh.
+    void _write(void) const;
+
+    /// Build mesh.
+    void _read(void);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    int _dimension; ///< Dimension of mesh.
+    int _numCellsPerEdge; ///< Number of cells along each edge.
+    double _edgeLength; ///< Length of each edge.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    MeshIOBox(const MeshIOBox&); ///< Not implemented
+    const MeshIOBox& operator=(const MeshIOBox&); ///< Not implemented
+
+}; // MeshIOBox
+
+#endif // pylith_testing_meshiobox_hh
+
+// End of file
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+"""Compare benchmark results (JSON) against a stored baseline.
+
+Exits with a nonzero status if the throughput (cells per second) of any benchmark drops below
+the baseline by more than the tolerance. Baselines depend on the machine, so none are stored in
+the repository; if the baseline file does not exist, the comparison is skipped.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+
+def load(filename):
+    """Load benchmark results from JSON file.
+    """
+    with open(filename, "r") as fin:
+        return json.load(fin)
+
+
+def compare(baseline, current, tolerance):
+    """Compare current results against baseline.
+
+    Returns list of names of benchmarks that regressed.
+    """
+    for key in ("dimension", "cells_per_edge", "basis_order", "matrix_type", "rheology", "num_procs"):
+        if baseline["configuration"].get(key) != current["configuration"].get(key):
+            print(f"WARNING: Configuration '{key}' differs: baseline={baseline['configuration'].get(key)}, "
+                  f"current={current['configuration'].get(key)}.")
+
+    baselineResults = {b["name"]: b for b in baseline["benchmarks"]}
+    regressions = []
+    print(f"{'Benchmark':24s} {'Baseline cells/s':>18s} {'Current cells/s':>18s} {'Ratio':>8s}")
+    for result in current["benchmarks"]:
+        name = result["name"]
+        if not name in baselineResults:
+            print(f"{name:24s} {'--':>18s} {result['cells_per_second']:18.4g} {'--':>8s}")
+            continue
+        rateBaseline = baselineResults[name]["cells_per_second"]
+        rateCurrent = result["cells_per_second"]
+        ratio = rateCurrent / rateBaseline if rateBaseline > 0.0 else 1.0
+        flag = ""
+        if ratio < 1.0 - tolerance:
+            regressions.append(name)
+            flag = " REGRESSION"
+        print(f"{name:24s} {rateBaseline:18.4g} {rateCurrent:18.4g} {ratio:8.3f}{flag}")
+    return regressions
+
+
+def main():
+    """Application driver.
+    """
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--baseline", action="store", dest="baseline", required=True, help="JSON file with baseline results.")
+    parser.add_argument("--current", action="store", dest="current", required=True, help="JSON file with current results.")
+    parser.add_argument("--tolerance", action="store", dest="tolerance", type=float, default=0.1,
+                        help="Allowed fractional decrease in cells per second.")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.baseline):
+        print(f"Skipping comparison: baseline file '{args.baseline}' does not exist. "
+              f"Create a baseline on this machine by copying the results, for example "
+              f"'cp {args.current} {args.baseline}'.")
+        return
+
+    regressions = compare(load(args.baseline), load(args.current), args.tolerance)
+    if regressions:
+        print(f"Performance regressions detected: {', '.join(regressions)}.")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
+
+
+# End of file
@@ -0,0 +1,293 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+#include <portinfo>
+
+#include "Benchmark.hh" // USES Benchmark
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::deallocate()
+#include "pylith/utils/journals.hh" // USES journals
+
+#include "petsc.h"
+#include <Python.h>
+
+#include <getopt.h> // USES getopt_long()
+#include <cstdlib> // USES atoi()
+#include <sstream> // USES std::istringstream
+#include <fstream> // USES std::ofstream
+#include <vector> // USES std::vector
+#include <string> // USES std::string
+#include <iostream> // USES std::cout
+#include <stdexcept> // USES std::exception
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace testing {
+        class BenchmarkDriver {
+            // PUBLIC METHODS /////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            BenchmarkDriver(void);
+
+            /** Run benchmarks.
+             *
+             * @param argc[in] Number of arguments passed.
+             * @param argv[in] Array of input arguments.
+             *
+             * @returns 1 if errors were detected, 0 otherwise.
+             */
+            int run(int argc,
+                    char* argv[]);
+
+            // PRIVATE METHODS ////////////////////////////////////////////////////////////////////
+private:
+
+            /** Parse command line arguments.
+             *
+             * @param argc[in] Number of arguments passed.
+             * @param argv[in] Array of input arguments.
+             */
+            void _parseArgs(int argc,
+                            char* argv[]);
+
+            /// Print help information.
+            void _printHelp(void);
+
+            /** Initialize PETSc.
+             *
+             * @param[in] programName Name of executable program.
+             */
+            int _initializePetsc(char* programName);
+
+            // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////
+private:
+
+            std::vector<std::string> _petscOptions; ///< PETSc options.
+            std::vector<std::string> _infoJournals; ///< Names of info journals to activate.
+            std::string _jsonFilename; ///< Name of JSON file for results (empty for stdout).
+            std::string _hdf5Filename; ///< Name of HDF5 file for output benchmark.
+            std::string _matrixType; ///< PETSc matrix type for Jacobian.
+            std::string _rheology; ///< Name of bulk rheology for material.
+            int _dimension; ///< Dimension of box mesh.
+            int _numCellsPerEdge; ///< Number of cells along each edge.
+            int _basisOrder; ///< Basis order of solution.
+            int _numRepeat; ///< Number of repetitions.
+            bool _showHelp; ///< Print help.
+
+        }; // BenchmarkDriver
+    } // testing
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::testing::BenchmarkDriver::BenchmarkDriver(void) :
+    _hdf5Filename("benchmark_output.h5"),
+    _matrixType("aij"),
+    _rheology("elastic"),
+    _dimension(2),
+    _numCellsPerEdge(64),
+    _basisOrder(1),
+    _numRepeat(10),
+    _showHelp(false) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Run benchmarks.
+int
+pylith::testing::BenchmarkDriver::run(int argc,
+                                      char* argv[]) {
+    _parseArgs(argc, argv);
+    if (_showHelp) {
+        _printHelp();
+        return 0;
+    } // if
+
+    int err = _initializePetsc(argv[0]);CHKERRQ(err);
+
+    // Initialize Python (needed for journals).
+    Py_Initialize();
+
+    for (size_t i = 0; i < _infoJournals.size(); ++i) {
+        pythia::journal::info_t(_infoJournals[i]).activate();
+    } // for
+
+    int result = 0;
+    try {
+        pylith::testing::Benchmark benchmark;
+        benchmark.setDimension(_dimension);
+        benchmark.setNumCellsPerEdge(_numCellsPerEdge);
+        benchmark.setBasisOrder(_basisOrder);
+        benchmark.setNumRepeat(_numRepeat);
+        benchmark.setMatrixType(_matrixType.c_str());
+        benchmark.setRheology(_rheology.c_str());
+        benchmark.setOutputFilename(_hdf5Filename.c_str());
+        benchmark.run();
+
+        int rank = 0;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+        if (!rank) {
+            if (_jsonFilename.empty()) {
+                benchmark.writeJSON(std::cout);
+            } else {
+                std::ofstream fout(_jsonFilename.c_str());
+                benchmark.writeJSON(fout);
+            } // if/else
+        } // if
+        benchmark.deallocate();
+    } catch (const std::exception& err) {
+        std::cerr << "Error running benchmarks: " << err.what() << std::endl;
+        result = 1;
+    } // try/catch
+
+    // Finalize Python
+    Py_Finalize();
+
+    // Finalize PETSc
+    pylith::topology::FieldOps::deallocate();
+    err = PetscFinalize();CHKERRQ(err);
+
+    return result;
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Parse command line arguments.
+void
+pylith::testing::BenchmarkDriver::_parseArgs(int argc,
+                                             char* argv[]) {
+    static struct option options[12] = {
+        {"help", no_argument, NULL, 'h'},
+        {"dim", required_argument, NULL, 'd'},
+        {"cells", required_argument, NULL, 'c'},
+        {"order", required_argument, NULL, 'o'},
+        {"repeat", required_argument, NULL, 'r'},
+        {"output", required_argument, NULL, 'j'},
+        {"hdf5", required_argument, NULL, 'f'},
+        {"matrix", required_argument, NULL, 'm'},
+        {"rheology", required_argument, NULL, 'e'},
+        {"petsc", required_argument, NULL, 'p'},
+        {"journal.info", required_argument, NULL, 'i'},
+        {0, 0, 0, 0}
+    };
+
+    while (true) {
+        const int c = getopt_long(argc, argv, "hd:c:o:r:j:f:m:e:p:i:", options, NULL);
+        if (-1 == c) { break; }
+        switch (c) {
+        case 'h':
+            _showHelp = true;
+            break;
+        case 'd':
+            _dimension = atoi(optarg);
+            break;
+        case 'c':
+            _numCellsPerEdge = atoi(optarg);
+            break;
+        case 'o':
+            _basisOrder = atoi(optarg);
+            break;
+        case 'r':
+            _numRepeat = atoi(optarg);
+            break;
+        case 'j':
+            _jsonFilename = optarg;
+            break;
+        case 'f':
+            _hdf5Filename = optarg;
+            break;
+        case 'm':
+            _matrixType = optarg;
+            break;
+        case 'e':
+            _rheology = optarg;
+            break;
+        case 'p':
+            _petscOptions.push_back(optarg);
+            break;
+        case 'i':
+            _infoJournals.push_back(optarg);
+            break;
+        case '?':
+            break;
+        default:
+            break;
+        } // switch
+    } // while
+} // _parseArgs
+
+
+// ------------------------------------------------------------------------------------------------
+// Print help information.
+void
+pylith::testing::BenchmarkDriver::_printHelp(void) {
+    std::cout << "Command line arguments:\n"
+              << "[--help] [--dim=DIM] [--cells=NUM] [--order=ORDER] [--repeat=NUM] [--output=FILE] [--hdf5=FILE] [--matrix=TYPE]\n"
+              << "[--rheology=NAME]\n\n"
+              << "    --help              Print help information to stdout and exit.\n"
+              << "    --dim=DIM           Dimension of box mesh, 2 (quad) or 3 (hex) (default: 2).\n"
+              << "    --cells=NUM         Number of cells along each edge, must be even (default: 64).\n"
+              << "    --order=ORDER       Basis order of solution (default: 1).\n"
+              << "    --repeat=NUM        Number of repetitions of each benchmark (default: 10).\n"
+              << "    --output=FILE       Write JSON results to FILE (default: stdout).\n"
+              << "    --hdf5=FILE         HDF5 file for output benchmarks; VTK and VTU files use the same root (default: benchmark_output.h5).\n"
+              << "    --matrix=TYPE       Matrix type for Jacobian, aij, baij, or sbaij (default: aij).\n"
+              << "    --rheology=NAME     Bulk rheology, elastic or genmaxwell (3 Maxwell elements) (default: elastic).\n"
+              << "    --petsc ARG=VALUE   Arguments to pass to PETSc. May be repeated for multiple arguments.\n"
+              << "    --journal.info=COMPONENT Activate info journal for COMPONENT. May be repeated.\n"
+              << std::endl;
+} // _printHelp
+
+
+// ------------------------------------------------------------------------------------------------
+// Initialize PETSc.
+int
+pylith::testing::BenchmarkDriver::_initializePetsc(char* programName) {
+    int argc = 1;
+    char** argv = new char*[argc+1];
+    argv[0] = programName;
+    argv[argc] = NULL; // C standard is argv[argc] == NULL.
+    PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+    delete[] argv;argv = NULL;
+
+    // Track peak memory usage.
+    err = PetscMemorySetGetMaximumUsage();CHKERRQ(err);
+
+    for (size_t i = 0; i < _petscOptions.size(); ++i) {
+        const size_t pos = _petscOptions[i].find_first_of('=');
+        if (pos < _petscOptions[i].length()) {
+            const std::string& arg = std::string("-") + _petscOptions[i].substr(0, pos);
+            const std::string& value = _petscOptions[i].substr(pos+1);
+            err = PetscOptionsSetValue(NULL, arg.c_str(), value.c_str());CHKERRQ(err);
+        } else {
+            const std::string& arg = std::string("-") + _petscOptions[i];
+            err = PetscOptionsSetValue(NULL, arg.c_str(), "");CHKERRQ(err);
+        } // if/else
+    } // for
+
+    return 0;
+} // _initializePetsc
+
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    return pylith::testing::BenchmarkDriver().run(argc, argv);
+} // main
+
+
+// End of file
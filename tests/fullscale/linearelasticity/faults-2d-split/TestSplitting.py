@@ -0,0 +1,77 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+import unittest
+import numpy
+
+from pylith.testing.FullTestApp import FullTestCase
+from pylith.testing import has_h5py
+
+
+# -------------------------------------------------------------------------------------------------
+class TestSplitting(FullTestCase):
+    """Insert the cohesive cells after distributing the mesh when a process has fault vertices but
+    none of the fault faces. The fault faces are added to the overlap before inserting the cohesive
+    cells, so the run succeeds and gives the uniform displacement of the rigid-body translation.
+    """
+    NPROCS = 3
+    DISPLACEMENT = [1.5, -0.5]
+
+    def setUp(self):
+        super().setUp()
+        self.name = "splitting"
+
+        FullTestCase.run_pylith(self, self.name, ["pylithapp.cfg"], nprocs=self.NPROCS)
+        return
+
+    def test_output(self):
+        if not has_h5py():
+            return
+        import h5py
+
+        filename = "output/{name}-domain.h5".format(name=self.name)
+        h5 = h5py.File(filename, "r")
+        disp = h5["vertex_fields/displacement"][:]
+        h5.close()
+
+        # Vertices on the fault are duplicated, but the slip is zero, so all vertices have the
+        # same displacement.
+        tolerance = 1.0e-6
+        dispE = numpy.zeros(disp.shape)
+        dispE[:, :, :] = self.DISPLACEMENT
+        numpy.testing.assert_allclose(disp, dispE, rtol=tolerance, atol=tolerance)
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestSplitting,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -16,8 +16,10 @@
 # ----------------------------------------------------------------------
 
 import unittest
+import numpy
 
 from pylith.testing.FullTestApp import (FullTestCase, Check)
+from pylith.testing import has_h5py
 
 import meshes
 import shearnoslip_soln
@@ -70,8 +72,48 @@ class TestCase(FullTestCase):
             ),
         ]
 
-    def run_pylith(self, testName, args):
-        FullTestCase.run_pylith(self, testName, args, shearnoslip_gendb.GenerateDB)
+    def run_pylith(self, testName, args, nprocs=1):
+        FullTestCase.run_pylith(self, testName, args, shearnoslip_gendb.GenerateDB, nprocs=nprocs)
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCaseParallel(TestCase):
+    """Insert the cohesive cells after distributing the mesh and compare the solution with the
+    one from the serial run that inserts the cohesive cells before distributing the mesh.
+    """
+
+    def test_serial_insertion(self):
+        if not has_h5py():
+            return
+        import h5py
+
+        for mesh_entity in ["domain", "boundary_ypos"]:
+            filename = "output/{name}-{mesh_entity}.h5".format(name=self.name, mesh_entity=mesh_entity)
+            filenameSerial = "output/{name}-{mesh_entity}.h5".format(name=self.nameSerial, mesh_entity=mesh_entity)
+            with self.subTest(filename=filename):
+                h5 = h5py.File(filename, "r")
+                vertices = h5["geometry/vertices"][:]
+                disp = h5["vertex_fields/displacement"][:]
+                h5.close()
+
+                h5 = h5py.File(filenameSerial, "r")
+                verticesSerial = h5["geometry/vertices"][:]
+                dispSerial = h5["vertex_fields/displacement"][:]
+                h5.close()
+
+                self.assertEqual(verticesSerial.shape, vertices.shape)
+                self.assertEqual(dispSerial.shape, disp.shape)
+
+                # Vertex order depends on the partitioning, so we match vertices by coordinates.
+                # Vertices on the fault are duplicated, but the slip is zero, so the duplicates have
+                # the same displacement.
+                tolerance = 1.0e-6
+                lengthScale = numpy.max(numpy.abs(verticesSerial))
+                for iVertex, vertex in enumerate(vertices):
+                    dist = numpy.max(numpy.abs(verticesSerial - vertex), axis=1)
+                    iSerial = numpy.argmin(dist)
+                    self.assertLess(dist[iSerial], tolerance*lengthScale)
+                    numpy.testing.assert_allclose(disp[:, iVertex, :], dispSerial[:, iSerial, :], rtol=tolerance, atol=tolerance)
 
 
 # -------------------------------------------------------------------------------------------------
@@ -98,11 +140,43 @@ class TestTriGmsh(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestQuadGmshParallel(TestCaseParallel):
+
+    def setUp(self):
+        self.name = "shearnoslip_parallel_quad"
+        self.nameSerial = "shearnoslip_quad"
+        self.mesh = meshes.QuadGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.nameSerial, ["shearnoslip.cfg", "shearnoslip_quad.cfg"])
+        TestCase.run_pylith(self, self.name, ["shearnoslip.cfg", "shearnoslip_quad.cfg",
+                                              "shearnoslip_parallel_quad.cfg"], nprocs=2)
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTriGmshParallel(TestCaseParallel):
+
+    def setUp(self):
+        self.name = "shearnoslip_parallel_tri"
+        self.nameSerial = "shearnoslip_tri"
+        self.mesh = meshes.TriGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.nameSerial, ["shearnoslip.cfg", "shearnoslip_tri.cfg"])
+        TestCase.run_pylith(self, self.name, ["shearnoslip.cfg", "shearnoslip_tri.cfg",
+                                              "shearnoslip_parallel_tri.cfg"], nprocs=3)
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
         TestQuadGmsh,
         TestTriGmsh,
+        TestQuadGmshParallel,
+        TestTriGmshParallel,
     ]
 
 
@@ -69,8 +69,8 @@ class TestCase(FullTestCase):
             ),
         ]
 
-    def run_pylith(self, testName, args):
-        FullTestCase.run_pylith(self, testName, args)
+    def run_pylith(self, testName, args, nprocs=1):
+        FullTestCase.run_pylith(self, testName, args, nprocs=nprocs)
 
 
 # -------------------------------------------------------------------------------------------------
@@ -121,6 +121,21 @@ class TestTriCubit(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestTriCubitParallel(TestCase):
+    """Read the mesh in parallel, which inserts the cohesive cells after distributing the mesh.
+    """
+
+    def setUp(self):
+        self.name = "threeblocks_cubit_parallel_tri"
+        self.mesh = meshes.TriCubit()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["threeblocks.cfg", "threeblocks_cubit_tri.cfg",
+                                              "threeblocks_cubit_parallel_tri.cfg"], nprocs=3)
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 class TestQuadGmshIC(TestCase):
 
@@ -152,6 +167,7 @@ def test_cases():
         TestTriGmsh,
         TestQuadCubit,
         TestTriCubit,
+        TestTriCubitParallel,
         TestQuadGmshIC,
         TestTriGmshIC,
     ]
@@ -0,0 +1,143 @@
+#!/usr/bin/env nemesis
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+
+import unittest
+import re
+import subprocess
+
+import numpy
+
+from pylith.testing.FullTestApp import FullTestCase
+
+
+# -------------------------------------------------------------------------------------------------
+class TestCase(FullTestCase):
+    """Compare Green's functions computed with the linear solver with and without the projection
+    basis for the initial guess.
+
+    We run PyLith in a separate process so that we can capture the number of iterations the linear
+    solver takes for each impulse.
+    """
+    TOLERANCE = 1.0e-6
+    RE_ITERATIONS = re.compile(r"Linear solve converged due to \w+ iterations (\d+)")
+
+    # Number of iterations for each impulse from runs already done, keyed by simulation name.
+    _iterations = {}
+
+    def setUp(self):
+        if not self.RUN_PYLITH:
+            self.skipTest("Test requires running PyLith.")
+
+        self.iterations = self._run(self.name, [])
+        self.iterationsNone = self._run(self.name + "_none", ["--problem.projection_basis_size=0"])
+        return
+
+    def test_iterations(self):
+        self.assertEqual(self.nimpulses, len(self.iterations))
+        self.assertEqual(self.nimpulses, len(self.iterationsNone))
+
+        # Initial guess for first impulse is zero in both cases.
+        self.assertEqual(self.iterationsNone[0], self.iterations[0])
+        for i, (n, nNone) in enumerate(zip(self.iterations[1:], self.iterationsNone[1:])):
+            with self.subTest(impulse=i+1):
+                self.assertLessEqual(n, nNone)
+        self.assertLess(sum(self.iterations[1:]), sum(self.iterationsNone[1:]))
+        return
+
+    def test_output(self):
+        import h5py
+
+        outputs = (
+            ("domain", "displacement"),
+            ("bc_ypos", "displacement"),
+            ("fault", "slip"),
+        )
+        for mesh_entity, field_name in outputs:
+            filename = f"output/{self.name}-{mesh_entity}.h5"
+            filenameNone = f"output/{self.name}_none-{mesh_entity}.h5"
+            with self.subTest(filename=filename):
+                with h5py.File(filename, "r") as h5, h5py.File(filenameNone, "r") as h5None:
+                    field = h5["vertex_fields/" + field_name][:]
+                    fieldNone = h5None["vertex_fields/" + field_name][:]
+                self.assertEqual(fieldNone.shape, field.shape)
+                self.assertEqual(self.nimpulses, field.shape[0])
+                scale = max(numpy.max(numpy.abs(fieldNone)), 1.0)
+                self.assertLess(numpy.max(numpy.abs(field - fieldNone)), self.TOLERANCE * scale)
+        return
+
+    def _run(self, name, args):
+        """Run PyLith, if not already run, and return number of linear solver iterations for each impulse.
+        """
+        if name in TestCase._iterations:
+            return TestCase._iterations[name]
+
+        cmd = ["pylith"] + self.cfgfiles + [
+            f"--problem.defaults.name={name}",
+            f"--dump_parameters.filename=output/{name}-parameters.json",
+            f"--problem.progress_monitor.filename=output/{name}-progress.txt",
+            ] + args
+        if self.VERBOSITY > 0:
+            print("Running Pylith with args '{}' ...".format(" ".join(cmd[1:])))
+        result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+        if self.VERBOSITY > 0:
+            print(result.stdout)
+        self.assertEqual(0, result.returncode, result.stdout)
+        iterations = [int(n) for n in self.RE_ITERATIONS.findall(result.stdout)]
+        TestCase._iterations[name] = iterations
+        return iterations
+
+
+# -------------------------------------------------------------------------------------------------
+class TestQuad(TestCase):
+
+    def setUp(self):
+        self.name = "projectionbasis_quad"
+        self.cfgfiles = ["projectionbasis.cfg", "projectionbasis_quad.cfg"]
+        self.nimpulses = 10
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTri(TestCase):
+
+    def setUp(self):
+        self.name = "projectionbasis_tri"
+        self.cfgfiles = ["projectionbasis.cfg", "projectionbasis_tri.cfg"]
+        self.nimpulses = 9
+        super().setUp()
+
+
+# -------------------------------------------------------------------------------------------------
+def test_cases():
+    return [
+        TestQuad,
+        TestTri,
+    ]
+
+
+# -------------------------------------------------------------------------------------------------
+if __name__ == '__main__':
+    FullTestCase.parse_args()
+
+    suite = unittest.TestSuite()
+    for test in test_cases():
+        suite.addTest(unittest.makeSuite(test))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
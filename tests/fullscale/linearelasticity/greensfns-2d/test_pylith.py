@@ -39,6 +39,10 @@ class TestApp(TestDriver):
         for test in TestLeftLateral.test_cases():
             suite.addTest(unittest.makeSuite(test))
 
+        import TestProjectionBasis
+        for test in TestProjectionBasis.test_cases():
+            suite.addTest(unittest.makeSuite(test))
+
         return suite
 
 
@@ -116,6 +116,17 @@ class TestQuad(TestCase):
         TestCase.run_pylith(self, self.name, ["terzaghi.cfg", "terzaghi_quad.cfg"])
 
 
+# -------------------------------------------------------------------------------------------------
+class TestQuadFixedStress(TestCase):
+
+    def setUp(self):
+        self.name = "terzaghi_quad_fixedstress"
+        self.mesh = meshes.Quad()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["terzaghi.cfg", "terzaghi_quad_fixedstress.cfg"])
+
+
 # -------------------------------------------------------------------------------------------------
 class TestTri(TestCase):
 
@@ -131,6 +142,7 @@ class TestTri(TestCase):
 def test_cases():
     return [
         TestQuad,
+        TestQuadFixedStress,
         TestTri,
     ]
 
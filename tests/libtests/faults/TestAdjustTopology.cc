@@ -21,6 +21,7 @@
 #include "TestAdjustTopology.hh"
 
 #include "tests/src/FaultCohesiveStub.hh" // USES FaultsCohesiveStub
+#include "pylith/faults/TopologyOps.hh" // USES TopologyOps
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
@@ -33,6 +34,42 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+#include <map> // USES std::map
+#include <algorithm> // USES std::sort
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _TestAdjustTopology {
+public:
+
+            /** Compare cohesive cells using label value and then coordinates of centroids.
+             *
+             * Coordinates are compared using a tolerance, so the order does not depend on roundoff.
+             *
+             * @param[in] a Cohesive cell.
+             * @param[in] b Cohesive cell.
+             * @returns True if a is less than b.
+             */
+            static
+            bool lessThan(const pylith::scalar_array& a,
+                          const pylith::scalar_array& b) {
+                const PylithReal tolerance = 1.0e-6;
+                const size_t size = std::min(a.size(), b.size());
+                for (size_t i = 0; i < size; ++i) {
+                    if (a[i] < b[i] - tolerance) {
+                        return true;
+                    } else if (a[i] > b[i] + tolerance) {
+                        return false;
+                    } // if/else
+                } // for
+                return a.size() < b.size();
+            } // lessThan
+
+        }; // _TestAdjustTopology
+    } // faults
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 // Setup testing _data->
 void
@@ -71,19 +108,7 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
 
     for (size_t i = 0; i < _data->numFaults; ++i) {
         FaultCohesiveStub fault;
-
-        CPPUNIT_ASSERT(_data->interfaceIds);
-        CPPUNIT_ASSERT(_data->faultSurfaceLabels);
-        CPPUNIT_ASSERT(_data->faultEdgeLabels);
-
-        fault.setCohesiveLabelName(pylith::topology::Mesh::cells_label_name);
-        fault.setCohesiveLabelValue(_data->interfaceIds[i]);
-        fault.setSurfaceLabelName(_data->faultSurfaceLabels[i]);
-        fault.setSurfaceLabelValue(1);
-        if (_data->faultEdgeLabels[i]) {
-            fault.setBuriedEdgesLabelName(_data->faultEdgeLabels[i]);
-            fault.setBuriedEdgesLabelValue(1);
-        } // if
+        _setupFault(&fault, i);
         if (!_data->failureExpected) {
             fault.adjustTopology(_mesh);
         } else {
@@ -98,6 +123,122 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
     PetscViewerPopFormat(PETSC_VIEWER_STDOUT_WORLD);
 #endif
 
+    _checkMesh(true);
+
+    PYLITH_METHOD_END;
+} // testAdjustTopology
+
+
+// ------------------------------------------------------------------------------------------------
+// Test adjustTopologyMultiple().
+void
+pylith::faults::TestAdjustTopology::testAdjustTopologyMultiple(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    const size_t numFaults = _data->numFaults;
+    FaultCohesiveStub* faultsArray = new FaultCohesiveStub[numFaults];
+    FaultCohesive** faults = new FaultCohesive*[numFaults];
+    for (size_t i = 0; i < numFaults; ++i) {
+        _setupFault(&faultsArray[i], i);
+        faults[i] = &faultsArray[i];
+    } // for
+    if (!_data->failureExpected) {
+        FaultCohesive::adjustTopologyMultiple(_mesh, faults, numFaults);
+    } else {
+        CPPUNIT_ASSERT_THROW(FaultCohesive::adjustTopologyMultiple(_mesh, faults, numFaults), std::runtime_error);
+    } // if/else
+    delete[] faults;faults = NULL;
+    delete[] faultsArray;faultsArray = NULL;
+    if (_data->failureExpected) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Cells may be ordered differently than when the faults are inserted one at a time.
+    _checkMesh(false);
+
+    std::vector<pylith::scalar_array> cohesiveCells;
+    _getCohesiveCells(&cohesiveCells);
+
+    // Cohesive cells must match those from inserting the faults one at a time.
+    _initialize();
+    for (size_t i = 0; i < numFaults; ++i) {
+        FaultCohesiveStub fault;
+        _setupFault(&fault, i);
+        fault.adjustTopology(_mesh);
+    } // for
+    std::vector<pylith::scalar_array> cohesiveCellsE;
+    _getCohesiveCells(&cohesiveCellsE);
+
+    CPPUNIT_ASSERT_EQUAL(cohesiveCellsE.size(), cohesiveCells.size());
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iCell = 0; iCell < cohesiveCells.size(); ++iCell) {
+        CPPUNIT_ASSERT_EQUAL(cohesiveCellsE[iCell].size(), cohesiveCells[iCell].size());
+        for (size_t i = 0; i < cohesiveCells[iCell].size(); ++i) {
+            std::ostringstream msg;
+            msg << "Mismatch in cohesive cell " << iCell << " for value " << i << ".";
+            CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str().c_str(), cohesiveCellsE[iCell][i], cohesiveCells[iCell][i], tolerance);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testAdjustTopologyMultiple
+
+
+// ------------------------------------------------------------------------------------------------
+void
+pylith::faults::TestAdjustTopology::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;CPPUNIT_ASSERT(_mesh);
+
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(_data->filename);
+    iohandler.read(_mesh);
+    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumCells(*_mesh) > 0);
+    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumVertices(*_mesh) > 0);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup fault.
+void
+pylith::faults::TestAdjustTopology::_setupFault(FaultCohesiveStub* fault,
+                                                const size_t index) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(fault);
+    CPPUNIT_ASSERT(_data);
+    CPPUNIT_ASSERT(_data->interfaceIds);
+    CPPUNIT_ASSERT(_data->faultSurfaceLabels);
+    CPPUNIT_ASSERT(_data->faultEdgeLabels);
+
+    fault->setCohesiveLabelName(pylith::topology::Mesh::cells_label_name);
+    fault->setCohesiveLabelValue(_data->interfaceIds[index]);
+    fault->setSurfaceLabelName(_data->faultSurfaceLabels[index]);
+    fault->setSurfaceLabelValue(1);
+    if (_data->faultEdgeLabels[index]) {
+        fault->setBuriedEdgesLabelName(_data->faultEdgeLabels[index]);
+        fault->setBuriedEdgesLabelValue(1);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupFault
+
+
+// ------------------------------------------------------------------------------------------------
+// Check mesh against test data.
+void
+pylith::faults::TestAdjustTopology::_checkMesh(const bool checkCellOrder) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
     CPPUNIT_ASSERT_EQUAL(_data->cellDim, size_t(_mesh->getDimension()));
     PetscDM dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
 
@@ -134,6 +275,7 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
     err = DMGetLabel(dmMesh, cellsLabelName, &labelMaterials);PYLITH_CHECK_ERROR(err);
     CPPUNIT_ASSERT(labelMaterials);
     const PetscInt idDefault = -999;
+    std::map<int, size_t> materialCounts, materialCountsE;
     for (PetscInt c = cStart, cell = 0; c < cEnd; ++c, ++cell) {
         PetscInt value;
 
@@ -141,9 +283,18 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
         if (value == -1) {
             value = idDefault;
         } // if
+        if (checkCellOrder) {
+            std::ostringstream msg;
+            msg << "Mismatch in '"<<cellsLabelName<<"' for cell "<<cell<<".";
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), _data->materialIds[cell], value);
+        } // if
+        materialCounts[value] += 1;
+        materialCountsE[_data->materialIds[cell]] += 1;
+    } // for
+    for (std::map<int, size_t>::const_iterator iter = materialCountsE.begin(); iter != materialCountsE.end(); ++iter) {
         std::ostringstream msg;
-        msg << "Mismatch in '"<<cellsLabelName<<"' for cell "<<cell<<".";
-        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), _data->materialIds[cell], value);
+        msg << "Mismatch in number of cells with '"<<cellsLabelName<<"' value "<<iter->first<<".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), iter->second, materialCounts[iter->first]);
     } // for
 
     // Check groups
@@ -193,25 +344,66 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
         CPPUNIT_ASSERT_MESSAGE(msg.str().c_str(), foundGroup);
     } // for
 
-} // testAdjustTopology
+    PYLITH_METHOD_END;
+} // _checkMesh
 
 
 // ------------------------------------------------------------------------------------------------
+// Get cohesive cells sorted by label value and coordinates of vertices.
 void
-pylith::faults::TestAdjustTopology::_initialize(void) {
+pylith::faults::TestAdjustTopology::_getCohesiveCells(std::vector<pylith::scalar_array>* cohesiveCells) {
     PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(cohesiveCells);
+    CPPUNIT_ASSERT(_mesh);
     CPPUNIT_ASSERT(_data);
 
-    delete _mesh;_mesh = new pylith::topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    PetscDM dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
+    const size_t spaceDim = _data->spaceDim;
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    pylith::scalar_array coordsCell;
 
-    pylith::meshio::MeshIOAscii iohandler;
-    iohandler.setFilename(_data->filename);
-    iohandler.read(_mesh);
-    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumCells(*_mesh) > 0);
-    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumVertices(*_mesh) > 0);
+    PetscErrorCode err = 0;
+    PetscDMLabel labelMaterials = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &labelMaterials);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(labelMaterials);
+
+    cohesiveCells->clear();
+    for (size_t iFault = 0; iFault < _data->numFaults; ++iFault) {
+        const PetscInt labelValue = _data->interfaceIds[iFault];
+        PetscIS cellsIS = NULL;
+        PetscInt numCells = 0;
+        const PetscInt* cells = NULL;
+        err = DMLabelGetStratumIS(labelMaterials, labelValue, &cellsIS);PYLITH_CHECK_ERROR(err);
+        if (!cellsIS) { continue; }
+        err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+            PylithInt adjacentCells[3];
+            adjacentCells[0] = cells[iCell];
+            TopologyOps::getAdjacentCells(&adjacentCells[1], &adjacentCells[2], dmMesh, cells[iCell]);
+
+            pylith::scalar_array cohesiveCell(0.0, 1 + 3*spaceDim);
+            cohesiveCell[0] = labelValue;
+            for (size_t i = 0; i < 3; ++i) {
+                coordsVisitor.getClosure(&coordsCell, adjacentCells[i]);
+                const size_t numVertices = coordsCell.size() / spaceDim;
+                CPPUNIT_ASSERT(numVertices > 0);
+                for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+                    for (size_t iDim = 0; iDim < spaceDim; ++iDim) {
+                        cohesiveCell[1+i*spaceDim+iDim] += coordsCell[iVertex*spaceDim+iDim] / numVertices;
+                    } // for
+                } // for
+            } // for
+            cohesiveCells->push_back(cohesiveCell);
+        } // for
+        err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    std::sort(cohesiveCells->begin(), cohesiveCells->end(), _TestAdjustTopology::lessThan);
 
     PYLITH_METHOD_END;
-} // _initialize
+} // _getCohesiveCells
 
 
 // ------------------------------------------------------------------------------------------------
@@ -28,6 +28,10 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "pylith/topology/topologyfwd.hh" // USES PETSc Mesh
+#include "pylith/testing/testingfwd.hh" // USES FaultCohesiveStub
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+
+#include <vector> // USES std::vector
 
 /// Namespace for pylith package
 namespace pylith {
@@ -43,6 +47,7 @@ class pylith::faults::TestAdjustTopology : public CppUnit::TestFixture {
     CPPUNIT_TEST_SUITE(TestAdjustTopology);
 
     CPPUNIT_TEST(testAdjustTopology);
+    CPPUNIT_TEST(testAdjustTopologyMultiple);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -58,6 +63,9 @@ public:
     /// Test adjustTopology().
     void testAdjustTopology(void);
 
+    /// Test adjustTopologyMultiple().
+    void testAdjustTopologyMultiple(void);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -70,6 +78,30 @@ private:
     /// Setup mesh.
     void _initialize();
 
+    /** Setup fault.
+     *
+     * @param[out] fault Fault to setup.
+     * @param[in] index Index of fault in test data.
+     */
+    void _setupFault(FaultCohesiveStub* fault,
+                     const size_t index);
+
+    /** Check mesh against test data.
+     *
+     * @param[in] checkCellOrder Check material ids in order of cells, otherwise check number of cells with
+     * each material id.
+     */
+    void _checkMesh(const bool checkCellOrder);
+
+    /** Get cohesive cells sorted by label value and coordinates of vertices.
+     *
+     * Each cohesive cell is represented by the label value, the centroid of the cohesive cell, and the
+     * centroids of the adjacent cells on the negative and positive sides of the fault.
+     *
+     * @param[out] cohesiveCells Array of cohesive cells.
+     */
+    void _getCohesiveCells(std::vector<pylith::scalar_array>* cohesiveCells);
+
 }; // class TestAdjustTopology
 
 class pylith::faults::TestAdjustTopology_Data {
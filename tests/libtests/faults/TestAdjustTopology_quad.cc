@@ -418,6 +418,52 @@ namespace pylith {
         }; // TestAdjustTopology_QuadI
         CPPUNIT_TEST_SUITE_REGISTRATION(TestAdjustTopology_QuadI);
 
+        // ----------------------------------------------------------------------------------------
+        class TestAdjustTopology_QuadJ : public TestAdjustTopology {
+            CPPUNIT_TEST_SUB_SUITE(TestAdjustTopology_QuadJ, TestAdjustTopology);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestAdjustTopology::setUp();
+
+                _data->filename = "data/quad_j.mesh";
+
+                _data->numFaults = 2;
+                static const char* const faultSurfaceLabels[2] = { "faultA", "faultB" };
+                _data->faultSurfaceLabels = const_cast<const char**>(faultSurfaceLabels);
+                static const char* const faultEdgeLabels[2] = { NULL, "faultB-edge" };
+                _data->faultEdgeLabels = const_cast<const char**>(faultEdgeLabels);
+                static const int interfaceIds[2] = { 100, 101 };
+                _data->interfaceIds = const_cast<const int*>(interfaceIds);
+
+                _data->cellDim = 2;
+                _data->spaceDim = 2;
+                _data->numVertices = 19;
+
+                static const size_t numCells = 11;
+                _data->numCells = numCells;
+
+                static const int numCorners[numCells] = {
+                    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, };
+                _data->numCorners = const_cast<int*>(numCorners);
+                static const int materialIds[numCells] = {
+                    10, 10, 10, 10, 10, 10, 10, 10,
+                    101, 100, 100, };
+                _data->materialIds = const_cast<int*>(materialIds);
+
+                static const size_t numGroups = 3;
+                _data->numGroups = numGroups;
+                static const int groupSizes[numGroups] = { 6+4, 3+2, 1 }; // vertices + edges
+                _data->groupSizes = const_cast<int*>(groupSizes);
+                static const char* groupNames[numGroups] = { "faultA", "faultB", "faultB-edge" };
+                _data->groupNames = const_cast<char**>(groupNames);
+                static const char* groupTypes[numGroups] = { "vertex", "vertex", "vertex" };
+                _data->groupTypes = const_cast<char**>(groupTypes);
+            } // setUp
+
+        }; // TestAdjustTopology_QuadJ
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestAdjustTopology_QuadJ);
+
     } // faults
 } // pylith
 
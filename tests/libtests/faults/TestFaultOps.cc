@@ -0,0 +1,465 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/faults/FaultOps.hh" // USES FaultOps
+
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <cmath> // USES fabs()
+#include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
+
+namespace pylith {
+    namespace faults {
+        class TestFaultOps;
+    } // faults
+} // pylith
+
+class pylith::faults::TestFaultOps : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestFaultOps);
+
+    CPPUNIT_TEST(testMarkSideDOF);
+    CPPUNIT_TEST(testCreateSchurPrecond);
+    CPPUNIT_TEST(testCreateSchurPrecondDirichlet);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test IntegratorInterface::markSideDOF().
+    void testMarkSideDOF(void);
+
+    /// Test createSchurPrecond().
+    void testCreateSchurPrecond(void);
+
+    /// Test createSchurPrecond() with Dirichlet boundary condition on one component at fault vertices.
+    void testCreateSchurPrecondDirichlet(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////
+private:
+
+    /** Read mesh, insert cohesive cells, and create solution field.
+     *
+     * @param[in] useDirichlet Constrain the x component of the displacement on the 'output' boundary.
+     */
+    void _initialize(const bool useDirichlet);
+
+    /** Check createSchurPrecond() against Schur complement computed from dense matrices.
+     *
+     * @param[in] hasConstrainedDOF True if some fault vertices have constrained displacement DOF.
+     */
+    void _testCreateSchurPrecond(const bool hasConstrainedDOF);
+
+    /** Get value of Jacobian used in testing.
+     *
+     * @param[in] i Row.
+     * @param[in] j Column.
+     * @param[in] size Number of rows.
+     * @returns Value of Jacobian.
+     */
+    static
+    PylithScalar _jacobianValue(const PetscInt i,
+                                const PetscInt j,
+                                const PetscInt size);
+
+    /** Check whether point is a vertex on the fault.
+     *
+     * @param[in] point Point in mesh.
+     * @returns True if point is a vertex on the fault, false otherwise.
+     */
+    bool _isFaultVertex(const PetscInt point) const;
+
+    /// Zero values for Dirichlet boundary condition.
+    static
+    PetscErrorCode _zero(PetscInt dim,
+                         PetscReal t,
+                         const PetscReal x[],
+                         PetscInt numComponents,
+                         PetscScalar* values,
+                         void* context);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+    FaultCohesiveStub* _fault; ///< Fault.
+    pylith::feassemble::IntegratorInterface* _integrator; ///< Integrator for fault.
+    spatialdata::geocoords::CSCart _cs; ///< Coordinate system.
+    spatialdata::units::Nondimensional _normalizer; ///< Scales for nondimensionalization.
+
+}; // class TestFaultOps
+
+// ------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::faults::TestFaultOps);
+
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::faults::TestFaultOps::setUp(void) {
+    _mesh = NULL;
+    _solution = NULL;
+    _fault = NULL;
+    _integrator = NULL;
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::faults::TestFaultOps::tearDown(void) {
+    delete _integrator;_integrator = NULL;
+    delete _fault;_fault = NULL;
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test IntegratorInterface::markSideDOF().
+void
+pylith::faults::TestFaultOps::testMarkSideDOF(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize(false);
+    CPPUNIT_ASSERT(_solution);
+    CPPUNIT_ASSERT(_integrator);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = _solution->getDM();
+    PetscVec markLocalVec = NULL;
+    err = DMGetLocalVector(dmSoln, &markLocalVec);CPPUNIT_ASSERT(!err);
+    err = VecSet(markLocalVec, 0.0);CPPUNIT_ASSERT(!err);
+    _integrator->markSideDOF(markLocalVec, *_solution, "displacement");
+
+    PetscSection solnSection = _solution->getLocalSection();CPPUNIT_ASSERT(solnSection);
+    const PetscInt dispIndex = _solution->getSubfieldInfo("displacement").index;
+    const PetscInt lagrangeIndex = _solution->getSubfieldInfo("lagrange_multiplier_fault").index;
+    const PetscScalar* markArray = NULL;
+    err = VecGetArrayRead(markLocalVec, &markArray);CPPUNIT_ASSERT(!err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(solnSection, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    size_t numMarkedPoints = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        std::ostringstream msg;
+        msg << "Mismatch in mark for point " << point << ".";
+
+        PetscInt numDof = 0, offset = 0;
+        err = PetscSectionGetFieldDof(solnSection, point, dispIndex, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(solnSection, point, dispIndex, &offset);CPPUNIT_ASSERT(!err);
+        const PylithScalar markE = (numDof > 0 && _isFaultVertex(point)) ? 1.0 : 0.0;
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), markE, PylithScalar(markArray[offset+iDof]));
+        } // for
+        numMarkedPoints += (markE > 0.0) ? 1 : 0;
+
+        err = PetscSectionGetFieldDof(solnSection, point, lagrangeIndex, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(solnSection, point, lagrangeIndex, &offset);CPPUNIT_ASSERT(!err);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), PylithScalar(0.0), PylithScalar(markArray[offset+iDof]));
+        } // for
+    } // for
+    err = VecRestoreArrayRead(markLocalVec, &markArray);CPPUNIT_ASSERT(!err);
+    err = DMRestoreLocalVector(dmSoln, &markLocalVec);CPPUNIT_ASSERT(!err);
+
+    // Two fault vertices, each with a vertex on the negative and positive sides.
+    CPPUNIT_ASSERT_EQUAL(size_t(4), numMarkedPoints);
+
+    PYLITH_METHOD_END;
+} // testMarkSideDOF
+
+
+// ------------------------------------------------------------------------------------------------
+// Test createSchurPrecond().
+void
+pylith::faults::TestFaultOps::testCreateSchurPrecond(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize(false);
+    _testCreateSchurPrecond(false);
+
+    PYLITH_METHOD_END;
+} // testCreateSchurPrecond
+
+
+// ------------------------------------------------------------------------------------------------
+// Test createSchurPrecond() with Dirichlet boundary condition on one component at fault vertices.
+void
+pylith::faults::TestFaultOps::testCreateSchurPrecondDirichlet(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize(true);
+    _testCreateSchurPrecond(true);
+
+    PYLITH_METHOD_END;
+} // testCreateSchurPrecondDirichlet
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh, insert cohesive cells, and create solution field.
+void
+pylith::faults::TestFaultOps::_initialize(const bool useDirichlet) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri_a.mesh");
+    iohandler.read(_mesh);
+    _cs.setSpaceDim(2);
+    _mesh->setCoordSys(&_cs);
+
+    _fault = new FaultCohesiveStub();CPPUNIT_ASSERT(_fault);
+    _fault->setCohesiveLabelValue(100);
+    _fault->setSurfaceLabelName("fault");
+    _fault->adjustTopology(_mesh);
+
+    _solution = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_solution);
+    _solution->setLabel("solution");
+    pylith::problems::SolutionFactory factory(*_solution, _normalizer);
+    factory.addDisplacement(pylith::topology::Field::Discretization(1, 1));
+    factory.addLagrangeMultiplierFault(pylith::topology::Field::Discretization(1, 1, 1, -1, true));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+
+    if (useDirichlet) {
+        PetscErrorCode err = 0;
+        PetscDM dmSoln = _solution->getDM();
+        PetscDS ds = NULL;
+        PetscDMLabel label = NULL;
+        const PetscInt labelValue = 1;
+        const PetscInt constrainedDOF[1] = { 0 };
+        const PetscInt dispIndex = _solution->getSubfieldInfo("displacement").index;
+        err = DMGetDS(dmSoln, &ds);CPPUNIT_ASSERT(!err);
+        err = DMGetLabel(dmSoln, "output", &label);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(label);
+        err = PetscDSAddBoundary(ds, DM_BC_ESSENTIAL, "output", label, 1, &labelValue, dispIndex,
+                                 1, constrainedDOF, (void (*)(void))_zero, NULL, NULL, NULL);CPPUNIT_ASSERT(!err);
+    } // if
+    _solution->allocate();
+
+    _integrator = new pylith::feassemble::IntegratorInterface(_fault);CPPUNIT_ASSERT(_integrator);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Check createSchurPrecond() against Schur complement computed from dense matrices.
+void
+pylith::faults::TestFaultOps::_testCreateSchurPrecond(const bool hasConstrainedDOF) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_solution);
+    CPPUNIT_ASSERT(_integrator);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = _solution->getDM();
+
+    // Dense Jacobian with dominant diagonal.
+    PetscMat jacobianMat = NULL;
+    PetscInt size = 0;
+    err = DMCreateMatrix(dmSoln, &jacobianMat);CPPUNIT_ASSERT(!err);
+    err = MatSetOption(jacobianMat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);CPPUNIT_ASSERT(!err);
+    err = MatGetSize(jacobianMat, &size, NULL);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < size; ++i) {
+        for (PetscInt j = 0; j < size; ++j) {
+            const PetscScalar value = _jacobianValue(i, j, size);
+            err = MatSetValues(jacobianMat, 1, &i, 1, &j, &value, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+        } // for
+    } // for
+    err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+    err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+    std::vector<pylith::feassemble::IntegratorInterface*> integrators(1, _integrator);
+    PetscMat precondMat = NULL;
+    FaultOps::createSchurPrecond(&precondMat, jacobianMat, *_solution, integrators);CPPUNIT_ASSERT(precondMat);
+
+    // Blocks of unconstrained displacement DOF at vertices on the negative and positive sides of the fault.
+    PetscSection solnSection = _solution->getLocalSection();CPPUNIT_ASSERT(solnSection);
+    PetscSection globalSection = _solution->getGlobalSection();CPPUNIT_ASSERT(globalSection);
+    const PetscInt dispIndex = _solution->getSubfieldInfo("displacement").index;
+    CPPUNIT_ASSERT_EQUAL(PetscInt(0), dispIndex);
+    std::vector<std::vector<PetscInt> > blocks;
+    bool hasPartialBlock = false;
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(solnSection, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt numDof = 0, numConstrained = 0, globalOffset = 0;
+        err = PetscSectionGetFieldDof(solnSection, point, dispIndex, &numDof);CPPUNIT_ASSERT(!err);
+        if (!numDof || !_isFaultVertex(point)) { continue; }
+        err = PetscSectionGetFieldConstraintDof(solnSection, point, dispIndex, &numConstrained);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetOffset(globalSection, point, &globalOffset);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(globalOffset >= 0);
+        std::vector<PetscInt> block;
+        for (PetscInt iDof = 0; iDof < numDof-numConstrained; ++iDof) {
+            block.push_back(globalOffset+iDof);
+        } // for
+        if (block.size() > 0) {
+            blocks.push_back(block);
+        } // if
+        hasPartialBlock = hasPartialBlock || (numConstrained > 0 && numConstrained < numDof);
+    } // for
+    CPPUNIT_ASSERT(blocks.size() > 0);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in fault vertices with constrained DOF.", hasConstrainedDOF, hasPartialBlock);
+
+    PetscInt numFields = 0;
+    char** fieldNames = NULL;
+    PetscIS* fieldIS = NULL;
+    const PetscInt lagrangeIndex = _solution->getSubfieldInfo("lagrange_multiplier_fault").index;
+    err = DMCreateFieldIS(dmSoln, &numFields, &fieldNames, &fieldIS);CPPUNIT_ASSERT(!err);
+    PetscInt numLagrange = 0;
+    const PetscInt* lagrangeIndices = NULL;
+    err = ISGetLocalSize(fieldIS[lagrangeIndex], &numLagrange);CPPUNIT_ASSERT(!err);
+    err = ISGetIndices(fieldIS[lagrangeIndex], &lagrangeIndices);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(numLagrange > 0);
+
+    PetscInt numRows = 0, numCols = 0;
+    err = MatGetSize(precondMat, &numRows, &numCols);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numLagrange, numRows);
+    CPPUNIT_ASSERT_EQUAL(numLagrange, numCols);
+
+    // Sp = A11 - A10 inv(blockdiag(A00)) A01
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt iRow = 0; iRow < numLagrange; ++iRow) {
+        for (PetscInt iCol = 0; iCol < numLagrange; ++iCol) {
+            const PetscInt row = lagrangeIndices[iRow];
+            const PetscInt col = lagrangeIndices[iCol];
+            PylithScalar valueE = _jacobianValue(row, col, size);
+            for (size_t iBlock = 0; iBlock < blocks.size(); ++iBlock) {
+                const std::vector<PetscInt>& block = blocks[iBlock];
+                PylithScalar blockInv[4];
+                if (1 == block.size()) {
+                    blockInv[0] = 1.0 / _jacobianValue(block[0], block[0], size);
+                } else {
+                    CPPUNIT_ASSERT_EQUAL(size_t(2), block.size());
+                    const PylithScalar a = _jacobianValue(block[0], block[0], size);
+                    const PylithScalar b = _jacobianValue(block[0], block[1], size);
+                    const PylithScalar c = _jacobianValue(block[1], block[0], size);
+                    const PylithScalar d = _jacobianValue(block[1], block[1], size);
+                    const PylithScalar det = a*d - b*c;
+                    blockInv[0] = d / det;
+                    blockInv[1] = -b / det;
+                    blockInv[2] = -c / det;
+                    blockInv[3] = a / det;
+                } // if/else
+                for (size_t i = 0; i < block.size(); ++i) {
+                    for (size_t j = 0; j < block.size(); ++j) {
+                        valueE -= _jacobianValue(row, block[i], size) * blockInv[i*block.size()+j] * _jacobianValue(block[j], col, size);
+                    } // for
+                } // for
+            } // for
+
+            PetscScalar value = 0.0;
+            err = MatGetValues(precondMat, 1, &iRow, 1, &iCol, &value);CPPUNIT_ASSERT(!err);
+            std::ostringstream msg;
+            msg << "Mismatch in Schur complement preconditioner for row " << iRow << " and column " << iCol << ".";
+            CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str().c_str(), valueE, PylithScalar(value), tolerance*fabs(valueE));
+        } // for
+    } // for
+
+    err = ISRestoreIndices(fieldIS[lagrangeIndex], &lagrangeIndices);CPPUNIT_ASSERT(!err);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        err = PetscFree(fieldNames[iField]);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&fieldIS[iField]);CPPUNIT_ASSERT(!err);
+    } // for
+    err = PetscFree(fieldNames);CPPUNIT_ASSERT(!err);
+    err = PetscFree(fieldIS);CPPUNIT_ASSERT(!err);
+    err = MatDestroy(&precondMat);CPPUNIT_ASSERT(!err);
+    err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // _testCreateSchurPrecond
+
+
+// ------------------------------------------------------------------------------------------------
+// Get value of Jacobian used in testing.
+PylithScalar
+pylith::faults::TestFaultOps::_jacobianValue(const PetscInt i,
+                                             const PetscInt j,
+                                             const PetscInt size) {
+    return (i == j) ? 4.0*size + i : 1.0 / (1.0 + i + 2.0*j);
+} // _jacobianValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether point is a vertex on the fault.
+bool
+pylith::faults::TestFaultOps::_isFaultVertex(const PetscInt point) const {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+
+    // Fault in data/tri_a.mesh is along x=0, and all other vertices are at x=+-1.
+    PetscErrorCode err = 0;
+    PetscDM dmMesh = _mesh->getDM();
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);CPPUNIT_ASSERT(!err);
+    if ((point < vStart) || (point >= vEnd)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscSection coordSection = NULL;
+    PetscVec coordVec = NULL;
+    PetscInt numCoords = 0;
+    PetscScalar* coords = NULL;
+    err = DMGetCoordinateSection(dmMesh, &coordSection);CPPUNIT_ASSERT(!err);
+    err = DMGetCoordinatesLocal(dmMesh, &coordVec);CPPUNIT_ASSERT(!err);
+    err = DMPlexVecGetClosure(dmMesh, coordSection, coordVec, point, &numCoords, &coords);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(2), numCoords);
+    const bool isFaultVertex = fabs(PetscRealPart(coords[0])) < 1.0e-6;
+    err = DMPlexVecRestoreClosure(dmMesh, coordSection, coordVec, point, &numCoords, &coords);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_RETURN(isFaultVertex);
+} // _isFaultVertex
+
+
+// ------------------------------------------------------------------------------------------------
+// Zero values for Dirichlet boundary condition.
+PetscErrorCode
+pylith::faults::TestFaultOps::_zero(PetscInt dim,
+                                    PetscReal t,
+                                    const PetscReal x[],
+                                    PetscInt numComponents,
+                                    PetscScalar* values,
+                                    void* context) {
+    for (PetscInt i = 0; i < numComponents; ++i) {
+        values[i] = 0.0;
+    } // for
+    return PETSC_SUCCESS;
+} // _zero
+
+
+// End of file
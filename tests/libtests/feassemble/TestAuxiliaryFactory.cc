@@ -29,6 +29,7 @@
 #include "pylith/utils/journals.hh"
 
 #include "spatialdata/spatialdb/UserFunctionDB.hh" // USES UserFunctionDB
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -288,4 +289,69 @@ pylith::feassemble::TestAuxiliaryFactory::testSetValuesFromDB(void) {
 } // testSetValuesFromDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test compactUniformSubfields().
+void
+pylith::feassemble::TestAuxiliaryFactory::testCompactUniformSubfields(void) {
+    const int spaceDim = 2;
+    spatialdata::units::Nondimensional normalizer;
+
+    // Density and shear modulus are read-only; velocity is a state variable. Shear modulus is
+    // filled from a separate, nonuniform database.
+    pylith::topology::Field::Description descriptionDensity;
+    descriptionDensity.label = "density";
+    descriptionDensity.alias = "density";
+    descriptionDensity.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionDensity.numComponents = 1;
+    descriptionDensity.componentNames.resize(1);
+    descriptionDensity.componentNames[0] = "density";
+    descriptionDensity.scale = normalizer.getDensityScale();
+
+    pylith::topology::Field::Description descriptionShearModulus = descriptionDensity;
+    descriptionShearModulus.label = "shear_modulus";
+    descriptionShearModulus.alias = "shear_modulus";
+    descriptionShearModulus.componentNames[0] = "shear_modulus";
+    descriptionShearModulus.scale = normalizer.getPressureScale();
+
+    pylith::topology::Field::Description descriptionVelocity;
+    descriptionVelocity.label = "velocity";
+    descriptionVelocity.alias = "velocity";
+    descriptionVelocity.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVelocity.numComponents = 2;
+    descriptionVelocity.componentNames.resize(2);
+    descriptionVelocity.componentNames[0] = "velocity_x";
+    descriptionVelocity.componentNames[1] = "velocity_y";
+    descriptionVelocity.scale = normalizer.getLengthScale() / normalizer.getTimeScale();
+    descriptionVelocity.hasHistory = true;
+    descriptionVelocity.historySize = 1;
+
+    spatialdata::spatialdb::UniformDB uniformDB;
+    spatialdata::spatialdb::UserFunctionDB userDB;
+
+    pylith::topology::Mesh mesh;
+    pylith::topology::Field auxiliaryField(mesh);
+
+    CPPUNIT_ASSERT(_factory);
+    _factory->setQueryDB(&uniformDB);
+    _factory->initialize(&auxiliaryField, normalizer, spaceDim);
+    auxiliaryField.subfieldAdd(descriptionDensity, pylith::topology::Field::Discretization(1, 2));
+    _factory->setSubfieldQuery("density");
+    auxiliaryField.subfieldAdd(descriptionShearModulus, pylith::topology::Field::Discretization(1, 2));
+    _factory->setSubfieldQuery("shear_modulus", NULL, 0, NULL, &userDB);
+    auxiliaryField.subfieldAdd(descriptionVelocity, pylith::topology::Field::Discretization(2, 2));
+    _factory->setSubfieldQuery("velocity");
+
+    _factory->compactUniformSubfields();
+
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in basis order for uniform read-only subfield.",
+                                 0, auxiliaryField.getSubfieldInfo("density").fe.basisOrder);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in quadrature order for uniform read-only subfield.",
+                                 2, auxiliaryField.getSubfieldInfo("density").fe.quadOrder);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in basis order for subfield from nonuniform database.",
+                                 1, auxiliaryField.getSubfieldInfo("shear_modulus").fe.basisOrder);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in basis order for state variable subfield.",
+                                 2, auxiliaryField.getSubfieldInfo("velocity").fe.basisOrder);
+} // testCompactUniformSubfields
+
+
 // End of file
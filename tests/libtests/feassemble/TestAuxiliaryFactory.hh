@@ -46,6 +46,7 @@ class pylith::feassemble::TestAuxiliaryFactory : public CppUnit::TestFixture {
     CPPUNIT_TEST(testSubfieldDiscretization);
     CPPUNIT_TEST(testInitialize);
     CPPUNIT_TEST(testSetValuesFromDB);
+    CPPUNIT_TEST(testCompactUniformSubfields);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -70,6 +71,9 @@ public:
     /// Test setValuesFromDB().
     void testSetValuesFromDB(void);
 
+    /// Test compactUniformSubfields().
+    void testCompactUniformSubfields(void);
+
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
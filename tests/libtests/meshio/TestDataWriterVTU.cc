@@ -0,0 +1,700 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscdmplex.h"
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <algorithm> // USES std::sort(), std::unique(), std::max()
+#include <cassert> // USES assert()
+#include <cmath> // USES fabs()
+#include <cstdint> // USES uint64_t, int64_t
+#include <cstdlib> // USES strtoul(), atoi()
+#include <cstring> // USES memcpy(), strlen()
+#include <iostream> // USES std::cerr
+#include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ifstream
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _TestDataWriterVTU {
+public:
+
+            /// Attributes of DataArray element in header of VTK XML file.
+            struct DataArray {
+                std::string section; ///< Name of enclosing element.
+                std::string type; ///< VTK type of values.
+                std::string name; ///< Name of array.
+                int numComponents; ///< Number of components.
+                size_t offset; ///< Offset of block in appended data.
+            }; // DataArray
+
+            /// Order data arrays by offset of block in appended data.
+            static
+            bool compareOffset(const DataArray& a,
+                               const DataArray& b) {
+                return a.offset < b.offset;
+            } // compareOffset
+
+            /** Generate root of filenames (no extension) for time step.
+             *
+             * @param[in] filename Name of file given to writer.
+             * @param[in] t Time stamp.
+             * @param[in] timeFormat Format of timestamp in filename.
+             * @returns Root of filenames.
+             */
+            static
+            std::string filenameRoot(const char* filename,
+                                     const PylithScalar t,
+                                     const char* timeFormat) {
+                const std::string& fileroot = filename;
+                const size_t indexExt = fileroot.find(".vtu");
+
+                char sbuffer[256];
+                sprintf(sbuffer, timeFormat, t);
+                std::string timestamp(sbuffer);
+                const size_t pos = timestamp.find(".");
+                if (pos != std::string::npos) {
+                    timestamp.erase(pos, 1);
+                } // if
+                return std::string(fileroot, 0, indexExt) + "_t" + timestamp;
+            } // filenameRoot
+
+            /** Remove directory from filename.
+             *
+             * @param[in] filename Name of file.
+             * @returns Name of file without directory.
+             */
+            static
+            std::string basename(const std::string& filename) {
+                const size_t pos = filename.find_last_of('/');
+                return (pos != std::string::npos) ? filename.substr(pos+1) : filename;
+            } // basename
+
+            /** Read entire contents of file.
+             *
+             * @param[in] filename Name of file.
+             * @returns Contents of file.
+             */
+            static
+            std::string readFile(const std::string& filename) {
+                std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
+                if (!fin.is_open()) {
+                    std::cerr << "Could not open file '" << filename << "'." << std::endl;
+                } // if
+                CPPUNIT_ASSERT(fin.is_open());
+                std::ostringstream contents;
+                contents << fin.rdbuf();
+                fin.close();
+                return contents.str();
+            } // readFile
+
+            /** Get value of attribute in XML element.
+             *
+             * @param[in] element XML element.
+             * @param[in] name Name of attribute.
+             * @returns Value of attribute (empty if attribute is missing).
+             */
+            static
+            std::string getAttribute(const std::string& element,
+                                     const char* name) {
+                const std::string& key = std::string(" ") + name + "=\"";
+                const size_t posBegin = element.find(key);
+                if (posBegin == std::string::npos) {
+                    return std::string();
+                } // if
+                const size_t posValue = posBegin + key.length();
+                const size_t posEnd = element.find('"', posValue);
+                CPPUNIT_ASSERT(posEnd != std::string::npos);
+                return element.substr(posValue, posEnd-posValue);
+            } // getAttribute
+
+            /** Get XML element starting with tag.
+             *
+             * @param[in] contents Contents of XML file.
+             * @param[in] tag Opening of element, e.g., "<Piece".
+             * @returns XML element.
+             */
+            static
+            std::string getElement(const std::string& contents,
+                                   const char* tag) {
+                const size_t posBegin = contents.find(tag);
+                if (posBegin == std::string::npos) {
+                    std::cerr << "Could not find XML element '" << tag << "'." << std::endl;
+                } // if
+                CPPUNIT_ASSERT(posBegin != std::string::npos);
+                const size_t posEnd = contents.find('>', posBegin);
+                CPPUNIT_ASSERT(posEnd != std::string::npos);
+                return contents.substr(posBegin, posEnd+1-posBegin);
+            } // getElement
+
+            /** Get contents between opening and closing tags.
+             *
+             * @param[in] contents Contents of XML file.
+             * @param[in] name Name of XML element.
+             * @returns Contents of XML element.
+             */
+            static
+            std::string getSection(const std::string& contents,
+                                   const char* name) {
+                const std::string& tagBegin = std::string("<") + name + ">";
+                const std::string& tagEnd = std::string("</") + name + ">";
+                const size_t posBegin = contents.find(tagBegin);
+                const size_t posEnd = contents.find(tagEnd);
+                if ((posBegin == std::string::npos) || (posEnd == std::string::npos)) {
+                    std::cerr << "Could not find XML element '" << name << "'." << std::endl;
+                } // if
+                CPPUNIT_ASSERT(posBegin != std::string::npos);
+                CPPUNIT_ASSERT(posEnd != std::string::npos);
+                CPPUNIT_ASSERT(posEnd > posBegin);
+                return contents.substr(posBegin+tagBegin.length(), posEnd-posBegin-tagBegin.length());
+            } // getSection
+
+            /** Count number of occurrences of string.
+             *
+             * @param[in] contents String to search.
+             * @param[in] value String to count.
+             * @returns Number of occurrences.
+             */
+            static
+            size_t count(const std::string& contents,
+                         const std::string& value) {
+                size_t n = 0;
+                for (size_t pos = contents.find(value); pos != std::string::npos; pos = contents.find(value, pos+1)) {
+                    ++n;
+                } // for
+                return n;
+            } // count
+
+            /** Get DataArray elements in header of VTK XML unstructured grid file.
+             *
+             * @param[in] header Header (everything before appended data).
+             * @returns Attributes of DataArray elements in order.
+             */
+            static
+            std::vector<DataArray> getDataArrays(const std::string& header) {
+                const char* sections[4] = { "<PointData>", "<CellData>", "<Points>", "<Cells>" };
+                std::vector<DataArray> arrays;
+                for (size_t pos = header.find("<DataArray"); pos != std::string::npos; pos = header.find("<DataArray", pos+1)) {
+                    const size_t posEnd = header.find("/>", pos);
+                    CPPUNIT_ASSERT(posEnd != std::string::npos);
+                    const std::string& element = header.substr(pos, posEnd-pos);
+
+                    DataArray array;
+                    size_t posSection = 0;
+                    for (size_t i = 0; i < 4; ++i) {
+                        const size_t posTag = header.rfind(sections[i], pos);
+                        if ((posTag != std::string::npos) && (posTag >= posSection)) {
+                            posSection = posTag;
+                            array.section = std::string(sections[i], 1, strlen(sections[i])-2);
+                        } // if
+                    } // for
+                    array.type = getAttribute(element, "type");
+                    array.name = getAttribute(element, "Name");
+                    const std::string& numComponents = getAttribute(element, "NumberOfComponents");
+                    array.numComponents = numComponents.empty() ? 1 : atoi(numComponents.c_str());
+                    CPPUNIT_ASSERT_EQUAL(std::string("appended"), getAttribute(element, "format"));
+                    const std::string& offset = getAttribute(element, "offset");
+                    CPPUNIT_ASSERT(!offset.empty());
+                    array.offset = strtoul(offset.c_str(), NULL, 10);
+                    arrays.push_back(array);
+                } // for
+                return arrays;
+            } // getDataArrays
+
+            /** Get size of VTK type in bytes.
+             *
+             * @param[in] type VTK type.
+             * @returns Size of type in bytes.
+             */
+            static
+            size_t typeSize(const std::string& type) {
+                if (type == "Float64") { return sizeof(double); }
+                if (type == "Float32") { return sizeof(float); }
+                if (type == "Int64") { return sizeof(int64_t); }
+                if (type == "UInt8") { return sizeof(unsigned char); }
+                std::cerr << "Unknown VTK type '" << type << "'." << std::endl;
+                CPPUNIT_ASSERT(false);
+                return 0;
+            } // typeSize
+
+            /** Get values in block of appended data.
+             *
+             * @param[out] values Values in block.
+             * @param[in] appended Appended data.
+             * @param[in] offset Offset of block (including UInt64 header).
+             */
+            template<typename T>
+            static
+            void getValues(std::vector<T>* values,
+                           const std::string& appended,
+                           const size_t offset) {
+                assert(values);
+                uint64_t numBytes = 0;
+                CPPUNIT_ASSERT(offset + sizeof(numBytes) <= appended.size());
+                memcpy(&numBytes, &appended[offset], sizeof(numBytes));
+                CPPUNIT_ASSERT_EQUAL(size_t(0), size_t(numBytes % sizeof(T)));
+                CPPUNIT_ASSERT(offset + sizeof(numBytes) + numBytes <= appended.size());
+                values->resize(numBytes / sizeof(T));
+                if (numBytes > 0) {
+                    memcpy(&(*values)[0], &appended[offset+sizeof(numBytes)], numBytes);
+                } // if
+            } // getValues
+
+            /** Get VTK cell type for PETSc polytope type.
+             *
+             * @param[in] ct PETSc polytope type.
+             * @returns VTK cell type.
+             */
+            static
+            int cellType(const DMPolytopeType ct) {
+                switch (ct) {
+                case DM_POLYTOPE_POINT:
+                    return 1;
+                case DM_POLYTOPE_SEGMENT:
+                    return 3;
+                case DM_POLYTOPE_TRIANGLE:
+                    return 5;
+                case DM_POLYTOPE_QUADRILATERAL:
+                    return 9;
+                case DM_POLYTOPE_TETRAHEDRON:
+                    return 10;
+                case DM_POLYTOPE_HEXAHEDRON:
+                    return 12;
+                case DM_POLYTOPE_TRI_PRISM:
+                    return 13;
+                default:
+                    CPPUNIT_ASSERT_MESSAGE("Unexpected cell type.", false);
+                } // switch
+                return 0;
+            } // cellType
+
+            /** Get vertices in closure of cell.
+             *
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] cell Cell in mesh.
+             * @returns Vertices in closure of cell (sorted).
+             */
+            static
+            std::vector<PetscInt> getCellVertices(const PetscDM dm,
+                                                  const PetscInt cell) {
+                PetscErrorCode err = 0;
+                PetscInt vStart = 0, vEnd = 0;
+                err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+                std::vector<PetscInt> vertices;
+                PetscInt closureSize = 0, *closure = NULL;
+                err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+                for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+                    if ((closure[cl] >= vStart) && (closure[cl] < vEnd)) {
+                        vertices.push_back(closure[cl]);
+                    } // if
+                } // for
+                err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+                std::sort(vertices.begin(), vertices.end());
+                return vertices;
+            } // getCellVertices
+
+            /** Check values of field in appended data against subfield.
+             *
+             * Vector fields with fewer than 3 components should be padded with zeros.
+             *
+             * @param[in] array Attributes of DataArray element.
+             * @param[in] appended Appended data.
+             * @param[in] subfield Subfield written to file.
+             * @param[in] points Points in file.
+             */
+            static
+            void checkField(const DataArray& array,
+                            const std::string& appended,
+                            const pylith::meshio::OutputSubfield& subfield,
+                            const std::vector<PetscInt>& points) {
+                const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+                const int numComponents = description.numComponents;
+                const bool isPadded = (pylith::topology::FieldBase::VECTOR == description.vectorFieldType) && (numComponents < 3);
+                CPPUNIT_ASSERT_EQUAL(description.label, array.name);
+                CPPUNIT_ASSERT_EQUAL(isPadded ? 3 : numComponents, array.numComponents);
+
+                std::vector<PylithScalar> values;
+                getValues(&values, appended, array.offset);
+                const size_t numPoints = points.size();
+                const size_t stride = array.numComponents;
+                CPPUNIT_ASSERT_EQUAL(numPoints*stride, values.size());
+
+                PetscDM dmSubfield = subfield.getDM();CPPUNIT_ASSERT(dmSubfield);
+                PetscSection section = NULL;
+                PetscVec localVec = NULL;
+                const PetscScalar* localArray = NULL;
+                PetscErrorCode err = 0;
+                err = DMGetLocalSection(dmSubfield, &section);PYLITH_CHECK_ERROR(err);
+                err = DMGetLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+                err = DMGlobalToLocalBegin(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+                err = DMGlobalToLocalEnd(dmSubfield, subfield.getVector(), INSERT_VALUES, localVec);PYLITH_CHECK_ERROR(err);
+                err = VecGetArrayRead(localVec, &localArray);PYLITH_CHECK_ERROR(err);
+                for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+                    PetscInt dof = 0, off = 0;
+                    err = PetscSectionGetDof(section, points[iPoint], &dof);PYLITH_CHECK_ERROR(err);
+                    err = PetscSectionGetOffset(section, points[iPoint], &off);PYLITH_CHECK_ERROR(err);
+                    CPPUNIT_ASSERT_EQUAL(PetscInt(numComponents), dof);
+                    for (int iComponent = 0; iComponent < numComponents; ++iComponent) {
+                        std::ostringstream msg;
+                        msg << "Mismatch in field '" << array.name << "' for point " << iPoint << ", component " << iComponent << ".";
+                        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), PylithScalar(localArray[off+iComponent]), values[iPoint*stride+iComponent]);
+                    } // for
+                    for (size_t iComponent = numComponents; iComponent < stride; ++iComponent) {
+                        CPPUNIT_ASSERT_EQUAL_MESSAGE("Expected zero for padded component.", PylithScalar(0.0), values[iPoint*stride+iComponent]);
+                    } // for
+                } // for
+                err = VecRestoreArrayRead(localVec, &localArray);PYLITH_CHECK_ERROR(err);
+                err = DMRestoreLocalVector(dmSubfield, &localVec);PYLITH_CHECK_ERROR(err);
+            } // checkField
+
+            /** Check VTK XML unstructured grid file for this process.
+             *
+             * @param[in] filename Name of file.
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] vertices Vertices in file.
+             * @param[in] cells Cells in file.
+             * @param[in] vertexFields Vertex fields written to file.
+             * @param[in] cellFields Cell fields written to file.
+             */
+            static
+            void checkPiece(const std::string& filename,
+                            const PetscDM dm,
+                            const std::vector<PetscInt>& vertices,
+                            const std::vector<PetscInt>& cells,
+                            const std::vector<OutputSubfield*>& vertexFields,
+                            const std::vector<OutputSubfield*>& cellFields) {
+                const std::string& contents = readFile(filename);
+                const std::string& scalarType = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+
+                const std::string& vtkFile = getElement(contents, "<VTKFile");
+                CPPUNIT_ASSERT_EQUAL(std::string("UnstructuredGrid"), getAttribute(vtkFile, "type"));
+                CPPUNIT_ASSERT_EQUAL(std::string("UInt64"), getAttribute(vtkFile, "header_type"));
+
+                // Split header and appended data.
+                const std::string tagAppended = "<AppendedData encoding=\"raw\">\n_";
+                const size_t posAppended = contents.find(tagAppended);
+                CPPUNIT_ASSERT(posAppended != std::string::npos);
+                const std::string& header = contents.substr(0, posAppended);
+                const std::string& appended = contents.substr(posAppended + tagAppended.length());
+
+                // Cells in file are cells owned by this process, excluding cohesive cells.
+                PetscErrorCode err = 0;
+                PetscInt cellHeight = 0, cStart = 0, cEnd = 0;
+                err = DMPlexGetVTKCellHeight(dm, &cellHeight);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetHeightStratum(dm, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+                PetscIS globalCellNumbers = NULL;
+                const PetscInt* gcell = NULL;
+                err = DMPlexGetCellNumbering(dm, &globalCellNumbers);PYLITH_CHECK_ERROR(err);
+                err = ISGetIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+                std::vector<PetscInt> cellsE;
+                for (PetscInt c = cStart; c < cEnd; ++c) {
+                    if ((gcell[c-cStart] >= 0) && !pylith::topology::MeshOps::isCohesiveCell(dm, c)) {
+                        cellsE.push_back(c);
+                    } // if
+                } // for
+                err = ISRestoreIndices(globalCellNumbers, &gcell);PYLITH_CHECK_ERROR(err);
+                std::vector<PetscInt> cellsSorted(cells);
+                std::sort(cellsSorted.begin(), cellsSorted.end());
+                CPPUNIT_ASSERT(cellsE == cellsSorted);
+
+                // Vertices in file are vertices in closure of cells.
+                std::vector<PetscInt> verticesE;
+                size_t connectivitySizeE = 0;
+                for (size_t iCell = 0; iCell < cells.size(); ++iCell) {
+                    const std::vector<PetscInt>& cone = getCellVertices(dm, cells[iCell]);
+                    verticesE.insert(verticesE.end(), cone.begin(), cone.end());
+                    connectivitySizeE += cone.size();
+                } // for
+                std::sort(verticesE.begin(), verticesE.end());
+                verticesE.erase(std::unique(verticesE.begin(), verticesE.end()), verticesE.end());
+                std::vector<PetscInt> verticesSorted(vertices);
+                std::sort(verticesSorted.begin(), verticesSorted.end());
+                CPPUNIT_ASSERT(verticesE == verticesSorted);
+
+                const size_t numVertices = vertices.size();
+                const size_t numCells = cells.size();
+                const std::string& piece = getElement(header, "<Piece");
+                CPPUNIT_ASSERT_EQUAL(numVertices, size_t(strtoul(getAttribute(piece, "NumberOfPoints").c_str(), NULL, 10)));
+                CPPUNIT_ASSERT_EQUAL(numCells, size_t(strtoul(getAttribute(piece, "NumberOfCells").c_str(), NULL, 10)));
+
+                // Arrays in header: vertex fields, cell fields, points, connectivity, offsets, and types.
+                const std::vector<DataArray>& arrays = getDataArrays(header);
+                const size_t numVertexFields = vertexFields.size();
+                const size_t numCellFields = cellFields.size();
+                CPPUNIT_ASSERT_EQUAL(numVertexFields + numCellFields + 4, arrays.size());
+                const size_t iPoints = numVertexFields + numCellFields;
+                for (size_t i = 0; i < numVertexFields; ++i) {
+                    CPPUNIT_ASSERT_EQUAL(std::string("PointData"), arrays[i].section);
+                    CPPUNIT_ASSERT_EQUAL(scalarType, arrays[i].type);
+                } // for
+                for (size_t i = numVertexFields; i < iPoints; ++i) {
+                    CPPUNIT_ASSERT_EQUAL(std::string("CellData"), arrays[i].section);
+                    CPPUNIT_ASSERT_EQUAL(scalarType, arrays[i].type);
+                } // for
+                CPPUNIT_ASSERT_EQUAL(std::string("Points"), arrays[iPoints].section);
+                CPPUNIT_ASSERT_EQUAL(scalarType, arrays[iPoints].type);
+                CPPUNIT_ASSERT_EQUAL(3, arrays[iPoints].numComponents);
+                const char* cellsNames[3] = { "connectivity", "offsets", "types" };
+                const char* cellsTypes[3] = { "Int64", "Int64", "UInt8" };
+                for (size_t i = 0; i < 3; ++i) {
+                    CPPUNIT_ASSERT_EQUAL(std::string("Cells"), arrays[iPoints+1+i].section);
+                    CPPUNIT_ASSERT_EQUAL(std::string(cellsNames[i]), arrays[iPoints+1+i].name);
+                    CPPUNIT_ASSERT_EQUAL(std::string(cellsTypes[i]), arrays[iPoints+1+i].type);
+                } // for
+
+                // Blocks in appended data are contiguous, with the size of each block matching its header.
+                std::vector<DataArray> arraysByOffset(arrays);
+                std::sort(arraysByOffset.begin(), arraysByOffset.end(), compareOffset);
+                size_t offsetE = 0;
+                for (size_t i = 0; i < arraysByOffset.size(); ++i) {
+                    const DataArray& array = arraysByOffset[i];
+                    std::ostringstream msg;
+                    msg << "Mismatch in offset of block for array '" << array.name << "' in section '" << array.section << "'.";
+                    CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), offsetE, array.offset);
+
+                    size_t numValuesE = 0;
+                    if (("PointData" == array.section) || ("Points" == array.section)) {
+                        numValuesE = numVertices * array.numComponents;
+                    } else if ("CellData" == array.section) {
+                        numValuesE = numCells * array.numComponents;
+                    } else if ("connectivity" == array.name) {
+                        numValuesE = connectivitySizeE;
+                    } else {
+                        numValuesE = numCells;
+                    } // if/else
+                    uint64_t numBytes = 0;
+                    CPPUNIT_ASSERT(array.offset + sizeof(numBytes) <= appended.size());
+                    memcpy(&numBytes, &appended[array.offset], sizeof(numBytes));
+                    CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), numValuesE*typeSize(array.type), size_t(numBytes));
+                    offsetE += sizeof(numBytes) + numBytes;
+                } // for
+                CPPUNIT_ASSERT(offsetE <= appended.size());
+                CPPUNIT_ASSERT_EQUAL(std::string("\n  </AppendedData>\n</VTKFile>\n"), appended.substr(offsetE));
+
+                // Coordinates of vertices, padded to 3 components with zeros.
+                std::vector<PylithScalar> coordinates;
+                getValues(&coordinates, appended, arrays[iPoints].offset);
+                CPPUNIT_ASSERT_EQUAL(numVertices*3, coordinates.size());
+                PylithReal lengthScale = 1.0;
+                err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+                pylith::topology::CoordsVisitor coordsVisitor(dm);
+                const PetscScalar* coordsArray = coordsVisitor.localArray();
+                const PylithScalar tolerance = 1.0e-6;
+                for (size_t iVertex = 0; iVertex < numVertices; ++iVertex) {
+                    const PetscInt off = coordsVisitor.sectionOffset(vertices[iVertex]);
+                    const PetscInt dof = coordsVisitor.sectionDof(vertices[iVertex]);
+                    CPPUNIT_ASSERT(dof <= 3);
+                    for (PetscInt iDim = 0; iDim < dof; ++iDim) {
+                        const PylithScalar valueE = lengthScale * coordsArray[off+iDim];
+                        const PylithScalar toleranceV = std::max(tolerance, tolerance*fabs(valueE));
+                        CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, coordinates[iVertex*3+iDim], toleranceV);
+                    } // for
+                    for (PetscInt iDim = dof; iDim < 3; ++iDim) {
+                        CPPUNIT_ASSERT_EQUAL_MESSAGE("Expected zero for padded coordinate.", PylithScalar(0.0), coordinates[iVertex*3+iDim]);
+                    } // for
+                } // for
+
+                // Connectivity, offsets, and cell types.
+                std::vector<int64_t> connectivity;
+                std::vector<int64_t> offsets;
+                std::vector<unsigned char> types;
+                getValues(&connectivity, appended, arrays[iPoints+1].offset);
+                getValues(&offsets, appended, arrays[iPoints+2].offset);
+                getValues(&types, appended, arrays[iPoints+3].offset);
+                CPPUNIT_ASSERT_EQUAL(numCells, offsets.size());
+                CPPUNIT_ASSERT_EQUAL(numCells, types.size());
+                int64_t offsetCell = 0;
+                for (size_t iCell = 0; iCell < numCells; ++iCell) {
+                    const std::vector<PetscInt>& coneE = getCellVertices(dm, cells[iCell]);
+                    CPPUNIT_ASSERT_EQUAL(int64_t(offsetCell + coneE.size()), offsets[iCell]);
+                    std::vector<PetscInt> cone;
+                    for (int64_t i = offsetCell; i < offsets[iCell]; ++i) {
+                        CPPUNIT_ASSERT(connectivity[i] >= 0 && size_t(connectivity[i]) < numVertices);
+                        cone.push_back(vertices[connectivity[i]]);
+                    } // for
+                    std::sort(cone.begin(), cone.end());
+                    CPPUNIT_ASSERT(coneE == cone);
+                    offsetCell = offsets[iCell];
+
+                    DMPolytopeType ct;
+                    err = DMPlexGetCellType(dm, cells[iCell], &ct);PYLITH_CHECK_ERROR(err);
+                    CPPUNIT_ASSERT_EQUAL(cellType(ct), int(types[iCell]));
+                } // for
+
+                // Values of fields.
+                for (size_t i = 0; i < numVertexFields; ++i) {
+                    CPPUNIT_ASSERT(vertexFields[i]);
+                    checkField(arrays[i], appended, *vertexFields[i], vertices);
+                } // for
+                for (size_t i = 0; i < numCellFields; ++i) {
+                    CPPUNIT_ASSERT(cellFields[i]);
+                    checkField(arrays[numVertexFields+i], appended, *cellFields[i], cells);
+                } // for
+            } // checkPiece
+
+            /** Check VTK XML parallel unstructured grid file.
+             *
+             * @param[in] filename Name of file.
+             * @param[in] pieceRoot Root of names of files for processes.
+             * @param[in] numProcs Number of processes.
+             * @param[in] vertexFields Vertex fields written to file.
+             * @param[in] cellFields Cell fields written to file.
+             */
+            static
+            void checkIndex(const std::string& filename,
+                            const std::string& pieceRoot,
+                            const int numProcs,
+                            const std::vector<OutputSubfield*>& vertexFields,
+                            const std::vector<OutputSubfield*>& cellFields) {
+                const std::string& contents = readFile(filename);
+                const std::string& scalarType = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+
+                const std::string& vtkFile = getElement(contents, "<VTKFile");
+                CPPUNIT_ASSERT_EQUAL(std::string("PUnstructuredGrid"), getAttribute(vtkFile, "type"));
+
+                const std::vector<OutputSubfield*>* fields[2] = { &vertexFields, &cellFields };
+                const char* sections[2] = { "PPointData", "PCellData" };
+                for (size_t iGroup = 0; iGroup < 2; ++iGroup) {
+                    const std::string& section = getSection(contents, sections[iGroup]);
+                    const size_t numFields = fields[iGroup]->size();
+                    CPPUNIT_ASSERT_EQUAL(numFields, count(section, "<PDataArray"));
+                    size_t pos = 0;
+                    for (size_t i = 0; i < numFields; ++i) {
+                        const pylith::topology::FieldBase::Description& description = (*fields[iGroup])[i]->getDescription();
+                        const bool isPadded = (pylith::topology::FieldBase::VECTOR == description.vectorFieldType) && (description.numComponents < 3);
+                        std::ostringstream element;
+                        element << "<PDataArray type=\"" << scalarType << "\" Name=\"" << description.label
+                                << "\" NumberOfComponents=\"" << (isPadded ? 3 : description.numComponents) << "\"/>";
+                        pos = section.find(element.str(), pos);
+                        if (pos == std::string::npos) {
+                            std::cerr << "Could not find '" << element.str() << "' in '" << sections[iGroup] << "'." << std::endl;
+                        } // if
+                        CPPUNIT_ASSERT(pos != std::string::npos);
+                    } // for
+                } // for
+
+                const std::string& points = getSection(contents, "PPoints");
+                CPPUNIT_ASSERT_EQUAL(size_t(1), count(points, "<PDataArray"));
+                CPPUNIT_ASSERT_EQUAL(std::string("3"), getAttribute(getElement(points, "<PDataArray"), "NumberOfComponents"));
+
+                CPPUNIT_ASSERT_EQUAL(size_t(numProcs), count(contents, "<Piece "));
+                for (int iProc = 0; iProc < numProcs; ++iProc) {
+                    std::ostringstream element;
+                    element << "<Piece Source=\"" << basename(pieceRoot) << "_p" << iProc << ".vtu\"/>";
+                    CPPUNIT_ASSERT(contents.find(element.str()) != std::string::npos);
+                } // for
+            } // checkIndex
+
+        }; // _TestDataWriterVTU
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Check VTK XML files for time step against the mesh and fields.
+void
+pylith::meshio::TestDataWriterVTU::checkFiles(const DataWriterVTU& writer,
+                                              const char* filename,
+                                              const PylithScalar t,
+                                              const char* timeFormat,
+                                              const std::vector<OutputSubfield*>& vertexFields,
+                                              const std::vector<OutputSubfield*>& cellFields) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(writer._dm);
+
+    MPI_Comm comm = PETSC_COMM_SELF;
+    PetscMPIInt commRank = 0, commSize = 1;
+    PetscErrorCode err = PetscObjectGetComm((PetscObject) writer._dm, &comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    const std::string& fileroot = _TestDataWriterVTU::filenameRoot(filename, t, timeFormat);
+    std::ostringstream pieceFilename;
+    pieceFilename << fileroot << "_p" << commRank << ".vtu";
+    _TestDataWriterVTU::checkPiece(pieceFilename.str(), writer._dm, writer._vertices, writer._cells, vertexFields, cellFields);
+
+    if (!commRank) {
+        _TestDataWriterVTU::checkIndex(fileroot + ".pvtu", fileroot, commSize, vertexFields, cellFields);
+    } // if
+
+    PYLITH_METHOD_END;
+} // checkFiles
+
+
+// ------------------------------------------------------------------------------------------------
+// Check VTK collection file against time steps.
+void
+pylith::meshio::TestDataWriterVTU::checkCollection(const char* filename,
+                                                   const std::vector<PylithScalar>& times,
+                                                   const char* timeFormat) {
+    PYLITH_METHOD_BEGIN;
+
+    const std::string& fileroot = filename;
+    const std::string& contents = _TestDataWriterVTU::readFile(std::string(fileroot, 0, fileroot.find(".vtu")) + ".pvd");
+
+    const std::string& vtkFile = _TestDataWriterVTU::getElement(contents, "<VTKFile");
+    CPPUNIT_ASSERT_EQUAL(std::string("Collection"), _TestDataWriterVTU::getAttribute(vtkFile, "type"));
+
+    const size_t numSteps = times.size();
+    CPPUNIT_ASSERT_EQUAL(numSteps, _TestDataWriterVTU::count(contents, "<DataSet "));
+    size_t pos = 0;
+    for (size_t i = 0; i < numSteps; ++i) {
+        const std::string& stepRoot = _TestDataWriterVTU::filenameRoot(filename, times[i], timeFormat);
+        std::ostringstream element;
+        element.precision(16);
+        element << "<DataSet timestep=\"" << times[i] << "\" group=\"\" part=\"0\" file=\""
+                << _TestDataWriterVTU::basename(stepRoot) << ".pvtu\"/>";
+        pos = contents.find(element.str(), pos);
+        if (pos == std::string::npos) {
+            std::cerr << "Could not find '" << element.str() << "' in collection file." << std::endl;
+        } // if
+        CPPUNIT_ASSERT(pos != std::string::npos);
+    } // for
+
+    PYLITH_METHOD_END;
+} // checkCollection
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestDataWriterVTU_Data::TestDataWriterVTU_Data(void) :
+    timestepFilename(NULL),
+    vertexFilename(NULL),
+    cellFilename(NULL) { // constructor
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestDataWriterVTU_Data::~TestDataWriterVTU_Data(void) { // destructor
+} // destructor
+
+
+// End of file
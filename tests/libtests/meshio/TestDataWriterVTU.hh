@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestDataWriterVTU.hh
+ *
+ * @brief C++ TestDataWriterVTU object
+ *
+ * C++ unit testing for DataWriterVTU.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtu_hh)
+#define pylith_meshio_testdatawritervtu_hh
+
+#include "pylith/meshio/meshiofwd.hh" // USES DataWriterVTU, OutputSubfield
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <vector> // USES std::vector
+
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterVTU;
+
+        class TestDataWriterVTU_Data;
+    } // meshio
+} // pylith
+
+// =====================================================================================================================
+class pylith::meshio::TestDataWriterVTU {
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Check VTK XML unstructured grid file (.vtu) for this process and parallel unstructured grid file (.pvtu)
+     * for time step against the mesh and fields.
+     *
+     * Must be called after closeTimeStep() and before close().
+     *
+     * @param writer Writer that wrote the files.
+     * @param filename Name of file given to writer.
+     * @param t Time for files.
+     * @param timeFormat Format of timestamp in filename.
+     * @param vertexFields Vertex fields written to files (in order).
+     * @param cellFields Cell fields written to files (in order).
+     */
+    static
+    void checkFiles(const DataWriterVTU& writer,
+                    const char* filename,
+                    const PylithScalar t,
+                    const char* timeFormat,
+                    const std::vector<OutputSubfield*>& vertexFields,
+                    const std::vector<OutputSubfield*>& cellFields);
+
+    /** Check VTK collection file (.pvd) against time steps.
+     *
+     * @param filename Name of file given to writer.
+     * @param times Times of time steps (in order).
+     * @param timeFormat Format of timestamp in filename.
+     */
+    static
+    void checkCollection(const char* filename,
+                         const std::vector<PylithScalar>& times,
+                         const char* timeFormat);
+
+}; // class TestDataWriterVTU
+
+// =====================================================================================================================
+class pylith::meshio::TestDataWriterVTU_Data {
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestDataWriterVTU_Data(void);
+
+    /// Destructor
+    ~TestDataWriterVTU_Data(void);
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    const char* timestepFilename; ///< Name of file with no data fields.
+    const char* vertexFilename; ///< Name of file with vertex fields.
+    const char* cellFilename; ///< Name of file with cell fields.
+
+}; // TestDataWriterVTU_Data
+
+#endif // pylith_meshio_testdatawritervtu_hh
+
+// End of file
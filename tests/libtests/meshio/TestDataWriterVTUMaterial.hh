@@ -0,0 +1,96 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+
+/**
+ * @file tests/libtests/meshio/TestDataWriterVTUMaterial.hh
+ *
+ * @brief C++ TestDataWriterVTUMaterial object
+ *
+ * C++ unit testing for DataWriterVTUMaterial.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtumaterial_hh)
+#define pylith_meshio_testdatawritervtumaterial_hh
+
+#include "TestDataWriterVTU.hh" // ISA TestDataWriterVTU
+#include "TestDataWriterMaterial.hh" // ISA TestDataWriterMaterial
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterVTUMaterial;
+
+        class TestDataWriterVTUMaterial_Data;
+    } // meshio
+} // pylith
+
+// ======================================================================
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMaterial : public TestDataWriterVTU, public TestDataWriterMaterial, public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestDataWriterVTUMaterial);
+
+    CPPUNIT_TEST(testTimeStep);
+    CPPUNIT_TEST(testWriteVertexField);
+    CPPUNIT_TEST(testWriteCellField);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test openTimeStep() and closeTimeStep()
+    void testTimeStep(void);
+
+    /// Test writeVertexField.
+    void testWriteVertexField(void);
+
+    /// Test writeCellField.
+    void testWriteCellField(void);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////
+protected:
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestDataWriterMaterial_Data* _getData(void);
+
+    // PROTECTED MEMBDERS /////////////////////////////////////////////////
+protected:
+
+    TestDataWriterVTUMaterial_Data* _data; ///< Data for testing.
+
+}; // class TestDataWriterVTUMaterial
+
+// ======================================================================
+class pylith::meshio::TestDataWriterVTUMaterial_Data : public TestDataWriterVTU_Data, public TestDataWriterMaterial_Data {};
+
+#endif // pylith_meshio_testdatawritervtumaterial_hh
+
+// End of file
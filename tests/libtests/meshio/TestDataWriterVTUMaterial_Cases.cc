@@ -0,0 +1,124 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMaterial.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+namespace pylith {
+    namespace meshio {
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMaterial_Tri : public TestDataWriterVTUMaterial {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMaterial_Tri, TestDataWriterVTUMaterial);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMaterial::setUp();
+                _data = new TestDataWriterVTUMaterial_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tri3_mat.vtu";
+                _data->vertexFilename = "tri3_mat_vertex.vtu";
+                _data->cellFilename = "tri3_mat_cell.vtu";
+
+                TestDataWriterMaterial::_setDataTri();
+                TestDataWriterMaterial::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMaterial_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMaterial_Tri);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMaterial_Quad : public TestDataWriterVTUMaterial {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMaterial_Quad, TestDataWriterVTUMaterial);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMaterial::setUp();
+                _data = new TestDataWriterVTUMaterial_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "quad4_mat.vtu";
+                _data->vertexFilename = "quad4_mat_vertex.vtu";
+                _data->cellFilename = "quad4_mat_cell.vtu";
+
+                TestDataWriterMaterial::_setDataQuad();
+                TestDataWriterMaterial::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMaterial_Quad
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMaterial_Quad);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMaterial_Tet : public TestDataWriterVTUMaterial {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMaterial_Tet, TestDataWriterVTUMaterial);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMaterial::setUp();
+                _data = new TestDataWriterVTUMaterial_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tet4_mat.vtu";
+                _data->vertexFilename = "tet4_mat_vertex.vtu";
+                _data->cellFilename = "tet4_mat_cell.vtu";
+
+                TestDataWriterMaterial::_setDataTet();
+                TestDataWriterMaterial::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMaterial_Tet
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMaterial_Tet);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMaterial_Hex : public TestDataWriterVTUMaterial {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMaterial_Hex, TestDataWriterVTUMaterial);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMaterial::setUp();
+                _data = new TestDataWriterVTUMaterial_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "hex8_mat.vtu";
+                _data->vertexFilename = "hex8_mat_vertex.vtu";
+                _data->cellFilename = "hex8_mat_cell.vtu";
+
+                TestDataWriterMaterial::_setDataHex();
+                TestDataWriterMaterial::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMaterial_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMaterial_Hex);
+
+    } // meshio
+} // pylith
+
+
+// End of file
@@ -0,0 +1,285 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMesh.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
+
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TestDataWriterMesh::setUp();
+    _data = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TestDataWriterMesh::tearDown();
+    delete _data;_data = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestDataWriterVTUMesh::testConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterVTU writer;
+
+    CPPUNIT_ASSERT(!writer._dm);
+    CPPUNIT_ASSERT_EQUAL(std::string("output.vtu"), writer._filename);
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(1.0), writer._timeConstant);
+    CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+    PYLITH_METHOD_END;
+} // testConstructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestDataWriterVTUMesh::testFilename(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterVTU writer;
+
+    const char* filename = "data.vtu";
+    writer.filename(filename);
+    CPPUNIT_ASSERT_EQUAL(std::string(filename), writer._filename);
+
+    PYLITH_METHOD_END;
+} // testFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Test timeFormat()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeFormat(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterVTU writer;
+
+    const char* format = "%4.1f";
+    writer.timeFormat(format);
+    CPPUNIT_ASSERT_EQUAL(std::string(format), writer._timeFormat);
+
+    PYLITH_METHOD_END;
+} // testTimeFormat
+
+
+// ------------------------------------------------------------------------------------------------
+// Test timeConstant()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeConstant(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterVTU writer;
+
+    const PylithScalar value = 4.5;
+    writer.timeConstant(value);
+    CPPUNIT_ASSERT_EQUAL(value, writer._timeConstant);
+
+    // Verify error with negative time constant.
+    CPPUNIT_ASSERT_THROW(writer.timeConstant(-1.0), std::runtime_error);
+
+    PYLITH_METHOD_END;
+} // testTimeConstant
+
+
+// ------------------------------------------------------------------------------------------------
+// Test openTimeStep() and closeTimeStep()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    DataWriterVTU writer;
+
+    writer.filename(_data->timestepFilename);
+    writer.timeFormat(_data->timeFormat);
+
+    const bool isInfo = false;
+    writer.open(*_mesh, isInfo);
+
+    // Files for each time step contain the mesh without fields.
+    const std::vector<OutputSubfield*> noFields;
+    std::vector<PylithScalar> times;
+    times.push_back(_data->time);
+    times.push_back(_data->time + 1.0);
+    for (size_t i = 0; i < times.size(); ++i) {
+        writer.openTimeStep(times[i], *_mesh);
+        CPPUNIT_ASSERT_EQUAL(true, writer._isOpenTimeStep);
+        writer.closeTimeStep();
+        CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+        checkFiles(writer, _data->timestepFilename, times[i], _data->timeFormat, noFields, noFields);
+    } // for
+    writer.close();
+
+    checkCollection(_data->timestepFilename, times, _data->timeFormat);
+
+    PYLITH_METHOD_END;
+} // testTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeVertexField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    pylith::topology::Field vertexField(*_mesh);
+    _createVertexField(&vertexField);
+
+    DataWriterVTU writer;
+    writer.filename(_data->vertexFilename);
+    writer.timeFormat(_data->timeFormat);
+
+    const PylithScalar t = _data->time;
+    const bool isInfo = false;
+    writer.open(*_mesh, isInfo);
+    writer.openTimeStep(t, *_mesh);
+
+    const pylith::string_vector& subfieldNames = vertexField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+    std::vector<OutputSubfield*> subfields(numFields);
+    for (size_t i = 0; i < numFields; ++i) {
+        subfields[i] = OutputSubfield::create(vertexField, *_mesh, subfieldNames[i].c_str(), 1);
+        CPPUNIT_ASSERT(subfields[i]);
+        subfields[i]->project(vertexField.getOutputVector());
+        writer.writeVertexField(t, *subfields[i]);
+    } // for
+    writer.closeTimeStep();
+
+    checkFiles(writer, _data->vertexFilename, t, _data->timeFormat, subfields, std::vector<OutputSubfield*>());
+    checkCollection(_data->vertexFilename, std::vector<PylithScalar>(1, t), _data->timeFormat);
+
+    writer.close();
+    for (size_t i = 0; i < numFields; ++i) {
+        delete subfields[i];subfields[i] = NULL;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeCellField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteCellField(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    pylith::topology::Field cellField(*_mesh);
+    _createCellField(&cellField);
+
+    DataWriterVTU writer;
+    writer.filename(_data->cellFilename);
+    writer.timeFormat(_data->timeFormat);
+
+    const PylithScalar t = _data->time;
+    const bool isInfo = false;
+    writer.open(*_mesh, isInfo);
+    writer.openTimeStep(t, *_mesh);
+
+    const pylith::string_vector& subfieldNames = cellField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+    std::vector<OutputSubfield*> subfields(numFields);
+    for (size_t i = 0; i < numFields; ++i) {
+        subfields[i] = OutputSubfield::create(cellField, *_mesh, subfieldNames[i].c_str(), 0);
+        CPPUNIT_ASSERT(subfields[i]);
+        subfields[i]->project(cellField.getOutputVector());
+        writer.writeCellField(t, *subfields[i]);
+    } // for
+    writer.closeTimeStep();
+
+    checkFiles(writer, _data->cellFilename, t, _data->timeFormat, std::vector<OutputSubfield*>(), subfields);
+    checkCollection(_data->cellFilename, std::vector<PylithScalar>(1, t), _data->timeFormat);
+
+    writer.close();
+    for (size_t i = 0; i < numFields; ++i) {
+        delete subfields[i];subfields[i] = NULL;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWriteCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _vtuFilenameRoot.
+void
+pylith::meshio::TestDataWriterVTUMesh::testVtuFilenameRoot(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterVTU writer;
+
+    writer._isInfo = true;
+    writer._filename = "output.vtu";
+    CPPUNIT_ASSERT_EQUAL(std::string("output_info"), writer._vtuFilenameRoot(0.0));
+
+    // Use default normalization of 1.0, remove period from time stamp.
+    writer._isInfo = false;
+    writer._filename = "output.vtu";
+    writer.timeFormat("%05.2f");
+    CPPUNIT_ASSERT_EQUAL(std::string("output_t0230"), writer._vtuFilenameRoot(2.3));
+
+    // Use normalization of 20.0, remove period from time stamp.
+    writer._isInfo = false;
+    writer._filename = "output.vtu";
+    writer.timeFormat("%05.2f");
+    writer.timeConstant(20.0);
+    CPPUNIT_ASSERT_EQUAL(std::string("output_t0250"), writer._vtuFilenameRoot(50.0));
+
+    PYLITH_METHOD_END;
+} // testVtuFilenameRoot
+
+
+// ------------------------------------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestDataWriter_Data*
+pylith::meshio::TestDataWriterVTUMesh::_getData(void) {
+    return _data;
+} // _getData
+
+
+// End of file
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestDataWriterVTUMesh.hh
+ *
+ * @brief C++ TestDataWriterVTUMesh object
+ *
+ * C++ unit testing for DataWriterVTUMesh.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtumesh_hh)
+#define pylith_meshio_testdatawritervtumesh_hh
+
+#include "TestDataWriterVTU.hh" // ISA TestDataWriterVTU
+#include "TestDataWriterMesh.hh" // ISA TestDataWriterMesh
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterVTUMesh;
+
+        class TestDataWriterVTUMesh_Data;
+    } // meshio
+} // pylith
+
+// ======================================================================
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMesh : public TestDataWriterVTU, public TestDataWriterMesh, public CppUnit::TestFixture {
+
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestDataWriterVTUMesh);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testFilename);
+    CPPUNIT_TEST(testTimeFormat);
+    CPPUNIT_TEST(testTimeConstant);
+    CPPUNIT_TEST(testTimeStep);
+    CPPUNIT_TEST(testWriteVertexField);
+    CPPUNIT_TEST(testWriteCellField);
+    CPPUNIT_TEST(testVtuFilenameRoot);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test constructor
+    void testConstructor(void);
+
+    /// Test filename()
+    void testFilename(void);
+
+    /// Test timeFormat()
+    void testTimeFormat(void);
+
+    /// Test timeConstant()
+    void testTimeConstant(void);
+
+    /// Test openTimeStep() and closeTimeStep()
+    void testTimeStep(void);
+
+    /// Test writeVertexField.
+    void testWriteVertexField(void);
+
+    /// Test writeCellField.
+    void testWriteCellField(void);
+
+    /// Test _vtuFilenameRoot.
+    void testVtuFilenameRoot(void);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////
+protected:
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestDataWriter_Data* _getData(void);
+
+
+    // PROTECTED MEMBDERS /////////////////////////////////////////////////
+protected:
+
+    TestDataWriterVTUMesh_Data* _data; ///< Data for testing.
+
+}; // class TestDataWriterVTUMesh
+
+
+// ======================================================================
+class pylith::meshio::TestDataWriterVTUMesh_Data : public TestDataWriterVTU_Data, public TestDataWriter_Data {};
+
+#endif // pylith_meshio_testdatawritervtumesh_hh
+
+
+// End of file
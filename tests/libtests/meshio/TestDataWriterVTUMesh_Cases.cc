@@ -0,0 +1,124 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMesh.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+namespace pylith {
+    namespace meshio {
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMesh_Tri : public TestDataWriterVTUMesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMesh_Tri, TestDataWriterVTUMesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMesh::setUp();
+                _data = new TestDataWriterVTUMesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tri3.vtu";
+                _data->vertexFilename = "tri3_vertex.vtu";
+                _data->cellFilename = "tri3_cell.vtu";
+
+                TestDataWriterMesh::_setDataTri();
+                TestDataWriterMesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMesh_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMesh_Tri);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMesh_Quad : public TestDataWriterVTUMesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMesh_Quad, TestDataWriterVTUMesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMesh::setUp();
+                _data = new TestDataWriterVTUMesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "quad4.vtu";
+                _data->vertexFilename = "quad4_vertex.vtu";
+                _data->cellFilename = "quad4_cell.vtu";
+
+                TestDataWriterMesh::_setDataQuad();
+                TestDataWriterMesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMesh_Quad
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMesh_Quad);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMesh_Tet : public TestDataWriterVTUMesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMesh_Tet, TestDataWriterVTUMesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMesh::setUp();
+                _data = new TestDataWriterVTUMesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tet4.vtu";
+                _data->vertexFilename = "tet4_vertex.vtu";
+                _data->cellFilename = "tet4_cell.vtu";
+
+                TestDataWriterMesh::_setDataTet();
+                TestDataWriterMesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMesh_Tet
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMesh_Tet);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUMesh_Hex : public TestDataWriterVTUMesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUMesh_Hex, TestDataWriterVTUMesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUMesh::setUp();
+                _data = new TestDataWriterVTUMesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "hex8.vtu";
+                _data->vertexFilename = "hex8_vertex.vtu";
+                _data->cellFilename = "hex8_cell.vtu";
+
+                TestDataWriterMesh::_setDataHex();
+                TestDataWriterMesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUMesh_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUMesh_Hex);
+
+    } // meshio
+} // pylith
+
+
+// End of file
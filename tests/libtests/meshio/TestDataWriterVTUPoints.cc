@@ -0,0 +1,147 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUPoints.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUPoints::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TestDataWriterPoints::setUp();
+    _data = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestDataWriterVTUPoints::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TestDataWriterPoints::tearDown();
+    delete _data;_data = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test openTimeStep() and closeTimeStep()
+void
+pylith::meshio::TestDataWriterVTUPoints::testTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_pointMesh);
+    CPPUNIT_ASSERT(_data);
+
+    DataWriterVTU writer;
+
+    writer.filename(_data->timestepFilename);
+    writer.timeFormat(_data->timeFormat);
+
+    const bool isInfo = false;
+    writer.open(*_pointMesh, isInfo);
+
+    // Files for each time step contain the mesh without fields.
+    const std::vector<OutputSubfield*> noFields;
+    std::vector<PylithScalar> times;
+    times.push_back(_data->time);
+    times.push_back(_data->time + 1.0);
+    for (size_t i = 0; i < times.size(); ++i) {
+        writer.openTimeStep(times[i], *_pointMesh);
+        CPPUNIT_ASSERT_EQUAL(true, writer._isOpenTimeStep);
+        writer.closeTimeStep();
+        CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+        checkFiles(writer, _data->timestepFilename, times[i], _data->timeFormat, noFields, noFields);
+    } // for
+    writer.close();
+
+    checkCollection(_data->timestepFilename, times, _data->timeFormat);
+
+    PYLITH_METHOD_END;
+} // testTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Test writeVertexField.
+void
+pylith::meshio::TestDataWriterVTUPoints::testWriteVertexField(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_pointMesh);
+    CPPUNIT_ASSERT(_data);
+
+    pylith::topology::Field vertexField(*_pointMesh);
+    _createVertexField(&vertexField);
+
+    DataWriterVTU writer;
+    writer.filename(_data->vertexFilename);
+    writer.timeFormat(_data->timeFormat);
+
+    const PylithScalar t = _data->time;
+    const bool isInfo = false;
+    writer.open(*_pointMesh, isInfo);
+    writer.openTimeStep(t, *_pointMesh);
+
+    const pylith::string_vector& subfieldNames = vertexField.getSubfieldNames();
+    const size_t numFields = subfieldNames.size();
+    std::vector<OutputSubfield*> subfields(numFields);
+    for (size_t i = 0; i < numFields; ++i) {
+        subfields[i] = OutputSubfield::create(vertexField, *_pointMesh, subfieldNames[i].c_str());
+        CPPUNIT_ASSERT(subfields[i]);
+
+        const pylith::topology::Field::SubfieldInfo& info = vertexField.getSubfieldInfo(subfieldNames[i].c_str());
+        subfields[i]->extractSubfield(vertexField, info.index);
+
+        writer.writeVertexField(t, *subfields[i]);
+    } // for
+    writer.closeTimeStep();
+
+    checkFiles(writer, _data->vertexFilename, t, _data->timeFormat, subfields, std::vector<OutputSubfield*>());
+    checkCollection(_data->vertexFilename, std::vector<PylithScalar>(1, t), _data->timeFormat);
+
+    writer.close();
+    for (size_t i = 0; i < numFields; ++i) {
+        delete subfields[i];subfields[i] = NULL;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWriteVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestDataWriterPoints_Data*
+pylith::meshio::TestDataWriterVTUPoints::_getData(void) {
+    return _data;
+} // _getData
+
+
+// End of file
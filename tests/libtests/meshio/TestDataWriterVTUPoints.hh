@@ -0,0 +1,94 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestDataWriterVTUPoints.hh
+ *
+ * @brief C++ TestDataWriterVTUPoints object
+ *
+ * C++ unit testing for DataWriterVTUPoints.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtupoints_hh)
+#define pylith_meshio_testdatawritervtupoints_hh
+
+#include "TestDataWriterVTU.hh" // ISA TestDataWriterVTU
+#include "TestDataWriterPoints.hh" // ISA TestDataWriterPoints
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterVTUPoints;
+
+        class TestDataWriterVTUPoints_Data;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestDataWriterVTUPoints :
+    public TestDataWriterVTU,
+    public TestDataWriterPoints,
+    public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestDataWriterVTUPoints);
+
+    CPPUNIT_TEST(testTimeStep);
+    CPPUNIT_TEST(testWriteVertexField);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test openTimeStep() and closeTimeStep()
+    void testTimeStep(void);
+
+    /// Test writeVertexField.
+    void testWriteVertexField(void);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////
+protected:
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestDataWriterPoints_Data* _getData(void);
+
+    // PROTECTED MEMBDERS /////////////////////////////////////////////////
+protected:
+
+    TestDataWriterVTUPoints_Data* _data; ///< Data for testing.
+
+}; // class TestDataWriterVTUPoints
+
+// ======================================================================
+class pylith::meshio::TestDataWriterVTUPoints_Data : public TestDataWriterVTU_Data, public TestDataWriterPoints_Data {};
+
+#endif // pylith_meshio_testdatawritervtupoints_hh
+
+// End of file
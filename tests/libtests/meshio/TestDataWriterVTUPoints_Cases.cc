@@ -0,0 +1,122 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUPoints.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+namespace pylith {
+    namespace meshio {
+        // --------------------------------------------------------------
+        class TestDataWriterVTUPoints_Tri : public TestDataWriterVTUPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUPoints_Tri, TestDataWriterVTUPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUPoints::setUp();
+                _data = new TestDataWriterVTUPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tri3_points.vtu";
+                _data->vertexFilename = "tri3_points_vertex.vtu";
+
+                TestDataWriterPoints::_setDataTri();
+                TestDataWriterPoints::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestDataWriterVTUPoints_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUPoints_Tri);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUPoints_Quad : public TestDataWriterVTUPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUPoints_Quad, TestDataWriterVTUPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUPoints::setUp();
+                _data = new TestDataWriterVTUPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "quad4_points.vtu";
+                _data->vertexFilename = "quad4_points_vertex.vtu";
+
+                TestDataWriterPoints::_setDataQuad();
+                TestDataWriterPoints::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestDataWriterVTUPoints_Quad
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUPoints_Quad);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUPoints_Tet : public TestDataWriterVTUPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUPoints_Tet, TestDataWriterVTUPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUPoints::setUp();
+                _data = new TestDataWriterVTUPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tet4_points.vtu";
+                _data->vertexFilename = "tet4_points_vertex.vtu";
+
+                TestDataWriterPoints::_setDataTet();
+                TestDataWriterPoints::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestDataWriterVTUPoints_Tet
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUPoints_Tet);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUPoints_Hex : public TestDataWriterVTUPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUPoints_Hex, TestDataWriterVTUPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUPoints::setUp();
+                _data = new TestDataWriterVTUPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "hex8_points.vtu";
+                _data->vertexFilename = "hex8_points_vertex.vtu";
+
+                TestDataWriterPoints::_setDataHex();
+                TestDataWriterPoints::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestDataWriterVTUPoints_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUPoints_Hex);
+
+    } // meshio
+} // pylith
+
+// End of file
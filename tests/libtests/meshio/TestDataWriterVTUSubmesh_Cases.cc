@@ -0,0 +1,124 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUSubmesh.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+namespace pylith {
+    namespace meshio {
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUSubmesh_Tri : public TestDataWriterVTUSubmesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUSubmesh_Tri, TestDataWriterVTUSubmesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUSubmesh::setUp();
+                _data = new TestDataWriterVTUSubmesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tri3_surf.vtu";
+                _data->vertexFilename = "tri3_surf_vertex.vtu";
+                _data->cellFilename = "tri3_surf_cell.vtu";
+
+                TestDataWriterSubmesh::_setDataTri();
+                TestDataWriterSubmesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUSubmesh_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUSubmesh_Tri);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUSubmesh_Quad : public TestDataWriterVTUSubmesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUSubmesh_Quad, TestDataWriterVTUSubmesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUSubmesh::setUp();
+                _data = new TestDataWriterVTUSubmesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "quad4_surf.vtu";
+                _data->vertexFilename = "quad4_surf_vertex.vtu";
+                _data->cellFilename = "quad4_surf_cell.vtu";
+
+                TestDataWriterSubmesh::_setDataQuad();
+                TestDataWriterSubmesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUSubmesh_Quad
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUSubmesh_Quad);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUSubmesh_Tet : public TestDataWriterVTUSubmesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUSubmesh_Tet, TestDataWriterVTUSubmesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUSubmesh::setUp();
+                _data = new TestDataWriterVTUSubmesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "tet4_surf.vtu";
+                _data->vertexFilename = "tet4_surf_vertex.vtu";
+                _data->cellFilename = "tet4_surf_cell.vtu";
+
+                TestDataWriterSubmesh::_setDataTet();
+                TestDataWriterSubmesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUSubmesh_Tet
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUSubmesh_Tet);
+
+        // --------------------------------------------------------------
+        class TestDataWriterVTUSubmesh_Hex : public TestDataWriterVTUSubmesh {
+            CPPUNIT_TEST_SUB_SUITE(TestDataWriterVTUSubmesh_Hex, TestDataWriterVTUSubmesh);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestDataWriterVTUSubmesh::setUp();
+                _data = new TestDataWriterVTUSubmesh_Data();CPPUNIT_ASSERT(_data);
+
+                _data->timestepFilename = "hex8_surf.vtu";
+                _data->vertexFilename = "hex8_surf_vertex.vtu";
+                _data->cellFilename = "hex8_surf_cell.vtu";
+
+                TestDataWriterSubmesh::_setDataHex();
+                TestDataWriterSubmesh::_initialize();
+
+                PYLITH_METHOD_END;
+            } // setUp
+        }; // class TestDataWriterVTUSubmesh_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestDataWriterVTUSubmesh_Hex);
+
+    } // meshio
+} // pylith
+
+
+// End of file
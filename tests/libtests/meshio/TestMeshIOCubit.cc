@@ -23,11 +23,47 @@
 #include "pylith/meshio/MeshIOCubit.hh"
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES JournalingComponent
 
 #include <strings.h> // USES strcasecmp()
+#include <set> // USES std::set
+#include <vector> // USES std::vector
+#include <limits> // USES std::numeric_limits
+#include <iterator> // USES std::distance()
+#include <algorithm> // USES std::min(), std::max()
+#include <cmath> // USES fabs()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _TestMeshIOCubit {
+public:
+
+            /** Compute global summary of mesh using only points owned by each process.
+             *
+             * Sums contain the number of cells, the number of vertices, the sum of the vertex coordinates, the
+             * number of cells with each material id, and the number of vertices in each group.
+             *
+             * @param[out] sums Global sums.
+             * @param[out] minCoords Global minimum of vertex coordinates.
+             * @param[out] maxCoords Global maximum of vertex coordinates.
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] data Test data with material ids and group names.
+             */
+            static
+            void computeSummary(std::vector<PylithReal>* sums,
+                                std::vector<PylithReal>* minCoords,
+                                std::vector<PylithReal>* maxCoords,
+                                const pylith::topology::Mesh& mesh,
+                                const TestMeshIO_Data& data);
+
+        }; // _TestMeshIOCubit
+    } // meshio
+} // pylith
 
 // ----------------------------------------------------------------------
 // Setup testing data.
@@ -112,6 +148,66 @@ pylith::meshio::TestMeshIOCubit::testRead(void) {
 } // testRead
 
 
+// ----------------------------------------------------------------------
+// Test read() with parallel read.
+void
+pylith::meshio::TestMeshIOCubit::testReadParallel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    _io->setFilename(_data->filename);
+    _io->setUseNodesetNames(true);
+    _io->setUseParallelRead(true);
+    CPPUNIT_ASSERT(_io->getUseParallelRead());
+
+    // Read mesh
+    delete _mesh;_mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    _io->read(_mesh);
+
+    pythia::journal::debug_t debug("TestMeshIOCubit");
+    if (debug.state()) {
+        _mesh->view();
+    } // if
+
+    int commSize = 1;
+    PetscErrorCode err = MPI_Comm_size(_mesh->getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+    if (1 == commSize) {
+        // Make sure mesh matches data
+        _checkVals();
+    } else {
+        // Make sure distributed mesh matches mesh read in serial.
+        MeshIOCubit ioSerial;
+        ioSerial.setFilename(_data->filename);
+        ioSerial.setUseNodesetNames(true);
+        ioSerial.setUseParallelRead(false);
+        topology::Mesh meshSerial;
+        ioSerial.read(&meshSerial);
+
+        CPPUNIT_ASSERT_EQUAL(meshSerial.getDimension(), _mesh->getDimension());
+
+        std::vector<PylithReal> sumsParallel, minParallel, maxParallel;
+        _TestMeshIOCubit::computeSummary(&sumsParallel, &minParallel, &maxParallel, *_mesh, *_data);
+        std::vector<PylithReal> sumsSerial, minSerial, maxSerial;
+        _TestMeshIOCubit::computeSummary(&sumsSerial, &minSerial, &maxSerial, meshSerial, *_data);
+
+        const PylithReal tolerance = 1.0e-6;
+        CPPUNIT_ASSERT_EQUAL(sumsSerial.size(), sumsParallel.size());
+        for (size_t i = 0; i < sumsSerial.size(); ++i) {
+            const PylithReal toleranceV = std::max(tolerance, fabs(sumsSerial[i])*tolerance);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(sumsSerial[i], sumsParallel[i], toleranceV);
+        } // for
+        for (size_t i = 0; i < minSerial.size(); ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(minSerial[i], minParallel[i], tolerance);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(maxSerial[i], maxParallel[i], tolerance);
+        } // for
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // testReadParallel
+
+
 // ----------------------------------------------------------------------
 // Get test data.
 pylith::meshio::TestMeshIO_Data*
@@ -131,4 +227,106 @@ pylith::meshio::TestMeshIOCubit_Data::TestMeshIOCubit_Data(void) :
 pylith::meshio::TestMeshIOCubit_Data::~TestMeshIOCubit_Data(void) {}
 
 
+// ----------------------------------------------------------------------
+// Compute global summary of mesh using only points owned by each process.
+void
+pylith::meshio::_TestMeshIOCubit::computeSummary(std::vector<PylithReal>* sums,
+                                                 std::vector<PylithReal>* minCoords,
+                                                 std::vector<PylithReal>* maxCoords,
+                                                 const pylith::topology::Mesh& mesh,
+                                                 const TestMeshIO_Data& data) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(sums);
+    CPPUNIT_ASSERT(minCoords);
+    CPPUNIT_ASSERT(maxCoords);
+
+    PetscDM dmMesh = mesh.getDM();CPPUNIT_ASSERT(dmMesh);
+    PetscErrorCode err = 0;
+
+    // Points that are leaves in the point SF are owned by another process.
+    PylithInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isOwned(pEnd-pStart, true);
+    PetscSF sf = NULL;
+    PylithInt numRoots = 0, numLeaves = 0;
+    const PylithInt* leaves = NULL;
+    err = DMGetPointSF(dmMesh, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PylithInt i = 0; i < numLeaves; ++i) {
+        const PylithInt p = leaves ? leaves[i] : i;
+        isOwned[p-pStart] = false;
+    } // for
+
+    const int spaceDim = data.spaceDim;
+    std::set<PylithInt> materialIds(data.materialIds, data.materialIds+data.numCells);
+    const size_t numSums = 2 + spaceDim + materialIds.size() + data.numGroups;
+    std::vector<PylithReal> sumsLocal(numSums, 0.0);
+    std::vector<PylithReal> minLocal(spaceDim, std::numeric_limits<PylithReal>::max());
+    std::vector<PylithReal> maxLocal(spaceDim, -std::numeric_limits<PylithReal>::max());
+
+    // Cells and material ids.
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PylithInt cStart = cellsStratum.begin();
+    const PylithInt cEnd = cellsStratum.end();
+    for (PylithInt c = cStart; c < cEnd; ++c) {
+        if (!isOwned[c-pStart]) { continue; }
+        sumsLocal[0] += 1.0;
+
+        PylithInt matId = 0;
+        err = DMGetLabelValue(dmMesh, pylith::topology::Mesh::cells_label_name, c, &matId);PYLITH_CHECK_ERROR(err);
+        const size_t iMaterial = std::distance(materialIds.begin(), materialIds.find(matId));
+        CPPUNIT_ASSERT(iMaterial < materialIds.size());
+        sumsLocal[2+spaceDim+iMaterial] += 1.0;
+    } // for
+
+    // Vertices and coordinates.
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PylithInt vStart = verticesStratum.begin();
+    const PylithInt vEnd = verticesStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    for (PylithInt v = vStart; v < vEnd; ++v) {
+        if (!isOwned[v-pStart]) { continue; }
+        sumsLocal[1] += 1.0;
+
+        const PylithInt off = coordsVisitor.sectionOffset(v);
+        CPPUNIT_ASSERT_EQUAL(spaceDim, coordsVisitor.sectionDof(v));
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            sumsLocal[2+iDim] += coordsArray[off+iDim];
+            minLocal[iDim] = std::min(minLocal[iDim], PylithReal(coordsArray[off+iDim]));
+            maxLocal[iDim] = std::max(maxLocal[iDim], PylithReal(coordsArray[off+iDim]));
+        } // for
+    } // for
+
+    // Groups.
+    for (PylithInt iGroup = 0; iGroup < data.numGroups; ++iGroup) {
+        const char* groupName = data.groupNames[iGroup];
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(dmMesh, groupName, &hasLabel);PYLITH_CHECK_ERROR(err);
+        if (!hasLabel) { continue; }
+
+        const PylithInt labelValue = data.groupTags ? data.groupTags[iGroup] : 1;
+        topology::StratumIS groupIS(dmMesh, groupName, labelValue);
+        const PylithInt numPoints = groupIS.size();
+        const PylithInt* points = groupIS.points();
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            if (isOwned[points[p]-pStart]) {
+                sumsLocal[2+spaceDim+materialIds.size()+iGroup] += 1.0;
+            } // if
+        } // for
+    } // for
+
+    MPI_Comm comm = mesh.getComm();
+    sums->resize(numSums);
+    minCoords->resize(spaceDim);
+    maxCoords->resize(spaceDim);
+    err = MPI_Allreduce(&sumsLocal[0], &(*sums)[0], numSums, MPIU_REAL, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&minLocal[0], &(*minCoords)[0], spaceDim, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&maxLocal[0], &(*maxCoords)[0], spaceDim, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeSummary
+
+
 // End of file
@@ -48,6 +48,7 @@ class pylith::meshio::TestMeshIOCubit : public TestMeshIO { // class TestMeshIOC
     CPPUNIT_TEST(testConstructor);
     CPPUNIT_TEST(testFilename);
     CPPUNIT_TEST(testRead);
+    CPPUNIT_TEST(testReadParallel);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -69,6 +70,9 @@ public:
     /// Test read().
     void testRead(void);
 
+    /// Test read() with parallel read.
+    void testReadParallel(void);
+
     /** Get test data.
      *
      * @returns Test data.
@@ -20,350 +20,281 @@
 
 #include "TestOutputSolnPoints.hh" // Implementation of class methods
 
-#include "pylith/meshio/OutputSolnPoints.hh"
+#include "FieldFactory.hh" // USES FieldFactory
 
+#include "pylith/meshio/OutputSolnPoints.hh" // Test subject
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Stratum.hh" // USES Stratum
-#include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
-#include "pylith/meshio/MeshIOCubit.hh" // USES MeshIOCubit
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
-#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "data/OutputSolnPointsDataTri3.hh"
-#include "data/OutputSolnPointsDataQuad4.hh"
-#include "data/OutputSolnPointsDataTet4.hh"
-#include "data/OutputSolnPointsDataHex8.hh"
+#include <vector> // USES std::vector
 
-#include <string.h> // USES strcmp()
-
-// ----------------------------------------------------------------------
-CPPUNIT_TEST_SUITE_REGISTRATION(pylith::meshio::TestOutputSolnPoints);
-
-// ----------------------------------------------------------------------
-// Test constructor
-void
-pylith::meshio::TestOutputSolnPoints::testConstructor(void) { // testConstructor
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-
-    PYLITH_METHOD_END;
-} // testConstructor
-
-
-// ----------------------------------------------------------------------
-// Test setupInterpolator for tri3 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorTri3(void) { // testSetupInterpolatorTri3
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataTri3 data;
-
-    _testSetupInterpolator(data);
-
-    PYLITH_METHOD_END;
-} // testSetupInterpolatorTri3
-
-
-// ----------------------------------------------------------------------
-// Test interpolation for tri3 mesh.
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
 void
-pylith::meshio::TestOutputSolnPoints::testInterpolateTri3(void) { // testInterpolateTri3
+pylith::meshio::TestOutputSolnPoints::setUp(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataTri3 data;
-
-    _testInterpolate(data);
+    _data = NULL;
+    _mesh = NULL;
 
     PYLITH_METHOD_END;
-} // testInterpolateTri3
+} // setUp
 
 
-// ----------------------------------------------------------------------
-// Test setupInterpolator for quad4 mesh.
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
 void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorQuad4(void) { // testSetupInterpolatorQuad4
+pylith::meshio::TestOutputSolnPoints::tearDown(void) {
     PYLITH_METHOD_BEGIN;
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataQuad4 data;
-
-    _testSetupInterpolator(data);
+    delete _data;_data = NULL;
+    delete _mesh;_mesh = NULL;
 
     PYLITH_METHOD_END;
-} // testSetupInterpolatorQuad4
+} // tearDown
 
 
-// ----------------------------------------------------------------------
-// Test interpolation for quad4 mesh.
+// ------------------------------------------------------------------------------------------------
+// Test _matchPoints().
 void
-pylith::meshio::TestOutputSolnPoints::testInterpolateQuad4(void) { // testInterpolateQuad4
+pylith::meshio::TestOutputSolnPoints::testMatchPoints(void) {
     PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+    CPPUNIT_ASSERT(_data->points);
+
+    const int spaceDim = _data->spaceDim;
+    const size_t numPoints = _data->numPoints;
+    const PylithReal tolerance = 1.0e-6;
+
+    // Points to search: points in reverse order, a duplicate of the first point, and a distant point.
+    pylith::scalar_array points((numPoints+2)*spaceDim);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            points[(numPoints-1-iPoint)*spaceDim+iDim] = _data->points[iPoint*spaceDim+iDim];
+        } // for
+    } // for
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        points[numPoints*spaceDim+iDim] = _data->points[iDim];
+        points[(numPoints+1)*spaceDim+iDim] = 100.0;
+    } // for
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataQuad4 data;
+    // Targets: points shifted by less than the tolerance and a point that does not match.
+    const size_t numTargets = numPoints + 1;
+    pylith::scalar_array targets(numTargets*spaceDim);
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            targets[iPoint*spaceDim+iDim] = _data->points[iPoint*spaceDim+iDim] + 0.2*tolerance;
+        } // for
+    } // for
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        targets[numPoints*spaceDim+iDim] = -50.0;
+    } // for
 
-    _testInterpolate(data);
+    pylith::int_array indices;
+    OutputSolnPoints::_matchPoints(&indices, &targets[0], numTargets, points, spaceDim, tolerance);
+    CPPUNIT_ASSERT_EQUAL(numTargets, indices.size());
+    // Duplicate of first point matches the point with the lower index.
+    for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+        const int indexE = numPoints - 1 - iPoint;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in index of matching point.", indexE, indices[iPoint]);
+    } // for
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Expected no match for distant target point.", -1, indices[numPoints]);
+
+    // No points to search.
+    pylith::scalar_array pointsEmpty;
+    OutputSolnPoints::_matchPoints(&indices, &targets[0], numTargets, pointsEmpty, spaceDim, tolerance);
+    CPPUNIT_ASSERT_EQUAL(numTargets, indices.size());
+    for (size_t iTarget = 0; iTarget < numTargets; ++iTarget) {
+        CPPUNIT_ASSERT_EQUAL(-1, indices[iTarget]);
+    } // for
 
     PYLITH_METHOD_END;
-} // testInterpolateQuad4
+} // testMatchPoints
 
 
-// ----------------------------------------------------------------------
-// Test setupInterpolator for tet4 mesh.
+// ------------------------------------------------------------------------------------------------
+// Test _setupInterpolator() and _interpolateField() with cached basis functions.
 void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorTet4(void) { // testSetupInterpolatorTet4
+pylith::meshio::TestOutputSolnPoints::testInterpolate(void) {
     PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataTet4 data;
-
-    _testSetupInterpolator(data);
-
-    PYLITH_METHOD_END;
-} // testSetupInterpolatorTet4
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
 
+    pylith::topology::Field solution(*_mesh);
+    _createSolution(&solution);
 
-// ----------------------------------------------------------------------
-// Test interpolation for tet4 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testInterpolateTet4(void) { // testInterpolateTet4
-    PYLITH_METHOD_BEGIN;
+    const int spaceDim = _data->spaceDim;
+    const int numPoints = _data->numPoints;
+    std::vector<const char*> names(numPoints);
+    for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+        names[iPoint] = _data->names[iPoint].c_str();
+    } // for
 
     OutputSolnPoints output;
-    OutputSolnPointsDataTet4 data;
-
-    _testInterpolate(data);
-
-    PYLITH_METHOD_END;
-} // testInterpolateTet4
+    output.setPoints(_data->points, numPoints, spaceDim, &names[0], numPoints);
+    output._setupInterpolator(solution);
+    CPPUNIT_ASSERT(output._interpolator);
+    CPPUNIT_ASSERT(output._pointSoln);
+
+    // Check point names.
+    CPPUNIT_ASSERT_EQUAL(size_t(numPoints), output._pointNames.size());
+    for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+        CPPUNIT_ASSERT_EQUAL(_data->names[iPoint], output._pointNames[iPoint]);
+    } // for
 
+    // Verify we use the cached basis functions rather than DMInterpolationEvaluate().
+    const size_t numFields = 2;
+    CPPUNIT_ASSERT_EQUAL(2*numFields, output._interpolationFieldSizes.size());
+    CPPUNIT_ASSERT(output._interpolationWeightsStride > 0);
+    CPPUNIT_ASSERT_EQUAL(size_t(numPoints), output._interpolationCells.size());
 
-// ----------------------------------------------------------------------
-// Test setupInterpolator for hex8 mesh.
-void
-pylith::meshio::TestOutputSolnPoints::testSetupInterpolatorHex8(void) { // testSetupInterpolatorHex8
-    PYLITH_METHOD_BEGIN;
-
-    OutputSolnPoints output;
-    OutputSolnPointsDataHex8 data;
+    output._interpolateField(solution);
 
-    _testSetupInterpolator(data);
+    // Interpolate using DMInterpolationEvaluate().
+    PetscErrorCode err = 0;
+    PetscVec interpolatedE = NULL;
+    err = VecDuplicate(output._pointSoln->getLocalVector(), &interpolatedE);CPPUNIT_ASSERT(!err);
+    err = DMInterpolationEvaluate(output._interpolator, solution.getDM(), solution.getLocalVector(),
+                                  interpolatedE);CPPUNIT_ASSERT(!err);
+
+    const int numDof = 1 + spaceDim;
+    PetscInt size = 0, sizeE = 0;
+    err = VecGetLocalSize(output._pointSoln->getLocalVector(), &size);CPPUNIT_ASSERT(!err);
+    err = VecGetLocalSize(interpolatedE, &sizeE);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(numPoints*numDof), sizeE);
+    CPPUNIT_ASSERT_EQUAL(sizeE, size);
+
+    const PetscScalar* interpolatedArray = NULL;
+    const PetscScalar* interpolatedEArray = NULL;
+    err = VecGetArrayRead(output._pointSoln->getLocalVector(), &interpolatedArray);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(interpolatedE, &interpolatedEArray);CPPUNIT_ASSERT(!err);
+    const PylithReal tolerance = 1.0e-10;
+    for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+        for (int iDof = 0; iDof < numDof; ++iDof) {
+            const PylithScalar valueE = interpolatedEArray[iPoint*numDof+iDof];
+            const PylithScalar value = interpolatedArray[iPoint*numDof+iDof];
+            const PylithScalar valueFn = _linearFn(iDof, &_data->points[iPoint*spaceDim], spaceDim);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch with DMInterpolationEvaluate().", valueE, value, tolerance);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch with linear function.", valueFn, value, tolerance);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(output._pointSoln->getLocalVector(), &interpolatedArray);CPPUNIT_ASSERT(!err);
+    err = VecRestoreArrayRead(interpolatedE, &interpolatedEArray);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&interpolatedE);CPPUNIT_ASSERT(!err);
 
     PYLITH_METHOD_END;
-} // testSetupInterpolatorHex8
+} // testInterpolate
 
 
-// ----------------------------------------------------------------------
-// Test interpolation for hex8 mesh.
+// ------------------------------------------------------------------------------------------------
+// Initialize mesh.
 void
-pylith::meshio::TestOutputSolnPoints::testInterpolateHex8(void) { // testInterpolateHex8
+pylith::meshio::TestOutputSolnPoints::_initialize(void) {
     PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
 
-    OutputSolnPoints output;
-    OutputSolnPointsDataHex8 data;
+    delete _mesh;_mesh = new pylith::topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename(_data->meshFilename);
+    iohandler.read(_mesh);
 
-    _testInterpolate(data);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(_data->spaceDim);
+    _mesh->setCoordSys(&cs);
 
     PYLITH_METHOD_END;
-} // testInterpolateHex8
+} // _initialize
 
 
-// ----------------------------------------------------------------------
-// Test setupInterpolator().
+// ------------------------------------------------------------------------------------------------
+// Create solution field with a scalar and a vector subfield that vary linearly in space.
 void
-pylith::meshio::TestOutputSolnPoints::_testSetupInterpolator(const OutputSolnPointsData& data) { // _testSetupInterpolator
+pylith::meshio::TestOutputSolnPoints::_createSolution(pylith::topology::Field* field) {
     PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(field);
+    CPPUNIT_ASSERT(_data);
 
-    const int numPoints = data.numPoints;
-    const int spaceDim = data.spaceDim;
-
-    const int numVerticesE = numPoints;
-    const int numCellsE = numPoints;
-    const int numCornersE = 1;
-
-    topology::Mesh mesh;
-    spatialdata::geocoords::CSCart cs;
-    spatialdata::units::Nondimensional normalizer;
-
-    cs.setSpaceDim(spaceDim);
-    mesh.setCoordSys(&cs);
-    MeshIOCubit iohandler;
-    iohandler.filename(data.meshFilename);
-    iohandler.read(&mesh);
+    const int spaceDim = _data->spaceDim;
+    const pylith::topology::FieldBase::Discretization discretization(1, 1, spaceDim);
 
-    OutputSolnPoints output;
-    CPPUNIT_ASSERT(data.points);
-    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
+    FieldFactory factory(*field);
+    factory.addScalar(discretization);
+    factory.addVector(discretization);
 
-    PetscDM dmMesh = output.pointsMesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->setLabel("solution");
+    field->allocate();
 
-    // Check vertices
-    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    // Basis order 1 reproduces linear functions exactly, so values at the vertices define the field.
+    PetscDM dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
+    pylith::topology::Stratum verticesStratum(dmMesh, pylith::topology::Stratum::DEPTH, 0);
     const PetscInt vStart = verticesStratum.begin();
     const PetscInt vEnd = verticesStratum.end();
-    CPPUNIT_ASSERT_EQUAL(numVerticesE, verticesStratum.size());
-    for (PetscInt v = vStart, index = 0; v < vEnd; ++v, ++index) {
-        const int vertexE = numCellsE + index;
-        CPPUNIT_ASSERT_EQUAL(vertexE, v);
-    } // for
 
-    // Check cells
-    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
-    const PetscInt cStart = cellsStratum.begin();
-    const PetscInt cEnd = cellsStratum.end();
-    PetscErrorCode err = 0;
-    CPPUNIT_ASSERT_EQUAL(numCellsE, cellsStratum.size());
-    for (PetscInt c = cStart, index = 0; c < cEnd; ++c) {
-        const PetscInt *cone = NULL;
-        PetscInt coneSize = 0;
+    pylith::topology::VecVisitorMesh fieldVisitor(*field);
+    PylithScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
 
-        err = DMPlexGetConeSize(dmMesh, c, &coneSize);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetCone(dmMesh, c, &cone);PYLITH_CHECK_ERROR(err);
+    pylith::topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PylithScalar* coordsArray = coordsVisitor.localArray();CPPUNIT_ASSERT(coordsArray);
 
-        CPPUNIT_ASSERT_EQUAL(numCornersE, coneSize);
+    const PetscInt numDof = 1 + spaceDim;
+    PylithReal coords[3];
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+        const PetscInt off = fieldVisitor.sectionOffset(v);
+        CPPUNIT_ASSERT_EQUAL(numDof, fieldVisitor.sectionDof(v));
 
-        for (PetscInt p = 0; p < coneSize; ++p, ++index) {
-            const int coneE = numCellsE+index;
-            CPPUNIT_ASSERT_EQUAL(coneE, cone[p]);
+        const PetscInt coff = coordsVisitor.sectionOffset(v);
+        CPPUNIT_ASSERT_EQUAL(PetscInt(spaceDim), coordsVisitor.sectionDof(v));
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            coords[iDim] = coordsArray[coff+iDim];
         } // for
-    } // for
-
-    PYLITH_METHOD_END;
-} // _testSetupInterpolator
-
-
-// ----------------------------------------------------------------------
-// Test interpolation.
-void
-pylith::meshio::TestOutputSolnPoints::_testInterpolate(const OutputSolnPointsData& data) { // _testInterpolate
-    PYLITH_METHOD_BEGIN;
-
-    const int numPoints = data.numPoints;
-    const int spaceDim = data.spaceDim;
 
-    topology::Mesh mesh;
-    spatialdata::geocoords::CSCart cs;
-    spatialdata::units::Nondimensional normalizer;
-
-    cs.setSpaceDim(spaceDim);
-    mesh.setCoordSys(&cs);
-    MeshIOCubit iohandler;
-    iohandler.filename(data.meshFilename);
-    iohandler.read(&mesh);
-
-    OutputSolnPoints output;
-    CPPUNIT_ASSERT(data.points);
-    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
-
-    // Create field with data.
-    const char* fieldName = "data_field";
-    const int fiberDim = data.fiberDim;
-    pylith::topology::Field field(mesh);
-    field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
-    field.allocate();
-    field.setLabel(fieldName);
-    this->_calcField(&field, data);
-
-    // Create field for interpolated data.
-    pylith::topology::Field fieldInterp(output.pointsMesh());
-    fieldInterp.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
-    fieldInterp.allocate();
-    fieldInterp.setLabel(field.getLabel());
-    fieldInterp.vectorFieldType(field.vectorFieldType());
-    fieldInterp.scale(field.scale());
-
-    // Create field to populate with expected data.
-    pylith::topology::Field fieldInterpE(fieldInterp.mesh());
-    fieldInterpE.cloneSection(fieldInterp);
-    fieldInterpE.allocate();
-    this->_calcField(&fieldInterpE, data);
-
-    PetscDM pointsMeshDM = output.pointsMesh().dmMesh();CPPUNIT_ASSERT(pointsMeshDM);
-    PetscErrorCode err;
-    err = DMInterpolationSetDof(output._interpolator, fiberDim);PYLITH_CHECK_ERROR(err);
-    err = DMInterpolationEvaluate(output._interpolator, field.dmMesh(), field.localVector(), fieldInterp.localVector());PYLITH_CHECK_ERROR(err);
-
-    // Check interpolated field
-    topology::Stratum verticesStratum(pointsMeshDM, topology::Stratum::DEPTH, 0);
-    const PetscInt vStart = verticesStratum.begin();
-    const PetscInt vEnd = verticesStratum.end();
-
-    topology::VecVisitorMesh fieldInterpVisitor(fieldInterp);
-    PetscScalar* fieldInterpArray = fieldInterpVisitor.localArray();CPPUNIT_ASSERT(fieldInterpArray);
-
-    topology::VecVisitorMesh fieldInterpEVisitor(fieldInterpE);
-    PetscScalar* fieldInterpEArray = fieldInterpEVisitor.localArray();CPPUNIT_ASSERT(fieldInterpEArray);
-
-    const double tolerance = 1.0e-6;
-    for (PetscInt v = vStart; v < vEnd; ++v) {
-        const PetscInt off = fieldInterpVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldInterpVisitor.sectionDof(v));
-
-        const PetscInt offE = fieldInterpEVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldInterpEVisitor.sectionDof(v));
-
-        for (PetscInt d = 0; d < fiberDim; ++d) {
-            const PylithScalar valueE = fieldInterpEArray[offE+d];
-            const PylithScalar value = fieldInterpArray[off+d];
-            if (fabs(valueE) > 1.0) {
-                CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,  value / valueE, tolerance);
-            } else {
-                CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
-            } // else
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            fieldArray[off+iDof] = _linearFn(iDof, coords, spaceDim);
         } // for
     } // for
 
     PYLITH_METHOD_END;
-} // _testInterpolate
-
-
-// ----------------------------------------------------------------------
-void
-pylith::meshio::TestOutputSolnPoints::_calcField(pylith::topology::Field* field,
-                                                 const OutputSolnPointsData& data) { // _calcField
-    PYLITH_METHOD_BEGIN;
-
-    CPPUNIT_ASSERT(field);
-
-    const pylith::topology::Mesh& mesh = field->mesh();
-    pylith::topology::Stratum verticesStratum(mesh.dmMesh(), topology::Stratum::DEPTH, 0);
-    const PetscInt vStart = verticesStratum.begin();
-    const PetscInt vEnd = verticesStratum.end();
-
-    pylith::topology::VecVisitorMesh fieldVisitor(*field);
-    PylithScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+} // _createSolution
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute value of linear function for component of solution.
+PylithScalar
+pylith::meshio::TestOutputSolnPoints::_linearFn(const int iComponent,
+                                                const PylithReal* coords,
+                                                const int spaceDim) {
+    PylithScalar value = 1.0 + iComponent;
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        value += (0.5*(iComponent+1) - 0.25*iDim) * coords[iDim];
+    } // for
 
-    pylith::topology::CoordsVisitor coordsVisitor(mesh.dmMesh());
-    PylithScalar* coordsArray = coordsVisitor.localArray();CPPUNIT_ASSERT(coordsArray);
+    return value;
+} // _linearFn
 
-    const PetscInt fiberDim = data.fiberDim;
-    const PetscInt spaceDim = data.spaceDim;
 
-    for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
-        const PetscInt foff = fieldVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(v));
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestOutputSolnPoints_Data::TestOutputSolnPoints_Data(void) :
+    meshFilename(NULL),
+    spaceDim(0),
+    numPoints(0),
+    points(NULL) {}
 
-        const PetscInt coff = coordsVisitor.sectionOffset(v);
-        CPPUNIT_ASSERT_EQUAL(spaceDim, coordsVisitor.sectionDof(v));
-
-        for (PetscInt d = 0; d < fiberDim; ++d, ++index) {
-            PylithScalar value = 0.0;
-            for (PetscInt iv = 0; iv < spaceDim; ++iv) {
-                const PetscInt ic = d*spaceDim + iv;
-                value += data.coefs[ic]*coordsArray[coff+iv];
-            } // for
-            fieldArray[foff+d] = value;
-        } // for
-    } // for
 
-    PYLITH_METHOD_END;
-} // _calcField
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestOutputSolnPoints_Data::~TestOutputSolnPoints_Data(void) {}
 
 
 // End of file
@@ -29,94 +29,97 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
-#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+#include "pylith/utils/array.hh" // HASA string_vector
 
-/// Namespace for pylith package
 namespace pylith {
     namespace meshio {
         class TestOutputSolnPoints;
 
-        class OutputSolnPointsData;
+        class TestOutputSolnPoints_Data;
     } // meshio
 } // pylith
 
 /// C++ unit testing for OutputSolnPoints
-class pylith::meshio::TestOutputSolnPoints : public CppUnit::TestFixture { // class TestOutputSolnPoints
-                                                                           // CPPUNIT TEST SUITE
-                                                                           // /////////////////////////////////////////////////
+class pylith::meshio::TestOutputSolnPoints : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
     CPPUNIT_TEST_SUITE(TestOutputSolnPoints);
 
-    CPPUNIT_TEST(testConstructor);
-
-    CPPUNIT_TEST(testSetupInterpolatorTri);
-    CPPUNIT_TEST(testInterpolateTri);
-
-    CPPUNIT_TEST(testSetupInterpolatorQuad);
-    CPPUNIT_TEST(testInterpolateQuad);
-
-    CPPUNIT_TEST(testSetupInterpolatorTet);
-    CPPUNIT_TEST(testInterpolateTet);
-
-    CPPUNIT_TEST(testSetupInterpolatorHex);
-    CPPUNIT_TEST(testInterpolateHex);
+    CPPUNIT_TEST(testMatchPoints);
+    CPPUNIT_TEST(testInterpolate);
 
     CPPUNIT_TEST_SUITE_END();
 
     // PUBLIC METHODS /////////////////////////////////////////////////////
 public:
 
-    /// Test constructor
-    void testConstructor(void);
-
-    /// Test setupInterpolator for tri3 mesh.
-    void testSetupInterpolatorTri3(void);
-
-    /// Test interpolation for tri3 mesh.
-    void testInterpolateTri3(void);
+    /// Setup testing data.
+    void setUp(void);
 
-    /// Test setupInterpolator for quad4 mesh.
-    void testSetupInterpolatorQuad4(void);
+    /// Tear down testing data.
+    void tearDown(void);
 
-    /// Test interpolation for quad4 mesh.
-    void testInterpolateQuad4(void);
+    /// Test _matchPoints().
+    void testMatchPoints(void);
 
-    /// Test setupInterpolator for tet4 mesh.
-    void testSetupInterpolatorTet4(void);
+    /// Test _setupInterpolator() and _interpolateField() with cached basis functions.
+    void testInterpolate(void);
 
-    /// Test interpolation for tet4 mesh.
-    void testInterpolateTet4(void);
+    // PROTECTED METHODS //////////////////////////////////////////////////
+protected:
 
-    /// Test setupInterpolator for hex8 mesh.
-    void testSetupInterpolatorHex8(void);
+    /// Initialize mesh.
+    void _initialize(void);
 
-    /// Test interpolation for hex8 mesh.
-    void testInterpolateHex8(void);
-
-    // PRIVATE METHODS ////////////////////////////////////////////////////
-private:
-
-    /** Test setupInterpolator.
+    /** Create solution field with a scalar and a vector subfield that vary linearly in space.
      *
-     * @param data Test data.
+     * @param[out] field Solution field.
      */
-    void _testSetupInterpolator(const OutputSolnPointsData& data);
+    void _createSolution(pylith::topology::Field* field);
 
-    /** Test interpolation.
+    /** Compute value of linear function for component of solution.
      *
-     * @param data Test data.
+     * @param[in] iComponent Index of component.
+     * @param[in] coords Coordinates of point.
+     * @param[in] spaceDim Spatial dimension.
+     * @returns Value of function at point.
      */
-    void _testInterpolate(const OutputSolnPointsData& data);
+    static
+    PylithScalar _linearFn(const int iComponent,
+                           const PylithReal* coords,
+                           const int spaceDim);
 
-    /** Compute values of field at vertices in mesh.
-     *
-     * @param field Field to hold values.
-     * @param data Test data.
-     */
-    void _calcField(pylith::topology::Field* field,
-                    const OutputSolnPointsData& data);
+    // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected:
+
+    TestOutputSolnPoints_Data* _data; ///< Data for testing.
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
 
 }; // class TestOutputSolnPoints
 
+// ======================================================================
+class pylith::meshio::TestOutputSolnPoints_Data {
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestOutputSolnPoints_Data(void);
+
+    /// Destructor
+    ~TestOutputSolnPoints_Data(void);
+
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////
+public:
+
+    const char* meshFilename; ///< Name of file with mesh.
+    int spaceDim; ///< Spatial dimension.
+
+    int numPoints; ///< Number of points for interpolation.
+    const PylithReal* points; ///< Coordinates of points [numPoints*spaceDim].
+    pylith::string_vector names; ///< Station names for points.
+
+}; // class TestOutputSolnPoints_Data
+
 #endif // pylith_meshio_testoutputsolnpoints_hh
 
 // End of file
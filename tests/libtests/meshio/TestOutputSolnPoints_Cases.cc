@@ -0,0 +1,154 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestOutputSolnPoints.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+namespace pylith {
+    namespace meshio {
+        // --------------------------------------------------------------
+        class TestOutputSolnPoints_Tri : public TestOutputSolnPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestOutputSolnPoints_Tri, TestOutputSolnPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestOutputSolnPoints::setUp();
+                _data = new TestOutputSolnPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/tri3.mesh";
+                _data->spaceDim = 2;
+
+                static const int numPoints = 4;
+                static const PylithReal points[numPoints*2] = {
+                    -0.3333333, 0.0,
+                    +0.0000001, 0.0,
+                    +0.2500000, 0.5,
+                    +0.6000000, -0.3,
+                };
+                _data->numPoints = numPoints;
+                _data->points = points;
+                _data->names = pylith::string_vector({"ZZ.A", "ZZ.B", "ZZ.C", "ZZ.D"});
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestOutputSolnPoints_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestOutputSolnPoints_Tri);
+
+        // --------------------------------------------------------------
+        class TestOutputSolnPoints_Quad : public TestOutputSolnPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestOutputSolnPoints_Quad, TestOutputSolnPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestOutputSolnPoints::setUp();
+                _data = new TestOutputSolnPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/quad4.mesh";
+                _data->spaceDim = 2;
+
+                static const int numPoints = 4;
+                static const PylithReal points[numPoints*2] = {
+                    -0.5000000, 0.0,
+                    +0.0000001, 0.0,
+                    +0.7500000, 0.8,
+                    -0.9000000, -0.6,
+                };
+                _data->numPoints = numPoints;
+                _data->points = points;
+                _data->names = pylith::string_vector({"ZZ.A", "ZZ.B", "ZZ.C", "ZZ.D"});
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestOutputSolnPoints_Quad
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestOutputSolnPoints_Quad);
+
+        // --------------------------------------------------------------
+        class TestOutputSolnPoints_Tet : public TestOutputSolnPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestOutputSolnPoints_Tet, TestOutputSolnPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestOutputSolnPoints::setUp();
+                _data = new TestOutputSolnPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/tet4.mesh";
+                _data->spaceDim = 3;
+
+                static const int numPoints = 4;
+                static const PylithReal points[numPoints*3] = {
+                    -0.33333333, 0.0, 0.33333333,
+                    +0.00000001, 0.0, 0.33333333,
+                    +0.25000000, 0.2, 0.10000000,
+                    +0.20000000, -0.3, 0.25000000,
+                };
+                _data->numPoints = numPoints;
+                _data->points = points;
+                _data->names = pylith::string_vector({"ZZ.A", "ZZ.B", "ZZ.C", "ZZ.D"});
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestOutputSolnPoints_Tet
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestOutputSolnPoints_Tet);
+
+        // --------------------------------------------------------------
+        class TestOutputSolnPoints_Hex : public TestOutputSolnPoints {
+            CPPUNIT_TEST_SUB_SUITE(TestOutputSolnPoints_Hex, TestOutputSolnPoints);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestOutputSolnPoints::setUp();
+                _data = new TestOutputSolnPoints_Data();CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/hex8.mesh";
+                _data->spaceDim = 3;
+
+                static const int numPoints = 4;
+                static const PylithReal points[numPoints*3] = {
+                    -0.5, 0.0, 0.5,
+                    -0.00000001, 0.0, 0.0,
+                    +0.6, -0.4, 0.3,
+                    -0.7, 0.8, -0.9,
+                };
+                _data->numPoints = numPoints;
+                _data->points = points;
+                _data->names = pylith::string_vector({"ZZ.A", "ZZ.B", "ZZ.C", "ZZ.D"});
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestOutputSolnPoints_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestOutputSolnPoints_Hex);
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -0,0 +1,482 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "FieldFactory.hh" // USES FieldFactory
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::createLowerDimMesh()
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDiscretization()
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <sstream> // USES std::ostringstream
+
+namespace pylith {
+    namespace meshio {
+        class TestOutputSubfield;
+    } // meshio
+} // pylith
+
+class pylith::meshio::TestOutputSubfield : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestOutputSubfield);
+
+    CPPUNIT_TEST(testProjectDirichlet);
+    CPPUNIT_TEST(testProjectSubmesh);
+    CPPUNIT_TEST(testExtractSubfield);
+    CPPUNIT_TEST(testProjectPointSpace);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test project() with plan against DMProjectField() with constrained DOF.
+    void testProjectDirichlet(void);
+
+    /// Test project() with plan against DMProjectField() for boundary submesh.
+    void testProjectSubmesh(void);
+
+    /// Test extractSubfield() with plan against extracting values point by point.
+    void testExtractSubfield(void);
+
+    /// Test project() for subfield with values at quadrature points.
+    void testProjectPointSpace(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////
+private:
+
+    /** Read mesh and create field with scalar and vector subfields.
+     *
+     * The scalar subfield is constrained on the 'bc' boundary.
+     */
+    void _initialize(void);
+
+    /** Project subfield with and without the plan and check that the values match.
+     *
+     * @param[in] mesh Mesh for subfield.
+     * @param[in] name Name of subfield.
+     * @param[in] fieldVector Global PETSc vector with subfields.
+     * @param[in] usePlanE Expected value for using plan.
+     */
+    void _checkProject(const pylith::topology::Mesh& mesh,
+                       const char* name,
+                       const PetscVec fieldVector,
+                       const bool usePlanE);
+
+    /** Check values of subfield vectors match.
+     *
+     * @param[in] vectorE Vector with expected values.
+     * @param[in] vector Vector with values to check.
+     * @param[in] name Name of subfield.
+     */
+    static
+    void _checkValues(const PetscVec vectorE,
+                      const PetscVec vector,
+                      const char* name);
+
+    /// Values for Dirichlet boundary condition.
+    static
+    PetscErrorCode _boundaryValue(PetscInt dim,
+                                  PetscReal t,
+                                  const PetscReal x[],
+                                  PetscInt numComponents,
+                                  PetscScalar* values,
+                                  void* context);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _field; ///< Field with subfields.
+    spatialdata::geocoords::CSCart _cs; ///< Coordinate system.
+
+}; // class TestOutputSubfield
+
+// ------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::meshio::TestOutputSubfield);
+
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestOutputSubfield::setUp(void) {
+    _mesh = NULL;
+    _field = NULL;
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestOutputSubfield::tearDown(void) {
+    delete _field;_field = NULL;
+    delete _mesh;_mesh = NULL;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test project() with plan against DMProjectField() with constrained DOF.
+void
+pylith::meshio::TestOutputSubfield::testProjectDirichlet(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_field);
+
+    // Global vector excludes the constrained DOF of the scalar subfield, which shift the
+    // offsets of the vector subfield at the constrained points.
+    _checkProject(*_mesh, "scalar", _field->getGlobalVector(), false);
+    _checkProject(*_mesh, "vector", _field->getGlobalVector(), true);
+
+    // Output vector includes the constrained DOF.
+    _checkProject(*_mesh, "scalar", _field->getOutputVector(), true);
+    _checkProject(*_mesh, "vector", _field->getOutputVector(), true);
+
+    PYLITH_METHOD_END;
+} // testProjectDirichlet
+
+
+// ------------------------------------------------------------------------------------------------
+// Test project() with plan against DMProjectField() for boundary submesh.
+void
+pylith::meshio::TestOutputSubfield::testProjectSubmesh(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_field);
+
+    pylith::topology::Mesh* submesh = pylith::topology::MeshOps::createLowerDimMesh(*_mesh, "bc2", 1);CPPUNIT_ASSERT(submesh);
+    _checkProject(*submesh, "scalar", _field->getOutputVector(), true);
+    _checkProject(*submesh, "vector", _field->getOutputVector(), true);
+    delete submesh;submesh = NULL;
+
+    PYLITH_METHOD_END;
+} // testProjectSubmesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Test extractSubfield() with plan against extracting values point by point.
+void
+pylith::meshio::TestOutputSubfield::testExtractSubfield(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_field);
+
+    const char* names[2] = { "scalar", "vector" };
+    for (int i = 0; i < 2; ++i) {
+        const PetscInt subfieldIndex = _field->getSubfieldInfo(names[i]).index;
+
+        OutputSubfield* subfield = OutputSubfield::create(*_field, *_mesh, names[i]);CPPUNIT_ASSERT(subfield);
+        CPPUNIT_ASSERT(subfield->_extractFieldIS);
+        subfield->extractSubfield(*_field, subfieldIndex);
+
+        OutputSubfield* subfieldE = OutputSubfield::create(*_field, *_mesh, names[i]);CPPUNIT_ASSERT(subfieldE);
+        PetscErrorCode err = 0;
+        err = ISDestroy(&subfieldE->_extractFieldIS);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&subfieldE->_extractSubfieldIS);CPPUNIT_ASSERT(!err);
+        subfieldE->extractSubfield(*_field, subfieldIndex);
+
+        _checkValues(subfieldE->getVector(), subfield->getVector(), names[i]);
+
+        delete subfield;subfield = NULL;
+        delete subfieldE;subfieldE = NULL;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testExtractSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Test project() for subfield with values at quadrature points.
+void
+pylith::meshio::TestOutputSubfield::testProjectPointSpace(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+    _cs.setSpaceDim(2);
+    _mesh->setCoordSys(&_cs);
+
+    const int quadOrder = 2;
+    pylith::topology::Field solution(*_mesh);
+    solution.setLabel("solution");
+    FieldFactory solutionFactory(solution);
+    solutionFactory.addVector(pylith::topology::FieldBase::Discretization(1, quadOrder));
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+
+    _field = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_field);
+    _field->setLabel("auxiliary");
+    FieldFactory factory(*_field);
+    factory.addTensor(pylith::topology::FieldBase::Discretization(0, quadOrder, -1, -1, false,
+                                                                  pylith::topology::FieldBase::DEFAULT_BASIS,
+                                                                  pylith::topology::FieldBase::POINT_SPACE));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+    pylith::topology::FieldOps::checkDiscretization(solution, *_field);
+    _field->allocate();
+
+    const pylith::topology::Field::SubfieldInfo& info = _field->getSubfieldInfo("tensor");
+    const PetscInt numComponents = info.description.numComponents;
+    CPPUNIT_ASSERT_EQUAL(PetscInt(3), numComponents);
+
+    PetscErrorCode err = 0;
+    PetscDM dm = _field->getDM();
+    PetscDS ds = NULL;
+    PetscObject fe = NULL;
+    PetscQuadrature quadrature = NULL;
+    PetscInt numQuadPts = 0;
+    const PetscReal* quadWeights = NULL;
+    err = DMGetDS(dm, &ds);CPPUNIT_ASSERT(!err);
+    err = PetscDSGetDiscretization(ds, info.index, &fe);CPPUNIT_ASSERT(!err);
+    err = PetscFEGetQuadrature((PetscFE)fe, &quadrature);CPPUNIT_ASSERT(!err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, &quadWeights);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(numQuadPts > 1);
+
+    // Values are only in cells, with one value per component at each quadrature point.
+    PetscSection section = _field->getLocalSection();
+    PetscVec localVec = _field->getLocalVector();
+    PetscScalar* localArray = NULL;
+    PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);CPPUNIT_ASSERT(!err);
+    err = VecGetArray(localVec, &localArray);CPPUNIT_ASSERT(!err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const bool isCell = (point >= cStart) && (point < cEnd);
+        PetscInt numDof = 0, offset = 0;
+        err = PetscSectionGetFieldDof(section, point, info.index, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(section, point, info.index, &offset);CPPUNIT_ASSERT(!err);
+        std::ostringstream msg;
+        msg << "Mismatch in number of values for point " << point << ".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), isCell ? numQuadPts*numComponents : PetscInt(0), numDof);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            const PetscInt iQuad = iDof / numComponents;
+            const PetscInt iComponent = iDof % numComponents;
+            localArray[offset+iDof] = (1.0 + iComponent) * (1.0 + 0.5*iQuad) + point;
+        } // for
+    } // for
+    err = VecRestoreArray(localVec, &localArray);CPPUNIT_ASSERT(!err);
+    _field->createOutputVector();
+    _field->scatterLocalToOutput();
+
+    // Output is quadrature-weighted cell average with basis order 0.
+    OutputSubfield* subfield = OutputSubfield::create(*_field, *_mesh, "tensor", 1);CPPUNIT_ASSERT(subfield);
+    CPPUNIT_ASSERT_EQUAL(0, subfield->getBasisOrder());
+    subfield->project(_field->getOutputVector());
+
+    PetscDM subfieldDM = subfield->getDM();
+    PetscSection subfieldSection = NULL;
+    const PetscScalar* subfieldArray = NULL;
+    err = DMGetLocalSection(subfieldDM, &subfieldSection);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(subfield->getVector(), &subfieldArray);CPPUNIT_ASSERT(!err);
+    PylithReal weightsSum = 0.0;
+    for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+        weightsSum += quadWeights[iQuad];
+    } // for
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt numDof = 0, offset = 0;
+        err = PetscSectionGetDof(subfieldSection, cell, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetOffset(subfieldSection, cell, &offset);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numComponents, numDof);
+        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+            PylithReal valueE = 0.0;
+            for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                valueE += quadWeights[iQuad] * ((1.0 + iComponent) * (1.0 + 0.5*iQuad) + cell);
+            } // for
+            valueE /= weightsSum;
+            std::ostringstream msg;
+            msg << "Mismatch in cell average for component " << iComponent << " in cell " << cell << ".";
+            CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str().c_str(), valueE, PylithReal(subfieldArray[offset+iComponent]), tolerance*valueE);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(subfield->getVector(), &subfieldArray);CPPUNIT_ASSERT(!err);
+    delete subfield;subfield = NULL;
+
+    PYLITH_METHOD_END;
+} // testProjectPointSpace
+
+
+// ------------------------------------------------------------------------------------------------
+// Read mesh and create field with scalar and vector subfields.
+void
+pylith::meshio::TestOutputSubfield::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(_mesh);
+    _cs.setSpaceDim(2);
+    _mesh->setCoordSys(&_cs);
+
+    _field = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_field);
+    _field->setLabel("field");
+    FieldFactory factory(*_field);
+    factory.addScalar(pylith::topology::FieldBase::Discretization(1, 1));
+    factory.addVector(pylith::topology::FieldBase::Discretization(1, 1));
+    _field->subfieldsSetup();
+    _field->createDiscretization();
+
+    PetscErrorCode err = 0;
+    PetscDM dm = _field->getDM();
+    PetscDS ds = NULL;
+    PetscDMLabel label = NULL;
+    const PetscInt labelValue = 1;
+    const PetscInt constrainedDOF[1] = { 0 };
+    const PetscInt scalarIndex = _field->getSubfieldInfo("scalar").index;
+    CPPUNIT_ASSERT(scalarIndex < _field->getSubfieldInfo("vector").index);
+    err = DMGetDS(dm, &ds);CPPUNIT_ASSERT(!err);
+    err = DMGetLabel(dm, "bc", &label);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(label);
+    err = PetscDSAddBoundary(ds, DM_BC_ESSENTIAL, "bc", label, 1, &labelValue, scalarIndex,
+                             1, constrainedDOF, (void (*)(void))_boundaryValue, NULL, NULL, NULL);CPPUNIT_ASSERT(!err);
+    _field->allocate();
+
+    // Set values with constrained DOF consistent with boundary condition.
+    PetscVec localVec = _field->getLocalVector();
+    PetscInt localSize = 0;
+    PetscScalar* localArray = NULL;
+    err = VecGetLocalSize(localVec, &localSize);CPPUNIT_ASSERT(!err);
+    err = VecGetArray(localVec, &localArray);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < localSize; ++i) {
+        localArray[i] = 1.0 + 0.25*i;
+    } // for
+    err = VecRestoreArray(localVec, &localArray);CPPUNIT_ASSERT(!err);
+    err = DMPlexInsertBoundaryValues(dm, PETSC_TRUE, localVec, 0.0, NULL, NULL, NULL);CPPUNIT_ASSERT(!err);
+
+    _field->createGlobalVector();
+    _field->scatterLocalToVector(_field->getGlobalVector());
+    _field->createOutputVector();
+    _field->scatterLocalToOutput();
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Project subfield with and without the plan and check that the values match.
+void
+pylith::meshio::TestOutputSubfield::_checkProject(const pylith::topology::Mesh& mesh,
+                                                  const char* name,
+                                                  const PetscVec fieldVector,
+                                                  const bool usePlanE) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_field);
+
+    const int basisOrder = 1;
+    OutputSubfield* subfield = OutputSubfield::create(*_field, mesh, name, basisOrder);CPPUNIT_ASSERT(subfield);
+    CPPUNIT_ASSERT(subfield->_usePlan);
+    subfield->project(fieldVector);
+
+    std::ostringstream msg;
+    msg << "Mismatch in use of plan for subfield '" << name << "'.";
+    CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), usePlanE, subfield->_usePlan);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), usePlanE, NULL != subfield->_projectFieldIS);
+
+    OutputSubfield* subfieldE = OutputSubfield::create(*_field, mesh, name, basisOrder);CPPUNIT_ASSERT(subfieldE);
+    subfieldE->_usePlan = false;
+    subfieldE->project(fieldVector);
+
+    _checkValues(subfieldE->getVector(), subfield->getVector(), name);
+
+    // Projecting again reuses the plan.
+    if (usePlanE) {
+        PetscIS fieldIS = subfield->_projectFieldIS;
+        subfield->project(fieldVector);
+        CPPUNIT_ASSERT(fieldIS == subfield->_projectFieldIS);
+        _checkValues(subfieldE->getVector(), subfield->getVector(), name);
+    } // if
+
+    delete subfield;subfield = NULL;
+    delete subfieldE;subfieldE = NULL;
+
+    PYLITH_METHOD_END;
+} // _checkProject
+
+
+// ------------------------------------------------------------------------------------------------
+// Check values of subfield vectors match.
+void
+pylith::meshio::TestOutputSubfield::_checkValues(const PetscVec vectorE,
+                                                 const PetscVec vector,
+                                                 const char* name) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(vectorE);
+    CPPUNIT_ASSERT(vector);
+
+    PetscErrorCode err = 0;
+    PetscInt sizeE = 0, size = 0;
+    err = VecGetLocalSize(vectorE, &sizeE);CPPUNIT_ASSERT(!err);
+    err = VecGetLocalSize(vector, &size);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(sizeE, size);
+    CPPUNIT_ASSERT(size > 0);
+
+    const PetscScalar* valuesE = NULL;
+    const PetscScalar* values = NULL;
+    err = VecGetArrayRead(vectorE, &valuesE);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(vector, &values);CPPUNIT_ASSERT(!err);
+    const PylithReal tolerance = 1.0e-12;
+    for (PetscInt i = 0; i < size; ++i) {
+        std::ostringstream msg;
+        msg << "Mismatch in value " << i << " of subfield '" << name << "'.";
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str().c_str(), PylithReal(valuesE[i]), PylithReal(values[i]), tolerance);
+    } // for
+    err = VecRestoreArrayRead(vector, &values);CPPUNIT_ASSERT(!err);
+    err = VecRestoreArrayRead(vectorE, &valuesE);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // _checkValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Values for Dirichlet boundary condition.
+PetscErrorCode
+pylith::meshio::TestOutputSubfield::_boundaryValue(PetscInt dim,
+                                                   PetscReal t,
+                                                   const PetscReal x[],
+                                                   PetscInt numComponents,
+                                                   PetscScalar* values,
+                                                   void* context) {
+    for (PetscInt i = 0; i < numComponents; ++i) {
+        values[i] = -2.5;
+    } // for
+    return PETSC_SUCCESS;
+} // _boundaryValue
+
+
+// End of file
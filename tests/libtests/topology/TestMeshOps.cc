@@ -105,6 +105,14 @@ pylith::topology::TestMeshOps::testCheckTopology(void) {
         "data/twohex8.mesh",
     };
 
+    const size_t numLevels = 4;
+    const MeshOps::CheckTopologyLevel levels[numLevels] = {
+        MeshOps::CHECK_TOPOLOGY_NONE,
+        MeshOps::CHECK_TOPOLOGY_BASIC,
+        MeshOps::CHECK_TOPOLOGY_LOCAL,
+        MeshOps::CHECK_TOPOLOGY_FULL,
+    };
+
     for (int i = 0; i < numFiles; ++i) {
         const char* filename = filenames[i];
         Mesh mesh;
@@ -112,6 +120,27 @@ pylith::topology::TestMeshOps::testCheckTopology(void) {
         iohandler.setFilename(filename);
         iohandler.read(&mesh);
         MeshOps::checkTopology(mesh);
+
+        for (size_t iLevel = 0; iLevel < numLevels; ++iLevel) {
+            MeshOps::checkTopology(mesh, levels[iLevel]);
+
+            MeshOps::setCheckTopologyLevel(levels[iLevel]);
+            CPPUNIT_ASSERT_EQUAL(levels[iLevel], MeshOps::getCheckTopologyLevel());
+            pylith::int_array cells(1);
+            cells[0] = 0;
+            MeshOps::checkTopology(mesh, cells);
+        } // for
+        MeshOps::setCheckTopologyLevel(MeshOps::CHECK_TOPOLOGY_FULL);
+    } // for
+
+    // Mesh with inverted cell.
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3_inverted.mesh");
+    iohandler.read(&mesh, false);
+    MeshOps::checkTopology(mesh, MeshOps::CHECK_TOPOLOGY_NONE);
+    for (size_t iLevel = 1; iLevel < numLevels; ++iLevel) {
+        CPPUNIT_ASSERT_THROW(MeshOps::checkTopology(mesh, levels[iLevel]), std::runtime_error);
     } // for
 
     PYLITH_METHOD_END;
@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestMeshOrdering.hh
+ *
+ * @brief C++ TestMeshOrdering object
+ *
+ * C++ unit testing for MeshOrdering.
+ */
+
+#if !defined(pylith_topology_testmeshordering_hh)
+#define pylith_topology_testmeshordering_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/MeshOrdering.hh" // USES MeshOrdering
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestMeshOrdering;
+        class TestMeshOrdering_Data;
+    } // topology
+} // pylith
+
+// TestMeshOrdering ---------------------------------------------------------------
+class pylith::topology::TestMeshOrdering : public CppUnit::TestFixture
+{ // class TestMeshOrdering
+
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE( TestMeshOrdering );
+
+    CPPUNIT_TEST( testReorder );
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test reorder().
+    void testReorder(void);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////
+protected:
+
+    TestMeshOrdering_Data* _data; ///< Data for testing.
+    Mesh* _mesh; ///< Finite-element mesh.
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /// Setup mesh.
+    void _initialize();
+
+}; // class TestMeshOrdering
+
+
+// TestMeshOrdering_Data-----------------------------------------------------------
+class pylith::topology::TestMeshOrdering_Data {
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestMeshOrdering_Data(void);
+
+    /// Destructor
+    ~TestMeshOrdering_Data(void);
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////
+public:
+
+    const char* filename; ///< Name of mesh file.
+    const char* faultLabel; ///< Label for fault (use NULL for no fault).
+    MeshOrdering::OrderingEnum ordering; ///< Algorithm used to order cells.
+
+};  // TestMeshOrdering_Data
+
+
+#endif // pylith_topology_testmeshordering_hh
+
+
+// End of file
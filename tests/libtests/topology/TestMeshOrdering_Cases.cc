@@ -0,0 +1,193 @@
+// -*- C++ -*-
+//
+// -----------------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// -----------------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshOrdering.hh" // Implementation of class methods
+
+// -----------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Tri_Fault_RCM : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Tri_Fault_RCM, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_tri3.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::RCM;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Tri_Fault_RCM
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Tri_Fault_RCM );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Tri_Nofault_Morton : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Tri_Nofault_Morton, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_tri3.mesh";
+                _data->faultLabel = NULL;
+                _data->ordering = MeshOrdering::MORTON;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Tri_Nofault_Morton
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Tri_Nofault_Morton );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Quad_Nofault_RCM : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Quad_Nofault_RCM, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_quad4.mesh";
+                _data->faultLabel = NULL;
+                _data->ordering = MeshOrdering::RCM;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Quad_Nofault_RCM
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Quad_Nofault_RCM );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Quad_Fault_Morton : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Quad_Fault_Morton, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_quad4.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::MORTON;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Quad_Fault_Morton
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Quad_Fault_Morton );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Tet_Fault_RCM : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Tet_Fault_RCM, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_tet4.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::RCM;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Tet_Fault_RCM
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Tet_Fault_RCM );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Tet_Fault_Hilbert : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Tet_Fault_Hilbert, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_tet4.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::HILBERT;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Tet_Fault_Hilbert
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Tet_Fault_Hilbert );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Hex_Nofault_RCM : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Hex_Nofault_RCM, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = NULL;
+                _data->ordering = MeshOrdering::RCM;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Hex_Nofault_RCM
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Hex_Nofault_RCM );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Hex_Fault_Morton : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Hex_Fault_Morton, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::MORTON;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Hex_Fault_Morton
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Hex_Fault_Morton );
+
+        // ---------------------------------------------------------------------
+        class TestMeshOrdering_Hex_Fault_Hilbert : public TestMeshOrdering {
+
+            CPPUNIT_TEST_SUB_SUITE( TestMeshOrdering_Hex_Fault_Hilbert, TestMeshOrdering );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshOrdering::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = "fault";
+                _data->ordering = MeshOrdering::HILBERT;
+            }   // setUp
+
+
+        };  // TestMeshOrdering_Hex_Fault_Hilbert
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestMeshOrdering_Hex_Fault_Hilbert );
+
+    }   // topology
+}   // pylith
+
+
+// End of file
@@ -0,0 +1,341 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshSnapshot.hh" // Implementation of class methods
+
+#include "pylith/topology/MeshSnapshot.hh" // USES MeshSnapshot
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/materials/Elasticity.hh" // USES Elasticity
+#include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::topology::TestMeshSnapshot);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test write() and read() for mesh with triangular cells.
+void
+pylith::topology::TestMeshSnapshot::testTri3(void) {
+    _testWriteRead("data/reorder_tri3.mesh", NULL);
+} // testTri3
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test write() and read() for mesh with triangular cells and a fault.
+void
+pylith::topology::TestMeshSnapshot::testTri3Fault(void) {
+    _testWriteRead("data/reorder_tri3.mesh", "fault");
+} // testTri3Fault
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test write() and read() for mesh with hexahedral cells and a fault.
+void
+pylith::topology::TestMeshSnapshot::testHex8Fault(void) {
+    _testWriteRead("data/reorder_hex8.mesh", "fault");
+} // testHex8Fault
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test residual on restored mesh with triangular cells.
+void
+pylith::topology::TestMeshSnapshot::testResidualTri3(void) {
+    _testResidual("data/reorder_tri3.mesh", NULL);
+} // testResidualTri3
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test residual on restored mesh with triangular cells and a fault.
+void
+pylith::topology::TestMeshSnapshot::testResidualTri3Fault(void) {
+    _testResidual("data/reorder_tri3.mesh", "fault");
+} // testResidualTri3Fault
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to snapshot, read it back, and check that the meshes are identical.
+void
+pylith::topology::TestMeshSnapshot::_testWriteRead(const char* filename,
+                                                   const char* faultLabel) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(filename);
+
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(filename);
+    iohandler.read(&mesh);
+
+    pylith::faults::FaultCohesiveStub fault;
+    pylith::faults::FaultCohesive* faults[1] = { &fault };
+    const int numFaults = faultLabel ? 1 : 0;
+    if (faultLabel) {
+        fault.setCohesiveLabelValue(100);
+        fault.setSurfaceLabelName(faultLabel);
+        fault.adjustTopology(&mesh);
+    } // if
+
+    const char* snapshotFilename = "mesh_snapshot.h5";
+    MeshSnapshot::write(mesh, snapshotFilename);
+
+    Mesh meshRestored;
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(mesh.getDimension());
+    meshRestored.setCoordSys(&cs);
+    MeshSnapshot::read(&meshRestored, snapshotFilename, faults, numFaults);
+
+    PetscErrorCode err = 0;
+    PetscDM dm = mesh.getDM();CPPUNIT_ASSERT(dm);
+    PetscDM dmRestored = meshRestored.getDM();CPPUNIT_ASSERT(dmRestored);
+
+    // Check points, cones, and cell types.
+    PetscInt pStart = 0, pEnd = 0, pStartRestored = 0, pEndRestored = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    err = DMPlexGetChart(dmRestored, &pStartRestored, &pEndRestored);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(pStart, pStartRestored);
+    CPPUNIT_ASSERT_EQUAL(pEnd, pEndRestored);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        std::ostringstream msg;
+        msg << "Mismatch for point " << point << ".";
+
+        PetscInt coneSize = 0, coneSizeRestored = 0;
+        err = DMPlexGetConeSize(dm, point, &coneSize);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetConeSize(dmRestored, point, &coneSizeRestored);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), coneSize, coneSizeRestored);
+
+        const PetscInt *cone = NULL, *coneRestored = NULL;
+        const PetscInt *orientation = NULL, *orientationRestored = NULL;
+        err = DMPlexGetCone(dm, point, &cone);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetCone(dmRestored, point, &coneRestored);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetConeOrientation(dm, point, &orientation);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetConeOrientation(dmRestored, point, &orientationRestored);CPPUNIT_ASSERT(!err);
+        for (PetscInt i = 0; i < coneSize; ++i) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), cone[i], coneRestored[i]);
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), orientation[i], orientationRestored[i]);
+        } // for
+
+        DMPolytopeType ct, ctRestored;
+        err = DMPlexGetCellType(dm, point, &ct);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetCellType(dmRestored, point, &ctRestored);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), int(ct), int(ctRestored));
+    } // for
+
+    // Check coordinates (bit-identical).
+    PetscVec coordsVec = NULL, coordsVecRestored = NULL;
+    PetscInt coordsSize = 0, coordsSizeRestored = 0;
+    err = DMGetCoordinatesLocal(dm, &coordsVec);CPPUNIT_ASSERT(!err);
+    err = DMGetCoordinatesLocal(dmRestored, &coordsVecRestored);CPPUNIT_ASSERT(!err);
+    err = VecGetLocalSize(coordsVec, &coordsSize);CPPUNIT_ASSERT(!err);
+    err = VecGetLocalSize(coordsVecRestored, &coordsSizeRestored);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(coordsSize, coordsSizeRestored);
+    const PetscScalar *coords = NULL, *coordsRestored = NULL;
+    err = VecGetArrayRead(coordsVec, &coords);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(coordsVecRestored, &coordsRestored);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < coordsSize; ++i) {
+        CPPUNIT_ASSERT_EQUAL(coords[i], coordsRestored[i]);
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coords);CPPUNIT_ASSERT(!err);
+    err = VecRestoreArrayRead(coordsVecRestored, &coordsRestored);CPPUNIT_ASSERT(!err);
+
+    // Check labels.
+    PetscInt numLabels = 0;
+    err = DMGetNumLabels(dm, &numLabels);CPPUNIT_ASSERT(!err);
+    for (PetscInt iLabel = 0; iLabel < numLabels; ++iLabel) {
+        const char* labelName = NULL;
+        PetscDMLabel label = NULL, labelRestored = NULL;
+        err = DMGetLabelName(dm, iLabel, &labelName);CPPUNIT_ASSERT(!err);
+        err = DMGetLabel(dm, labelName, &label);CPPUNIT_ASSERT(!err);
+        err = DMGetLabel(dmRestored, labelName, &labelRestored);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_MESSAGE(std::string("Missing label '") + labelName + "'.", labelRestored);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt value = 0, valueRestored = 0;
+            err = DMLabelGetValue(label, point, &value);CPPUNIT_ASSERT(!err);
+            err = DMLabelGetValue(labelRestored, point, &valueRestored);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(std::string("Mismatch in label '") + labelName + "'.", value, valueRestored);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _testWriteRead
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to snapshot, read it back, and check that the residuals for elasticity are identical.
+void
+pylith::topology::TestMeshSnapshot::_testResidual(const char* filename,
+                                                  const char* faultLabel) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(filename);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(2);
+
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(1.0e+03);
+    normalizer.setTimeScale(2.0);
+    normalizer.setPressureScale(2.25e+10);
+    normalizer.computeDensityScale();
+
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(filename);
+    iohandler.read(&mesh);
+    mesh.setCoordSys(&cs);
+
+    pylith::faults::FaultCohesiveStub fault;
+    pylith::faults::FaultCohesive* faults[1] = { &fault };
+    const int numFaults = faultLabel ? 1 : 0;
+    if (faultLabel) {
+        fault.setCohesiveLabelValue(100);
+        fault.setSurfaceLabelName(faultLabel);
+        fault.adjustTopology(&mesh);
+    } // if
+
+    // Snapshots are written before nondimensionalizing the mesh, as in MeshImporter.
+    const char* snapshotFilename = "mesh_snapshot_residual.h5";
+    MeshSnapshot::write(mesh, snapshotFilename);
+
+    Mesh meshRestored;
+    meshRestored.setCoordSys(&cs);
+    MeshSnapshot::read(&meshRestored, snapshotFilename, faults, numFaults);
+
+    MeshOps::nondimensionalize(&mesh, normalizer);
+    MeshOps::nondimensionalize(&meshRestored, normalizer);
+
+    pylith::scalar_array residual;
+    pylith::scalar_array residualRestored;
+    _computeResidual(&residual, mesh, normalizer, faults, numFaults);
+    _computeResidual(&residualRestored, meshRestored, normalizer, faults, numFaults);
+
+    CPPUNIT_ASSERT(residual.size() > 0);
+    CPPUNIT_ASSERT_EQUAL(residual.size(), residualRestored.size());
+    for (size_t i = 0; i < residual.size(); ++i) {
+        std::ostringstream msg;
+        msg << "Mismatch in residual for degree of freedom " << i << ".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), residual[i], residualRestored[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _testResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute residual for elasticity with a fixed trial solution.
+void
+pylith::topology::TestMeshSnapshot::_computeResidual(pylith::scalar_array* residual,
+                                                     const pylith::topology::Mesh& mesh,
+                                                     const spatialdata::units::Nondimensional& normalizer,
+                                                     pylith::faults::FaultCohesive* faults[],
+                                                     const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(residual);
+
+    const size_t numValues = 3;
+    const char* const names[numValues] = { "density", "vs", "vp" };
+    const char* const units[numValues] = { "kg/m**3", "m/s", "m/s" };
+    const double values[numValues] = { 2500.0, 3000.0, 5291.5026 };
+    spatialdata::spatialdb::UniformDB auxDB;
+    auxDB.setDescription("material auxiliary field spatial database");
+    auxDB.setData(names, units, values, numValues);
+
+    // Materials match material-ids in data/reorder_tri3.mesh.
+    const size_t numMaterials = 2;
+    pylith::materials::IsotropicLinearElasticity rheologies[numMaterials];
+    pylith::materials::Elasticity elasticity[numMaterials];
+    pylith::materials::Material* materials[numMaterials];
+    for (size_t i = 0; i < numMaterials; ++i) {
+        rheologies[i].useReferenceState(false);
+        elasticity[i].setBulkRheology(&rheologies[i]);
+        elasticity[i].setAuxiliaryFieldDB(&auxDB);
+        elasticity[i].setFormulation(pylith::problems::Physics::QUASISTATIC);
+        elasticity[i].useBodyForce(false);
+        elasticity[i].setLabelValue(i+1);
+        materials[i] = &elasticity[i];
+    } // for
+
+    pylith::topology::Field solution(mesh);
+    solution.setLabel("solution");
+    pylith::problems::SolutionFactory factory(solution, normalizer);
+    factory.addDisplacement(pylith::topology::Field::Discretization(1, 1));
+
+    pylith::problems::TimeDependent problem;
+    problem.setNormalizer(normalizer);
+    problem.setMaterials(materials, numMaterials);
+    problem.setInterfaces(faults, numFaults);
+    problem.setStartTime(0.0);
+    problem.setEndTime(1.0);
+    problem.setInitialTimeStep(1.0);
+    problem.setFormulation(pylith::problems::Physics::QUASISTATIC);
+    problem.setSolverType(pylith::problems::Problem::LINEAR);
+    problem.setMaxTimeSteps(1);
+    problem.setSolution(&solution);
+    problem.preinitialize(mesh);
+    problem.verifyConfiguration();
+    problem.initialize();
+
+    // Trial solution depends only on the global index of the degree of freedom, so it is the same for
+    // meshes with identical points and sections.
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL, solutionDotVec = NULL, residualVec = NULL;
+    err = VecDuplicate(problem.getSolution()->getGlobalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(solutionVec, &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(solutionVec, &residualVec);CPPUNIT_ASSERT(!err);
+    PetscInt size = 0;
+    err = VecGetLocalSize(solutionVec, &size);CPPUNIT_ASSERT(!err);
+    PetscScalar* solutionArray = NULL;
+    err = VecGetArray(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < size; ++i) {
+        solutionArray[i] = 1.0e-3 * (1 + (7*i) % 11);
+    } // for
+    err = VecRestoreArray(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+
+    problem.computeLHSResidual(residualVec, 0.0, 1.0, solutionVec, solutionDotVec);
+
+    const PetscScalar* residualArray = NULL;
+    residual->resize(size);
+    err = VecGetArrayRead(residualVec, &residualArray);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < size; ++i) {
+        (*residual)[i] = residualArray[i];
+    } // for
+    err = VecRestoreArrayRead(residualVec, &residualArray);CPPUNIT_ASSERT(!err);
+
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualVec);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // _computeResidual
+
+
+// End of file
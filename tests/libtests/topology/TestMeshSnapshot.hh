@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestMeshSnapshot.hh
+ *
+ * @brief C++ TestMeshSnapshot object.
+ *
+ * C++ unit testing for MeshSnapshot.
+ */
+
+#if !defined(pylith_topology_testmeshsnapshot_hh)
+#define pylith_topology_testmeshsnapshot_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/faults/faultsfwd.hh" // USES FaultCohesive
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestMeshSnapshot;
+    } // topology
+} // pylith
+
+/// C++ unit testing for MeshSnapshot.
+class pylith::topology::TestMeshSnapshot : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMeshSnapshot);
+
+    CPPUNIT_TEST(testTri3);
+    CPPUNIT_TEST(testTri3Fault);
+    CPPUNIT_TEST(testHex8Fault);
+    CPPUNIT_TEST(testResidualTri3);
+    CPPUNIT_TEST(testResidualTri3Fault);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Test write() and read() for mesh with triangular cells.
+    void testTri3(void);
+
+    /// Test write() and read() for mesh with triangular cells and a fault.
+    void testTri3Fault(void);
+
+    /// Test write() and read() for mesh with hexahedral cells and a fault.
+    void testHex8Fault(void);
+
+    /// Test residual on restored mesh with triangular cells.
+    void testResidualTri3(void);
+
+    /// Test residual on restored mesh with triangular cells and a fault.
+    void testResidualTri3Fault(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////
+private:
+
+    /** Write mesh to snapshot, read it back, and check that the meshes are identical.
+     *
+     * The restored mesh must have the same points, cones, cell types, coordinates, and labels,
+     * so computations on the restored mesh give bit-identical results.
+     *
+     * @param[in] filename Name of mesh file.
+     * @param[in] faultLabel Name of label for fault (NULL if no fault).
+     */
+    void _testWriteRead(const char* filename,
+                        const char* faultLabel);
+
+    /** Write mesh to snapshot, read it back, and check that the residuals for elasticity are identical.
+     *
+     * @param[in] filename Name of mesh file.
+     * @param[in] faultLabel Name of label for fault (NULL if no fault).
+     */
+    void _testResidual(const char* filename,
+                       const char* faultLabel);
+
+    /** Compute residual for elasticity with a fixed trial solution.
+     *
+     * @param[out] residual Values of residual (global vector).
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] normalizer Scales for nondimensionalization.
+     * @param[in] faults Array of faults.
+     * @param[in] numFaults Number of faults.
+     */
+    static
+    void _computeResidual(pylith::scalar_array* residual,
+                          const pylith::topology::Mesh& mesh,
+                          const spatialdata::units::Nondimensional& normalizer,
+                          pylith::faults::FaultCohesive* faults[],
+                          const int numFaults);
+
+}; // class TestMeshSnapshot
+
+#endif // pylith_topology_testmeshsnapshot_hh
+
+// End of file
@@ -192,6 +192,67 @@ pylith::topology::TestRefineUniform::testRefine(void) {
 } // testRefine
 
 
+// ----------------------------------------------------------------------
+// Test refine() with keeping coarse levels.
+void
+pylith::topology::TestRefineUniform::testRefineHierarchy(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    Mesh mesh(_data->cellDim);
+    _initializeMesh(&mesh);
+
+    RefineUniform refiner;
+    Mesh newMesh(_data->cellDim);
+    const bool keepHierarchy = true;
+    refiner.refine(&newMesh, mesh, _data->refineLevel, keepHierarchy);
+
+    PetscErrorCode err = 0;
+    PetscDM dmMesh = newMesh.getDM();CPPUNIT_ASSERT(dmMesh);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(_data->numCells+_data->numCellsCohesive, cEnd-cStart);
+
+    // Walk from finest to coarsest level.
+    int numLevels = 0;
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);CPPUNIT_ASSERT(!err);
+    while (dmCoarse) {
+        ++numLevels;
+
+        // Cells label should only contain cells.
+        PetscInt cStartCoarse = 0, cEndCoarse = 0;
+        err = DMPlexGetHeightStratum(dmCoarse, 0, &cStartCoarse, &cEndCoarse);CPPUNIT_ASSERT(!err);
+        PetscDMLabel matidLabel = NULL;
+        err = DMGetLabel(dmCoarse, pylith::topology::Mesh::cells_label_name, &matidLabel);CPPUNIT_ASSERT(!err);
+        PetscInt pStart = 0, pEnd = 0;
+        err = DMPlexGetChart(dmCoarse, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            if (( p >= cStartCoarse) && ( p < cEndCoarse) ) { continue; }
+            PetscInt matId = -1;
+            err = DMLabelGetValue(matidLabel, p, &matId);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT_EQUAL(-1, matId);
+        } // for
+
+        if (numLevels == _data->refineLevel) {
+            CPPUNIT_ASSERT_EQUAL(mesh.getDM(), dmCoarse);
+        } // if
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);CPPUNIT_ASSERT(!err);
+    } // while
+    CPPUNIT_ASSERT_EQUAL(_data->refineLevel, numLevels);
+
+    // Clones of mesh share coarse levels.
+    Mesh* meshClone = newMesh.clone();CPPUNIT_ASSERT(meshClone);
+    PetscDM dmCloneCoarse = NULL;
+    err = DMGetCoarseDM(meshClone->getDM(), &dmCloneCoarse);CPPUNIT_ASSERT(!err);
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(dmCoarse, dmCloneCoarse);
+    delete meshClone;meshClone = NULL;
+
+    PYLITH_METHOD_END;
+} // testRefineHierarchy
+
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestRefineUniform::_initializeMesh(Mesh* const mesh) {
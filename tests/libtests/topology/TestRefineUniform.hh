@@ -49,6 +49,7 @@ class pylith::topology::TestRefineUniform : public CppUnit::TestFixture {
     CPPUNIT_TEST_SUITE( TestRefineUniform );
 
     CPPUNIT_TEST( testRefine );
+    CPPUNIT_TEST( testRefineHierarchy );
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -64,6 +65,9 @@ public:
     /// Test refine().
     void testRefine(void);
 
+    /// Test refine() with keeping coarse levels.
+    void testRefineHierarchy(void);
+
     // PROTECTED METHODS /////////////////////////////////////////////////////////
 protected:
 
@@ -0,0 +1,162 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include <vector> // USES std::vector
+#include <cstdlib> // USES abs()
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::topology::TestSpaceFillingCurve);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test mortonKey().
+void
+pylith::topology::TestSpaceFillingCurve::testMortonKey(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int numBits = 2;
+    { // 2-D
+        const int dim = 2;
+        const unsigned long long coords[dim] = { 2, 1 }; // binary 10, 01
+        const unsigned long long keyE = 9; // binary 1001
+        CPPUNIT_ASSERT_EQUAL(keyE, SpaceFillingCurve::mortonKey(coords, dim, numBits));
+    } // 2-D
+
+    { // 3-D
+        const int dim = 3;
+        const unsigned long long coords[dim] = { 3, 0, 1 }; // binary 11, 00, 01
+        const unsigned long long keyE = 37; // binary 100101
+        CPPUNIT_ASSERT_EQUAL(keyE, SpaceFillingCurve::mortonKey(coords, dim, numBits));
+    } // 3-D
+
+    PYLITH_METHOD_END;
+} // testMortonKey
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test hilbertKey().
+void
+pylith::topology::TestSpaceFillingCurve::testHilbertKey(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Keys should enumerate every point of the grid exactly once, and consecutive points along
+    // the curve should be neighbors.
+    const int numBits = 3;
+    const int numPerDim = 1 << numBits;
+    for (int dim = 1; dim <= 3; ++dim) {
+        int numPoints = 1;
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            numPoints *= numPerDim;
+        } // for
+
+        std::vector<int> pointAtKey(numPoints, -1);
+        for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+            unsigned long long coords[3];
+            for (int iDim = 0, index = iPoint; iDim < dim; ++iDim, index /= numPerDim) {
+                coords[iDim] = index % numPerDim;
+            } // for
+            const unsigned long long key = SpaceFillingCurve::hilbertKey(coords, dim, numBits);
+            CPPUNIT_ASSERT(key < (unsigned long long)(numPoints));
+            CPPUNIT_ASSERT_EQUAL(-1, pointAtKey[key]);
+            pointAtKey[key] = iPoint;
+        } // for
+
+        for (int iKey = 1; iKey < numPoints; ++iKey) {
+            int distance = 0;
+            for (int iDim = 0, a = pointAtKey[iKey-1], b = pointAtKey[iKey]; iDim < dim; ++iDim, a /= numPerDim, b /= numPerDim) {
+                distance += abs(a % numPerDim - b % numPerDim);
+            } // for
+            CPPUNIT_ASSERT_EQUAL(1, distance);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testHilbertKey
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test sortKeys().
+void
+pylith::topology::TestSpaceFillingCurve::testSortKeys(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const size_t numKeys = 5;
+    const unsigned long long keysArray[numKeys] = { 7, 2, 9, 2, 0 };
+    const PetscInt orderE[numKeys] = { 4, 1, 3, 0, 2 };
+
+    std::vector<unsigned long long> keys(keysArray, keysArray+numKeys);
+    std::vector<PetscInt> order;
+    SpaceFillingCurve::sortKeys(&order, keys);
+    CPPUNIT_ASSERT_EQUAL(numKeys, order.size());
+    for (size_t i = 0; i < numKeys; ++i) {
+        CPPUNIT_ASSERT_EQUAL(orderE[i], order[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSortKeys
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeCellKeys().
+void
+pylith::topology::TestSpaceFillingCurve::testComputeCellKeys(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourquad4.mesh");
+    iohandler.read(&mesh);
+
+    PetscDM dmMesh = mesh.getDM();CPPUNIT_ASSERT(dmMesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    const size_t numCells = cellsStratum.size();
+
+    const bool useGlobalBoundingBox = false;
+    std::vector<unsigned long long> keysMorton;
+    SpaceFillingCurve::computeCellKeys(&keysMorton, dmMesh, cStart, cEnd, SpaceFillingCurve::MORTON, useGlobalBoundingBox);
+    CPPUNIT_ASSERT_EQUAL(numCells, keysMorton.size());
+
+    std::vector<unsigned long long> keysHilbert;
+    SpaceFillingCurve::computeCellKeys(&keysHilbert, dmMesh, cStart, cEnd, SpaceFillingCurve::HILBERT, useGlobalBoundingBox);
+    CPPUNIT_ASSERT_EQUAL(numCells, keysHilbert.size());
+
+    // Cells have distinct centroids, so keys must be distinct.
+    for (size_t i = 0; i < numCells; ++i) {
+        for (size_t j = i+1; j < numCells; ++j) {
+            CPPUNIT_ASSERT(keysMorton[i] != keysMorton[j]);
+            CPPUNIT_ASSERT(keysHilbert[i] != keysHilbert[j]);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testComputeCellKeys
+
+
+// End of file
@@ -0,0 +1,70 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestSpaceFillingCurve.hh
+ *
+ * @brief C++ TestSpaceFillingCurve object.
+ *
+ * C++ unit testing for SpaceFillingCurve.
+ */
+
+#if !defined(pylith_topology_testspacefillingcurve_hh)
+#define pylith_topology_testspacefillingcurve_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestSpaceFillingCurve;
+    } // topology
+} // pylith
+
+/// C++ unit testing for SpaceFillingCurve.
+class pylith::topology::TestSpaceFillingCurve : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestSpaceFillingCurve);
+
+    CPPUNIT_TEST(testMortonKey);
+    CPPUNIT_TEST(testHilbertKey);
+    CPPUNIT_TEST(testSortKeys);
+    CPPUNIT_TEST(testComputeCellKeys);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Test mortonKey().
+    void testMortonKey(void);
+
+    /// Test hilbertKey().
+    void testHilbertKey(void);
+
+    /// Test sortKeys().
+    void testSortKeys(void);
+
+    /// Test computeCellKeys().
+    void testComputeCellKeys(void);
+
+}; // class TestSpaceFillingCurve
+
+#endif // pylith_topology_testspacefillingcurve_hh
+
+// End of file
@@ -169,6 +169,55 @@ pylith::utils::TestEventLogger::testEventLogging(void) {
 } // testEventLogging
 
 
+// ----------------------------------------------------------------------
+// Test getEvents() and getEventPerfInfo().
+void
+pylith::utils::TestEventLogger::testEventPerfInfo(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!EventLogger::isLoggingActive()) {
+        PetscErrorCode err = PetscLogDefaultBegin();CPPUNIT_ASSERT(!err);
+    } // if
+    CPPUNIT_ASSERT(EventLogger::isLoggingActive());
+
+    EventLogger logger;
+    logger.setClassName("my class");
+    logger.initialize();
+
+    const int id = logger.registerEvent("event perf");
+    const std::map<std::string,int>& events = logger.getEvents();
+    CPPUNIT_ASSERT_EQUAL(size_t(1), events.size());
+    CPPUNIT_ASSERT_EQUAL(id, events.find("event perf")->second);
+
+    int countStart = 0;
+    double timeStart = 0.0, flopsStart = 0.0;
+    EventLogger::getEventPerfInfo(&countStart, &timeStart, &flopsStart, id);
+
+    // Log events in the main stage and in a registered stage.
+    const int numCalls = 3;
+    const double numFlops = 10.0;
+    const int stageId = logger.registerStage("stage perf");
+    for (int i = 0; i < numCalls; ++i) {
+        if (i == numCalls-1) {
+            logger.stagePush(stageId);
+        } // if
+        logger.eventBegin(id);
+        PetscErrorCode err = PetscLogFlops(numFlops);CPPUNIT_ASSERT(!err);
+        logger.eventEnd(id);
+    } // for
+    logger.stagePop();
+
+    int count = 0;
+    double time = 0.0, flops = 0.0;
+    EventLogger::getEventPerfInfo(&count, &time, &flops, id);
+    CPPUNIT_ASSERT_EQUAL(countStart+numCalls, count);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(flopsStart+numCalls*numFlops, flops, 1.0e-6);
+    CPPUNIT_ASSERT(time >= timeStart);
+
+    PYLITH_METHOD_END;
+} // testEventPerfInfo
+
+
 // ----------------------------------------------------------------------
 // Test registerStage().
 void
@@ -48,6 +48,7 @@ class pylith::utils::TestEventLogger : public CppUnit::TestFixture { // class Te
     CPPUNIT_TEST(testRegisterEvent);
     CPPUNIT_TEST(testGetEventId);
     CPPUNIT_TEST(testEventLogging);
+    CPPUNIT_TEST(testEventPerfInfo);
     CPPUNIT_TEST(testRegisterStage);
     CPPUNIT_TEST(testGetStageId);
     CPPUNIT_TEST(testStageLogging);
@@ -75,6 +76,9 @@ public:
     /// Test eventBegin() and eventEnd().
     void testEventLogging(void);
 
+    /// Test getEvents() and getEventPerfInfo().
+    void testEventPerfInfo(void);
+
     /// Test registerStage().
     void testRegisterStage(void);
 
@@ -412,6 +412,29 @@ pylith::PlanePWave2D::QuadQ1Distorted(void) {
 } // QuadQ1Distorted
 
 
+// ------------------------------------------------------------------------------------------------
+pylith::TestLinearElasticity_Data*
+pylith::PlanePWave2D::QuadQ1Graded(void) {
+    TestLinearElasticity_Data* data = pylith::_PlanePWave2D::createData();assert(data);
+
+    // Cells in center of mesh are half the size of the other cells, so they are in the fast rate
+    // class with local time stepping. The time step is less than the stable time step of the
+    // smaller cells, h/vp.
+    data->meshFilename = "data/quad_graded.mesh";
+    data->tolerance = 1.0e-4;
+    data->dt = 0.008;
+
+    data->numSolnSubfields = 2;
+    static const pylith::topology::Field::Discretization _solnDiscretizations[2] = {
+        pylith::topology::Field::Discretization(1, 1), // disp
+        pylith::topology::Field::Discretization(1, 1), // vel
+    };
+    data->solnDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_solnDiscretizations);
+
+    return data;
+} // QuadQ1Graded
+
+
 // ------------------------------------------------------------------------------------------------
 pylith::TestLinearElasticity_Data*
 pylith::PlanePWave2D::QuadQ2(void) {
@@ -40,6 +40,8 @@ public:
 
     static TestLinearElasticity_Data* QuadQ1Distorted(void);
 
+    static TestLinearElasticity_Data* QuadQ1Graded(void);
+
     static TestLinearElasticity_Data* QuadQ2(void);
 
     static TestLinearElasticity_Data* QuadQ3(void);
@@ -109,6 +109,36 @@ TEST_CASE("UniformStrain2D::QuadQ3::testJacobianFiniteDiff", "[UniformStrain2D][
     pylith::TestLinearElasticity(pylith::UniformStrain2D::QuadQ3()).testJacobianFiniteDiff();
 }
 
+// ------------------------------------------------------------------------------------------------
+#include "UniformStrainMaxwell2D.hh"
+// TriP2
+TEST_CASE("UniformStrainMaxwell2D::TriP2::testDiscretization", "[UniformStrainMaxwell2D][TriP2][discretization]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::TriP2()).testDiscretization();
+}
+TEST_CASE("UniformStrainMaxwell2D::TriP2::testResidual", "[UniformStrainMaxwell2D][TriP2][residual]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::TriP2()).testResidual();
+}
+TEST_CASE("UniformStrainMaxwell2D::TriP2::testJacobianTaylorSeries", "[UniformStrainMaxwell2D][TriP2][Jacobian Taylor series]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::TriP2()).testJacobianTaylorSeries();
+}
+TEST_CASE("UniformStrainMaxwell2D::TriP2::testJacobianFiniteDiff", "[UniformStrainMaxwell2D][TriP2][Jacobian finite difference]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::TriP2()).testJacobianFiniteDiff();
+}
+
+// QuadQ2
+TEST_CASE("UniformStrainMaxwell2D::QuadQ2::testDiscretization", "[UniformStrainMaxwell2D][QuadQ2][discretization]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::QuadQ2()).testDiscretization();
+}
+TEST_CASE("UniformStrainMaxwell2D::QuadQ2::testResidual", "[UniformStrainMaxwell2D][QuadQ2][residual]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::QuadQ2()).testResidual();
+}
+TEST_CASE("UniformStrainMaxwell2D::QuadQ2::testJacobianTaylorSeries", "[UniformStrainMaxwell2D][QuadQ2][Jacobian Taylor series]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::QuadQ2()).testJacobianTaylorSeries();
+}
+TEST_CASE("UniformStrainMaxwell2D::QuadQ2::testJacobianFiniteDiff", "[UniformStrainMaxwell2D][QuadQ2][Jacobian finite difference]") {
+    pylith::TestLinearElasticity(pylith::UniformStrainMaxwell2D::QuadQ2()).testJacobianFiniteDiff();
+}
+
 // ------------------------------------------------------------------------------------------------
 #include "Gravity2D.hh"
 // TriP2
@@ -386,6 +416,17 @@ TEST_CASE("PlanePWave2D::QuadQ1::testResidual", "[PlanePWave2D][QuadQ1][residual
     pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ1()).testResidual();
 }
 
+// QuadQ1Graded
+TEST_CASE("PlanePWave2D::QuadQ1Graded::testDiscretization", "[PlanePWave2D][QuadQ1Graded][discretization]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ1Graded()).testDiscretization();
+}
+TEST_CASE("PlanePWave2D::QuadQ1Graded::testResidual", "[PlanePWave2D][QuadQ1Graded][residual]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ1Graded()).testResidual();
+}
+TEST_CASE("PlanePWave2D::QuadQ1Graded::testLocalTimeStepping", "[PlanePWave2D][QuadQ1Graded][local time stepping]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ1Graded()).testLocalTimeStepping();
+}
+
 // QuadQ2
 TEST_CASE("PlanePWave2D::QuadQ2::testDiscretization", "[PlanePWave2D][QuadQ2][discretization]") {
     pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ2()).testDiscretization();
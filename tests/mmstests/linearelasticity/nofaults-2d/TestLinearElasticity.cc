@@ -90,7 +90,11 @@ pylith::TestLinearElasticity::_initialize(void) {
     pylith::topology::MeshOps::nondimensionalize(_mesh, _data->normalizer);
 
     // Set up material
-    _data->material.setBulkRheology(&_data->rheology);
+    if (_data->otherRheology) {
+        _data->material.setBulkRheology(_data->otherRheology);
+    } else {
+        _data->material.setBulkRheology(&_data->rheology);
+    } // if/else
     _data->material.setAuxiliaryFieldDB(&_data->auxDB);
 
     for (size_t i = 0; i < _data->numAuxSubfields; ++i) {
@@ -171,6 +175,7 @@ pylith::TestLinearElasticity_Data::TestLinearElasticity_Data(void) :
     dt(0.05),
     formulation(pylith::problems::Physics::QUASISTATIC),
 
+    otherRheology(NULL),
     gravityField(NULL),
 
     numSolnSubfields(0),
@@ -191,6 +196,7 @@ pylith::TestLinearElasticity_Data::~TestLinearElasticity_Data(void) {
         delete bcs[i];bcs[i] = NULL;
     } // for
     delete gravityField;gravityField = NULL;
+    delete otherRheology;otherRheology = NULL;
 
 } // destructor
 
@@ -29,6 +29,7 @@
 
 #include "pylith/materials/Elasticity.hh" // USES Elasticity
 #include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/materials/RheologyElasticity.hh" // USES RheologyElasticity
 #include "pylith/bc/DirichletUserFn.hh" // USES DirichletUserFn
 
 #include "spatialdata/spatialdb/UserFunctionDB.hh" // USES UserFunctionDB
@@ -107,6 +108,7 @@ public:
 
     pylith::materials::Elasticity material; ///< Materials.
     pylith::materials::IsotropicLinearElasticity rheology; ///< Bulk rheology for materials.
+    pylith::materials::RheologyElasticity* otherRheology; ///< Bulk rheology used instead of `rheology` (optional).
     spatialdata::spatialdb::GravityField* gravityField; ///< Gravity field.
     std::vector<pylith::bc::BoundaryCondition*> bcs; ///< Dirichlet boundary condition.
 
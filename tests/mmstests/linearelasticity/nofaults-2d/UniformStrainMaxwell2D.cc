@@ -0,0 +1,310 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "UniformStrainMaxwell2D.hh" // Implementation of cases
+
+#include "pylith/materials/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/topology/Field.hh" // USES pylith::topology::Field::Discretization
+#include "pylith/utils/journals.hh" // USES pythia::journal::debug_t
+
+// ------------------------------------------------------------------------------------------------
+// Uniform strain with a linear Maxwell viscoelastic rheology. The state variables (total and
+// viscous strain) are uniform and use the point finite-element space, so they are stored at the
+// quadrature points of the solution. Uniform material properties and state variables give a
+// uniform stress, so the residual is zero for any value of the viscous strain.
+namespace pylith {
+    class _UniformStrainMaxwell2D;
+}
+class pylith::_UniformStrainMaxwell2D {
+private:
+
+    // Density
+    static double density(const double x,
+                          const double y) {
+        return 2500.0;
+    } // density
+
+    static const char* density_units(void) {
+        return "kg/m**3";
+    } // density_units
+
+    // Vs
+    static double vs(const double x,
+                     const double y) {
+        return 3000.0;
+    } // vs
+
+    static const char* vs_units(void) {
+        return "m/s";
+    } // vs_units
+
+    // Vp
+    static double vp(const double x,
+                     const double y) {
+        return sqrt(3.0)*vs(x,y);
+    } // vp
+
+    static const char* vp_units(void) {
+        return "m/s";
+    } // vp_units
+
+    // Viscosity
+    static double viscosity(const double x,
+                            const double y) {
+        return 7.5e+18;
+    } // viscosity
+
+    static const char* viscosity_units(void) {
+        return "Pa*s";
+    } // viscosity_units
+
+    // Solution subfields.
+
+    static double strain_xx(void) {
+        return 0.1;
+    } // strain_xx
+
+    static double strain_yy(void) {
+        return 0.25;
+    } // strain_yy
+
+    static double strain_xy(void) {
+        return 0.3;
+    } // strain_xy
+
+    // Total strain
+    static double total_strain_xx(const double x,
+                                  const double y) {
+        return strain_xx();
+    } // total_strain_xx
+
+    static double total_strain_yy(const double x,
+                                  const double y) {
+        return strain_yy();
+    } // total_strain_yy
+
+    static double total_strain_zz(const double x,
+                                  const double y) {
+        return 0.0;
+    } // total_strain_zz
+
+    static double total_strain_xy(const double x,
+                                  const double y) {
+        return strain_xy();
+    } // total_strain_xy
+
+    // Viscous strain
+    static double viscous_strain_xx(const double x,
+                                    const double y) {
+        return -0.02;
+    } // viscous_strain_xx
+
+    static double viscous_strain_yy(const double x,
+                                    const double y) {
+        return 0.03;
+    } // viscous_strain_yy
+
+    static double viscous_strain_zz(const double x,
+                                    const double y) {
+        return -0.01;
+    } // viscous_strain_zz
+
+    static double viscous_strain_xy(const double x,
+                                    const double y) {
+        return 0.04;
+    } // viscous_strain_xy
+
+    static const char* strain_units(void) {
+        return "None";
+    } // strain_units
+
+    // Displacement
+    static double disp_x(const double x,
+                         const double y) {
+        return strain_xx()*x + strain_xy()*y;
+    } // disp_x
+
+    static double disp_y(const double x,
+                         const double y) {
+        return strain_xy()*x + strain_yy()*y;
+    } // disp_y
+
+    static const char* disp_units(void) {
+        return "m";
+    } // disp_units
+
+    static
+    PetscErrorCode solnkernel_disp(PetscInt spaceDim,
+                                   PetscReal t,
+                                   const PetscReal x[],
+                                   PetscInt numComponents,
+                                   PetscScalar* s,
+                                   void* context) {
+        assert(2 == spaceDim);
+        assert(x);
+        assert(2 == numComponents);
+        assert(s);
+
+        s[0] = disp_x(x[0], x[1]);
+        s[1] = disp_y(x[0], x[1]);
+
+        return PETSC_SUCCESS;
+    } // solnkernel_disp
+
+public:
+
+    static
+    TestLinearElasticity_Data* createData(void) {
+        TestLinearElasticity_Data* data = new TestLinearElasticity_Data();assert(data);
+
+        data->journalName = "UniformStrainMaxwell2D";
+
+        data->isJacobianLinear = true;
+
+        data->meshFilename = ":UNKNOWN:"; // Set in child class.
+        data->boundaryLabel = "boundary";
+
+        data->normalizer.setLengthScale(1.0e+03);
+        data->normalizer.setTimeScale(1.0e+08);
+        data->normalizer.setPressureScale(2.25e+10);
+        data->normalizer.computeDensityScale();
+
+        // solnDiscretizations and auxDiscretizations set in derived class.
+
+        // Material information
+        data->numAuxSubfields = 6;
+        static const char* _auxSubfields[6] = {
+            "density",
+            "shear_modulus",
+            "bulk_modulus",
+            "maxwell_time",
+            "viscous_strain",
+            "total_strain",
+        };
+        data->auxSubfields = _auxSubfields;
+
+        data->auxDB.addValue("density", density, density_units());
+        data->auxDB.addValue("vp", vp, vp_units());
+        data->auxDB.addValue("vs", vs, vs_units());
+        data->auxDB.addValue("viscosity", viscosity, viscosity_units());
+        data->auxDB.addValue("total_strain_xx", total_strain_xx, strain_units());
+        data->auxDB.addValue("total_strain_yy", total_strain_yy, strain_units());
+        data->auxDB.addValue("total_strain_zz", total_strain_zz, strain_units());
+        data->auxDB.addValue("total_strain_xy", total_strain_xy, strain_units());
+        data->auxDB.addValue("viscous_strain_xx", viscous_strain_xx, strain_units());
+        data->auxDB.addValue("viscous_strain_yy", viscous_strain_yy, strain_units());
+        data->auxDB.addValue("viscous_strain_zz", viscous_strain_zz, strain_units());
+        data->auxDB.addValue("viscous_strain_xy", viscous_strain_xy, strain_units());
+        data->auxDB.setCoordSys(data->cs);
+
+        data->material.setFormulation(pylith::problems::Physics::QUASISTATIC);
+        data->material.useBodyForce(false);
+
+        pylith::materials::IsotropicLinearMaxwell* rheology = new pylith::materials::IsotropicLinearMaxwell();assert(rheology);
+        rheology->useReferenceState(false);
+        data->otherRheology = rheology;
+
+        data->material.setDescription("Isotropic Linear Maxwell Plane Strain");
+        data->material.setLabelValue(24);
+
+        static const PylithInt constrainedDOF[2] = {0, 1};
+        static const PylithInt numConstrained = 2;
+        data->bcs.resize(1);
+        pylith::bc::DirichletUserFn* bc = new pylith::bc::DirichletUserFn();assert(bc);
+        bc->setSubfieldName("displacement");
+        bc->setLabelName("boundary");
+        bc->setLabelValue(1);
+        bc->setConstrainedDOF(constrainedDOF, numConstrained);
+        bc->setUserFn(solnkernel_disp);
+        data->bcs[0] = bc;
+
+        static const pylith::testing::MMSTest::solution_fn _exactSolnFns[1] = {
+            solnkernel_disp,
+        };
+        data->exactSolnFns = const_cast<pylith::testing::MMSTest::solution_fn*>(_exactSolnFns);
+        data->exactSolnDotFns = nullptr;
+
+        return data;
+    } // createData
+
+}; // _UniformStrainMaxwell2D
+
+// ------------------------------------------------------------------------------------------------
+pylith::TestLinearElasticity_Data*
+pylith::UniformStrainMaxwell2D::TriP2(void) {
+    TestLinearElasticity_Data* data = pylith::_UniformStrainMaxwell2D::createData();assert(data);
+
+    data->meshFilename = "data/tri.mesh";
+
+    // The quadrature order of the point space for the state variables must match the solution.
+    static const pylith::topology::Field::Discretization _auxDiscretizations[6] = {
+        pylith::topology::Field::Discretization(0, 2), // density
+        pylith::topology::Field::Discretization(0, 2), // shear_modulus
+        pylith::topology::Field::Discretization(0, 2), // bulk_modulus
+        pylith::topology::Field::Discretization(0, 2), // maxwell_time
+        pylith::topology::Field::Discretization(0, 2, -1, -1, false, pylith::topology::Field::DEFAULT_BASIS,
+                                                pylith::topology::Field::POINT_SPACE, false), // viscous_strain
+        pylith::topology::Field::Discretization(0, 2, -1, -1, false, pylith::topology::Field::DEFAULT_BASIS,
+                                                pylith::topology::Field::POINT_SPACE, false), // total_strain
+    };
+    data->auxDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_auxDiscretizations);
+
+    data->numSolnSubfields = 1;
+    static const pylith::topology::Field::Discretization _solnDiscretizations[1] = {
+        pylith::topology::Field::Discretization(2, 2), // disp
+    };
+    data->solnDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_solnDiscretizations);
+
+    return data;
+} // TriP2
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::TestLinearElasticity_Data*
+pylith::UniformStrainMaxwell2D::QuadQ2(void) {
+    TestLinearElasticity_Data* data = pylith::_UniformStrainMaxwell2D::createData();assert(data);
+
+    data->meshFilename = "data/quad.msh";
+    data->useAsciiMesh = false;
+
+    static const pylith::topology::Field::Discretization _auxDiscretizations[6] = {
+        pylith::topology::Field::Discretization(0, 2), // density
+        pylith::topology::Field::Discretization(0, 2), // shear_modulus
+        pylith::topology::Field::Discretization(0, 2), // bulk_modulus
+        pylith::topology::Field::Discretization(0, 2), // maxwell_time
+        pylith::topology::Field::Discretization(0, 2, -1, -1, false, pylith::topology::Field::DEFAULT_BASIS,
+                                                pylith::topology::Field::POINT_SPACE, false), // viscous_strain
+        pylith::topology::Field::Discretization(0, 2, -1, -1, false, pylith::topology::Field::DEFAULT_BASIS,
+                                                pylith::topology::Field::POINT_SPACE, false), // total_strain
+    };
+    data->auxDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_auxDiscretizations);
+
+    data->numSolnSubfields = 1;
+    static const pylith::topology::Field::Discretization _solnDiscretizations[1] = {
+        pylith::topology::Field::Discretization(2, 2), // disp
+    };
+    data->solnDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_solnDiscretizations);
+
+    return data;
+} // QuadQ2
+
+
+// End of file
@@ -0,0 +1,629 @@
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+
+#include <portinfo>
+
+#include "DarcyFlow2D.hh" // Implementation of cases
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/topology/Field.hh" // USES pylith::topology::Field::Discretization
+#include "pylith/utils/journals.hh" // USES pythia::journal::debug_t
+
+#include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
+
+// ------------------------------------------------------------------------------------------------
+/* Pressure is quadratic in space and linear in time,
+ *
+ *   p = p0 + g.x + 0.5*x.H.x + r*t,
+ *
+ * so the Darcy flux varies linearly in space and its divergence, -(k/mu_f):H, balances the fluid
+ * source and the storage term with r = M*(gamma + (k/mu_f):H). The displacement is the gradient of
+ * a quartic potential whose Laplacian (the trace strain) balances the pressure gradient, body force,
+ * and gravity in the equilibrium equation. The trace strain does not depend on time.
+ */
+namespace pylith {
+    class _DarcyFlow2D;
+}
+class pylith::_DarcyFlow2D {
+private:
+
+    static const double LENGTHSCALE;
+    static const double TIMESCALE;
+    static const double PRESSURESCALE;
+    static const double GACC;
+    static const double PRESSURE0;
+    static const double PRESSUREGRADIENT[2];
+    static const double PRESSUREHESSIAN[4];
+
+    static bool _useBodyForce;
+    static bool _useGravity;
+    static bool _useSourceDensity;
+    static bool _useTensorPermeability;
+
+    // Solid density
+    static double solid_density(const double x,
+                                const double y) {
+        return 2500.0;
+    } // solid_density
+
+    // Fluid density
+    static double fluid_density(const double x,
+                                const double y) {
+        return 1000.0;
+    } // fluid_density
+
+    static const char* density_units(void) {
+        return "kg/m**3";
+    } // density_units
+
+    // Fluid viscosity
+    static double fluid_viscosity(const double x,
+                                  const double y) {
+        return 1.0e-3;
+    } // fluid_viscosity
+
+    static const char* viscosity_units(void) {
+        return "Pa*s";
+    } // viscosity_units
+
+    // Porosity
+    static double porosity(const double x,
+                           const double y) {
+        return 0.1;
+    } // porosity
+
+    // Biot coefficient
+    static double biot_coefficient(const double x,
+                                   const double y) {
+        return 0.8;
+    } // biot_coefficient
+
+    static const char* none_units(void) {
+        return "none";
+    } // none_units
+
+    // Shear modulus
+    static double shear_modulus(const double x,
+                                const double y) {
+        return 3.0e+10;
+    } // shear_modulus
+
+    // Drained bulk modulus
+    static double drained_bulk_modulus(const double x,
+                                       const double y) {
+        return 4.0e+10;
+    } // drained_bulk_modulus
+
+    // Fluid bulk modulus
+    static double fluid_bulk_modulus(const double x,
+                                     const double y) {
+        return 2.0e+9;
+    } // fluid_bulk_modulus
+
+    // Solid bulk modulus
+    static double solid_bulk_modulus(const double x,
+                                     const double y) {
+        return 5.0e+10;
+    } // solid_bulk_modulus
+
+    static const char* modulus_units(void) {
+        return "Pa";
+    } // modulus_units
+
+    // Isotropic permeability
+    static double isotropic_permeability(const double x,
+                                         const double y) {
+        return 1.0e-13;
+    } // isotropic_permeability
+
+    // Tensor permeability
+    static double permeability_xx(const double x,
+                                  const double y) {
+        return 2.0e-13;
+    } // permeability_xx
+
+    static double permeability_yy(const double x,
+                                  const double y) {
+        return 1.0e-13;
+    } // permeability_yy
+
+    static double permeability_zz(const double x,
+                                  const double y) {
+        return 1.5e-13;
+    } // permeability_zz
+
+    static double permeability_xy(const double x,
+                                  const double y) {
+        return 0.4e-13;
+    } // permeability_xy
+
+    static const char* permeability_units(void) {
+        return "m**2";
+    } // permeability_units
+
+    // Body force
+    static double body_force_x(const double x,
+                               const double y) {
+        return 5.0e+3;
+    } // body_force_x
+
+    static double body_force_y(const double x,
+                               const double y) {
+        return -2.0e+3;
+    } // body_force_y
+
+    static const char* body_force_units(void) {
+        return "kg/(m**2*s**2)";
+    } // body_force_units
+
+    // Source density
+    static double source_density(const double x,
+                                 const double y) {
+        return 1.0e-6;
+    } // source_density
+
+    static const char* source_density_units(void) {
+        return "m/s";
+    } // source_density_units
+
+    // Nondimensional parameters
+
+    static double biotCoefficientN(void) {
+        return biot_coefficient(0.0, 0.0);
+    } // biotCoefficientN
+
+    static double pModulusN(void) {
+        const double mu = shear_modulus(0.0, 0.0);
+        const double lambda = drained_bulk_modulus(0.0, 0.0) - 2.0/3.0 * mu;
+        return (lambda + 2.0*mu) / PRESSURESCALE;
+    } // pModulusN
+
+    static double biotModulusN(void) {
+        const double phi = porosity(0.0, 0.0);
+        const double alpha = biot_coefficient(0.0, 0.0);
+        const double Kf = fluid_bulk_modulus(0.0, 0.0);
+        const double Ks = solid_bulk_modulus(0.0, 0.0);
+        return 1.0 / (phi / Kf + (alpha - phi) / Ks) / PRESSURESCALE;
+    } // biotModulusN
+
+    static double sourceDensityN(void) {
+        const double sourceDensityScale = LENGTHSCALE / TIMESCALE;
+        return _useSourceDensity ? source_density(0.0, 0.0) / sourceDensityScale : 0.0;
+    } // sourceDensityN
+
+    /** Body force and weight of the solid and fluid.
+     *
+     * @param[out] solidForce Body force plus weight of bulk material.
+     * @param[out] fluidForce Body force plus weight of fluid.
+     */
+    static void bodyForcesN(double solidForce[2],
+                            double fluidForce[2]) {
+        const double forceScale = PRESSURESCALE / LENGTHSCALE;
+        const double densityScale = PRESSURESCALE * TIMESCALE * TIMESCALE / (LENGTHSCALE * LENGTHSCALE);
+        const double accelerationScale = LENGTHSCALE / (TIMESCALE * TIMESCALE);
+
+        const double phi = porosity(0.0, 0.0);
+        const double bulkDensityN = ((1.0 - phi) * solid_density(0.0, 0.0) + phi * fluid_density(0.0, 0.0)) / densityScale;
+        const double fluidDensityN = fluid_density(0.0, 0.0) / densityScale;
+
+        const double bodyForceN[2] = {
+            _useBodyForce ? body_force_x(0.0, 0.0) / forceScale : 0.0,
+            _useBodyForce ? body_force_y(0.0, 0.0) / forceScale : 0.0,
+        };
+        const double gravityN[2] = {
+            0.0,
+            _useGravity ? -GACC / accelerationScale : 0.0,
+        };
+        for (int i = 0; i < 2; ++i) {
+            solidForce[i] = bodyForceN[i] + bulkDensityN * gravityN[i];
+            fluidForce[i] = bodyForceN[i] + fluidDensityN * gravityN[i];
+        } // for
+    } // bodyForcesN
+
+    static void mobilityN(double mobility[4]) {
+        const double permeabilityScale = LENGTHSCALE * LENGTHSCALE;
+        const double viscosityScale = PRESSURESCALE * TIMESCALE;
+        const double viscosityN = fluid_viscosity(0.0, 0.0) / viscosityScale;
+
+        if (_useTensorPermeability) {
+            mobility[0] = permeability_xx(0.0, 0.0) / permeabilityScale / viscosityN;
+            mobility[1] = permeability_xy(0.0, 0.0) / permeabilityScale / viscosityN;
+            mobility[2] = permeability_xy(0.0, 0.0) / permeabilityScale / viscosityN;
+            mobility[3] = permeability_yy(0.0, 0.0) / permeabilityScale / viscosityN;
+        } else {
+            const double permeabilityN = isotropic_permeability(0.0, 0.0) / permeabilityScale;
+            mobility[0] = permeabilityN / viscosityN;
+            mobility[1] = 0.0;
+            mobility[2] = 0.0;
+            mobility[3] = permeabilityN / viscosityN;
+        } // if/else
+    } // mobilityN
+
+    static void pressureGradientN(double gradient[2]) {
+        for (int i = 0; i < 2; ++i) {
+            gradient[i] = PRESSUREGRADIENT[i] * LENGTHSCALE / PRESSURESCALE;
+        } // for
+    } // pressureGradientN
+
+    static void pressureHessianN(double hessian[4]) {
+        for (int i = 0; i < 4; ++i) {
+            hessian[i] = PRESSUREHESSIAN[i] * LENGTHSCALE * LENGTHSCALE / PRESSURESCALE;
+        } // for
+    } // pressureHessianN
+
+    static double pressureRateN(void) {
+        double mobility[4];
+        mobilityN(mobility);
+        double hessian[4];
+        pressureHessianN(hessian);
+
+        double divFlux = 0.0;
+        for (int i = 0; i < 4; ++i) {
+            divFlux += mobility[i] * hessian[i];
+        } // for
+        return biotModulusN() * (sourceDensityN() + divFlux);
+    } // pressureRateN
+
+    /** Coefficients of trace strain, e_v = 0.5*x.A.x + c.x.
+     *
+     * @param[out] A Quadratic coefficients.
+     * @param[out] c Linear coefficients.
+     */
+    static void strainCoefsN(double A[4],
+                             double c[2]) {
+        const double alpha = biotCoefficientN();
+        const double pModulus = pModulusN();
+
+        double hessian[4];
+        pressureHessianN(hessian);
+        double gradient[2];
+        pressureGradientN(gradient);
+        double solidForce[2];
+        double fluidForce[2];
+        bodyForcesN(solidForce, fluidForce);
+
+        for (int i = 0; i < 4; ++i) {
+            A[i] = alpha * hessian[i] / pModulus;
+        } // for
+        for (int i = 0; i < 2; ++i) {
+            c[i] = (alpha * gradient[i] - solidForce[i]) / pModulus;
+        } // for
+    } // strainCoefsN
+
+    // Solution subfields (nondimensional)
+
+    // Displacement
+    static double disp_x(const double x,
+                         const double y) {
+        double A[4];
+        double c[2];
+        strainCoefsN(A, c);
+        return 0.5*(A[0]*x*x*x/3.0 + 0.5*A[1]*x*x*y + A[2]*y*y*y/6.0) + 0.5*c[0]*x*x;
+    } // disp_x
+
+    static double disp_y(const double x,
+                         const double y) {
+        double A[4];
+        double c[2];
+        strainCoefsN(A, c);
+        return 0.5*(A[3]*y*y*y/3.0 + 0.5*A[2]*y*y*x + A[1]*x*x*x/6.0) + 0.5*c[1]*y*y;
+    } // disp_y
+
+    // Pressure
+    static double pressure(const double x,
+                           const double y,
+                           const double t) {
+        double gradient[2];
+        pressureGradientN(gradient);
+        double H[4];
+        pressureHessianN(H);
+        return PRESSURE0 / PRESSURESCALE + gradient[0]*x + gradient[1]*y
+               + 0.5*(H[0]*x*x + 2.0*H[1]*x*y + H[3]*y*y) + pressureRateN()*t;
+    } // pressure
+
+    static double pressure_t(const double x,
+                             const double y) {
+        return pressureRateN();
+    } // pressure_t
+
+    // Trace strain
+    static double trace_strain(const double x,
+                               const double y) {
+        double A[4];
+        double c[2];
+        strainCoefsN(A, c);
+        return 0.5*(A[0]*x*x + 2.0*A[1]*x*y + A[3]*y*y) + c[0]*x + c[1]*y;
+    } // trace_strain
+
+    static PetscErrorCode solnkernel_disp(PetscInt spaceDim,
+                                          PetscReal t,
+                                          const PetscReal x[],
+                                          PetscInt numComponents,
+                                          PetscScalar* s,
+                                          void* context) {
+        assert(2 == spaceDim);
+        assert(2 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = disp_x(x[0], x[1]);
+        s[1] = disp_y(x[0], x[1]);
+
+        return 0;
+    } // solnkernel_disp
+
+    static PetscErrorCode solnkernel_disp_t(PetscInt spaceDim,
+                                            PetscReal t,
+                                            const PetscReal x[],
+                                            PetscInt numComponents,
+                                            PetscScalar* s,
+                                            void* context) {
+        assert(2 == spaceDim);
+        assert(2 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = 0.0;
+        s[1] = 0.0;
+
+        return 0;
+    } // solnkernel_disp_t
+
+    static PetscErrorCode solnkernel_pressure(PetscInt spaceDim,
+                                              PetscReal t,
+                                              const PetscReal x[],
+                                              PetscInt numComponents,
+                                              PetscScalar* s,
+                                              void* context) {
+        assert(2 == spaceDim);
+        assert(1 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = pressure(x[0], x[1], t);
+
+        return 0;
+    } // solnkernel_pressure
+
+    static PetscErrorCode solnkernel_pressure_t(PetscInt spaceDim,
+                                                PetscReal t,
+                                                const PetscReal x[],
+                                                PetscInt numComponents,
+                                                PetscScalar* s,
+                                                void* context) {
+        assert(2 == spaceDim);
+        assert(1 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = pressure_t(x[0], x[1]);
+
+        return 0;
+    } // solnkernel_pressure_t
+
+    static PetscErrorCode solnkernel_trace_strain(PetscInt spaceDim,
+                                                  PetscReal t,
+                                                  const PetscReal x[],
+                                                  PetscInt numComponents,
+                                                  PetscScalar* s,
+                                                  void* context) {
+        assert(2 == spaceDim);
+        assert(1 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = trace_strain(x[0], x[1]);
+
+        return 0;
+    } // solnkernel_trace_strain
+
+    static PetscErrorCode solnkernel_trace_strain_t(PetscInt spaceDim,
+                                                    PetscReal t,
+                                                    const PetscReal x[],
+                                                    PetscInt numComponents,
+                                                    PetscScalar* s,
+                                                    void* context) {
+        assert(2 == spaceDim);
+        assert(1 == numComponents);
+        assert(s);
+        assert(x);
+
+        s[0] = 0.0;
+
+        return 0;
+    } // solnkernel_trace_strain_t
+
+public:
+
+    static
+    TestIsotropicLinearPoroelasticity_Data* createData(const bool useBodyForce,
+                                                       const bool useGravity,
+                                                       const bool useSourceDensity,
+                                                       const bool useTensorPermeability) {
+        TestIsotropicLinearPoroelasticity_Data* data = new TestIsotropicLinearPoroelasticity_Data();assert(data);
+
+        // The solution kernels do not take a context, so the terms included in the current case are
+        // stored in static members.
+        _useBodyForce = useBodyForce;
+        _useGravity = useGravity;
+        _useSourceDensity = useSourceDensity;
+        _useTensorPermeability = useTensorPermeability;
+
+        data->journalName = "DarcyFlow2D";
+        data->isJacobianLinear = true;
+
+        data->meshFilename = ":UNKNOWN:"; // Set in child class.
+        data->boundaryLabel = "boundary";
+
+        data->normalizer.setLengthScale(LENGTHSCALE);
+        data->normalizer.setTimeScale(TIMESCALE);
+        data->normalizer.setPressureScale(PRESSURESCALE);
+        data->normalizer.computeDensityScale();
+
+        if (useGravity) {
+            delete data->gravityField;data->gravityField = new spatialdata::spatialdb::GravityField();
+            data->gravityField->setGravityDir(0.0, -1.0, 0.0);
+            data->gravityField->setGravityAcc(GACC);
+        } // if
+
+        // solnDiscretizations set in derived class.
+
+        // Material information. Discretizations are set by name, so we include all possible subfields.
+        data->numAuxSubfields = 13;
+        static const char* _auxSubfields[13] = {
+            "solid_density",
+            "fluid_density",
+            "fluid_viscosity",
+            "porosity",
+            "body_force",
+            "gravitational_acceleration",
+            "source_density",
+            "shear_modulus",
+            "drained_bulk_modulus",
+            "biot_coefficient",
+            "biot_modulus",
+            "isotropic_permeability",
+            "tensor_permeability",
+        };
+        data->auxSubfields = _auxSubfields;
+
+        data->auxDB.addValue("solid_density", solid_density, density_units());
+        data->auxDB.addValue("fluid_density", fluid_density, density_units());
+        data->auxDB.addValue("fluid_viscosity", fluid_viscosity, viscosity_units());
+        data->auxDB.addValue("porosity", porosity, none_units());
+        data->auxDB.addValue("shear_modulus", shear_modulus, modulus_units());
+        data->auxDB.addValue("drained_bulk_modulus", drained_bulk_modulus, modulus_units());
+        data->auxDB.addValue("biot_coefficient", biot_coefficient, none_units());
+        data->auxDB.addValue("fluid_bulk_modulus", fluid_bulk_modulus, modulus_units());
+        data->auxDB.addValue("solid_bulk_modulus", solid_bulk_modulus, modulus_units());
+        data->auxDB.addValue("isotropic_permeability", isotropic_permeability, permeability_units());
+        data->auxDB.addValue("permeability_xx", permeability_xx, permeability_units());
+        data->auxDB.addValue("permeability_yy", permeability_yy, permeability_units());
+        data->auxDB.addValue("permeability_zz", permeability_zz, permeability_units());
+        data->auxDB.addValue("permeability_xy", permeability_xy, permeability_units());
+        data->auxDB.addValue("body_force_x", body_force_x, body_force_units());
+        data->auxDB.addValue("body_force_y", body_force_y, body_force_units());
+        data->auxDB.addValue("source_density", source_density, source_density_units());
+        data->auxDB.setCoordSys(data->cs);
+
+        data->material.setFormulation(pylith::problems::Physics::QUASISTATIC);
+        data->material.useBodyForce(useBodyForce);
+        data->material.useSourceDensity(useSourceDensity);
+        data->rheology.useReferenceState(false);
+        data->rheology.useTensorPermeability(useTensorPermeability);
+
+        data->material.setDescription("Isotropic Linear Poroelasticity Plane Strain");
+        data->material.setLabelValue(24);
+
+        data->bcs.resize(2);
+        { // displacement
+            static const PylithInt constrainedDOF[2] = {0, 1};
+            static const PylithInt numConstrained = 2;
+            pylith::bc::DirichletUserFn* bc = new pylith::bc::DirichletUserFn();assert(bc);
+            bc->setSubfieldName("displacement");
+            bc->setLabelName("boundary");
+            bc->setLabelValue(1);
+            bc->setConstrainedDOF(constrainedDOF, numConstrained);
+            bc->setUserFn(solnkernel_disp);
+            bc->setUserFnDot(solnkernel_disp_t);
+            data->bcs[0] = bc;
+        } // displacement
+        { // pressure
+            static const PylithInt constrainedDOF[1] = {0};
+            static const PylithInt numConstrained = 1;
+            pylith::bc::DirichletUserFn* bc = new pylith::bc::DirichletUserFn();assert(bc);
+            bc->setSubfieldName("pressure");
+            bc->setLabelName("boundary");
+            bc->setLabelValue(1);
+            bc->setConstrainedDOF(constrainedDOF, numConstrained);
+            bc->setUserFn(solnkernel_pressure);
+            bc->setUserFnDot(solnkernel_pressure_t);
+            data->bcs[1] = bc;
+        } // pressure
+
+        static const pylith::testing::MMSTest::solution_fn _exactSolnFns[3] = {
+            solnkernel_disp,
+            solnkernel_pressure,
+            solnkernel_trace_strain,
+        };
+        data->exactSolnFns = const_cast<pylith::testing::MMSTest::solution_fn*>(_exactSolnFns);
+        static const pylith::testing::MMSTest::solution_fn _exactSolnDotFns[3] = {
+            solnkernel_disp_t,
+            solnkernel_pressure_t,
+            solnkernel_trace_strain_t,
+        };
+        data->exactSolnDotFns = const_cast<pylith::testing::MMSTest::solution_fn*>(_exactSolnDotFns);
+
+        return data;
+    } // createData
+
+}; // _DarcyFlow2D
+const double pylith::_DarcyFlow2D::LENGTHSCALE = 1.0e+3;
+const double pylith::_DarcyFlow2D::TIMESCALE = 1.0e+6;
+const double pylith::_DarcyFlow2D::PRESSURESCALE = 1.0e+10;
+const double pylith::_DarcyFlow2D::GACC = 9.80665;
+const double pylith::_DarcyFlow2D::PRESSURE0 = 1.0e+7;
+const double pylith::_DarcyFlow2D::PRESSUREGRADIENT[2] = { 2.0e+4, -1.0e+4 };
+const double pylith::_DarcyFlow2D::PRESSUREHESSIAN[4] = {
+    8.0, 3.0,
+    3.0, -5.0,
+};
+bool pylith::_DarcyFlow2D::_useBodyForce = false;
+bool pylith::_DarcyFlow2D::_useGravity = false;
+bool pylith::_DarcyFlow2D::_useSourceDensity = false;
+bool pylith::_DarcyFlow2D::_useTensorPermeability = false;
+
+// ------------------------------------------------------------------------------------------------
+pylith::TestIsotropicLinearPoroelasticity_Data*
+pylith::DarcyFlow2D::TriP3(const bool useBodyForce,
+                           const bool useGravity,
+                           const bool useSourceDensity,
+                           const bool useTensorPermeability) {
+    TestIsotropicLinearPoroelasticity_Data* data = pylith::_DarcyFlow2D::createData(useBodyForce, useGravity,
+                                                                                    useSourceDensity, useTensorPermeability);
+    assert(data);
+
+    data->meshFilename = "data/tri.mesh";
+
+    data->numSolnSubfields = 3;
+    static const pylith::topology::Field::Discretization _solnDiscretizations[3] = {
+        pylith::topology::Field::Discretization(3, 4), // disp
+        pylith::topology::Field::Discretization(2, 4), // pressure
+        pylith::topology::Field::Discretization(2, 4), // trace_strain
+    };
+    data->solnDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_solnDiscretizations);
+
+    static const pylith::topology::Field::Discretization _auxDiscretizations[13] = {
+        pylith::topology::Field::Discretization(0, 4), // solid_density
+        pylith::topology::Field::Discretization(0, 4), // fluid_density
+        pylith::topology::Field::Discretization(0, 4), // fluid_viscosity
+        pylith::topology::Field::Discretization(0, 4), // porosity
+        pylith::topology::Field::Discretization(0, 4), // body_force
+        pylith::topology::Field::Discretization(0, 4), // gravitational_acceleration
+        pylith::topology::Field::Discretization(0, 4), // source_density
+        pylith::topology::Field::Discretization(0, 4), // shear_modulus
+        pylith::topology::Field::Discretization(0, 4), // drained_bulk_modulus
+        pylith::topology::Field::Discretization(0, 4), // biot_coefficient
+        pylith::topology::Field::Discretization(0, 4), // biot_modulus
+        pylith::topology::Field::Discretization(0, 4), // isotropic_permeability
+        pylith::topology::Field::Discretization(0, 4), // tensor_permeability
+    };
+    data->auxDiscretizations = const_cast<pylith::topology::Field::Discretization*>(_auxDiscretizations);
+
+    return data;
+} // TriP3
+
+
+// End of file
@@ -0,0 +1,49 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "tests/mmstests/poroelasticity/TestIsotropicLinearPoroelasticity.hh" // USES TestIsotropicLinearPoroelasticity_Data
+
+namespace pylith {
+    class DarcyFlow2D;
+}
+
+class pylith::DarcyFlow2D {
+public:
+
+    // Data factory methods
+
+    /** Create data for steady Darcy flow with uniform pressurization.
+     *
+     * @param[in] useBodyForce Include body force.
+     * @param[in] useGravity Include gravitational body force.
+     * @param[in] useSourceDensity Include fluid source.
+     * @param[in] useTensorPermeability Use tensor permeability instead of isotropic permeability.
+     */
+    static TestIsotropicLinearPoroelasticity_Data* TriP3(const bool useBodyForce,
+                                                         const bool useGravity,
+                                                         const bool useSourceDensity,
+                                                         const bool useTensorPermeability);
+
+private:
+
+    DarcyFlow2D(void); ///< Not implemented
+}; // DarcyFlow2D
+
+// End of file
@@ -0,0 +1,252 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** Test cases for TestIsotropicLinearPoroelasticity
+ */
+
+#include "tests/mmstests/poroelasticity/TestIsotropicLinearPoroelasticity.hh" // USES TestIsotropicLinearPoroelasticity
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+#include "DarcyFlow2D.hh"
+// TriP3, IsotropicPermeability
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, Gravity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, Gravity, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, BodyForce
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, BodyForce, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, BodyForce, Gravity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, IsotropicPermeability, BodyForce, Gravity, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, false)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, false, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, false, true, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, Gravity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, false, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, Gravity, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(false, true, true, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, BodyForce
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, false, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, BodyForce, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, false, true, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, BodyForce, Gravity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, false, true)).testJacobianFiniteDiff();
+}
+
+// TriP3, TensorPermeability, BodyForce, Gravity, SourceDensity
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testDiscretization", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testResidual", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow2D::TriP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow2D][TriP3][TensorPermeability][BodyForce][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow2D::TriP3(true, true, true, true)).testJacobianFiniteDiff();
+}
+
+// End of file
@@ -0,0 +1,252 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** Test cases for TestIsotropicLinearPoroelasticity
+ */
+
+#include "tests/mmstests/poroelasticity/TestIsotropicLinearPoroelasticity.hh" // USES TestIsotropicLinearPoroelasticity
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+#include "DarcyFlow3D.hh"
+// TetP3, IsotropicPermeability
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, Gravity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, Gravity, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, BodyForce
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, BodyForce, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, BodyForce, Gravity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, IsotropicPermeability, BodyForce, Gravity, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, false)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, false)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, false)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::IsotropicPermeability::BodyForce::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][IsotropicPermeability][BodyForce][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, false)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, false, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, false, true, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, Gravity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, false, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, Gravity, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(false, true, true, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, BodyForce
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, false, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, BodyForce, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, false, true, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, BodyForce, Gravity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, false, true)).testJacobianFiniteDiff();
+}
+
+// TetP3, TensorPermeability, BodyForce, Gravity, SourceDensity
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testDiscretization", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][SourceDensity][discretization]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, true)).testDiscretization();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testResidual", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][SourceDensity][residual]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, true)).testResidual();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testJacobianTaylorSeries", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][SourceDensity][Jacobian Taylor series]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, true)).testJacobianTaylorSeries();
+}
+TEST_CASE("DarcyFlow3D::TetP3::TensorPermeability::BodyForce::Gravity::SourceDensity::testJacobianFiniteDiff", "[DarcyFlow3D][TetP3][TensorPermeability][BodyForce][Gravity][SourceDensity][Jacobian finite difference]") {
+    pylith::TestIsotropicLinearPoroelasticity(pylith::DarcyFlow3D::TetP3(true, true, true, true)).testJacobianFiniteDiff();
+}
+
+// End of file
@@ -1,5 +1,6 @@
 from .TestDataWriter import TestDataWriter
 from .TestDataWriterVTK import TestDataWriterVTK
+from .TestDataWriterVTU import TestDataWriterVTU
 from .TestMeshIOAscii import TestMeshIOAscii
 from .TestMeshIOLagrit import TestMeshIOLagrit
 from .TestOutputObserver import TestOutputObserver
@@ -36,6 +37,7 @@ def test_classes():
     classes = [
         TestDataWriter,
         TestDataWriterVTK,
+        TestDataWriterVTU,
         TestOutputObserver,
         TestOutputPhysics,
         TestOutputSoln,
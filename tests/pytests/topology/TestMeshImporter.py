@@ -22,7 +22,7 @@
 import unittest
 
 from pylith.testing.UnitTestApp import TestComponent
-from pylith.topology.MeshImporter import (MeshImporter, mesh_generator)
+from pylith.topology.MeshImporter import (MeshImporter, mesh_generator, validateOrdering)
 
 
 class TestMeshImporter(TestComponent):
@@ -31,6 +31,14 @@ class TestMeshImporter(TestComponent):
     _class = MeshImporter
     _factory = mesh_generator
 
+    def test_validateOrdering(self):
+        self.assertEqual("rcm", validateOrdering("True"))
+        self.assertEqual("none", validateOrdering("False"))
+        self.assertEqual("hilbert", validateOrdering("Hilbert"))
+        self.assertEqual("morton", validateOrdering("morton"))
+        with self.assertRaises(ValueError):
+            validateOrdering("peano")
+
 
 if __name__ == "__main__":
     suite = unittest.TestSuite()
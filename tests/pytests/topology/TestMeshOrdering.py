@@ -0,0 +1,54 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/topology/TestMeshOrdering.py
+#
+# @brief Unit testing of Python MeshOrdering object.
+
+import unittest
+
+from pylith.topology.MeshOrdering import MeshOrdering
+
+
+class TestMeshOrdering(unittest.TestCase):
+    """Unit testing of MeshOrdering object.
+    """
+
+    def test_constructor(self):
+        ordering = MeshOrdering()
+        self.assertTrue(not ordering is None)
+
+    def test_reorder_unknown(self):
+        ordering = MeshOrdering()
+        with self.assertRaises(ValueError):
+            ordering.reorder(None, "unknown")
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestMeshOrdering))
+
+    from pylith.utils.PetscManager import PetscManager
+    petsc = PetscManager()
+    petsc.initialize()
+
+    success = unittest.TextTestRunner(verbosity=2).run(suite).wasSuccessful()
+
+    petsc.finalize()
+
+
+# End of file
@@ -3,6 +3,7 @@ from .TestField import TestField
 from .TestMesh import TestMesh
 from .TestMeshGenerator import TestMeshGenerator
 from .TestMeshImporter import TestMeshImporter
+from .TestMeshOrdering import TestMeshOrdering
 from .TestMeshRefiner import TestMeshRefiner
 from .TestRefineUniform import TestRefineUniform
 from .TestReverseCuthillMcKee import TestReverseCuthillMcKee
@@ -16,6 +17,7 @@ def test_classes():
         TestMesh,
         TestMeshGenerator,
         TestMeshImporter,
+        TestMeshOrdering,
         TestMeshRefiner,
         TestRefineUniform,
         TestReverseCuthillMcKee,
@@ -209,6 +209,101 @@ pylith::testing::MMSTest::testJacobianFiniteDiff(void) {
 } // testJacobianFiniteDiff
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test local (multirate) time stepping against single-rate time stepping.
+void
+pylith::testing::MMSTest::testLocalTimeStepping(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _problem->useLocalTimeStepping(true);
+    _initialize();
+    REQUIRE(pylith::problems::Physics::DYNAMIC == _problem->getFormulation());
+
+    assert(_solutionExactVec);
+    PetscErrorCode err = 0;
+    PetscTS ts = _problem->getPetscTS();
+    const PylithReal t = _problem->getStartTime();
+    const PylithReal dt = _problem->getInitialTimeStep();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Residuals for rate classes should match residual for all degrees of freedom.
+    PetscVec residualVec = NULL;
+    PetscVec residualRateVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solutionExactVec, &residualRateVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeRHSResidual(residualVec, t, dt, _solutionExactVec);
+
+    const pylith::problems::TimeDependent::RateClassEnum rateClasses[2] = {
+        pylith::problems::TimeDependent::RATE_SLOW,
+        pylith::problems::TimeDependent::RATE_FAST,
+    };
+    for (int iRate = 0; iRate < 2; ++iRate) {
+        PetscIS rateClassIS = _problem->_rateClassDOFIS[rateClasses[iRate]];assert(rateClassIS);
+        PetscInt rateClassSize = 0;
+        err = ISGetSize(rateClassIS, &rateClassSize);PYLITH_CHECK_ERROR(err);
+        INFO("Rate class " << iRate << " has " << rateClassSize << " degrees of freedom.");
+        REQUIRE(rateClassSize > 0);
+
+        PetscVec residualSubVec = NULL;
+        err = VecGetSubVector(residualRateVec, rateClassIS, &residualSubVec);PYLITH_CHECK_ERROR(err);
+        _problem->computeRHSResidualRateClass(residualSubVec, t, dt, _solutionExactVec, rateClasses[iRate]);
+        err = VecRestoreSubVector(residualRateVec, rateClassIS, &residualSubVec);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PylithReal residualNorm = 0.0;
+    PylithReal differenceNorm = 0.0;
+    err = VecNorm(residualVec, NORM_2, &residualNorm);PYLITH_CHECK_ERROR(err);
+    err = VecAXPY(residualRateVec, -1.0, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(residualRateVec, NORM_2, &differenceNorm);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualRateVec);PYLITH_CHECK_ERROR(err);
+    INFO("|G(s)| == " << residualNorm << ", |G_slow(s) + G_fast(s) - G(s)| == " << differenceNorm);
+    REQUIRE(differenceNorm <= 1.0e-10*residualNorm);
+
+    // Advance solution with multirate time stepping using the time step and with single-rate time
+    // stepping using the time step of the fast rate class.
+    const PetscInt numSteps = 10;
+    const PylithReal tEnd = t + numSteps*dt;
+    PetscVec solutionVec = NULL;
+    PetscVec solutionExactEndVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solutionExactVec, &solutionExactEndVec);PYLITH_CHECK_ERROR(err);
+    err = DMComputeExactSolution(_problem->getPetscDM(), tEnd, solutionExactEndVec, NULL);PYLITH_CHECK_ERROR(err);
+
+    PylithReal errorNorm[2] = { 0.0, 0.0 };
+    for (int iScheme = 0; iScheme < 2; ++iScheme) {
+        const bool useMultirate = (0 == iScheme);
+        if (useMultirate) {
+            err = TSSetType(ts, TSMPRK);PYLITH_CHECK_ERROR(err);
+            err = TSMPRKSetType(ts, TSMPRK2A22);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = TSSetType(ts, TSRK);PYLITH_CHECK_ERROR(err);
+            err = TSRKSetType(ts, TSRK2A);PYLITH_CHECK_ERROR(err);
+        } // if/else
+        const PetscInt numStepsScheme = useMultirate ? numSteps : 2*numSteps;
+        err = VecCopy(_solutionExactVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        err = TSSetStepNumber(ts, 0);PYLITH_CHECK_ERROR(err);
+        err = TSSetTime(ts, t);PYLITH_CHECK_ERROR(err);
+        err = TSSetTimeStep(ts, (tEnd - t) / numStepsScheme);PYLITH_CHECK_ERROR(err);
+        err = TSSetMaxSteps(ts, numStepsScheme);PYLITH_CHECK_ERROR(err);
+        err = TSSetMaxTime(ts, tEnd);PYLITH_CHECK_ERROR(err);
+        err = TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP);PYLITH_CHECK_ERROR(err);
+        err = TSSolve(ts, solutionVec);PYLITH_CHECK_ERROR(err);
+
+        err = VecAXPY(solutionVec, -1.0, solutionExactEndVec);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(solutionVec, NORM_2, &errorNorm[iScheme]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionExactEndVec);PYLITH_CHECK_ERROR(err);
+
+    INFO("Error with multirate time stepping: " << errorNorm[0] << ", error with single-rate time stepping: " << errorNorm[1]);
+    REQUIRE(errorNorm[0] <= 2.0*errorNorm[1]);
+
+    PYLITH_METHOD_END;
+} // testLocalTimeStepping
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize objects for test.
 void
@@ -72,6 +72,14 @@ public:
      */
     void testJacobianFiniteDiff(void);
 
+    /** Test local (multirate) time stepping against single-rate time stepping.
+     *
+     * Verify residuals for the rate classes match the residual for all degrees of freedom and
+     * the error of the solution advanced with local time stepping is comparable to the error
+     * with single-rate time stepping using the time step of the fast rate class.
+     */
+    void testLocalTimeStepping(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
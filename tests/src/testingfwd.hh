@@ -33,6 +33,8 @@ namespace pylith {
         class MMSTest;
         class FieldTester;
         class TestDriver;
+        class Benchmark;
+        class MeshIOBox;
     } // testing
 
     namespace faults {